@@ -48,6 +48,10 @@
 
 callback_table *egg_get_callback_table(void);
 
+unsigned char egg_input_initialize(char *file_name);
+long egg_input_buffer_load(void);
+void egg_input_buffer_release(void);
+
 egg_token *nul(void);
 egg_token *soh(void);
 egg_token *stx(void);
@@ -233,4 +237,189 @@ egg_token *phrase(void);
 egg_token *grammar_element(void);
 egg_token *grammar(void);
 
+long recognize_nul(void);
+long recognize_soh(void);
+long recognize_stx(void);
+long recognize_etx(void);
+long recognize_eot(void);
+long recognize_enq(void);
+long recognize_ack(void);
+long recognize_bel(void);
+long recognize_bs(void);
+long recognize_ht(void);
+long recognize_lf(void);
+long recognize_vt(void);
+long recognize_ff(void);
+long recognize_cr(void);
+long recognize_so(void);
+long recognize_si(void);
+long recognize_dle(void);
+long recognize_dc1(void);
+long recognize_dc2(void);
+long recognize_dc3(void);
+long recognize_dc4(void);
+long recognize_nak(void);
+long recognize_syn(void);
+long recognize_etb(void);
+long recognize_can(void);
+long recognize_em(void);
+long recognize_sub(void);
+long recognize_esc(void);
+long recognize_fs(void);
+long recognize_gs(void);
+long recognize_rs(void);
+long recognize_us(void);
+long recognize_space(void);
+long recognize_exclamation_point(void);
+long recognize_quote(void);
+long recognize_number_sign(void);
+long recognize_dollar(void);
+long recognize_percent(void);
+long recognize_ampersand(void);
+long recognize_single_quote(void);
+long recognize_open_parenthesis(void);
+long recognize_close_parenthesis(void);
+long recognize_asterisk(void);
+long recognize_plus(void);
+long recognize_comma(void);
+long recognize_minus(void);
+long recognize_period(void);
+long recognize_slash(void);
+long recognize_zero(void);
+long recognize_one(void);
+long recognize_two(void);
+long recognize_three(void);
+long recognize_four(void);
+long recognize_five(void);
+long recognize_six(void);
+long recognize_seven(void);
+long recognize_eight(void);
+long recognize_nine(void);
+long recognize_colon(void);
+long recognize_semicolon(void);
+long recognize_less_than(void);
+long recognize_equal(void);
+long recognize_greater_than(void);
+long recognize_question_mark(void);
+long recognize_at(void);
+long recognize_A(void);
+long recognize_B(void);
+long recognize_C(void);
+long recognize_D(void);
+long recognize_E(void);
+long recognize_F(void);
+long recognize_G(void);
+long recognize_H(void);
+long recognize_I(void);
+long recognize_J(void);
+long recognize_K(void);
+long recognize_L(void);
+long recognize_M(void);
+long recognize_N(void);
+long recognize_O(void);
+long recognize_P(void);
+long recognize_Q(void);
+long recognize_R(void);
+long recognize_S(void);
+long recognize_T(void);
+long recognize_U(void);
+long recognize_V(void);
+long recognize_W(void);
+long recognize_X(void);
+long recognize_Y(void);
+long recognize_Z(void);
+long recognize_open_bracket(void);
+long recognize_back_slash(void);
+long recognize_close_bracket(void);
+long recognize_carat(void);
+long recognize_underscore(void);
+long recognize_back_quote(void);
+long recognize_a(void);
+long recognize_b(void);
+long recognize_c(void);
+long recognize_d(void);
+long recognize_e(void);
+long recognize_f(void);
+long recognize_g(void);
+long recognize_h(void);
+long recognize_i(void);
+long recognize_j(void);
+long recognize_k(void);
+long recognize_l(void);
+long recognize_m(void);
+long recognize_n(void);
+long recognize_o(void);
+long recognize_p(void);
+long recognize_q(void);
+long recognize_r(void);
+long recognize_s(void);
+long recognize_t(void);
+long recognize_u(void);
+long recognize_v(void);
+long recognize_w(void);
+long recognize_x(void);
+long recognize_y(void);
+long recognize_z(void);
+long recognize_open_brace(void);
+long recognize_bar(void);
+long recognize_close_brace(void);
+long recognize_tilde(void);
+long recognize_del(void);
+long recognize_control_character(void);
+long recognize_upper_case_letter(void);
+long recognize_lower_case_letter(void);
+long recognize_letter(void);
+long recognize_binary_digit(void);
+long recognize_octal_digit(void);
+long recognize_decimal_digit(void);
+long recognize_hexadecimal_digit(void);
+long recognize_white_space(void);
+long recognize_common_character(void);
+long recognize_literal_character(void);
+long recognize_comment_basic_character(void);
+long recognize_non_comment_start_character(void);
+long recognize_non_comment_end_character(void);
+long recognize_non_comment_start_sequence(void);
+long recognize_non_comment_end_sequence(void);
+long recognize_comment_character(void);
+long recognize_single_quoted_character(void);
+long recognize_quoted_character(void);
+long recognize_phrase_conjugator(void);
+long recognize_phrase_name_character(void);
+long recognize_binary_indicator(void);
+long recognize_octal_indicator(void);
+long recognize_hexadecimal_indicator(void);
+long recognize_comment_start_symbol(void);
+long recognize_comment_end_symbol(void);
+long recognize_alternation_symbol(void);
+long recognize_concatenation_symbol(void);
+long recognize_phrase_terminator_symbol(void);
+long recognize_binary_integer(void);
+long recognize_octal_integer(void);
+long recognize_hexadecimal_integer(void);
+long recognize_decimal_integer(void);
+long recognize_integer(void);
+long recognize_single_quoted_literal(void);
+long recognize_quoted_literal(void);
+long recognize_absolute_literal(void);
+long recognize_literal(void);
+long recognize_comment_item(void);
+long recognize_comment(void);
+long recognize_illumination(void);
+long recognize_non_grammar_item(void);
+long recognize_non_grammar_element(void);
+long recognize_phrase_name(void);
+long recognize_quantifier_item(void);
+long recognize_quantifier_option(void);
+long recognize_quantifier(void);
+long recognize_atom(void);
+long recognize_item(void);
+long recognize_sequence_continuation(void);
+long recognize_sequence(void);
+long recognize_definition_continuation(void);
+long recognize_definition(void);
+long recognize_phrase(void);
+long recognize_grammar_element(void);
+long recognize_grammar(void);
+
 #endif // EGG_PARSER_H
@@ -0,0 +1,205 @@
+/*!
+
+  @file egg-token-tree.h
+
+  @brief Source code for egg-token-tree.h
+
+  @version 0.4.1
+
+  @author Patrick Head mailto:patrickhead@gmail.com
+
+  @copyright Copyright (C) 2013-2014 Patrick Head
+
+  @license
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.@n
+  @n
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.@n
+  @n
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see   \<http://www.gnu.org/licenses/\>.
+
+*/
+
+  /*!
+
+    @file egg-token-tree.h
+
+    This is the header file for the egg grammar compact token tree
+    module.
+
+    A compact token tree stores the same hierarchy as a egg_token tree,
+    but as parallel arrays addressed by 32 bit indices instead of linked
+    nodes addressed by pointers.  Nodes are stored in pre-order, so the
+    root is always index 0 and every subtree occupies a contiguous range
+    of indices.
+
+  */
+
+#ifndef EGG_TOKEN_TREE_H
+#define EGG_TOKEN_TREE_H
+
+#include <stdint.h>
+
+#include "egg-token.h"
+
+  /*!
+    @brief Definition of egg_token_index, the index of a node in a
+    egg_token_tree
+  */
+
+typedef uint32_t egg_token_index;
+
+  /*!
+    @brief Index value used for a missing ascendant, descendant or next node
+  */
+
+#define EGG_TOKEN_INDEX_NONE ((egg_token_index)0xFFFFFFFF)
+
+  /*!
+    @brief Version of the egg_token_tree snapshot file format
+  */
+
+#define EGG_TOKEN_TREE_SNAPSHOT_VERSION 2
+
+  /*!
+    @brief Definition of egg_token_tree
+  */
+
+typedef struct
+{
+    /*! @brief Count of nodes in tree */
+  egg_token_index count;
+    /*! @brief Type of each node */
+  egg_token_type *type;
+    /*! @brief Index of ascendant (parent) of each node */
+  egg_token_index *ascendant;
+    /*! @brief Index of first descendant (child) of each node */
+  egg_token_index *descendant;
+    /*! @brief Index of next (sibling) of each node */
+  egg_token_index *next;
+    /*! @brief Input offset of first byte matched by each node */
+  long *offset;
+    /*! @brief Count of input bytes matched by each node */
+  long *length;
+    /*! @brief First-child-by-type hash, or NULL when not indexed */
+  egg_token_index *child_index;
+    /*! @brief Count of slots in child_index */
+  egg_token_index child_index_size;
+    /*! @brief Embedded input text, or NULL when read from the input */
+  char *source;
+    /*! @brief Count of bytes in source */
+  long source_length;
+    /*! @brief Offset of the start of each line of source, or NULL */
+  long *line_start;
+    /*! @brief Count of entries in line_start */
+  long line_count;
+    /*! @brief Snapshot mapping holding the arrays, or NULL */
+  void *mapping;
+    /*! @brief Count of bytes in mapping */
+  long mapping_size;
+} egg_token_tree;
+
+  /*!
+    @brief Definition of egg_token_tree_snapshot_header
+
+    A snapshot file starts with this header.  It is followed by the type,
+    ascendant, descendant, next, offset and length arrays of the tree, in
+    that order and each starting on an 8 byte boundary, and then by the
+    input text when it is embedded.  The arrays keep the byte order and
+    sizes of the writing host, which the header records, so a snapshot
+    from an incompatible host is refused.  The length and hash of the
+    input let a loaded tree be checked against the input source.
+  */
+
+typedef struct
+{
+    /*! @brief File signature, "EMBTREE" */
+  char magic[8];
+    /*! @brief Name of the parser that produced the tree */
+  char parser[24];
+    /*! @brief Snapshot format version */
+  uint32_t version;
+    /*! @brief 0x01020304 in writing host byte order */
+  uint32_t byte_order;
+    /*! @brief Size of egg_token_type on the writing host */
+  uint32_t type_size;
+    /*! @brief Size of long on the writing host */
+  uint32_t long_size;
+    /*! @brief Count of nodes in tree */
+  uint32_t count;
+    /*! @brief Non-zero when the input text is embedded */
+  uint32_t has_source;
+    /*! @brief Count of bytes of embedded input text */
+  uint64_t source_length;
+    /*! @brief Count of bytes of the input the tree was parsed from */
+  uint64_t input_length;
+    /*! @brief FNV-1a hash of the input the tree was parsed from */
+  uint64_t input_hash;
+} egg_token_tree_snapshot_header;
+
+egg_token_tree *egg_token_tree_new(egg_token *t);
+
+void egg_token_tree_free(egg_token_tree *tree);
+
+egg_token_index egg_token_tree_get_count(egg_token_tree *tree);
+
+egg_token_type egg_token_tree_get_type(egg_token_tree *tree,
+  egg_token_index i);
+
+egg_token_index egg_token_tree_get_ascendant(egg_token_tree *tree,
+  egg_token_index i);
+
+egg_token_index egg_token_tree_get_descendant(egg_token_tree *tree,
+  egg_token_index i);
+
+egg_token_index egg_token_tree_get_next(egg_token_tree *tree,
+  egg_token_index i);
+
+long egg_token_tree_get_offset(egg_token_tree *tree, egg_token_index i);
+
+long egg_token_tree_get_length(egg_token_tree *tree, egg_token_index i);
+
+egg_token_index egg_token_tree_find(egg_token_tree *tree,
+  egg_token_index i,
+  egg_token_type type);
+
+int egg_token_tree_index_children(egg_token_tree *tree);
+
+egg_token_index egg_token_tree_find_child(egg_token_tree *tree,
+  egg_token_index i,
+  egg_token_type type);
+
+egg_token_tree *egg_token_tree_load(char *file_name);
+
+int egg_token_tree_save(egg_token_tree *tree,
+  char *file_name,
+  int with_source);
+
+int egg_token_tree_match_input(egg_token_tree *tree);
+
+char *egg_token_tree_get_source(egg_token_tree *tree, long *length);
+
+void egg_token_tree_get_location(egg_token_tree *tree,
+  egg_token_index i,
+  input_location *location);
+
+char *egg_token_tree_span_to_string(egg_token_tree *tree,
+  egg_token_index i,
+  char *s);
+
+char *egg_token_tree_to_string(egg_token_tree *tree,
+  egg_token_index i,
+  char *s);
+long egg_token_tree_to_buffer(egg_token_tree *tree,
+  egg_token_index i,
+  char *buffer,
+  long size);
+
+#endif // EGG_TOKEN_TREE_H
+
@@ -417,5 +417,8 @@ typedef enum
   egg_token_type_grammar,
 } egg_token_type;
 
+  /*! @brief Count of token types, for range checks */
+#define EGG_TOKEN_TYPE_COUNT (egg_token_type_grammar + 1)
+
 #endif // EGG_TOKEN_TYPE_H
 
@@ -72,10 +72,59 @@ typedef struct egg_token
   struct egg_token *previous;
     /*! @brief Pointer to next (sibling) token */
   struct egg_token *next;
-    /*! @brief Line + offset location of token in input source */
-  input_location location;
+    /*! @brief Input offset of first byte matched by token */
+  long offset;
+    /*! @brief Count of input bytes matched by token */
+  long length;
 } egg_token;
 
+  /*!
+    @brief Definition of egg_token_mark, a saved allocation point in the
+    egg_token arena
+  */
+
+typedef struct
+{
+    /*! @brief Arena block in use when mark was taken */
+  void *block;
+    /*! @brief Count of tokens used in block when mark was taken */
+  long used;
+    /*! @brief Count of tokens in arena when mark was taken, so that
+        the later of two marks has the larger index */
+  long index;
+} egg_token_mark;
+
+  /*!
+    @brief Definition of traversal orders for egg_token_iterator.
+  */
+
+typedef enum
+{
+    /*! @brief Visit token before its descendants */
+  egg_token_pre_order,
+    /*! @brief Visit token after its descendants */
+  egg_token_post_order,
+    /*! @brief Visit only the descendants (children) of token */
+  egg_token_children
+} egg_token_order;
+
+  /*!
+    @brief Definition of egg_token_iterator, the state of a walk over a
+    egg_token tree
+  */
+
+typedef struct
+{
+    /*! @brief Order in which tokens are visited */
+  egg_token_order order;
+    /*! @brief Token the walk starts from, NULL once started */
+  egg_token *first;
+    /*! @brief Token most recently visited */
+  egg_token *current;
+    /*! @brief Depth of current token below first token */
+  int depth;
+} egg_token_iterator;
+
 egg_token *egg_token_new(egg_token_type type);
 
 void egg_token_free(egg_token *t);
@@ -103,9 +152,34 @@ void egg_token_set_previous(egg_token *t, egg_token *p);
 egg_token *egg_token_get_next(egg_token *t);
 void egg_token_set_next(egg_token *t, egg_token *n);
 
+long egg_token_get_offset(egg_token *t);
+void egg_token_set_offset(egg_token *t, long offset);
+
+long egg_token_get_length(egg_token *t);
+void egg_token_set_length(egg_token *t, long length);
+
+void egg_token_get_location(egg_token *t, input_location *location);
+
 egg_token *egg_token_find(egg_token *t, egg_token_type type);
+egg_token *egg_token_find_child(egg_token *t, egg_token_type type);
+egg_token *egg_token_find_within(egg_token *t,
+  egg_token_type type,
+  int depth);
 
 char *egg_token_to_string(egg_token *t, char *s);
+char *egg_token_span_to_string(egg_token *t, char *s);
+long egg_token_to_buffer(egg_token *t, char *buffer, long size);
+
+void egg_token_iterator_init(egg_token_iterator *it,
+  egg_token *t,
+  egg_token_order order);
+egg_token *egg_token_iterator_next(egg_token_iterator *it);
+int egg_token_iterator_get_depth(egg_token_iterator *it);
+
+egg_token_mark egg_token_arena_mark(void);
+void egg_token_arena_rewind(egg_token_mark mark);
+void egg_token_arena_release(void);
+void egg_token_line_index_release(void);
 
 #endif // EGG_TOKEN_H
 
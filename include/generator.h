@@ -62,6 +62,10 @@ void generate_token_util_source(FILE *of, char *parser_name, egg_token *t);
 
 void generate_token_util_header(FILE *of, char *parser_name);
 
+void generate_token_tree_header(FILE *of, char *parser_name);
+
+void generate_token_tree_source(FILE *of, char *parser_name);
+
 void generate_walker_source(FILE *of, char *parser_name, egg_token *t);
 
 void generate_makefile(FILE *of, char *parser_name);
@@ -95,4 +99,49 @@ void generator_set_license(char *license);
 unsigned char generator_get_external_usage_flag(void);
 void generator_set_external_usage_flag(unsigned char flag);
 
+unsigned char generator_get_memo_flag(void);
+void generator_set_memo_flag(unsigned char flag);
+
+char * generator_get_memo_phrases(void);
+void generator_set_memo_phrases(char *phrases);
+
+unsigned char generator_get_run_tokens_flag(void);
+void generator_set_run_tokens_flag(unsigned char flag);
+
+unsigned char generator_get_callbacks_flag(void);
+void generator_set_callbacks_flag(unsigned char flag);
+
+unsigned char generator_get_context_flag(void);
+void generator_set_context_flag(unsigned char flag);
+
+unsigned char generator_get_parallel_flag(void);
+void generator_set_parallel_flag(unsigned char flag);
+
+unsigned char generator_get_stream_flag(void);
+void generator_set_stream_flag(unsigned char flag);
+
+unsigned char generator_get_push_flag(void);
+void generator_set_push_flag(unsigned char flag);
+
+long generator_get_push_stack_size(void);
+void generator_set_push_stack_size(long size);
+
+unsigned char generator_get_vm_flag(void);
+void generator_set_vm_flag(unsigned char flag);
+
+unsigned char generator_get_inline_flag(void);
+void generator_set_inline_flag(unsigned char flag);
+
+unsigned char generator_get_recognizer_flag(void);
+void generator_set_recognizer_flag(unsigned char flag);
+
+unsigned char generator_get_events_flag(void);
+void generator_set_events_flag(unsigned char flag);
+
+char * generator_get_trivia_phrases(void);
+void generator_set_trivia_phrases(char *phrases);
+
+unsigned char generator_get_trivia_drop_flag(void);
+void generator_set_trivia_drop_flag(unsigned char flag);
+
 #endif // GENERATOR_H
@@ -41,6 +41,7 @@
 #include "config.h"
 #include "egg-token.h"
 #include "egg-token-util.h"
+#include "egg-token-tree.h"
 #include "egg-parser.h"
 #include "map.h"
 
@@ -49,11 +50,11 @@
 static void usage(void);
 static void version(void);
 static void map(FILE *of, egg_token *t);
-static void map_phrases(FILE *of, egg_token *t);
+static void map_phrases(FILE *of, egg_token_tree *tree);
 static void map_phrase_usage(FILE *of, egg_token *t);
 static void map_top_level_phrases(FILE *of, egg_token *t);
-static void emit_item(FILE *of, egg_token *item);
-static long convert_integer(egg_token *integer);
+static void emit_item(FILE *of, egg_token_tree *tree, egg_token_index item);
+static long convert_integer(egg_token_tree *tree, egg_token_index integer);
 
   /*!
 
@@ -115,17 +116,21 @@ int main(int argc, char **argv)
     if (strcmp(argv[optind], "-"))
       input_file = strdup(argv[optind]);
 
-  if (!input_initialize(input_file))
+  if (!egg_input_initialize(input_file))
     return 1;
 
+  egg_input_buffer_load();
+
   t = grammar();
   if (!t)
     fprintf(stderr, "Failed to parse grammar.\n");
 
-  input_cleanup();
-
   if (!t)
+  {
+    egg_input_buffer_release();
+    input_cleanup();
     return 1;
+  }
 
   if (output_file)
   {
@@ -133,6 +138,8 @@ int main(int argc, char **argv)
     if (!of)
     {
       fprintf(stderr, "Failed to open '%s'\n", output_file);
+      egg_input_buffer_release();
+      input_cleanup();
       return 1;
     }
   }
@@ -141,6 +148,13 @@ int main(int argc, char **argv)
 
   map(of, t);
 
+    // Token text is read from the input source, so it must outlive map()
+
+  egg_input_buffer_release();
+  input_cleanup();
+
+  egg_token_arena_release();
+
   if (output_file)
   {
     if (of)
@@ -199,6 +213,8 @@ static void version(void)
 
 static void map(FILE *of, egg_token *t)
 {
+  egg_token_tree *tree;
+
     // Sanity check parameters
 
   if (!of)
@@ -216,7 +232,15 @@ static void map(FILE *of, egg_token *t)
 
   fprintf(of, "<egg-map>\n");
 
-  map_phrases(of, t);
+    // The phrase map is a straight top-down scan, so it runs over the
+    // compact token tree rather than chasing egg_token pointers
+
+  tree = egg_token_tree_new(t);
+  egg_token_tree_index_children(tree);
+
+  map_phrases(of, tree);
+
+  egg_token_tree_free(tree);
 
   map_phrase_usage(of, t);
 
@@ -231,28 +255,28 @@ static void map(FILE *of, egg_token *t)
 
   /*!
 
-     @brief Map the phrases in an egg_token tree.
+     @brief Map the phrases in an egg_token_tree.
 
-     This function maps an egg_token tree, and emits phrase map data.
+     This function maps an egg_token_tree, and emits phrase map data.
      The data is a XML representation of containing a map of each phrase
      in an EGG grammar, including literals.  Basically, this is the nearly
      complete XML representation of an EGG grammar definition file.
 
-     @param of point to open file for output
-     @param t  egg_token * to root of egg_token tree
+     @param of   point to open file for output
+     @param tree egg_token_tree * of parsed EGG grammar
 
   */
 
-static void map_phrases(FILE *of, egg_token *t)
+static void map_phrases(FILE *of, egg_token_tree *tree)
 {
-  egg_token *ge;
-  egg_token *ph;
-  egg_token *phn;
-  egg_token *def;
-  egg_token *seq;
-  egg_token *it;
-  egg_token *defcon;
-  egg_token *seqcon;
+  egg_token_index ge;
+  egg_token_index ph;
+  egg_token_index phn;
+  egg_token_index def;
+  egg_token_index seq;
+  egg_token_index it;
+  egg_token_index defcon;
+  egg_token_index seqcon;
   char *sphn = NULL;
   char *s;
 
@@ -261,7 +285,7 @@ static void map_phrases(FILE *of, egg_token *t)
   if (!of)
     return;
 
-  if (!t)
+  if (!tree)
     return;
 
     // Emit XML node for the phrase map
@@ -273,51 +297,52 @@ static void map_phrases(FILE *of, egg_token *t)
 
     // Get first grammar-element
 
-  ge = egg_token_find(t, egg_token_type_grammar_element);
-  while (ge)
+  ge = egg_token_tree_find_child(tree, 0, egg_token_type_grammar_element);
+  while (ge != EGG_TOKEN_INDEX_NONE)
   {
       // Get it's phrase
 
-    ph = egg_token_find(ge->descendant, egg_token_type_phrase);
-    if (ph)
+    ph = egg_token_tree_find_child(tree, ge, egg_token_type_phrase);
+    if (ph != EGG_TOKEN_INDEX_NONE)
     {
 
         // Get the phrase's name
 
-      phn = egg_token_find(ph->descendant, egg_token_type_phrase_name);
-      if (phn)
-				sphn = egg_token_to_string(phn->descendant, NULL);
+      phn = egg_token_tree_find_child(tree, ph, egg_token_type_phrase_name);
+      if (phn != EGG_TOKEN_INDEX_NONE)
+				sphn = egg_token_tree_to_string(tree,
+                  egg_token_tree_get_descendant(tree, phn), NULL);
 
         // Get the phrase's definition
 
-      def = egg_token_find(ph->descendant, egg_token_type_definition);
-      if (def)
+      def = egg_token_tree_find_child(tree, ph, egg_token_type_definition);
+      if (def != EGG_TOKEN_INDEX_NONE)
       {
           // Get the first sequence in the definition
 
-				seq = egg_token_find(def->descendant, egg_token_type_sequence);
-        if (seq)
+				seq = egg_token_tree_find_child(tree, def, egg_token_type_sequence);
+        if (seq != EGG_TOKEN_INDEX_NONE)
         {
             // Emit the XML for the phrase
 
           fprintf(of, "    <phrase>\n");
           fprintf(of, "      <name>%s</name>\n", sphn);
           fprintf(of, "      <sequence>\n");
-          it = egg_token_find(seq->descendant, egg_token_type_item);
+          it = egg_token_tree_find_child(tree, seq, egg_token_type_item);
 
-					emit_item(of, it);
+					emit_item(of, tree, it);
 
             // Get any subsequent items in this sequence
 
-          seqcon = egg_token_find(def->descendant,
-                                  egg_token_type_sequence_continuation);
-          while (seqcon)
+          seqcon = egg_token_tree_find_child(tree, seq,
+                                          egg_token_type_sequence_continuation);
+          while (seqcon != EGG_TOKEN_INDEX_NONE)
           {
-						it = egg_token_find(seqcon->descendant, egg_token_type_item);
+						it = egg_token_tree_find_child(tree, seqcon, egg_token_type_item);
 
-						emit_item(of, it);
+						emit_item(of, tree, it);
 
-            seqcon = seqcon->next;
+            seqcon = egg_token_tree_get_next(tree, seqcon);
           }
 
             // Emit the closure for this sequence
@@ -326,40 +351,42 @@ static void map_phrases(FILE *of, egg_token *t)
 
             // Look for subsequent sequences in definition
 
-          defcon = egg_token_find(def->descendant,
-                                  egg_token_type_definition_continuation);
-          while (defcon)
+          defcon = egg_token_tree_find_child(tree, def,
+                                        egg_token_type_definition_continuation);
+          while (defcon != EGG_TOKEN_INDEX_NONE)
           {
               // Grab the sequence
 
-						seq = egg_token_find(defcon->descendant, egg_token_type_sequence);
-						if (seq)
+						seq = egg_token_tree_find_child(tree, defcon,
+                                            egg_token_type_sequence);
+						if (seq != EGG_TOKEN_INDEX_NONE)
 						{
                 // Emit the XML for this sequence
 
 							fprintf(of, "      <sequence>\n");
-							it = egg_token_find(seq->descendant, egg_token_type_item);
+							it = egg_token_tree_find_child(tree, seq, egg_token_type_item);
 
-							emit_item(of, it);
+							emit_item(of, tree, it);
 
                 // Get any subsequent items in this sequence
 
-							seqcon = egg_token_find(def->descendant,
-                                      egg_token_type_sequence_continuation);
-							while (seqcon)
+							seqcon = egg_token_tree_find_child(tree, seq,
+                                          egg_token_type_sequence_continuation);
+							while (seqcon != EGG_TOKEN_INDEX_NONE)
 							{
-								it = egg_token_find(seqcon->descendant, egg_token_type_item);
+								it = egg_token_tree_find_child(tree, seqcon,
+                                               egg_token_type_item);
 
-                emit_item(of, it);
+                emit_item(of, tree, it);
 
-								seqcon = seqcon->next;
+								seqcon = egg_token_tree_get_next(tree, seqcon);
 							}
 
                 // Emit the closure for this sequence
 
 							fprintf(of, "      </sequence>\n");
 						}
-            defcon = defcon->next;
+            defcon = egg_token_tree_get_next(tree, defcon);
           }
 
             // Emit the closure for the entire phrase
@@ -374,7 +401,7 @@ static void map_phrases(FILE *of, egg_token *t)
       sphn = NULL;
     }
 
-		ge = ge->next;
+		ge = egg_token_tree_get_next(tree, ge);
   }
 
     // Emit the closure for the completed phrase-map
@@ -391,25 +418,26 @@ static void map_phrases(FILE *of, egg_token *t)
      This function outputs the XML fragments that describe an EGG item
      token type.
 
-     @param of point to open file for output
-     @param t  egg_token * to root of egg_token tree
+     @param of   point to open file for output
+     @param tree egg_token_tree * containing item token
+     @param item egg_token_index of item token
 
   */
 
-static void emit_item(FILE *of, egg_token *item)
+static void emit_item(FILE *of, egg_token_tree *tree, egg_token_index item)
 {
   char *s;
-  egg_token *atom;
-  egg_token *phrase_name;
-  egg_token *literal;
-  egg_token *absolute;
-  egg_token *integer;
-  egg_token *quoted;
-  egg_token *string;
-  egg_token *qty;
-  egg_token *qty_option;
-  egg_token *qty_item;
-  egg_token *asterisk;
+  egg_token_index atom;
+  egg_token_index phrase_name;
+  egg_token_index literal;
+  egg_token_index absolute;
+  egg_token_index integer;
+  egg_token_index quoted;
+  egg_token_index string;
+  egg_token_index qty;
+  egg_token_index qty_option;
+  egg_token_index qty_item;
+  egg_token_index asterisk;
   long i;
 
     // Sanity check parameters
@@ -417,10 +445,13 @@ static void emit_item(FILE *of, egg_token *item)
   if (!of)
     return;
 
-  if (!item)
+  if (!tree)
     return;
 
-  if (item->type != egg_token_type_item)
+  if (item == EGG_TOKEN_INDEX_NONE)
+    return;
+
+  if (egg_token_tree_get_type(tree, item) != egg_token_type_item)
     return;
 
     // Emit XML for this item
@@ -430,17 +461,19 @@ static void emit_item(FILE *of, egg_token *item)
 
     // Look for the atom in this item
 
-  if (atom = egg_token_find(item->descendant,
-                            egg_token_type_atom))
+  if ((atom = egg_token_tree_find_child(tree, item, egg_token_type_atom))
+      != EGG_TOKEN_INDEX_NONE)
   {
       // If this atom is a phrase-name, then emit the XML for it
 
-    if (phrase_name = egg_token_find(atom->descendant,
-                                     egg_token_type_phrase_name))
+    if ((phrase_name = egg_token_tree_find_child(tree, atom,
+                                                 egg_token_type_phrase_name))
+        != EGG_TOKEN_INDEX_NONE)
     {
 			fprintf(of, "%10.10s", " ");
 			fprintf(of, "<phrase-name>");
-			fprintf(of, "%s", s = egg_token_to_string(phrase_name->descendant, NULL));
+			fprintf(of, "%s", s = egg_token_tree_to_string(tree,
+                  egg_token_tree_get_descendant(tree, phrase_name), NULL));
 			free(s);
 			fprintf(of, "</phrase-name>");
 			fprintf(of, "\n");
@@ -448,37 +481,42 @@ static void emit_item(FILE *of, egg_token *item)
 
       // If the atom is a literal, then process the literal
 
-		else if (literal = egg_token_find(item->descendant,
-                                      egg_token_type_literal))
+		else if ((literal = egg_token_tree_find_child(tree, atom,
+                                                  egg_token_type_literal))
+		    != EGG_TOKEN_INDEX_NONE)
 		{
         // If this is an absolute (integer) literal emit the XML for it
 
-			if (absolute = egg_token_find(literal->descendant,
-                                    egg_token_type_absolute_literal))
+			if ((absolute = egg_token_tree_find_child(tree, literal,
+                                               egg_token_type_absolute_literal))
+			    != EGG_TOKEN_INDEX_NONE)
 			{
-				if (integer = egg_token_find(absolute->descendant,
-                                     egg_token_type_integer))
+				if ((integer = egg_token_tree_find_child(tree, absolute,
+                                                 egg_token_type_integer))
+				    != EGG_TOKEN_INDEX_NONE)
 				{
 					fprintf(of, "%10.10s", " ");
 					fprintf(of, "<literal type=\"absolute\">");
-					fprintf(of, "%ld", convert_integer(integer));
+					fprintf(of, "%ld", convert_integer(tree, integer));
 					fprintf(of, "</literal>");
 					fprintf(of, "\n");
 				}
 			}
         // If this is a string literal, then process that
 
-			else if (quoted = egg_token_find(literal->descendant,
-                                       egg_token_type_quoted_literal))
+			else if ((quoted = egg_token_tree_find_child(tree, literal,
+                                                 egg_token_type_quoted_literal))
+			    != EGG_TOKEN_INDEX_NONE)
 			{
           // Emit XML for quoted string
 
-				if (string = egg_token_find(quoted->descendant,
-                                    egg_token_type_quoted_character))
+				if ((string = egg_token_tree_find_child(tree, quoted,
+                                               egg_token_type_quoted_character))
+				    != EGG_TOKEN_INDEX_NONE)
 				{
 					fprintf(of, "%10.10s", " ");
 					fprintf(of, "<literal type=\"string\">");
-					s = egg_token_to_string(string, NULL);
+					s = egg_token_tree_to_string(tree, string, NULL);
           if (strrchr(s, '"'))
             *(strrchr(s, '"')) = 0;
 					fprintf(of, "%s", s);
@@ -489,15 +527,17 @@ static void emit_item(FILE *of, egg_token *item)
 			}
          // Emit XML for single quoted string
 
-			else if (quoted = egg_token_find(literal->descendant,
-                                       egg_token_type_single_quoted_literal))
+			else if ((quoted = egg_token_tree_find_child(tree, literal,
+                                          egg_token_type_single_quoted_literal))
+			    != EGG_TOKEN_INDEX_NONE)
 			{
-				if (string = egg_token_find(quoted->descendant,
-                                    egg_token_type_single_quoted_character))
+				if ((string = egg_token_tree_find_child(tree, quoted,
+                                        egg_token_type_single_quoted_character))
+				    != EGG_TOKEN_INDEX_NONE)
 				{
 					fprintf(of, "%10.10s", " ");
 					fprintf(of, "<literal type=\"string\">");
-					s = egg_token_to_string(string, NULL);
+					s = egg_token_tree_to_string(tree, string, NULL);
           if (strrchr(s, '\''))
             *(strrchr(s, '\'')) = 0;
 					fprintf(of, "%s", s);
@@ -511,26 +551,28 @@ static void emit_item(FILE *of, egg_token *item)
 
     // Process any quantifier that may exist for this item
 
-  if (qty = egg_token_find(item->descendant,
-                           egg_token_type_quantifier))
+  if ((qty = egg_token_tree_find_child(tree, item, egg_token_type_quantifier))
+      != EGG_TOKEN_INDEX_NONE)
   {
-    if (integer = egg_token_find(qty->descendant,
-                                 egg_token_type_integer))
+    if ((integer = egg_token_tree_find_child(tree, qty, egg_token_type_integer))
+        != EGG_TOKEN_INDEX_NONE)
     {
 			fprintf(of, "%10.10s", " ");
 			fprintf(of, "<quantity>\n");
 
         // We always have a minimum for any quantifier
 
-      i = convert_integer(integer);
+      i = convert_integer(tree, integer);
 			fprintf(of, "%12.12s", " ");
 			fprintf(of, "<minimum>%ld</minimum>\n", i);
 
-      if (qty_option = egg_token_find(qty->descendant,
-                                      egg_token_type_quantifier_option))
+      if ((qty_option = egg_token_tree_find_child(tree, qty,
+                                              egg_token_type_quantifier_option))
+          != EGG_TOKEN_INDEX_NONE)
       {
-        if (qty_item = egg_token_find(qty_option->descendant,
-                                      egg_token_type_quantifier_item))
+        if ((qty_item = egg_token_tree_find_child(tree, qty_option,
+                                                egg_token_type_quantifier_item))
+            != EGG_TOKEN_INDEX_NONE)
         {
             // We may have an optional maximum
 
@@ -539,16 +581,18 @@ static void emit_item(FILE *of, egg_token *item)
 
             // Absolute (integer) maximum
 
-          if (integer = egg_token_find(qty_item->descendant,
-                                       egg_token_type_integer))
+          if ((integer = egg_token_tree_find_child(tree, qty_item,
+                                                   egg_token_type_integer))
+              != EGG_TOKEN_INDEX_NONE)
           {
-            fprintf(of, "%ld", convert_integer(integer));
+            fprintf(of, "%ld", convert_integer(tree, integer));
           }
 
             // Infinite maximum
 
-          else if (asterisk = egg_token_find(qty_item->descendant,
-                                             egg_token_type_asterisk))
+          else if ((asterisk = egg_token_tree_find_child(tree, qty_item,
+                                                       egg_token_type_asterisk))
+              != EGG_TOKEN_INDEX_NONE)
           {
             fprintf(of, "unlimited");
           }
@@ -578,27 +622,33 @@ static void emit_item(FILE *of, egg_token *item)
 
      @brief Converts an EGG integer token type token into an actual integer.
 
-     @param t  egg_token * to integer token
+     @param tree    egg_token_tree * containing integer token
+     @param integer egg_token_index of integer token
 
      @retval long integer representation of integer token
+     @retval 0 tree or integer is not a valid integer token
   */
 
-static long convert_integer(egg_token *integer)
+static long convert_integer(egg_token_tree *tree, egg_token_index integer)
 {
   char *s;
   long i;
 
     // Sanity check parameters
 
-  if (!integer)
-    return;
+  if (!tree)
+    return 0;
 
-  if (integer->type != egg_token_type_integer)
-    return;
+  if (integer == EGG_TOKEN_INDEX_NONE)
+    return 0;
+
+  if (egg_token_tree_get_type(tree, integer) != egg_token_type_integer)
+    return 0;
 
     // Grab integer defining string from the integer token
 
-	s = egg_token_to_string(integer->descendant, NULL);
+	s = egg_token_tree_to_string(tree,
+                egg_token_tree_get_descendant(tree, integer), NULL);
 
     // If this is NOT a decimal definition, then process that
 
@@ -803,4 +853,3 @@ static void map_top_level_phrases(FILE *of, egg_token *t)
 
   return;
 }
-
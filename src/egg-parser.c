@@ -60,6 +60,12 @@
   */
 
 #include <stdlib.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 #include "egg-token.h"
 #include "egg-parser.h"
@@ -257,6 +263,9 @@ static callback_entry _callbacks[] =
 
 static callback_table _cbt = { 184, _callbacks };
 
+static unsigned char *_input_buffer = NULL;
+static long _input_length = 0;
+
   /*!
 
     @brief Returns pointer to callback table.
@@ -274,6 +283,207 @@ callback_table *egg_get_callback_table(void)
   return &_cbt;
 }
 
+  /*!
+
+    @brief Initialize the input source for parsing
+
+    This calls input_initialize(), after discarding everything the parser
+    and the token module derived from the previous input source.  Use it
+    instead of input_initialize() whenever more than one input is parsed.
+    An input buffer that was loaded is loaded again from the new input
+    source.
+
+    @param file_name char * name of input file, NULL for standard input
+
+    @retval TRUE  success
+    @retval FALSE failure
+
+  */
+
+unsigned char egg_input_initialize(char *file_name)
+{
+  unsigned char reload = (_input_buffer != NULL);
+
+  egg_token_line_index_release();
+  egg_input_buffer_release();
+
+  if (!input_initialize(file_name))
+    return FALSE;
+
+  if (reload)
+    egg_input_buffer_load();
+
+  return TRUE;
+}
+
+  /*!
+
+    @brief Copy the whole input source into a contiguous buffer
+
+    With the input in one buffer, the parser can match runs of bytes and
+    literals against it directly instead of reading one byte at a time.
+    The input position is not changed.
+
+    @warning The buffer holds the input source it was loaded from.  Change
+             input sources with egg_input_initialize(), which loads
+             it again, rather than input_initialize().
+
+    @retval long count of bytes in buffer
+    @retval -1 on failure, in which case the parser reads the input source
+
+  */
+
+long egg_input_buffer_load(void)
+{
+  long pos = input_get_position();
+  unsigned char *b;
+  long size = 4096;
+
+  egg_input_buffer_release();
+
+  if (!(_input_buffer = malloc(size)))
+    return -1;
+
+  input_set_position(0);
+  while (!input_eof())
+  {
+    if (_input_length == size)
+    {
+      if (!(b = realloc(_input_buffer, size * 2)))
+      {
+        egg_input_buffer_release();
+        input_set_position(pos);
+        return -1;
+      }
+      _input_buffer = b;
+      size *= 2;
+    }
+    _input_buffer[_input_length++] = input_byte();
+  }
+  input_set_position(pos);
+
+  return _input_length;
+}
+
+  /*!
+
+    @brief Release the input buffer
+
+    The parser reads the input source one byte at a time again after this
+    call.
+
+  */
+
+void egg_input_buffer_release(void)
+{
+  free(_input_buffer);
+  _input_buffer = NULL;
+  _input_length = 0;
+
+  return;
+}
+
+  /*!
+
+    @brief Match a run of bytes from a byte class
+
+    The run starts at the current input position, and the input position
+    is moved past it.  When the input buffer is loaded, the run is scanned
+    in the buffer 32 or 16 bytes at a time where AVX2 or SSE2 is
+    available, and the class is given as byte ranges.
+
+    @param bits   string of 32 bytes holding a bitmap of the class
+    @param ranges count of byte ranges in class, or 0 if there are more
+                  than 4
+    @param lohi   string holding the first and last byte of each range
+    @param max    maximum length of run, or -1 for no maximum
+
+    @retval long length of run
+
+  */
+
+static long scan_run(const char *bits, int ranges, const char *lohi, long max)
+{
+  const unsigned char *map = (const unsigned char *)bits;
+  long pos = input_get_position();
+  long end, i;
+  unsigned char c;
+  int r;
+#ifdef __AVX2__
+  __m256i lo32[4], span32[4], x32, m32;
+#endif
+#ifdef __SSE2__
+  __m128i lo16[4], span16[4], x16, m16;
+#endif
+
+  if (!_input_buffer)
+  {
+    for (i = 0; ((max < 0) || (i < max)) && !input_eof(); ++i)
+    {
+      c = input_byte();
+      if (!(map[c >> 3] & (1 << (c & 7))))
+        break;
+    }
+    input_set_position(pos + i);
+    return i;
+  }
+
+  end = _input_length;
+  if ((max >= 0) && (max < end - pos))
+    end = pos + max;
+
+  i = pos;
+
+#ifdef __AVX2__
+  for (r = 0; r < ranges; ++r)
+  {
+    lo32[r] = _mm256_set1_epi8(lohi[r * 2]);
+    span32[r] = _mm256_set1_epi8((char)(lohi[r * 2 + 1] - lohi[r * 2]));
+  }
+  while (ranges && (end - i >= 32))
+  {
+    x32 = _mm256_loadu_si256((const __m256i *)(_input_buffer + i));
+    m32 = _mm256_setzero_si256();
+    for (r = 0; r < ranges; ++r)
+      m32 = _mm256_or_si256(m32,
+              _mm256_cmpeq_epi8(
+                _mm256_subs_epu8(_mm256_sub_epi8(x32, lo32[r]), span32[r]),
+                _mm256_setzero_si256()));
+    if (_mm256_movemask_epi8(m32) != -1)
+      break;
+    i += 32;
+  }
+#endif
+#ifdef __SSE2__
+  for (r = 0; r < ranges; ++r)
+  {
+    lo16[r] = _mm_set1_epi8(lohi[r * 2]);
+    span16[r] = _mm_set1_epi8((char)(lohi[r * 2 + 1] - lohi[r * 2]));
+  }
+  while (ranges && (end - i >= 16))
+  {
+    x16 = _mm_loadu_si128((const __m128i *)(_input_buffer + i));
+    m16 = _mm_setzero_si128();
+    for (r = 0; r < ranges; ++r)
+      m16 = _mm_or_si128(m16,
+              _mm_cmpeq_epi8(
+                _mm_subs_epu8(_mm_sub_epi8(x16, lo16[r]), span16[r]),
+                _mm_setzero_si128()));
+    if (_mm_movemask_epi8(m16) != 0xFFFF)
+      break;
+    i += 16;
+  }
+#endif
+
+  while ((i < end) &&
+         (map[_input_buffer[i] >> 3] & (1 << (_input_buffer[i] & 7))))
+    ++i;
+
+  input_set_position(i);
+
+  return i - pos;
+}
+
   /*!
 
     @par "EGG Phrase Definition"
@@ -289,53 +499,45 @@ callback_table *egg_get_callback_table(void)
 egg_token *nul(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    0,
-                    entry,
-                    (void *)egg_token_type_nul);
+  if (_callbacks[0].entry)
+    callback_by_index(&_cbt,
+                      0,
+                      entry,
+                      (void *)egg_token_type_nul);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x00)
+  {
+    nt = egg_token_new(egg_token_type_nul);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[0].success)
+        callback_by_index(&_cbt,
+                          0,
+                          success,
+                          (void *)egg_token_type_nul);
 
-  nt = egg_token_new(egg_token_type_nul);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      0,
-                      fail,
-                      (void *)egg_token_type_nul);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x00)
-  {
+  if (_callbacks[0].fail)
     callback_by_index(&_cbt,
                       0,
-                      success,
+                      fail,
                       (void *)egg_token_type_nul);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    0,
-                    fail,
-                    (void *)egg_token_type_nul);
-
   return NULL;
 }
 
@@ -354,53 +556,45 @@ egg_token *nul(void)
 egg_token *soh(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    1,
-                    entry,
-                    (void *)egg_token_type_soh);
+  if (_callbacks[1].entry)
+    callback_by_index(&_cbt,
+                      1,
+                      entry,
+                      (void *)egg_token_type_soh);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x01)
+  {
+    nt = egg_token_new(egg_token_type_soh);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[1].success)
+        callback_by_index(&_cbt,
+                          1,
+                          success,
+                          (void *)egg_token_type_soh);
 
-  nt = egg_token_new(egg_token_type_soh);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      1,
-                      fail,
-                      (void *)egg_token_type_soh);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x01)
-  {
+  if (_callbacks[1].fail)
     callback_by_index(&_cbt,
                       1,
-                      success,
+                      fail,
                       (void *)egg_token_type_soh);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    1,
-                    fail,
-                    (void *)egg_token_type_soh);
-
   return NULL;
 }
 
@@ -419,53 +613,45 @@ egg_token *soh(void)
 egg_token *stx(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    2,
-                    entry,
-                    (void *)egg_token_type_stx);
+  if (_callbacks[2].entry)
+    callback_by_index(&_cbt,
+                      2,
+                      entry,
+                      (void *)egg_token_type_stx);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x02)
+  {
+    nt = egg_token_new(egg_token_type_stx);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[2].success)
+        callback_by_index(&_cbt,
+                          2,
+                          success,
+                          (void *)egg_token_type_stx);
 
-  nt = egg_token_new(egg_token_type_stx);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      2,
-                      fail,
-                      (void *)egg_token_type_stx);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x02)
-  {
+  if (_callbacks[2].fail)
     callback_by_index(&_cbt,
                       2,
-                      success,
+                      fail,
                       (void *)egg_token_type_stx);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    2,
-                    fail,
-                    (void *)egg_token_type_stx);
-
   return NULL;
 }
 
@@ -484,53 +670,45 @@ egg_token *stx(void)
 egg_token *etx(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    3,
-                    entry,
-                    (void *)egg_token_type_etx);
+  if (_callbacks[3].entry)
+    callback_by_index(&_cbt,
+                      3,
+                      entry,
+                      (void *)egg_token_type_etx);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x03)
+  {
+    nt = egg_token_new(egg_token_type_etx);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[3].success)
+        callback_by_index(&_cbt,
+                          3,
+                          success,
+                          (void *)egg_token_type_etx);
 
-  nt = egg_token_new(egg_token_type_etx);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      3,
-                      fail,
-                      (void *)egg_token_type_etx);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x03)
-  {
+  if (_callbacks[3].fail)
     callback_by_index(&_cbt,
                       3,
-                      success,
+                      fail,
                       (void *)egg_token_type_etx);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    3,
-                    fail,
-                    (void *)egg_token_type_etx);
-
   return NULL;
 }
 
@@ -549,53 +727,45 @@ egg_token *etx(void)
 egg_token *eot(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    4,
-                    entry,
-                    (void *)egg_token_type_eot);
+  if (_callbacks[4].entry)
+    callback_by_index(&_cbt,
+                      4,
+                      entry,
+                      (void *)egg_token_type_eot);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x04)
+  {
+    nt = egg_token_new(egg_token_type_eot);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[4].success)
+        callback_by_index(&_cbt,
+                          4,
+                          success,
+                          (void *)egg_token_type_eot);
 
-  nt = egg_token_new(egg_token_type_eot);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      4,
-                      fail,
-                      (void *)egg_token_type_eot);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x04)
-  {
+  if (_callbacks[4].fail)
     callback_by_index(&_cbt,
                       4,
-                      success,
+                      fail,
                       (void *)egg_token_type_eot);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    4,
-                    fail,
-                    (void *)egg_token_type_eot);
-
   return NULL;
 }
 
@@ -614,53 +784,45 @@ egg_token *eot(void)
 egg_token *enq(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    5,
-                    entry,
-                    (void *)egg_token_type_enq);
+  if (_callbacks[5].entry)
+    callback_by_index(&_cbt,
+                      5,
+                      entry,
+                      (void *)egg_token_type_enq);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x05)
+  {
+    nt = egg_token_new(egg_token_type_enq);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[5].success)
+        callback_by_index(&_cbt,
+                          5,
+                          success,
+                          (void *)egg_token_type_enq);
 
-  nt = egg_token_new(egg_token_type_enq);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      5,
-                      fail,
-                      (void *)egg_token_type_enq);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x05)
-  {
+  if (_callbacks[5].fail)
     callback_by_index(&_cbt,
                       5,
-                      success,
+                      fail,
                       (void *)egg_token_type_enq);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    5,
-                    fail,
-                    (void *)egg_token_type_enq);
-
   return NULL;
 }
 
@@ -679,52 +841,44 @@ egg_token *enq(void)
 egg_token *ack(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    6,
-                    entry,
-                    (void *)egg_token_type_ack);
+  if (_callbacks[6].entry)
+    callback_by_index(&_cbt,
+                      6,
+                      entry,
+                      (void *)egg_token_type_ack);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_ack);
-  if (!nt)
+  first = input_byte();
+  if (first == 0x06)
   {
-    callback_by_index(&_cbt,
-                      6,
-                      fail,
-                      (void *)egg_token_type_ack);
-    return NULL;
-  }
-
-  t1 = nt;
+    nt = egg_token_new(egg_token_type_ack);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x06)
-  {
-    callback_by_index(&_cbt,
-                      6,
-                      success,
-                      (void *)egg_token_type_ack);
+      if (_callbacks[6].success)
+        callback_by_index(&_cbt,
+                          6,
+                          success,
+                          (void *)egg_token_type_ack);
 
-    return nt;
+      return nt;
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    6,
-                    fail,
-                    (void *)egg_token_type_ack);
+  if (_callbacks[6].fail)
+    callback_by_index(&_cbt,
+                      6,
+                      fail,
+                      (void *)egg_token_type_ack);
 
   return NULL;
 }
@@ -744,53 +898,45 @@ egg_token *ack(void)
 egg_token *bel(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    7,
-                    entry,
-                    (void *)egg_token_type_bel);
+  if (_callbacks[7].entry)
+    callback_by_index(&_cbt,
+                      7,
+                      entry,
+                      (void *)egg_token_type_bel);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x07)
+  {
+    nt = egg_token_new(egg_token_type_bel);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[7].success)
+        callback_by_index(&_cbt,
+                          7,
+                          success,
+                          (void *)egg_token_type_bel);
 
-  nt = egg_token_new(egg_token_type_bel);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      7,
-                      fail,
-                      (void *)egg_token_type_bel);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x07)
-  {
+  if (_callbacks[7].fail)
     callback_by_index(&_cbt,
                       7,
-                      success,
+                      fail,
                       (void *)egg_token_type_bel);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    7,
-                    fail,
-                    (void *)egg_token_type_bel);
-
   return NULL;
 }
 
@@ -809,53 +955,45 @@ egg_token *bel(void)
 egg_token *bs(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    8,
-                    entry,
-                    (void *)egg_token_type_bs);
+  if (_callbacks[8].entry)
+    callback_by_index(&_cbt,
+                      8,
+                      entry,
+                      (void *)egg_token_type_bs);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x08)
+  {
+    nt = egg_token_new(egg_token_type_bs);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[8].success)
+        callback_by_index(&_cbt,
+                          8,
+                          success,
+                          (void *)egg_token_type_bs);
 
-  nt = egg_token_new(egg_token_type_bs);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      8,
-                      fail,
-                      (void *)egg_token_type_bs);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x08)
-  {
+  if (_callbacks[8].fail)
     callback_by_index(&_cbt,
                       8,
-                      success,
+                      fail,
                       (void *)egg_token_type_bs);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    8,
-                    fail,
-                    (void *)egg_token_type_bs);
-
   return NULL;
 }
 
@@ -874,53 +1012,45 @@ egg_token *bs(void)
 egg_token *ht(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    9,
-                    entry,
-                    (void *)egg_token_type_ht);
+  if (_callbacks[9].entry)
+    callback_by_index(&_cbt,
+                      9,
+                      entry,
+                      (void *)egg_token_type_ht);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x09)
+  {
+    nt = egg_token_new(egg_token_type_ht);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[9].success)
+        callback_by_index(&_cbt,
+                          9,
+                          success,
+                          (void *)egg_token_type_ht);
 
-  nt = egg_token_new(egg_token_type_ht);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      9,
-                      fail,
-                      (void *)egg_token_type_ht);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x09)
-  {
+  if (_callbacks[9].fail)
     callback_by_index(&_cbt,
                       9,
-                      success,
+                      fail,
                       (void *)egg_token_type_ht);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    9,
-                    fail,
-                    (void *)egg_token_type_ht);
-
   return NULL;
 }
 
@@ -939,53 +1069,45 @@ egg_token *ht(void)
 egg_token *lf(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    10,
-                    entry,
-                    (void *)egg_token_type_lf);
+  if (_callbacks[10].entry)
+    callback_by_index(&_cbt,
+                      10,
+                      entry,
+                      (void *)egg_token_type_lf);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x0A)
+  {
+    nt = egg_token_new(egg_token_type_lf);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[10].success)
+        callback_by_index(&_cbt,
+                          10,
+                          success,
+                          (void *)egg_token_type_lf);
 
-  nt = egg_token_new(egg_token_type_lf);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      10,
-                      fail,
-                      (void *)egg_token_type_lf);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x0A)
-  {
+  if (_callbacks[10].fail)
     callback_by_index(&_cbt,
                       10,
-                      success,
+                      fail,
                       (void *)egg_token_type_lf);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    10,
-                    fail,
-                    (void *)egg_token_type_lf);
-
   return NULL;
 }
 
@@ -1004,53 +1126,45 @@ egg_token *lf(void)
 egg_token *vt(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    11,
-                    entry,
-                    (void *)egg_token_type_vt);
+  if (_callbacks[11].entry)
+    callback_by_index(&_cbt,
+                      11,
+                      entry,
+                      (void *)egg_token_type_vt);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x0B)
+  {
+    nt = egg_token_new(egg_token_type_vt);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[11].success)
+        callback_by_index(&_cbt,
+                          11,
+                          success,
+                          (void *)egg_token_type_vt);
 
-  nt = egg_token_new(egg_token_type_vt);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      11,
-                      fail,
-                      (void *)egg_token_type_vt);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x0B)
-  {
+  if (_callbacks[11].fail)
     callback_by_index(&_cbt,
                       11,
-                      success,
+                      fail,
                       (void *)egg_token_type_vt);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    11,
-                    fail,
-                    (void *)egg_token_type_vt);
-
   return NULL;
 }
 
@@ -1069,53 +1183,45 @@ egg_token *vt(void)
 egg_token *ff(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    12,
-                    entry,
-                    (void *)egg_token_type_ff);
+  if (_callbacks[12].entry)
+    callback_by_index(&_cbt,
+                      12,
+                      entry,
+                      (void *)egg_token_type_ff);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x0C)
+  {
+    nt = egg_token_new(egg_token_type_ff);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[12].success)
+        callback_by_index(&_cbt,
+                          12,
+                          success,
+                          (void *)egg_token_type_ff);
 
-  nt = egg_token_new(egg_token_type_ff);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      12,
-                      fail,
-                      (void *)egg_token_type_ff);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x0C)
-  {
+  if (_callbacks[12].fail)
     callback_by_index(&_cbt,
                       12,
-                      success,
+                      fail,
                       (void *)egg_token_type_ff);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    12,
-                    fail,
-                    (void *)egg_token_type_ff);
-
   return NULL;
 }
 
@@ -1134,53 +1240,45 @@ egg_token *ff(void)
 egg_token *cr(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    13,
-                    entry,
-                    (void *)egg_token_type_cr);
+  if (_callbacks[13].entry)
+    callback_by_index(&_cbt,
+                      13,
+                      entry,
+                      (void *)egg_token_type_cr);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x0D)
+  {
+    nt = egg_token_new(egg_token_type_cr);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[13].success)
+        callback_by_index(&_cbt,
+                          13,
+                          success,
+                          (void *)egg_token_type_cr);
 
-  nt = egg_token_new(egg_token_type_cr);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      13,
-                      fail,
-                      (void *)egg_token_type_cr);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x0D)
-  {
+  if (_callbacks[13].fail)
     callback_by_index(&_cbt,
                       13,
-                      success,
+                      fail,
                       (void *)egg_token_type_cr);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    13,
-                    fail,
-                    (void *)egg_token_type_cr);
-
   return NULL;
 }
 
@@ -1199,53 +1297,45 @@ egg_token *cr(void)
 egg_token *so(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    14,
-                    entry,
-                    (void *)egg_token_type_so);
+  if (_callbacks[14].entry)
+    callback_by_index(&_cbt,
+                      14,
+                      entry,
+                      (void *)egg_token_type_so);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x0E)
+  {
+    nt = egg_token_new(egg_token_type_so);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[14].success)
+        callback_by_index(&_cbt,
+                          14,
+                          success,
+                          (void *)egg_token_type_so);
 
-  nt = egg_token_new(egg_token_type_so);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      14,
-                      fail,
-                      (void *)egg_token_type_so);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x0E)
-  {
+  if (_callbacks[14].fail)
     callback_by_index(&_cbt,
                       14,
-                      success,
+                      fail,
                       (void *)egg_token_type_so);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    14,
-                    fail,
-                    (void *)egg_token_type_so);
-
   return NULL;
 }
 
@@ -1264,52 +1354,44 @@ egg_token *so(void)
 egg_token *si(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    15,
-                    entry,
-                    (void *)egg_token_type_si);
+  if (_callbacks[15].entry)
+    callback_by_index(&_cbt,
+                      15,
+                      entry,
+                      (void *)egg_token_type_si);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_si);
-  if (!nt)
+  first = input_byte();
+  if (first == 0x0F)
   {
-    callback_by_index(&_cbt,
-                      15,
-                      fail,
-                      (void *)egg_token_type_si);
-    return NULL;
-  }
-
-  t1 = nt;
+    nt = egg_token_new(egg_token_type_si);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x0F)
-  {
-    callback_by_index(&_cbt,
-                      15,
-                      success,
-                      (void *)egg_token_type_si);
+      if (_callbacks[15].success)
+        callback_by_index(&_cbt,
+                          15,
+                          success,
+                          (void *)egg_token_type_si);
 
-    return nt;
+      return nt;
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    15,
-                    fail,
-                    (void *)egg_token_type_si);
+  if (_callbacks[15].fail)
+    callback_by_index(&_cbt,
+                      15,
+                      fail,
+                      (void *)egg_token_type_si);
 
   return NULL;
 }
@@ -1329,53 +1411,45 @@ egg_token *si(void)
 egg_token *dle(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    16,
-                    entry,
-                    (void *)egg_token_type_dle);
+  if (_callbacks[16].entry)
+    callback_by_index(&_cbt,
+                      16,
+                      entry,
+                      (void *)egg_token_type_dle);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x10)
+  {
+    nt = egg_token_new(egg_token_type_dle);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[16].success)
+        callback_by_index(&_cbt,
+                          16,
+                          success,
+                          (void *)egg_token_type_dle);
 
-  nt = egg_token_new(egg_token_type_dle);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      16,
-                      fail,
-                      (void *)egg_token_type_dle);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x10)
-  {
+  if (_callbacks[16].fail)
     callback_by_index(&_cbt,
                       16,
-                      success,
+                      fail,
                       (void *)egg_token_type_dle);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    16,
-                    fail,
-                    (void *)egg_token_type_dle);
-
   return NULL;
 }
 
@@ -1394,53 +1468,45 @@ egg_token *dle(void)
 egg_token *dc1(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    17,
-                    entry,
-                    (void *)egg_token_type_dc1);
+  if (_callbacks[17].entry)
+    callback_by_index(&_cbt,
+                      17,
+                      entry,
+                      (void *)egg_token_type_dc1);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x11)
+  {
+    nt = egg_token_new(egg_token_type_dc1);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[17].success)
+        callback_by_index(&_cbt,
+                          17,
+                          success,
+                          (void *)egg_token_type_dc1);
 
-  nt = egg_token_new(egg_token_type_dc1);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      17,
-                      fail,
-                      (void *)egg_token_type_dc1);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x11)
-  {
+  if (_callbacks[17].fail)
     callback_by_index(&_cbt,
                       17,
-                      success,
+                      fail,
                       (void *)egg_token_type_dc1);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    17,
-                    fail,
-                    (void *)egg_token_type_dc1);
-
   return NULL;
 }
 
@@ -1459,53 +1525,45 @@ egg_token *dc1(void)
 egg_token *dc2(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    18,
-                    entry,
-                    (void *)egg_token_type_dc2);
+  if (_callbacks[18].entry)
+    callback_by_index(&_cbt,
+                      18,
+                      entry,
+                      (void *)egg_token_type_dc2);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x12)
+  {
+    nt = egg_token_new(egg_token_type_dc2);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[18].success)
+        callback_by_index(&_cbt,
+                          18,
+                          success,
+                          (void *)egg_token_type_dc2);
 
-  nt = egg_token_new(egg_token_type_dc2);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      18,
-                      fail,
-                      (void *)egg_token_type_dc2);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x12)
-  {
+  if (_callbacks[18].fail)
     callback_by_index(&_cbt,
                       18,
-                      success,
+                      fail,
                       (void *)egg_token_type_dc2);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    18,
-                    fail,
-                    (void *)egg_token_type_dc2);
-
   return NULL;
 }
 
@@ -1524,53 +1582,45 @@ egg_token *dc2(void)
 egg_token *dc3(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    19,
-                    entry,
-                    (void *)egg_token_type_dc3);
+  if (_callbacks[19].entry)
+    callback_by_index(&_cbt,
+                      19,
+                      entry,
+                      (void *)egg_token_type_dc3);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x13)
+  {
+    nt = egg_token_new(egg_token_type_dc3);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[19].success)
+        callback_by_index(&_cbt,
+                          19,
+                          success,
+                          (void *)egg_token_type_dc3);
 
-  nt = egg_token_new(egg_token_type_dc3);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      19,
-                      fail,
-                      (void *)egg_token_type_dc3);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x13)
-  {
+  if (_callbacks[19].fail)
     callback_by_index(&_cbt,
                       19,
-                      success,
+                      fail,
                       (void *)egg_token_type_dc3);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    19,
-                    fail,
-                    (void *)egg_token_type_dc3);
-
   return NULL;
 }
 
@@ -1589,53 +1639,45 @@ egg_token *dc3(void)
 egg_token *dc4(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    20,
-                    entry,
-                    (void *)egg_token_type_dc4);
+  if (_callbacks[20].entry)
+    callback_by_index(&_cbt,
+                      20,
+                      entry,
+                      (void *)egg_token_type_dc4);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x14)
+  {
+    nt = egg_token_new(egg_token_type_dc4);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[20].success)
+        callback_by_index(&_cbt,
+                          20,
+                          success,
+                          (void *)egg_token_type_dc4);
 
-  nt = egg_token_new(egg_token_type_dc4);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      20,
-                      fail,
-                      (void *)egg_token_type_dc4);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x14)
-  {
+  if (_callbacks[20].fail)
     callback_by_index(&_cbt,
                       20,
-                      success,
+                      fail,
                       (void *)egg_token_type_dc4);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    20,
-                    fail,
-                    (void *)egg_token_type_dc4);
-
   return NULL;
 }
 
@@ -1654,53 +1696,45 @@ egg_token *dc4(void)
 egg_token *nak(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    21,
-                    entry,
-                    (void *)egg_token_type_nak);
+  if (_callbacks[21].entry)
+    callback_by_index(&_cbt,
+                      21,
+                      entry,
+                      (void *)egg_token_type_nak);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x15)
+  {
+    nt = egg_token_new(egg_token_type_nak);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[21].success)
+        callback_by_index(&_cbt,
+                          21,
+                          success,
+                          (void *)egg_token_type_nak);
 
-  nt = egg_token_new(egg_token_type_nak);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      21,
-                      fail,
-                      (void *)egg_token_type_nak);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x15)
-  {
+  if (_callbacks[21].fail)
     callback_by_index(&_cbt,
                       21,
-                      success,
+                      fail,
                       (void *)egg_token_type_nak);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    21,
-                    fail,
-                    (void *)egg_token_type_nak);
-
   return NULL;
 }
 
@@ -1719,53 +1753,45 @@ egg_token *nak(void)
 egg_token *syn(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    22,
-                    entry,
-                    (void *)egg_token_type_syn);
+  if (_callbacks[22].entry)
+    callback_by_index(&_cbt,
+                      22,
+                      entry,
+                      (void *)egg_token_type_syn);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x16)
+  {
+    nt = egg_token_new(egg_token_type_syn);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[22].success)
+        callback_by_index(&_cbt,
+                          22,
+                          success,
+                          (void *)egg_token_type_syn);
 
-  nt = egg_token_new(egg_token_type_syn);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      22,
-                      fail,
-                      (void *)egg_token_type_syn);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x16)
-  {
+  if (_callbacks[22].fail)
     callback_by_index(&_cbt,
                       22,
-                      success,
+                      fail,
                       (void *)egg_token_type_syn);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    22,
-                    fail,
-                    (void *)egg_token_type_syn);
-
   return NULL;
 }
 
@@ -1784,53 +1810,45 @@ egg_token *syn(void)
 egg_token *etb(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    23,
-                    entry,
-                    (void *)egg_token_type_etb);
+  if (_callbacks[23].entry)
+    callback_by_index(&_cbt,
+                      23,
+                      entry,
+                      (void *)egg_token_type_etb);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x17)
+  {
+    nt = egg_token_new(egg_token_type_etb);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[23].success)
+        callback_by_index(&_cbt,
+                          23,
+                          success,
+                          (void *)egg_token_type_etb);
 
-  nt = egg_token_new(egg_token_type_etb);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      23,
-                      fail,
-                      (void *)egg_token_type_etb);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x17)
-  {
+  if (_callbacks[23].fail)
     callback_by_index(&_cbt,
                       23,
-                      success,
+                      fail,
                       (void *)egg_token_type_etb);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    23,
-                    fail,
-                    (void *)egg_token_type_etb);
-
   return NULL;
 }
 
@@ -1849,53 +1867,45 @@ egg_token *etb(void)
 egg_token *can(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    24,
-                    entry,
-                    (void *)egg_token_type_can);
+  if (_callbacks[24].entry)
+    callback_by_index(&_cbt,
+                      24,
+                      entry,
+                      (void *)egg_token_type_can);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x18)
+  {
+    nt = egg_token_new(egg_token_type_can);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[24].success)
+        callback_by_index(&_cbt,
+                          24,
+                          success,
+                          (void *)egg_token_type_can);
 
-  nt = egg_token_new(egg_token_type_can);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      24,
-                      fail,
-                      (void *)egg_token_type_can);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x18)
-  {
+  if (_callbacks[24].fail)
     callback_by_index(&_cbt,
                       24,
-                      success,
+                      fail,
                       (void *)egg_token_type_can);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    24,
-                    fail,
-                    (void *)egg_token_type_can);
-
   return NULL;
 }
 
@@ -1914,53 +1924,45 @@ egg_token *can(void)
 egg_token *em(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    25,
-                    entry,
-                    (void *)egg_token_type_em);
+  if (_callbacks[25].entry)
+    callback_by_index(&_cbt,
+                      25,
+                      entry,
+                      (void *)egg_token_type_em);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x19)
+  {
+    nt = egg_token_new(egg_token_type_em);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[25].success)
+        callback_by_index(&_cbt,
+                          25,
+                          success,
+                          (void *)egg_token_type_em);
 
-  nt = egg_token_new(egg_token_type_em);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      25,
-                      fail,
-                      (void *)egg_token_type_em);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x19)
-  {
+  if (_callbacks[25].fail)
     callback_by_index(&_cbt,
                       25,
-                      success,
+                      fail,
                       (void *)egg_token_type_em);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    25,
-                    fail,
-                    (void *)egg_token_type_em);
-
   return NULL;
 }
 
@@ -1979,53 +1981,45 @@ egg_token *em(void)
 egg_token *sub(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    26,
-                    entry,
-                    (void *)egg_token_type_sub);
+  if (_callbacks[26].entry)
+    callback_by_index(&_cbt,
+                      26,
+                      entry,
+                      (void *)egg_token_type_sub);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x1A)
+  {
+    nt = egg_token_new(egg_token_type_sub);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[26].success)
+        callback_by_index(&_cbt,
+                          26,
+                          success,
+                          (void *)egg_token_type_sub);
 
-  nt = egg_token_new(egg_token_type_sub);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      26,
-                      fail,
-                      (void *)egg_token_type_sub);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x1A)
-  {
+  if (_callbacks[26].fail)
     callback_by_index(&_cbt,
                       26,
-                      success,
+                      fail,
                       (void *)egg_token_type_sub);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    26,
-                    fail,
-                    (void *)egg_token_type_sub);
-
   return NULL;
 }
 
@@ -2044,53 +2038,45 @@ egg_token *sub(void)
 egg_token *esc(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    27,
-                    entry,
-                    (void *)egg_token_type_esc);
+  if (_callbacks[27].entry)
+    callback_by_index(&_cbt,
+                      27,
+                      entry,
+                      (void *)egg_token_type_esc);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x1B)
+  {
+    nt = egg_token_new(egg_token_type_esc);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[27].success)
+        callback_by_index(&_cbt,
+                          27,
+                          success,
+                          (void *)egg_token_type_esc);
 
-  nt = egg_token_new(egg_token_type_esc);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      27,
-                      fail,
-                      (void *)egg_token_type_esc);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x1B)
-  {
+  if (_callbacks[27].fail)
     callback_by_index(&_cbt,
                       27,
-                      success,
+                      fail,
                       (void *)egg_token_type_esc);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    27,
-                    fail,
-                    (void *)egg_token_type_esc);
-
   return NULL;
 }
 
@@ -2109,53 +2095,45 @@ egg_token *esc(void)
 egg_token *fs(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    28,
-                    entry,
-                    (void *)egg_token_type_fs);
+  if (_callbacks[28].entry)
+    callback_by_index(&_cbt,
+                      28,
+                      entry,
+                      (void *)egg_token_type_fs);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x1C)
+  {
+    nt = egg_token_new(egg_token_type_fs);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[28].success)
+        callback_by_index(&_cbt,
+                          28,
+                          success,
+                          (void *)egg_token_type_fs);
 
-  nt = egg_token_new(egg_token_type_fs);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      28,
-                      fail,
-                      (void *)egg_token_type_fs);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x1C)
-  {
+  if (_callbacks[28].fail)
     callback_by_index(&_cbt,
                       28,
-                      success,
+                      fail,
                       (void *)egg_token_type_fs);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    28,
-                    fail,
-                    (void *)egg_token_type_fs);
-
   return NULL;
 }
 
@@ -2174,53 +2152,45 @@ egg_token *fs(void)
 egg_token *gs(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    29,
-                    entry,
-                    (void *)egg_token_type_gs);
+  if (_callbacks[29].entry)
+    callback_by_index(&_cbt,
+                      29,
+                      entry,
+                      (void *)egg_token_type_gs);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x1D)
+  {
+    nt = egg_token_new(egg_token_type_gs);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[29].success)
+        callback_by_index(&_cbt,
+                          29,
+                          success,
+                          (void *)egg_token_type_gs);
 
-  nt = egg_token_new(egg_token_type_gs);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      29,
-                      fail,
-                      (void *)egg_token_type_gs);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x1D)
-  {
+  if (_callbacks[29].fail)
     callback_by_index(&_cbt,
                       29,
-                      success,
+                      fail,
                       (void *)egg_token_type_gs);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    29,
-                    fail,
-                    (void *)egg_token_type_gs);
-
   return NULL;
 }
 
@@ -2239,53 +2209,45 @@ egg_token *gs(void)
 egg_token *rs(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    30,
-                    entry,
-                    (void *)egg_token_type_rs);
+  if (_callbacks[30].entry)
+    callback_by_index(&_cbt,
+                      30,
+                      entry,
+                      (void *)egg_token_type_rs);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x1E)
+  {
+    nt = egg_token_new(egg_token_type_rs);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[30].success)
+        callback_by_index(&_cbt,
+                          30,
+                          success,
+                          (void *)egg_token_type_rs);
 
-  nt = egg_token_new(egg_token_type_rs);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      30,
-                      fail,
-                      (void *)egg_token_type_rs);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x1E)
-  {
+  if (_callbacks[30].fail)
     callback_by_index(&_cbt,
                       30,
-                      success,
+                      fail,
                       (void *)egg_token_type_rs);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    30,
-                    fail,
-                    (void *)egg_token_type_rs);
-
   return NULL;
 }
 
@@ -2304,53 +2266,45 @@ egg_token *rs(void)
 egg_token *us(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    31,
-                    entry,
-                    (void *)egg_token_type_us);
+  if (_callbacks[31].entry)
+    callback_by_index(&_cbt,
+                      31,
+                      entry,
+                      (void *)egg_token_type_us);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x1F)
+  {
+    nt = egg_token_new(egg_token_type_us);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[31].success)
+        callback_by_index(&_cbt,
+                          31,
+                          success,
+                          (void *)egg_token_type_us);
 
-  nt = egg_token_new(egg_token_type_us);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      31,
-                      fail,
-                      (void *)egg_token_type_us);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x1F)
-  {
+  if (_callbacks[31].fail)
     callback_by_index(&_cbt,
                       31,
-                      success,
+                      fail,
                       (void *)egg_token_type_us);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    31,
-                    fail,
-                    (void *)egg_token_type_us);
-
   return NULL;
 }
 
@@ -2369,53 +2323,45 @@ egg_token *us(void)
 egg_token *space(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    32,
-                    entry,
-                    (void *)egg_token_type_space);
+  if (_callbacks[32].entry)
+    callback_by_index(&_cbt,
+                      32,
+                      entry,
+                      (void *)egg_token_type_space);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x20)
+  {
+    nt = egg_token_new(egg_token_type_space);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[32].success)
+        callback_by_index(&_cbt,
+                          32,
+                          success,
+                          (void *)egg_token_type_space);
 
-  nt = egg_token_new(egg_token_type_space);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      32,
-                      fail,
-                      (void *)egg_token_type_space);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x20)
-  {
+  if (_callbacks[32].fail)
     callback_by_index(&_cbt,
                       32,
-                      success,
+                      fail,
                       (void *)egg_token_type_space);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    32,
-                    fail,
-                    (void *)egg_token_type_space);
-
   return NULL;
 }
 
@@ -2434,53 +2380,45 @@ egg_token *space(void)
 egg_token *exclamation_point(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    33,
-                    entry,
-                    (void *)egg_token_type_exclamation_point);
+  if (_callbacks[33].entry)
+    callback_by_index(&_cbt,
+                      33,
+                      entry,
+                      (void *)egg_token_type_exclamation_point);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x21)
+  {
+    nt = egg_token_new(egg_token_type_exclamation_point);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[33].success)
+        callback_by_index(&_cbt,
+                          33,
+                          success,
+                          (void *)egg_token_type_exclamation_point);
 
-  nt = egg_token_new(egg_token_type_exclamation_point);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      33,
-                      fail,
-                      (void *)egg_token_type_exclamation_point);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x21)
-  {
+  if (_callbacks[33].fail)
     callback_by_index(&_cbt,
                       33,
-                      success,
+                      fail,
                       (void *)egg_token_type_exclamation_point);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    33,
-                    fail,
-                    (void *)egg_token_type_exclamation_point);
-
   return NULL;
 }
 
@@ -2499,53 +2437,45 @@ egg_token *exclamation_point(void)
 egg_token *quote(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    34,
-                    entry,
-                    (void *)egg_token_type_quote);
+  if (_callbacks[34].entry)
+    callback_by_index(&_cbt,
+                      34,
+                      entry,
+                      (void *)egg_token_type_quote);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x22)
+  {
+    nt = egg_token_new(egg_token_type_quote);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[34].success)
+        callback_by_index(&_cbt,
+                          34,
+                          success,
+                          (void *)egg_token_type_quote);
 
-  nt = egg_token_new(egg_token_type_quote);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      34,
-                      fail,
-                      (void *)egg_token_type_quote);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x22)
-  {
+  if (_callbacks[34].fail)
     callback_by_index(&_cbt,
                       34,
-                      success,
+                      fail,
                       (void *)egg_token_type_quote);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    34,
-                    fail,
-                    (void *)egg_token_type_quote);
-
   return NULL;
 }
 
@@ -2564,53 +2494,45 @@ egg_token *quote(void)
 egg_token *number_sign(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    35,
-                    entry,
-                    (void *)egg_token_type_number_sign);
+  if (_callbacks[35].entry)
+    callback_by_index(&_cbt,
+                      35,
+                      entry,
+                      (void *)egg_token_type_number_sign);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x23)
+  {
+    nt = egg_token_new(egg_token_type_number_sign);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[35].success)
+        callback_by_index(&_cbt,
+                          35,
+                          success,
+                          (void *)egg_token_type_number_sign);
 
-  nt = egg_token_new(egg_token_type_number_sign);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      35,
-                      fail,
-                      (void *)egg_token_type_number_sign);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x23)
-  {
+  if (_callbacks[35].fail)
     callback_by_index(&_cbt,
                       35,
-                      success,
+                      fail,
                       (void *)egg_token_type_number_sign);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    35,
-                    fail,
-                    (void *)egg_token_type_number_sign);
-
   return NULL;
 }
 
@@ -2629,53 +2551,45 @@ egg_token *number_sign(void)
 egg_token *dollar(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    36,
-                    entry,
-                    (void *)egg_token_type_dollar);
+  if (_callbacks[36].entry)
+    callback_by_index(&_cbt,
+                      36,
+                      entry,
+                      (void *)egg_token_type_dollar);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x24)
+  {
+    nt = egg_token_new(egg_token_type_dollar);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[36].success)
+        callback_by_index(&_cbt,
+                          36,
+                          success,
+                          (void *)egg_token_type_dollar);
 
-  nt = egg_token_new(egg_token_type_dollar);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      36,
-                      fail,
-                      (void *)egg_token_type_dollar);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x24)
-  {
+  if (_callbacks[36].fail)
     callback_by_index(&_cbt,
                       36,
-                      success,
+                      fail,
                       (void *)egg_token_type_dollar);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    36,
-                    fail,
-                    (void *)egg_token_type_dollar);
-
   return NULL;
 }
 
@@ -2694,53 +2608,45 @@ egg_token *dollar(void)
 egg_token *percent(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    37,
-                    entry,
-                    (void *)egg_token_type_percent);
+  if (_callbacks[37].entry)
+    callback_by_index(&_cbt,
+                      37,
+                      entry,
+                      (void *)egg_token_type_percent);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x25)
+  {
+    nt = egg_token_new(egg_token_type_percent);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[37].success)
+        callback_by_index(&_cbt,
+                          37,
+                          success,
+                          (void *)egg_token_type_percent);
 
-  nt = egg_token_new(egg_token_type_percent);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      37,
-                      fail,
-                      (void *)egg_token_type_percent);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x25)
-  {
+  if (_callbacks[37].fail)
     callback_by_index(&_cbt,
                       37,
-                      success,
+                      fail,
                       (void *)egg_token_type_percent);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    37,
-                    fail,
-                    (void *)egg_token_type_percent);
-
   return NULL;
 }
 
@@ -2759,53 +2665,45 @@ egg_token *percent(void)
 egg_token *ampersand(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    38,
-                    entry,
-                    (void *)egg_token_type_ampersand);
+  if (_callbacks[38].entry)
+    callback_by_index(&_cbt,
+                      38,
+                      entry,
+                      (void *)egg_token_type_ampersand);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x26)
+  {
+    nt = egg_token_new(egg_token_type_ampersand);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[38].success)
+        callback_by_index(&_cbt,
+                          38,
+                          success,
+                          (void *)egg_token_type_ampersand);
 
-  nt = egg_token_new(egg_token_type_ampersand);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      38,
-                      fail,
-                      (void *)egg_token_type_ampersand);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x26)
-  {
+  if (_callbacks[38].fail)
     callback_by_index(&_cbt,
                       38,
-                      success,
+                      fail,
                       (void *)egg_token_type_ampersand);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    38,
-                    fail,
-                    (void *)egg_token_type_ampersand);
-
   return NULL;
 }
 
@@ -2824,53 +2722,45 @@ egg_token *ampersand(void)
 egg_token *single_quote(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    39,
-                    entry,
-                    (void *)egg_token_type_single_quote);
+  if (_callbacks[39].entry)
+    callback_by_index(&_cbt,
+                      39,
+                      entry,
+                      (void *)egg_token_type_single_quote);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x27)
+  {
+    nt = egg_token_new(egg_token_type_single_quote);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[39].success)
+        callback_by_index(&_cbt,
+                          39,
+                          success,
+                          (void *)egg_token_type_single_quote);
 
-  nt = egg_token_new(egg_token_type_single_quote);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      39,
-                      fail,
-                      (void *)egg_token_type_single_quote);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x27)
-  {
+  if (_callbacks[39].fail)
     callback_by_index(&_cbt,
                       39,
-                      success,
+                      fail,
                       (void *)egg_token_type_single_quote);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    39,
-                    fail,
-                    (void *)egg_token_type_single_quote);
-
   return NULL;
 }
 
@@ -2889,53 +2779,45 @@ egg_token *single_quote(void)
 egg_token *open_parenthesis(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    40,
-                    entry,
-                    (void *)egg_token_type_open_parenthesis);
+  if (_callbacks[40].entry)
+    callback_by_index(&_cbt,
+                      40,
+                      entry,
+                      (void *)egg_token_type_open_parenthesis);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x28)
+  {
+    nt = egg_token_new(egg_token_type_open_parenthesis);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[40].success)
+        callback_by_index(&_cbt,
+                          40,
+                          success,
+                          (void *)egg_token_type_open_parenthesis);
 
-  nt = egg_token_new(egg_token_type_open_parenthesis);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      40,
-                      fail,
-                      (void *)egg_token_type_open_parenthesis);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x28)
-  {
+  if (_callbacks[40].fail)
     callback_by_index(&_cbt,
                       40,
-                      success,
+                      fail,
                       (void *)egg_token_type_open_parenthesis);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    40,
-                    fail,
-                    (void *)egg_token_type_open_parenthesis);
-
   return NULL;
 }
 
@@ -2954,53 +2836,45 @@ egg_token *open_parenthesis(void)
 egg_token *close_parenthesis(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    41,
-                    entry,
-                    (void *)egg_token_type_close_parenthesis);
+  if (_callbacks[41].entry)
+    callback_by_index(&_cbt,
+                      41,
+                      entry,
+                      (void *)egg_token_type_close_parenthesis);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x29)
+  {
+    nt = egg_token_new(egg_token_type_close_parenthesis);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[41].success)
+        callback_by_index(&_cbt,
+                          41,
+                          success,
+                          (void *)egg_token_type_close_parenthesis);
 
-  nt = egg_token_new(egg_token_type_close_parenthesis);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      41,
-                      fail,
-                      (void *)egg_token_type_close_parenthesis);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x29)
-  {
+  if (_callbacks[41].fail)
     callback_by_index(&_cbt,
                       41,
-                      success,
+                      fail,
                       (void *)egg_token_type_close_parenthesis);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    41,
-                    fail,
-                    (void *)egg_token_type_close_parenthesis);
-
   return NULL;
 }
 
@@ -3019,52 +2893,44 @@ egg_token *close_parenthesis(void)
 egg_token *asterisk(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    42,
-                    entry,
-                    (void *)egg_token_type_asterisk);
+  if (_callbacks[42].entry)
+    callback_by_index(&_cbt,
+                      42,
+                      entry,
+                      (void *)egg_token_type_asterisk);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x2A)
+  {
+    nt = egg_token_new(egg_token_type_asterisk);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[42].success)
+        callback_by_index(&_cbt,
+                          42,
+                          success,
+                          (void *)egg_token_type_asterisk);
 
-  nt = egg_token_new(egg_token_type_asterisk);
-  if (!nt)
-  {
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[42].fail)
     callback_by_index(&_cbt,
                       42,
                       fail,
                       (void *)egg_token_type_asterisk);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if ((input_byte()) == 0x2A)
-  {
-    callback_by_index(&_cbt,
-                      42,
-                      success,
-                      (void *)egg_token_type_asterisk);
-
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    42,
-                    fail,
-                    (void *)egg_token_type_asterisk);
 
   return NULL;
 }
@@ -3084,53 +2950,45 @@ egg_token *asterisk(void)
 egg_token *plus(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    43,
-                    entry,
-                    (void *)egg_token_type_plus);
+  if (_callbacks[43].entry)
+    callback_by_index(&_cbt,
+                      43,
+                      entry,
+                      (void *)egg_token_type_plus);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x2B)
+  {
+    nt = egg_token_new(egg_token_type_plus);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[43].success)
+        callback_by_index(&_cbt,
+                          43,
+                          success,
+                          (void *)egg_token_type_plus);
 
-  nt = egg_token_new(egg_token_type_plus);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      43,
-                      fail,
-                      (void *)egg_token_type_plus);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x2B)
-  {
+  if (_callbacks[43].fail)
     callback_by_index(&_cbt,
                       43,
-                      success,
+                      fail,
                       (void *)egg_token_type_plus);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    43,
-                    fail,
-                    (void *)egg_token_type_plus);
-
   return NULL;
 }
 
@@ -3149,53 +3007,45 @@ egg_token *plus(void)
 egg_token *comma(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    44,
-                    entry,
-                    (void *)egg_token_type_comma);
+  if (_callbacks[44].entry)
+    callback_by_index(&_cbt,
+                      44,
+                      entry,
+                      (void *)egg_token_type_comma);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x2C)
+  {
+    nt = egg_token_new(egg_token_type_comma);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[44].success)
+        callback_by_index(&_cbt,
+                          44,
+                          success,
+                          (void *)egg_token_type_comma);
 
-  nt = egg_token_new(egg_token_type_comma);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      44,
-                      fail,
-                      (void *)egg_token_type_comma);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x2C)
-  {
+  if (_callbacks[44].fail)
     callback_by_index(&_cbt,
                       44,
-                      success,
+                      fail,
                       (void *)egg_token_type_comma);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    44,
-                    fail,
-                    (void *)egg_token_type_comma);
-
   return NULL;
 }
 
@@ -3214,53 +3064,45 @@ egg_token *comma(void)
 egg_token *minus(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    45,
-                    entry,
-                    (void *)egg_token_type_minus);
+  if (_callbacks[45].entry)
+    callback_by_index(&_cbt,
+                      45,
+                      entry,
+                      (void *)egg_token_type_minus);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x2D)
+  {
+    nt = egg_token_new(egg_token_type_minus);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[45].success)
+        callback_by_index(&_cbt,
+                          45,
+                          success,
+                          (void *)egg_token_type_minus);
 
-  nt = egg_token_new(egg_token_type_minus);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      45,
-                      fail,
-                      (void *)egg_token_type_minus);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x2D)
-  {
+  if (_callbacks[45].fail)
     callback_by_index(&_cbt,
                       45,
-                      success,
+                      fail,
                       (void *)egg_token_type_minus);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    45,
-                    fail,
-                    (void *)egg_token_type_minus);
-
   return NULL;
 }
 
@@ -3279,53 +3121,45 @@ egg_token *minus(void)
 egg_token *period(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    46,
-                    entry,
-                    (void *)egg_token_type_period);
+  if (_callbacks[46].entry)
+    callback_by_index(&_cbt,
+                      46,
+                      entry,
+                      (void *)egg_token_type_period);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x2E)
+  {
+    nt = egg_token_new(egg_token_type_period);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[46].success)
+        callback_by_index(&_cbt,
+                          46,
+                          success,
+                          (void *)egg_token_type_period);
 
-  nt = egg_token_new(egg_token_type_period);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      46,
-                      fail,
-                      (void *)egg_token_type_period);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x2E)
-  {
+  if (_callbacks[46].fail)
     callback_by_index(&_cbt,
                       46,
-                      success,
+                      fail,
                       (void *)egg_token_type_period);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    46,
-                    fail,
-                    (void *)egg_token_type_period);
-
   return NULL;
 }
 
@@ -3344,53 +3178,45 @@ egg_token *period(void)
 egg_token *slash(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    47,
-                    entry,
-                    (void *)egg_token_type_slash);
+  if (_callbacks[47].entry)
+    callback_by_index(&_cbt,
+                      47,
+                      entry,
+                      (void *)egg_token_type_slash);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x2F)
+  {
+    nt = egg_token_new(egg_token_type_slash);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[47].success)
+        callback_by_index(&_cbt,
+                          47,
+                          success,
+                          (void *)egg_token_type_slash);
 
-  nt = egg_token_new(egg_token_type_slash);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      47,
-                      fail,
-                      (void *)egg_token_type_slash);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x2F)
-  {
+  if (_callbacks[47].fail)
     callback_by_index(&_cbt,
                       47,
-                      success,
+                      fail,
                       (void *)egg_token_type_slash);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    47,
-                    fail,
-                    (void *)egg_token_type_slash);
-
   return NULL;
 }
 
@@ -3409,53 +3235,45 @@ egg_token *slash(void)
 egg_token *zero(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    48,
-                    entry,
-                    (void *)egg_token_type_zero);
+  if (_callbacks[48].entry)
+    callback_by_index(&_cbt,
+                      48,
+                      entry,
+                      (void *)egg_token_type_zero);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x30)
+  {
+    nt = egg_token_new(egg_token_type_zero);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[48].success)
+        callback_by_index(&_cbt,
+                          48,
+                          success,
+                          (void *)egg_token_type_zero);
 
-  nt = egg_token_new(egg_token_type_zero);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      48,
-                      fail,
-                      (void *)egg_token_type_zero);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x30)
-  {
+  if (_callbacks[48].fail)
     callback_by_index(&_cbt,
                       48,
-                      success,
+                      fail,
                       (void *)egg_token_type_zero);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    48,
-                    fail,
-                    (void *)egg_token_type_zero);
-
   return NULL;
 }
 
@@ -3474,53 +3292,45 @@ egg_token *zero(void)
 egg_token *one(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    49,
-                    entry,
-                    (void *)egg_token_type_one);
+  if (_callbacks[49].entry)
+    callback_by_index(&_cbt,
+                      49,
+                      entry,
+                      (void *)egg_token_type_one);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x31)
+  {
+    nt = egg_token_new(egg_token_type_one);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[49].success)
+        callback_by_index(&_cbt,
+                          49,
+                          success,
+                          (void *)egg_token_type_one);
 
-  nt = egg_token_new(egg_token_type_one);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      49,
-                      fail,
-                      (void *)egg_token_type_one);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x31)
-  {
+  if (_callbacks[49].fail)
     callback_by_index(&_cbt,
                       49,
-                      success,
+                      fail,
                       (void *)egg_token_type_one);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    49,
-                    fail,
-                    (void *)egg_token_type_one);
-
   return NULL;
 }
 
@@ -3539,53 +3349,45 @@ egg_token *one(void)
 egg_token *two(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    50,
-                    entry,
-                    (void *)egg_token_type_two);
+  if (_callbacks[50].entry)
+    callback_by_index(&_cbt,
+                      50,
+                      entry,
+                      (void *)egg_token_type_two);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x32)
+  {
+    nt = egg_token_new(egg_token_type_two);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[50].success)
+        callback_by_index(&_cbt,
+                          50,
+                          success,
+                          (void *)egg_token_type_two);
 
-  nt = egg_token_new(egg_token_type_two);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      50,
-                      fail,
-                      (void *)egg_token_type_two);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x32)
-  {
+  if (_callbacks[50].fail)
     callback_by_index(&_cbt,
                       50,
-                      success,
+                      fail,
                       (void *)egg_token_type_two);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    50,
-                    fail,
-                    (void *)egg_token_type_two);
-
   return NULL;
 }
 
@@ -3604,52 +3406,44 @@ egg_token *two(void)
 egg_token *three(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    51,
-                    entry,
-                    (void *)egg_token_type_three);
+  if (_callbacks[51].entry)
+    callback_by_index(&_cbt,
+                      51,
+                      entry,
+                      (void *)egg_token_type_three);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x33)
+  {
+    nt = egg_token_new(egg_token_type_three);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[51].success)
+        callback_by_index(&_cbt,
+                          51,
+                          success,
+                          (void *)egg_token_type_three);
 
-  nt = egg_token_new(egg_token_type_three);
-  if (!nt)
-  {
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[51].fail)
     callback_by_index(&_cbt,
                       51,
                       fail,
                       (void *)egg_token_type_three);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if ((input_byte()) == 0x33)
-  {
-    callback_by_index(&_cbt,
-                      51,
-                      success,
-                      (void *)egg_token_type_three);
-
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    51,
-                    fail,
-                    (void *)egg_token_type_three);
 
   return NULL;
 }
@@ -3669,53 +3463,45 @@ egg_token *three(void)
 egg_token *four(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    52,
-                    entry,
-                    (void *)egg_token_type_four);
+  if (_callbacks[52].entry)
+    callback_by_index(&_cbt,
+                      52,
+                      entry,
+                      (void *)egg_token_type_four);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x34)
+  {
+    nt = egg_token_new(egg_token_type_four);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[52].success)
+        callback_by_index(&_cbt,
+                          52,
+                          success,
+                          (void *)egg_token_type_four);
 
-  nt = egg_token_new(egg_token_type_four);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      52,
-                      fail,
-                      (void *)egg_token_type_four);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x34)
-  {
+  if (_callbacks[52].fail)
     callback_by_index(&_cbt,
                       52,
-                      success,
+                      fail,
                       (void *)egg_token_type_four);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    52,
-                    fail,
-                    (void *)egg_token_type_four);
-
   return NULL;
 }
 
@@ -3734,53 +3520,45 @@ egg_token *four(void)
 egg_token *five(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    53,
-                    entry,
-                    (void *)egg_token_type_five);
+  if (_callbacks[53].entry)
+    callback_by_index(&_cbt,
+                      53,
+                      entry,
+                      (void *)egg_token_type_five);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x35)
+  {
+    nt = egg_token_new(egg_token_type_five);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[53].success)
+        callback_by_index(&_cbt,
+                          53,
+                          success,
+                          (void *)egg_token_type_five);
 
-  nt = egg_token_new(egg_token_type_five);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      53,
-                      fail,
-                      (void *)egg_token_type_five);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x35)
-  {
+  if (_callbacks[53].fail)
     callback_by_index(&_cbt,
                       53,
-                      success,
+                      fail,
                       (void *)egg_token_type_five);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    53,
-                    fail,
-                    (void *)egg_token_type_five);
-
   return NULL;
 }
 
@@ -3799,53 +3577,45 @@ egg_token *five(void)
 egg_token *six(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    54,
-                    entry,
-                    (void *)egg_token_type_six);
+  if (_callbacks[54].entry)
+    callback_by_index(&_cbt,
+                      54,
+                      entry,
+                      (void *)egg_token_type_six);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x36)
+  {
+    nt = egg_token_new(egg_token_type_six);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[54].success)
+        callback_by_index(&_cbt,
+                          54,
+                          success,
+                          (void *)egg_token_type_six);
 
-  nt = egg_token_new(egg_token_type_six);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      54,
-                      fail,
-                      (void *)egg_token_type_six);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x36)
-  {
+  if (_callbacks[54].fail)
     callback_by_index(&_cbt,
                       54,
-                      success,
+                      fail,
                       (void *)egg_token_type_six);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    54,
-                    fail,
-                    (void *)egg_token_type_six);
-
   return NULL;
 }
 
@@ -3864,53 +3634,45 @@ egg_token *six(void)
 egg_token *seven(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    55,
-                    entry,
-                    (void *)egg_token_type_seven);
+  if (_callbacks[55].entry)
+    callback_by_index(&_cbt,
+                      55,
+                      entry,
+                      (void *)egg_token_type_seven);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x37)
+  {
+    nt = egg_token_new(egg_token_type_seven);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[55].success)
+        callback_by_index(&_cbt,
+                          55,
+                          success,
+                          (void *)egg_token_type_seven);
 
-  nt = egg_token_new(egg_token_type_seven);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      55,
-                      fail,
-                      (void *)egg_token_type_seven);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x37)
-  {
+  if (_callbacks[55].fail)
     callback_by_index(&_cbt,
                       55,
-                      success,
+                      fail,
                       (void *)egg_token_type_seven);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    55,
-                    fail,
-                    (void *)egg_token_type_seven);
-
   return NULL;
 }
 
@@ -3929,53 +3691,45 @@ egg_token *seven(void)
 egg_token *eight(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    56,
-                    entry,
-                    (void *)egg_token_type_eight);
+  if (_callbacks[56].entry)
+    callback_by_index(&_cbt,
+                      56,
+                      entry,
+                      (void *)egg_token_type_eight);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x38)
+  {
+    nt = egg_token_new(egg_token_type_eight);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[56].success)
+        callback_by_index(&_cbt,
+                          56,
+                          success,
+                          (void *)egg_token_type_eight);
 
-  nt = egg_token_new(egg_token_type_eight);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      56,
-                      fail,
-                      (void *)egg_token_type_eight);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x38)
-  {
+  if (_callbacks[56].fail)
     callback_by_index(&_cbt,
                       56,
-                      success,
+                      fail,
                       (void *)egg_token_type_eight);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    56,
-                    fail,
-                    (void *)egg_token_type_eight);
-
   return NULL;
 }
 
@@ -3994,53 +3748,45 @@ egg_token *eight(void)
 egg_token *nine(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    57,
-                    entry,
-                    (void *)egg_token_type_nine);
+  if (_callbacks[57].entry)
+    callback_by_index(&_cbt,
+                      57,
+                      entry,
+                      (void *)egg_token_type_nine);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x39)
+  {
+    nt = egg_token_new(egg_token_type_nine);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[57].success)
+        callback_by_index(&_cbt,
+                          57,
+                          success,
+                          (void *)egg_token_type_nine);
 
-  nt = egg_token_new(egg_token_type_nine);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      57,
-                      fail,
-                      (void *)egg_token_type_nine);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x39)
-  {
+  if (_callbacks[57].fail)
     callback_by_index(&_cbt,
                       57,
-                      success,
+                      fail,
                       (void *)egg_token_type_nine);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    57,
-                    fail,
-                    (void *)egg_token_type_nine);
-
   return NULL;
 }
 
@@ -4059,53 +3805,45 @@ egg_token *nine(void)
 egg_token *colon(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    58,
-                    entry,
-                    (void *)egg_token_type_colon);
+  if (_callbacks[58].entry)
+    callback_by_index(&_cbt,
+                      58,
+                      entry,
+                      (void *)egg_token_type_colon);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x3A)
+  {
+    nt = egg_token_new(egg_token_type_colon);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[58].success)
+        callback_by_index(&_cbt,
+                          58,
+                          success,
+                          (void *)egg_token_type_colon);
 
-  nt = egg_token_new(egg_token_type_colon);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      58,
-                      fail,
-                      (void *)egg_token_type_colon);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x3A)
-  {
+  if (_callbacks[58].fail)
     callback_by_index(&_cbt,
                       58,
-                      success,
+                      fail,
                       (void *)egg_token_type_colon);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    58,
-                    fail,
-                    (void *)egg_token_type_colon);
-
   return NULL;
 }
 
@@ -4124,53 +3862,45 @@ egg_token *colon(void)
 egg_token *semicolon(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    59,
-                    entry,
-                    (void *)egg_token_type_semicolon);
+  if (_callbacks[59].entry)
+    callback_by_index(&_cbt,
+                      59,
+                      entry,
+                      (void *)egg_token_type_semicolon);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x3B)
+  {
+    nt = egg_token_new(egg_token_type_semicolon);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[59].success)
+        callback_by_index(&_cbt,
+                          59,
+                          success,
+                          (void *)egg_token_type_semicolon);
 
-  nt = egg_token_new(egg_token_type_semicolon);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      59,
-                      fail,
-                      (void *)egg_token_type_semicolon);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x3B)
-  {
+  if (_callbacks[59].fail)
     callback_by_index(&_cbt,
                       59,
-                      success,
+                      fail,
                       (void *)egg_token_type_semicolon);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    59,
-                    fail,
-                    (void *)egg_token_type_semicolon);
-
   return NULL;
 }
 
@@ -4189,52 +3919,44 @@ egg_token *semicolon(void)
 egg_token *less_than(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    60,
-                    entry,
-                    (void *)egg_token_type_less_than);
+  if (_callbacks[60].entry)
+    callback_by_index(&_cbt,
+                      60,
+                      entry,
+                      (void *)egg_token_type_less_than);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x3C)
+  {
+    nt = egg_token_new(egg_token_type_less_than);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[60].success)
+        callback_by_index(&_cbt,
+                          60,
+                          success,
+                          (void *)egg_token_type_less_than);
 
-  nt = egg_token_new(egg_token_type_less_than);
-  if (!nt)
-  {
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[60].fail)
     callback_by_index(&_cbt,
                       60,
                       fail,
                       (void *)egg_token_type_less_than);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if ((input_byte()) == 0x3C)
-  {
-    callback_by_index(&_cbt,
-                      60,
-                      success,
-                      (void *)egg_token_type_less_than);
-
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    60,
-                    fail,
-                    (void *)egg_token_type_less_than);
 
   return NULL;
 }
@@ -4254,53 +3976,45 @@ egg_token *less_than(void)
 egg_token *equal(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    61,
-                    entry,
-                    (void *)egg_token_type_equal);
+  if (_callbacks[61].entry)
+    callback_by_index(&_cbt,
+                      61,
+                      entry,
+                      (void *)egg_token_type_equal);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x3D)
+  {
+    nt = egg_token_new(egg_token_type_equal);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[61].success)
+        callback_by_index(&_cbt,
+                          61,
+                          success,
+                          (void *)egg_token_type_equal);
 
-  nt = egg_token_new(egg_token_type_equal);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      61,
-                      fail,
-                      (void *)egg_token_type_equal);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x3D)
-  {
+  if (_callbacks[61].fail)
     callback_by_index(&_cbt,
                       61,
-                      success,
+                      fail,
                       (void *)egg_token_type_equal);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    61,
-                    fail,
-                    (void *)egg_token_type_equal);
-
   return NULL;
 }
 
@@ -4319,53 +4033,45 @@ egg_token *equal(void)
 egg_token *greater_than(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    62,
-                    entry,
-                    (void *)egg_token_type_greater_than);
+  if (_callbacks[62].entry)
+    callback_by_index(&_cbt,
+                      62,
+                      entry,
+                      (void *)egg_token_type_greater_than);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x3E)
+  {
+    nt = egg_token_new(egg_token_type_greater_than);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[62].success)
+        callback_by_index(&_cbt,
+                          62,
+                          success,
+                          (void *)egg_token_type_greater_than);
 
-  nt = egg_token_new(egg_token_type_greater_than);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      62,
-                      fail,
-                      (void *)egg_token_type_greater_than);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x3E)
-  {
+  if (_callbacks[62].fail)
     callback_by_index(&_cbt,
                       62,
-                      success,
+                      fail,
                       (void *)egg_token_type_greater_than);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    62,
-                    fail,
-                    (void *)egg_token_type_greater_than);
-
   return NULL;
 }
 
@@ -4384,53 +4090,45 @@ egg_token *greater_than(void)
 egg_token *question_mark(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    63,
-                    entry,
-                    (void *)egg_token_type_question_mark);
+  if (_callbacks[63].entry)
+    callback_by_index(&_cbt,
+                      63,
+                      entry,
+                      (void *)egg_token_type_question_mark);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x3F)
+  {
+    nt = egg_token_new(egg_token_type_question_mark);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[63].success)
+        callback_by_index(&_cbt,
+                          63,
+                          success,
+                          (void *)egg_token_type_question_mark);
 
-  nt = egg_token_new(egg_token_type_question_mark);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      63,
-                      fail,
-                      (void *)egg_token_type_question_mark);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x3F)
-  {
+  if (_callbacks[63].fail)
     callback_by_index(&_cbt,
                       63,
-                      success,
+                      fail,
                       (void *)egg_token_type_question_mark);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    63,
-                    fail,
-                    (void *)egg_token_type_question_mark);
-
   return NULL;
 }
 
@@ -4449,53 +4147,45 @@ egg_token *question_mark(void)
 egg_token *at(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    64,
-                    entry,
-                    (void *)egg_token_type_at);
+  if (_callbacks[64].entry)
+    callback_by_index(&_cbt,
+                      64,
+                      entry,
+                      (void *)egg_token_type_at);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x40)
+  {
+    nt = egg_token_new(egg_token_type_at);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[64].success)
+        callback_by_index(&_cbt,
+                          64,
+                          success,
+                          (void *)egg_token_type_at);
 
-  nt = egg_token_new(egg_token_type_at);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      64,
-                      fail,
-                      (void *)egg_token_type_at);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x40)
-  {
+  if (_callbacks[64].fail)
     callback_by_index(&_cbt,
                       64,
-                      success,
+                      fail,
                       (void *)egg_token_type_at);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    64,
-                    fail,
-                    (void *)egg_token_type_at);
-
   return NULL;
 }
 
@@ -4514,53 +4204,45 @@ egg_token *at(void)
 egg_token *A(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    65,
-                    entry,
-                    (void *)egg_token_type_A);
+  if (_callbacks[65].entry)
+    callback_by_index(&_cbt,
+                      65,
+                      entry,
+                      (void *)egg_token_type_A);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x41)
+  {
+    nt = egg_token_new(egg_token_type_A);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[65].success)
+        callback_by_index(&_cbt,
+                          65,
+                          success,
+                          (void *)egg_token_type_A);
 
-  nt = egg_token_new(egg_token_type_A);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      65,
-                      fail,
-                      (void *)egg_token_type_A);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x41)
-  {
+  if (_callbacks[65].fail)
     callback_by_index(&_cbt,
                       65,
-                      success,
+                      fail,
                       (void *)egg_token_type_A);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    65,
-                    fail,
-                    (void *)egg_token_type_A);
-
   return NULL;
 }
 
@@ -4579,53 +4261,45 @@ egg_token *A(void)
 egg_token *B(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    66,
-                    entry,
-                    (void *)egg_token_type_B);
+  if (_callbacks[66].entry)
+    callback_by_index(&_cbt,
+                      66,
+                      entry,
+                      (void *)egg_token_type_B);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x42)
+  {
+    nt = egg_token_new(egg_token_type_B);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[66].success)
+        callback_by_index(&_cbt,
+                          66,
+                          success,
+                          (void *)egg_token_type_B);
 
-  nt = egg_token_new(egg_token_type_B);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      66,
-                      fail,
-                      (void *)egg_token_type_B);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x42)
-  {
+  if (_callbacks[66].fail)
     callback_by_index(&_cbt,
                       66,
-                      success,
+                      fail,
                       (void *)egg_token_type_B);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    66,
-                    fail,
-                    (void *)egg_token_type_B);
-
   return NULL;
 }
 
@@ -4644,53 +4318,45 @@ egg_token *B(void)
 egg_token *C(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    67,
-                    entry,
-                    (void *)egg_token_type_C);
+  if (_callbacks[67].entry)
+    callback_by_index(&_cbt,
+                      67,
+                      entry,
+                      (void *)egg_token_type_C);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x43)
+  {
+    nt = egg_token_new(egg_token_type_C);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[67].success)
+        callback_by_index(&_cbt,
+                          67,
+                          success,
+                          (void *)egg_token_type_C);
 
-  nt = egg_token_new(egg_token_type_C);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      67,
-                      fail,
-                      (void *)egg_token_type_C);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x43)
-  {
+  if (_callbacks[67].fail)
     callback_by_index(&_cbt,
                       67,
-                      success,
+                      fail,
                       (void *)egg_token_type_C);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    67,
-                    fail,
-                    (void *)egg_token_type_C);
-
   return NULL;
 }
 
@@ -4709,53 +4375,45 @@ egg_token *C(void)
 egg_token *D(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    68,
-                    entry,
-                    (void *)egg_token_type_D);
+  if (_callbacks[68].entry)
+    callback_by_index(&_cbt,
+                      68,
+                      entry,
+                      (void *)egg_token_type_D);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x44)
+  {
+    nt = egg_token_new(egg_token_type_D);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[68].success)
+        callback_by_index(&_cbt,
+                          68,
+                          success,
+                          (void *)egg_token_type_D);
 
-  nt = egg_token_new(egg_token_type_D);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      68,
-                      fail,
-                      (void *)egg_token_type_D);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x44)
-  {
+  if (_callbacks[68].fail)
     callback_by_index(&_cbt,
                       68,
-                      success,
+                      fail,
                       (void *)egg_token_type_D);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    68,
-                    fail,
-                    (void *)egg_token_type_D);
-
   return NULL;
 }
 
@@ -4774,52 +4432,44 @@ egg_token *D(void)
 egg_token *E(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    69,
-                    entry,
-                    (void *)egg_token_type_E);
+  if (_callbacks[69].entry)
+    callback_by_index(&_cbt,
+                      69,
+                      entry,
+                      (void *)egg_token_type_E);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x45)
+  {
+    nt = egg_token_new(egg_token_type_E);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[69].success)
+        callback_by_index(&_cbt,
+                          69,
+                          success,
+                          (void *)egg_token_type_E);
 
-  nt = egg_token_new(egg_token_type_E);
-  if (!nt)
-  {
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[69].fail)
     callback_by_index(&_cbt,
                       69,
                       fail,
                       (void *)egg_token_type_E);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if ((input_byte()) == 0x45)
-  {
-    callback_by_index(&_cbt,
-                      69,
-                      success,
-                      (void *)egg_token_type_E);
-
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    69,
-                    fail,
-                    (void *)egg_token_type_E);
 
   return NULL;
 }
@@ -4839,53 +4489,45 @@ egg_token *E(void)
 egg_token *F(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    70,
-                    entry,
-                    (void *)egg_token_type_F);
+  if (_callbacks[70].entry)
+    callback_by_index(&_cbt,
+                      70,
+                      entry,
+                      (void *)egg_token_type_F);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x46)
+  {
+    nt = egg_token_new(egg_token_type_F);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[70].success)
+        callback_by_index(&_cbt,
+                          70,
+                          success,
+                          (void *)egg_token_type_F);
 
-  nt = egg_token_new(egg_token_type_F);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      70,
-                      fail,
-                      (void *)egg_token_type_F);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x46)
-  {
+  if (_callbacks[70].fail)
     callback_by_index(&_cbt,
                       70,
-                      success,
+                      fail,
                       (void *)egg_token_type_F);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    70,
-                    fail,
-                    (void *)egg_token_type_F);
-
   return NULL;
 }
 
@@ -4904,53 +4546,45 @@ egg_token *F(void)
 egg_token *G(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    71,
-                    entry,
-                    (void *)egg_token_type_G);
+  if (_callbacks[71].entry)
+    callback_by_index(&_cbt,
+                      71,
+                      entry,
+                      (void *)egg_token_type_G);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x47)
+  {
+    nt = egg_token_new(egg_token_type_G);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[71].success)
+        callback_by_index(&_cbt,
+                          71,
+                          success,
+                          (void *)egg_token_type_G);
 
-  nt = egg_token_new(egg_token_type_G);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      71,
-                      fail,
-                      (void *)egg_token_type_G);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x47)
-  {
+  if (_callbacks[71].fail)
     callback_by_index(&_cbt,
                       71,
-                      success,
+                      fail,
                       (void *)egg_token_type_G);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    71,
-                    fail,
-                    (void *)egg_token_type_G);
-
   return NULL;
 }
 
@@ -4969,53 +4603,45 @@ egg_token *G(void)
 egg_token *H(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    72,
-                    entry,
-                    (void *)egg_token_type_H);
+  if (_callbacks[72].entry)
+    callback_by_index(&_cbt,
+                      72,
+                      entry,
+                      (void *)egg_token_type_H);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x48)
+  {
+    nt = egg_token_new(egg_token_type_H);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[72].success)
+        callback_by_index(&_cbt,
+                          72,
+                          success,
+                          (void *)egg_token_type_H);
 
-  nt = egg_token_new(egg_token_type_H);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      72,
-                      fail,
-                      (void *)egg_token_type_H);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x48)
-  {
+  if (_callbacks[72].fail)
     callback_by_index(&_cbt,
                       72,
-                      success,
+                      fail,
                       (void *)egg_token_type_H);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    72,
-                    fail,
-                    (void *)egg_token_type_H);
-
   return NULL;
 }
 
@@ -5034,53 +4660,45 @@ egg_token *H(void)
 egg_token *I(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    73,
-                    entry,
-                    (void *)egg_token_type_I);
+  if (_callbacks[73].entry)
+    callback_by_index(&_cbt,
+                      73,
+                      entry,
+                      (void *)egg_token_type_I);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x49)
+  {
+    nt = egg_token_new(egg_token_type_I);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[73].success)
+        callback_by_index(&_cbt,
+                          73,
+                          success,
+                          (void *)egg_token_type_I);
 
-  nt = egg_token_new(egg_token_type_I);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      73,
-                      fail,
-                      (void *)egg_token_type_I);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x49)
-  {
+  if (_callbacks[73].fail)
     callback_by_index(&_cbt,
                       73,
-                      success,
+                      fail,
                       (void *)egg_token_type_I);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    73,
-                    fail,
-                    (void *)egg_token_type_I);
-
   return NULL;
 }
 
@@ -5099,53 +4717,45 @@ egg_token *I(void)
 egg_token *J(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    74,
-                    entry,
-                    (void *)egg_token_type_J);
+  if (_callbacks[74].entry)
+    callback_by_index(&_cbt,
+                      74,
+                      entry,
+                      (void *)egg_token_type_J);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x4A)
+  {
+    nt = egg_token_new(egg_token_type_J);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[74].success)
+        callback_by_index(&_cbt,
+                          74,
+                          success,
+                          (void *)egg_token_type_J);
 
-  nt = egg_token_new(egg_token_type_J);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      74,
-                      fail,
-                      (void *)egg_token_type_J);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x4A)
-  {
+  if (_callbacks[74].fail)
     callback_by_index(&_cbt,
                       74,
-                      success,
+                      fail,
                       (void *)egg_token_type_J);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    74,
-                    fail,
-                    (void *)egg_token_type_J);
-
   return NULL;
 }
 
@@ -5164,53 +4774,45 @@ egg_token *J(void)
 egg_token *K(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    75,
-                    entry,
-                    (void *)egg_token_type_K);
+  if (_callbacks[75].entry)
+    callback_by_index(&_cbt,
+                      75,
+                      entry,
+                      (void *)egg_token_type_K);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x4B)
+  {
+    nt = egg_token_new(egg_token_type_K);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[75].success)
+        callback_by_index(&_cbt,
+                          75,
+                          success,
+                          (void *)egg_token_type_K);
 
-  nt = egg_token_new(egg_token_type_K);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      75,
-                      fail,
-                      (void *)egg_token_type_K);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x4B)
-  {
+  if (_callbacks[75].fail)
     callback_by_index(&_cbt,
                       75,
-                      success,
+                      fail,
                       (void *)egg_token_type_K);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    75,
-                    fail,
-                    (void *)egg_token_type_K);
-
   return NULL;
 }
 
@@ -5229,53 +4831,45 @@ egg_token *K(void)
 egg_token *L(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    76,
-                    entry,
-                    (void *)egg_token_type_L);
+  if (_callbacks[76].entry)
+    callback_by_index(&_cbt,
+                      76,
+                      entry,
+                      (void *)egg_token_type_L);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x4C)
+  {
+    nt = egg_token_new(egg_token_type_L);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[76].success)
+        callback_by_index(&_cbt,
+                          76,
+                          success,
+                          (void *)egg_token_type_L);
 
-  nt = egg_token_new(egg_token_type_L);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      76,
-                      fail,
-                      (void *)egg_token_type_L);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x4C)
-  {
+  if (_callbacks[76].fail)
     callback_by_index(&_cbt,
                       76,
-                      success,
+                      fail,
                       (void *)egg_token_type_L);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    76,
-                    fail,
-                    (void *)egg_token_type_L);
-
   return NULL;
 }
 
@@ -5294,53 +4888,45 @@ egg_token *L(void)
 egg_token *M(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    77,
-                    entry,
-                    (void *)egg_token_type_M);
+  if (_callbacks[77].entry)
+    callback_by_index(&_cbt,
+                      77,
+                      entry,
+                      (void *)egg_token_type_M);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x4D)
+  {
+    nt = egg_token_new(egg_token_type_M);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[77].success)
+        callback_by_index(&_cbt,
+                          77,
+                          success,
+                          (void *)egg_token_type_M);
 
-  nt = egg_token_new(egg_token_type_M);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      77,
-                      fail,
-                      (void *)egg_token_type_M);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x4D)
-  {
+  if (_callbacks[77].fail)
     callback_by_index(&_cbt,
                       77,
-                      success,
+                      fail,
                       (void *)egg_token_type_M);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    77,
-                    fail,
-                    (void *)egg_token_type_M);
-
   return NULL;
 }
 
@@ -5359,52 +4945,44 @@ egg_token *M(void)
 egg_token *N(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    78,
-                    entry,
-                    (void *)egg_token_type_N);
+  if (_callbacks[78].entry)
+    callback_by_index(&_cbt,
+                      78,
+                      entry,
+                      (void *)egg_token_type_N);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x4E)
+  {
+    nt = egg_token_new(egg_token_type_N);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[78].success)
+        callback_by_index(&_cbt,
+                          78,
+                          success,
+                          (void *)egg_token_type_N);
 
-  nt = egg_token_new(egg_token_type_N);
-  if (!nt)
-  {
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[78].fail)
     callback_by_index(&_cbt,
                       78,
                       fail,
                       (void *)egg_token_type_N);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if ((input_byte()) == 0x4E)
-  {
-    callback_by_index(&_cbt,
-                      78,
-                      success,
-                      (void *)egg_token_type_N);
-
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    78,
-                    fail,
-                    (void *)egg_token_type_N);
 
   return NULL;
 }
@@ -5424,53 +5002,45 @@ egg_token *N(void)
 egg_token *O(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    79,
-                    entry,
-                    (void *)egg_token_type_O);
+  if (_callbacks[79].entry)
+    callback_by_index(&_cbt,
+                      79,
+                      entry,
+                      (void *)egg_token_type_O);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x4F)
+  {
+    nt = egg_token_new(egg_token_type_O);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[79].success)
+        callback_by_index(&_cbt,
+                          79,
+                          success,
+                          (void *)egg_token_type_O);
 
-  nt = egg_token_new(egg_token_type_O);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      79,
-                      fail,
-                      (void *)egg_token_type_O);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x4F)
-  {
+  if (_callbacks[79].fail)
     callback_by_index(&_cbt,
                       79,
-                      success,
+                      fail,
                       (void *)egg_token_type_O);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    79,
-                    fail,
-                    (void *)egg_token_type_O);
-
   return NULL;
 }
 
@@ -5489,53 +5059,45 @@ egg_token *O(void)
 egg_token *P(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    80,
-                    entry,
-                    (void *)egg_token_type_P);
+  if (_callbacks[80].entry)
+    callback_by_index(&_cbt,
+                      80,
+                      entry,
+                      (void *)egg_token_type_P);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x50)
+  {
+    nt = egg_token_new(egg_token_type_P);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[80].success)
+        callback_by_index(&_cbt,
+                          80,
+                          success,
+                          (void *)egg_token_type_P);
 
-  nt = egg_token_new(egg_token_type_P);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      80,
-                      fail,
-                      (void *)egg_token_type_P);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x50)
-  {
+  if (_callbacks[80].fail)
     callback_by_index(&_cbt,
                       80,
-                      success,
+                      fail,
                       (void *)egg_token_type_P);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    80,
-                    fail,
-                    (void *)egg_token_type_P);
-
   return NULL;
 }
 
@@ -5554,53 +5116,45 @@ egg_token *P(void)
 egg_token *Q(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    81,
-                    entry,
-                    (void *)egg_token_type_Q);
+  if (_callbacks[81].entry)
+    callback_by_index(&_cbt,
+                      81,
+                      entry,
+                      (void *)egg_token_type_Q);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x51)
+  {
+    nt = egg_token_new(egg_token_type_Q);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[81].success)
+        callback_by_index(&_cbt,
+                          81,
+                          success,
+                          (void *)egg_token_type_Q);
 
-  nt = egg_token_new(egg_token_type_Q);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      81,
-                      fail,
-                      (void *)egg_token_type_Q);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x51)
-  {
+  if (_callbacks[81].fail)
     callback_by_index(&_cbt,
                       81,
-                      success,
+                      fail,
                       (void *)egg_token_type_Q);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    81,
-                    fail,
-                    (void *)egg_token_type_Q);
-
   return NULL;
 }
 
@@ -5619,53 +5173,45 @@ egg_token *Q(void)
 egg_token *R(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    82,
-                    entry,
-                    (void *)egg_token_type_R);
+  if (_callbacks[82].entry)
+    callback_by_index(&_cbt,
+                      82,
+                      entry,
+                      (void *)egg_token_type_R);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x52)
+  {
+    nt = egg_token_new(egg_token_type_R);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[82].success)
+        callback_by_index(&_cbt,
+                          82,
+                          success,
+                          (void *)egg_token_type_R);
 
-  nt = egg_token_new(egg_token_type_R);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      82,
-                      fail,
-                      (void *)egg_token_type_R);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x52)
-  {
+  if (_callbacks[82].fail)
     callback_by_index(&_cbt,
                       82,
-                      success,
+                      fail,
                       (void *)egg_token_type_R);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    82,
-                    fail,
-                    (void *)egg_token_type_R);
-
   return NULL;
 }
 
@@ -5684,53 +5230,45 @@ egg_token *R(void)
 egg_token *S(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    83,
-                    entry,
-                    (void *)egg_token_type_S);
+  if (_callbacks[83].entry)
+    callback_by_index(&_cbt,
+                      83,
+                      entry,
+                      (void *)egg_token_type_S);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x53)
+  {
+    nt = egg_token_new(egg_token_type_S);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[83].success)
+        callback_by_index(&_cbt,
+                          83,
+                          success,
+                          (void *)egg_token_type_S);
 
-  nt = egg_token_new(egg_token_type_S);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      83,
-                      fail,
-                      (void *)egg_token_type_S);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x53)
-  {
+  if (_callbacks[83].fail)
     callback_by_index(&_cbt,
                       83,
-                      success,
+                      fail,
                       (void *)egg_token_type_S);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    83,
-                    fail,
-                    (void *)egg_token_type_S);
-
   return NULL;
 }
 
@@ -5749,53 +5287,45 @@ egg_token *S(void)
 egg_token *T(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    84,
-                    entry,
-                    (void *)egg_token_type_T);
+  if (_callbacks[84].entry)
+    callback_by_index(&_cbt,
+                      84,
+                      entry,
+                      (void *)egg_token_type_T);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x54)
+  {
+    nt = egg_token_new(egg_token_type_T);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[84].success)
+        callback_by_index(&_cbt,
+                          84,
+                          success,
+                          (void *)egg_token_type_T);
 
-  nt = egg_token_new(egg_token_type_T);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      84,
-                      fail,
-                      (void *)egg_token_type_T);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x54)
-  {
+  if (_callbacks[84].fail)
     callback_by_index(&_cbt,
                       84,
-                      success,
+                      fail,
                       (void *)egg_token_type_T);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    84,
-                    fail,
-                    (void *)egg_token_type_T);
-
   return NULL;
 }
 
@@ -5814,53 +5344,45 @@ egg_token *T(void)
 egg_token *U(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    85,
-                    entry,
-                    (void *)egg_token_type_U);
+  if (_callbacks[85].entry)
+    callback_by_index(&_cbt,
+                      85,
+                      entry,
+                      (void *)egg_token_type_U);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x55)
+  {
+    nt = egg_token_new(egg_token_type_U);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[85].success)
+        callback_by_index(&_cbt,
+                          85,
+                          success,
+                          (void *)egg_token_type_U);
 
-  nt = egg_token_new(egg_token_type_U);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      85,
-                      fail,
-                      (void *)egg_token_type_U);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x55)
-  {
+  if (_callbacks[85].fail)
     callback_by_index(&_cbt,
                       85,
-                      success,
+                      fail,
                       (void *)egg_token_type_U);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    85,
-                    fail,
-                    (void *)egg_token_type_U);
-
   return NULL;
 }
 
@@ -5879,53 +5401,45 @@ egg_token *U(void)
 egg_token *V(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    86,
-                    entry,
-                    (void *)egg_token_type_V);
+  if (_callbacks[86].entry)
+    callback_by_index(&_cbt,
+                      86,
+                      entry,
+                      (void *)egg_token_type_V);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x56)
+  {
+    nt = egg_token_new(egg_token_type_V);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[86].success)
+        callback_by_index(&_cbt,
+                          86,
+                          success,
+                          (void *)egg_token_type_V);
 
-  nt = egg_token_new(egg_token_type_V);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      86,
-                      fail,
-                      (void *)egg_token_type_V);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x56)
-  {
+  if (_callbacks[86].fail)
     callback_by_index(&_cbt,
                       86,
-                      success,
+                      fail,
                       (void *)egg_token_type_V);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    86,
-                    fail,
-                    (void *)egg_token_type_V);
-
   return NULL;
 }
 
@@ -5944,52 +5458,44 @@ egg_token *V(void)
 egg_token *W(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    87,
-                    entry,
-                    (void *)egg_token_type_W);
+  if (_callbacks[87].entry)
+    callback_by_index(&_cbt,
+                      87,
+                      entry,
+                      (void *)egg_token_type_W);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x57)
+  {
+    nt = egg_token_new(egg_token_type_W);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[87].success)
+        callback_by_index(&_cbt,
+                          87,
+                          success,
+                          (void *)egg_token_type_W);
 
-  nt = egg_token_new(egg_token_type_W);
-  if (!nt)
-  {
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[87].fail)
     callback_by_index(&_cbt,
                       87,
                       fail,
                       (void *)egg_token_type_W);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if ((input_byte()) == 0x57)
-  {
-    callback_by_index(&_cbt,
-                      87,
-                      success,
-                      (void *)egg_token_type_W);
-
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    87,
-                    fail,
-                    (void *)egg_token_type_W);
 
   return NULL;
 }
@@ -6009,53 +5515,45 @@ egg_token *W(void)
 egg_token *X(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    88,
-                    entry,
-                    (void *)egg_token_type_X);
+  if (_callbacks[88].entry)
+    callback_by_index(&_cbt,
+                      88,
+                      entry,
+                      (void *)egg_token_type_X);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x58)
+  {
+    nt = egg_token_new(egg_token_type_X);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[88].success)
+        callback_by_index(&_cbt,
+                          88,
+                          success,
+                          (void *)egg_token_type_X);
 
-  nt = egg_token_new(egg_token_type_X);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      88,
-                      fail,
-                      (void *)egg_token_type_X);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x58)
-  {
+  if (_callbacks[88].fail)
     callback_by_index(&_cbt,
                       88,
-                      success,
+                      fail,
                       (void *)egg_token_type_X);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    88,
-                    fail,
-                    (void *)egg_token_type_X);
-
   return NULL;
 }
 
@@ -6074,53 +5572,45 @@ egg_token *X(void)
 egg_token *Y(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    89,
-                    entry,
-                    (void *)egg_token_type_Y);
+  if (_callbacks[89].entry)
+    callback_by_index(&_cbt,
+                      89,
+                      entry,
+                      (void *)egg_token_type_Y);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x59)
+  {
+    nt = egg_token_new(egg_token_type_Y);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[89].success)
+        callback_by_index(&_cbt,
+                          89,
+                          success,
+                          (void *)egg_token_type_Y);
 
-  nt = egg_token_new(egg_token_type_Y);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      89,
-                      fail,
-                      (void *)egg_token_type_Y);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x59)
-  {
+  if (_callbacks[89].fail)
     callback_by_index(&_cbt,
                       89,
-                      success,
+                      fail,
                       (void *)egg_token_type_Y);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    89,
-                    fail,
-                    (void *)egg_token_type_Y);
-
   return NULL;
 }
 
@@ -6139,53 +5629,45 @@ egg_token *Y(void)
 egg_token *Z(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    90,
-                    entry,
-                    (void *)egg_token_type_Z);
+  if (_callbacks[90].entry)
+    callback_by_index(&_cbt,
+                      90,
+                      entry,
+                      (void *)egg_token_type_Z);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x5A)
+  {
+    nt = egg_token_new(egg_token_type_Z);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[90].success)
+        callback_by_index(&_cbt,
+                          90,
+                          success,
+                          (void *)egg_token_type_Z);
 
-  nt = egg_token_new(egg_token_type_Z);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      90,
-                      fail,
-                      (void *)egg_token_type_Z);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x5A)
-  {
+  if (_callbacks[90].fail)
     callback_by_index(&_cbt,
                       90,
-                      success,
+                      fail,
                       (void *)egg_token_type_Z);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    90,
-                    fail,
-                    (void *)egg_token_type_Z);
-
   return NULL;
 }
 
@@ -6204,53 +5686,45 @@ egg_token *Z(void)
 egg_token *open_bracket(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    91,
-                    entry,
-                    (void *)egg_token_type_open_bracket);
+  if (_callbacks[91].entry)
+    callback_by_index(&_cbt,
+                      91,
+                      entry,
+                      (void *)egg_token_type_open_bracket);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x5B)
+  {
+    nt = egg_token_new(egg_token_type_open_bracket);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[91].success)
+        callback_by_index(&_cbt,
+                          91,
+                          success,
+                          (void *)egg_token_type_open_bracket);
 
-  nt = egg_token_new(egg_token_type_open_bracket);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      91,
-                      fail,
-                      (void *)egg_token_type_open_bracket);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x5B)
-  {
+  if (_callbacks[91].fail)
     callback_by_index(&_cbt,
                       91,
-                      success,
+                      fail,
                       (void *)egg_token_type_open_bracket);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    91,
-                    fail,
-                    (void *)egg_token_type_open_bracket);
-
   return NULL;
 }
 
@@ -6269,53 +5743,45 @@ egg_token *open_bracket(void)
 egg_token *back_slash(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    92,
-                    entry,
-                    (void *)egg_token_type_back_slash);
+  if (_callbacks[92].entry)
+    callback_by_index(&_cbt,
+                      92,
+                      entry,
+                      (void *)egg_token_type_back_slash);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x5C)
+  {
+    nt = egg_token_new(egg_token_type_back_slash);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[92].success)
+        callback_by_index(&_cbt,
+                          92,
+                          success,
+                          (void *)egg_token_type_back_slash);
 
-  nt = egg_token_new(egg_token_type_back_slash);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      92,
-                      fail,
-                      (void *)egg_token_type_back_slash);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x5C)
-  {
+  if (_callbacks[92].fail)
     callback_by_index(&_cbt,
                       92,
-                      success,
+                      fail,
                       (void *)egg_token_type_back_slash);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    92,
-                    fail,
-                    (void *)egg_token_type_back_slash);
-
   return NULL;
 }
 
@@ -6334,53 +5800,45 @@ egg_token *back_slash(void)
 egg_token *close_bracket(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    93,
-                    entry,
-                    (void *)egg_token_type_close_bracket);
+  if (_callbacks[93].entry)
+    callback_by_index(&_cbt,
+                      93,
+                      entry,
+                      (void *)egg_token_type_close_bracket);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x5D)
+  {
+    nt = egg_token_new(egg_token_type_close_bracket);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[93].success)
+        callback_by_index(&_cbt,
+                          93,
+                          success,
+                          (void *)egg_token_type_close_bracket);
 
-  nt = egg_token_new(egg_token_type_close_bracket);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      93,
-                      fail,
-                      (void *)egg_token_type_close_bracket);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x5D)
-  {
+  if (_callbacks[93].fail)
     callback_by_index(&_cbt,
                       93,
-                      success,
+                      fail,
                       (void *)egg_token_type_close_bracket);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    93,
-                    fail,
-                    (void *)egg_token_type_close_bracket);
-
   return NULL;
 }
 
@@ -6399,53 +5857,45 @@ egg_token *close_bracket(void)
 egg_token *carat(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    94,
-                    entry,
-                    (void *)egg_token_type_carat);
+  if (_callbacks[94].entry)
+    callback_by_index(&_cbt,
+                      94,
+                      entry,
+                      (void *)egg_token_type_carat);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x5E)
+  {
+    nt = egg_token_new(egg_token_type_carat);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[94].success)
+        callback_by_index(&_cbt,
+                          94,
+                          success,
+                          (void *)egg_token_type_carat);
 
-  nt = egg_token_new(egg_token_type_carat);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      94,
-                      fail,
-                      (void *)egg_token_type_carat);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x5E)
-  {
+  if (_callbacks[94].fail)
     callback_by_index(&_cbt,
                       94,
-                      success,
+                      fail,
                       (void *)egg_token_type_carat);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    94,
-                    fail,
-                    (void *)egg_token_type_carat);
-
   return NULL;
 }
 
@@ -6464,53 +5914,45 @@ egg_token *carat(void)
 egg_token *underscore(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    95,
-                    entry,
-                    (void *)egg_token_type_underscore);
+  if (_callbacks[95].entry)
+    callback_by_index(&_cbt,
+                      95,
+                      entry,
+                      (void *)egg_token_type_underscore);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x5F)
+  {
+    nt = egg_token_new(egg_token_type_underscore);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[95].success)
+        callback_by_index(&_cbt,
+                          95,
+                          success,
+                          (void *)egg_token_type_underscore);
 
-  nt = egg_token_new(egg_token_type_underscore);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      95,
-                      fail,
-                      (void *)egg_token_type_underscore);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x5F)
-  {
+  if (_callbacks[95].fail)
     callback_by_index(&_cbt,
                       95,
-                      success,
+                      fail,
                       (void *)egg_token_type_underscore);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    95,
-                    fail,
-                    (void *)egg_token_type_underscore);
-
   return NULL;
 }
 
@@ -6529,52 +5971,44 @@ egg_token *underscore(void)
 egg_token *back_quote(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    96,
-                    entry,
-                    (void *)egg_token_type_back_quote);
+  if (_callbacks[96].entry)
+    callback_by_index(&_cbt,
+                      96,
+                      entry,
+                      (void *)egg_token_type_back_quote);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x60)
+  {
+    nt = egg_token_new(egg_token_type_back_quote);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[96].success)
+        callback_by_index(&_cbt,
+                          96,
+                          success,
+                          (void *)egg_token_type_back_quote);
 
-  nt = egg_token_new(egg_token_type_back_quote);
-  if (!nt)
-  {
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[96].fail)
     callback_by_index(&_cbt,
                       96,
                       fail,
                       (void *)egg_token_type_back_quote);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if ((input_byte()) == 0x60)
-  {
-    callback_by_index(&_cbt,
-                      96,
-                      success,
-                      (void *)egg_token_type_back_quote);
-
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    96,
-                    fail,
-                    (void *)egg_token_type_back_quote);
 
   return NULL;
 }
@@ -6594,53 +6028,45 @@ egg_token *back_quote(void)
 egg_token *a(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    97,
-                    entry,
-                    (void *)egg_token_type_a);
+  if (_callbacks[97].entry)
+    callback_by_index(&_cbt,
+                      97,
+                      entry,
+                      (void *)egg_token_type_a);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x61)
+  {
+    nt = egg_token_new(egg_token_type_a);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[97].success)
+        callback_by_index(&_cbt,
+                          97,
+                          success,
+                          (void *)egg_token_type_a);
 
-  nt = egg_token_new(egg_token_type_a);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      97,
-                      fail,
-                      (void *)egg_token_type_a);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x61)
-  {
+  if (_callbacks[97].fail)
     callback_by_index(&_cbt,
                       97,
-                      success,
+                      fail,
                       (void *)egg_token_type_a);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    97,
-                    fail,
-                    (void *)egg_token_type_a);
-
   return NULL;
 }
 
@@ -6659,53 +6085,45 @@ egg_token *a(void)
 egg_token *b(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    98,
-                    entry,
-                    (void *)egg_token_type_b);
+  if (_callbacks[98].entry)
+    callback_by_index(&_cbt,
+                      98,
+                      entry,
+                      (void *)egg_token_type_b);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x62)
+  {
+    nt = egg_token_new(egg_token_type_b);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[98].success)
+        callback_by_index(&_cbt,
+                          98,
+                          success,
+                          (void *)egg_token_type_b);
 
-  nt = egg_token_new(egg_token_type_b);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      98,
-                      fail,
-                      (void *)egg_token_type_b);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x62)
-  {
+  if (_callbacks[98].fail)
     callback_by_index(&_cbt,
                       98,
-                      success,
+                      fail,
                       (void *)egg_token_type_b);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    98,
-                    fail,
-                    (void *)egg_token_type_b);
-
   return NULL;
 }
 
@@ -6724,53 +6142,45 @@ egg_token *b(void)
 egg_token *c(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    99,
-                    entry,
-                    (void *)egg_token_type_c);
+  if (_callbacks[99].entry)
+    callback_by_index(&_cbt,
+                      99,
+                      entry,
+                      (void *)egg_token_type_c);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x63)
+  {
+    nt = egg_token_new(egg_token_type_c);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[99].success)
+        callback_by_index(&_cbt,
+                          99,
+                          success,
+                          (void *)egg_token_type_c);
 
-  nt = egg_token_new(egg_token_type_c);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      99,
-                      fail,
-                      (void *)egg_token_type_c);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x63)
-  {
+  if (_callbacks[99].fail)
     callback_by_index(&_cbt,
                       99,
-                      success,
+                      fail,
                       (void *)egg_token_type_c);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    99,
-                    fail,
-                    (void *)egg_token_type_c);
-
   return NULL;
 }
 
@@ -6789,53 +6199,45 @@ egg_token *c(void)
 egg_token *d(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    100,
-                    entry,
-                    (void *)egg_token_type_d);
+  if (_callbacks[100].entry)
+    callback_by_index(&_cbt,
+                      100,
+                      entry,
+                      (void *)egg_token_type_d);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x64)
+  {
+    nt = egg_token_new(egg_token_type_d);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[100].success)
+        callback_by_index(&_cbt,
+                          100,
+                          success,
+                          (void *)egg_token_type_d);
 
-  nt = egg_token_new(egg_token_type_d);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      100,
-                      fail,
-                      (void *)egg_token_type_d);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x64)
-  {
+  if (_callbacks[100].fail)
     callback_by_index(&_cbt,
                       100,
-                      success,
+                      fail,
                       (void *)egg_token_type_d);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    100,
-                    fail,
-                    (void *)egg_token_type_d);
-
   return NULL;
 }
 
@@ -6854,53 +6256,45 @@ egg_token *d(void)
 egg_token *e(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    101,
-                    entry,
-                    (void *)egg_token_type_e);
+  if (_callbacks[101].entry)
+    callback_by_index(&_cbt,
+                      101,
+                      entry,
+                      (void *)egg_token_type_e);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x65)
+  {
+    nt = egg_token_new(egg_token_type_e);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[101].success)
+        callback_by_index(&_cbt,
+                          101,
+                          success,
+                          (void *)egg_token_type_e);
 
-  nt = egg_token_new(egg_token_type_e);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      101,
-                      fail,
-                      (void *)egg_token_type_e);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x65)
-  {
+  if (_callbacks[101].fail)
     callback_by_index(&_cbt,
                       101,
-                      success,
+                      fail,
                       (void *)egg_token_type_e);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    101,
-                    fail,
-                    (void *)egg_token_type_e);
-
   return NULL;
 }
 
@@ -6919,53 +6313,45 @@ egg_token *e(void)
 egg_token *f(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    102,
-                    entry,
-                    (void *)egg_token_type_f);
+  if (_callbacks[102].entry)
+    callback_by_index(&_cbt,
+                      102,
+                      entry,
+                      (void *)egg_token_type_f);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x66)
+  {
+    nt = egg_token_new(egg_token_type_f);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[102].success)
+        callback_by_index(&_cbt,
+                          102,
+                          success,
+                          (void *)egg_token_type_f);
 
-  nt = egg_token_new(egg_token_type_f);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      102,
-                      fail,
-                      (void *)egg_token_type_f);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x66)
-  {
+  if (_callbacks[102].fail)
     callback_by_index(&_cbt,
                       102,
-                      success,
+                      fail,
                       (void *)egg_token_type_f);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    102,
-                    fail,
-                    (void *)egg_token_type_f);
-
   return NULL;
 }
 
@@ -6984,53 +6370,45 @@ egg_token *f(void)
 egg_token *g(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    103,
-                    entry,
-                    (void *)egg_token_type_g);
+  if (_callbacks[103].entry)
+    callback_by_index(&_cbt,
+                      103,
+                      entry,
+                      (void *)egg_token_type_g);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x67)
+  {
+    nt = egg_token_new(egg_token_type_g);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[103].success)
+        callback_by_index(&_cbt,
+                          103,
+                          success,
+                          (void *)egg_token_type_g);
 
-  nt = egg_token_new(egg_token_type_g);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      103,
-                      fail,
-                      (void *)egg_token_type_g);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x67)
-  {
+  if (_callbacks[103].fail)
     callback_by_index(&_cbt,
                       103,
-                      success,
+                      fail,
                       (void *)egg_token_type_g);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    103,
-                    fail,
-                    (void *)egg_token_type_g);
-
   return NULL;
 }
 
@@ -7049,53 +6427,45 @@ egg_token *g(void)
 egg_token *h(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    104,
-                    entry,
-                    (void *)egg_token_type_h);
+  if (_callbacks[104].entry)
+    callback_by_index(&_cbt,
+                      104,
+                      entry,
+                      (void *)egg_token_type_h);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x68)
+  {
+    nt = egg_token_new(egg_token_type_h);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[104].success)
+        callback_by_index(&_cbt,
+                          104,
+                          success,
+                          (void *)egg_token_type_h);
 
-  nt = egg_token_new(egg_token_type_h);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      104,
-                      fail,
-                      (void *)egg_token_type_h);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x68)
-  {
+  if (_callbacks[104].fail)
     callback_by_index(&_cbt,
                       104,
-                      success,
+                      fail,
                       (void *)egg_token_type_h);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    104,
-                    fail,
-                    (void *)egg_token_type_h);
-
   return NULL;
 }
 
@@ -7114,52 +6484,44 @@ egg_token *h(void)
 egg_token *i(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    105,
-                    entry,
-                    (void *)egg_token_type_i);
+  if (_callbacks[105].entry)
+    callback_by_index(&_cbt,
+                      105,
+                      entry,
+                      (void *)egg_token_type_i);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x69)
+  {
+    nt = egg_token_new(egg_token_type_i);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[105].success)
+        callback_by_index(&_cbt,
+                          105,
+                          success,
+                          (void *)egg_token_type_i);
 
-  nt = egg_token_new(egg_token_type_i);
-  if (!nt)
-  {
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[105].fail)
     callback_by_index(&_cbt,
                       105,
                       fail,
                       (void *)egg_token_type_i);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if ((input_byte()) == 0x69)
-  {
-    callback_by_index(&_cbt,
-                      105,
-                      success,
-                      (void *)egg_token_type_i);
-
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    105,
-                    fail,
-                    (void *)egg_token_type_i);
 
   return NULL;
 }
@@ -7179,53 +6541,45 @@ egg_token *i(void)
 egg_token *j(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    106,
-                    entry,
-                    (void *)egg_token_type_j);
+  if (_callbacks[106].entry)
+    callback_by_index(&_cbt,
+                      106,
+                      entry,
+                      (void *)egg_token_type_j);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x6A)
+  {
+    nt = egg_token_new(egg_token_type_j);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[106].success)
+        callback_by_index(&_cbt,
+                          106,
+                          success,
+                          (void *)egg_token_type_j);
 
-  nt = egg_token_new(egg_token_type_j);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      106,
-                      fail,
-                      (void *)egg_token_type_j);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x6A)
-  {
+  if (_callbacks[106].fail)
     callback_by_index(&_cbt,
                       106,
-                      success,
+                      fail,
                       (void *)egg_token_type_j);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    106,
-                    fail,
-                    (void *)egg_token_type_j);
-
   return NULL;
 }
 
@@ -7244,53 +6598,45 @@ egg_token *j(void)
 egg_token *k(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    107,
-                    entry,
-                    (void *)egg_token_type_k);
+  if (_callbacks[107].entry)
+    callback_by_index(&_cbt,
+                      107,
+                      entry,
+                      (void *)egg_token_type_k);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x6B)
+  {
+    nt = egg_token_new(egg_token_type_k);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[107].success)
+        callback_by_index(&_cbt,
+                          107,
+                          success,
+                          (void *)egg_token_type_k);
 
-  nt = egg_token_new(egg_token_type_k);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      107,
-                      fail,
-                      (void *)egg_token_type_k);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x6B)
-  {
+  if (_callbacks[107].fail)
     callback_by_index(&_cbt,
                       107,
-                      success,
+                      fail,
                       (void *)egg_token_type_k);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    107,
-                    fail,
-                    (void *)egg_token_type_k);
-
   return NULL;
 }
 
@@ -7309,53 +6655,45 @@ egg_token *k(void)
 egg_token *l(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    108,
-                    entry,
-                    (void *)egg_token_type_l);
+  if (_callbacks[108].entry)
+    callback_by_index(&_cbt,
+                      108,
+                      entry,
+                      (void *)egg_token_type_l);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x6C)
+  {
+    nt = egg_token_new(egg_token_type_l);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[108].success)
+        callback_by_index(&_cbt,
+                          108,
+                          success,
+                          (void *)egg_token_type_l);
 
-  nt = egg_token_new(egg_token_type_l);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      108,
-                      fail,
-                      (void *)egg_token_type_l);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x6C)
-  {
+  if (_callbacks[108].fail)
     callback_by_index(&_cbt,
                       108,
-                      success,
+                      fail,
                       (void *)egg_token_type_l);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    108,
-                    fail,
-                    (void *)egg_token_type_l);
-
   return NULL;
 }
 
@@ -7374,53 +6712,45 @@ egg_token *l(void)
 egg_token *m(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    109,
-                    entry,
-                    (void *)egg_token_type_m);
+  if (_callbacks[109].entry)
+    callback_by_index(&_cbt,
+                      109,
+                      entry,
+                      (void *)egg_token_type_m);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x6D)
+  {
+    nt = egg_token_new(egg_token_type_m);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[109].success)
+        callback_by_index(&_cbt,
+                          109,
+                          success,
+                          (void *)egg_token_type_m);
 
-  nt = egg_token_new(egg_token_type_m);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      109,
-                      fail,
-                      (void *)egg_token_type_m);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x6D)
-  {
+  if (_callbacks[109].fail)
     callback_by_index(&_cbt,
                       109,
-                      success,
+                      fail,
                       (void *)egg_token_type_m);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    109,
-                    fail,
-                    (void *)egg_token_type_m);
-
   return NULL;
 }
 
@@ -7439,53 +6769,45 @@ egg_token *m(void)
 egg_token *n(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    110,
-                    entry,
-                    (void *)egg_token_type_n);
+  if (_callbacks[110].entry)
+    callback_by_index(&_cbt,
+                      110,
+                      entry,
+                      (void *)egg_token_type_n);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x6E)
+  {
+    nt = egg_token_new(egg_token_type_n);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[110].success)
+        callback_by_index(&_cbt,
+                          110,
+                          success,
+                          (void *)egg_token_type_n);
 
-  nt = egg_token_new(egg_token_type_n);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      110,
-                      fail,
-                      (void *)egg_token_type_n);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x6E)
-  {
+  if (_callbacks[110].fail)
     callback_by_index(&_cbt,
                       110,
-                      success,
+                      fail,
                       (void *)egg_token_type_n);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    110,
-                    fail,
-                    (void *)egg_token_type_n);
-
   return NULL;
 }
 
@@ -7504,53 +6826,45 @@ egg_token *n(void)
 egg_token *o(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    111,
-                    entry,
-                    (void *)egg_token_type_o);
+  if (_callbacks[111].entry)
+    callback_by_index(&_cbt,
+                      111,
+                      entry,
+                      (void *)egg_token_type_o);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x6F)
+  {
+    nt = egg_token_new(egg_token_type_o);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[111].success)
+        callback_by_index(&_cbt,
+                          111,
+                          success,
+                          (void *)egg_token_type_o);
 
-  nt = egg_token_new(egg_token_type_o);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      111,
-                      fail,
-                      (void *)egg_token_type_o);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x6F)
-  {
+  if (_callbacks[111].fail)
     callback_by_index(&_cbt,
                       111,
-                      success,
+                      fail,
                       (void *)egg_token_type_o);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    111,
-                    fail,
-                    (void *)egg_token_type_o);
-
   return NULL;
 }
 
@@ -7569,53 +6883,45 @@ egg_token *o(void)
 egg_token *p(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    112,
-                    entry,
-                    (void *)egg_token_type_p);
+  if (_callbacks[112].entry)
+    callback_by_index(&_cbt,
+                      112,
+                      entry,
+                      (void *)egg_token_type_p);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x70)
+  {
+    nt = egg_token_new(egg_token_type_p);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[112].success)
+        callback_by_index(&_cbt,
+                          112,
+                          success,
+                          (void *)egg_token_type_p);
 
-  nt = egg_token_new(egg_token_type_p);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      112,
-                      fail,
-                      (void *)egg_token_type_p);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x70)
-  {
+  if (_callbacks[112].fail)
     callback_by_index(&_cbt,
                       112,
-                      success,
+                      fail,
                       (void *)egg_token_type_p);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    112,
-                    fail,
-                    (void *)egg_token_type_p);
-
   return NULL;
 }
 
@@ -7634,53 +6940,45 @@ egg_token *p(void)
 egg_token *q(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    113,
-                    entry,
-                    (void *)egg_token_type_q);
+  if (_callbacks[113].entry)
+    callback_by_index(&_cbt,
+                      113,
+                      entry,
+                      (void *)egg_token_type_q);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x71)
+  {
+    nt = egg_token_new(egg_token_type_q);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[113].success)
+        callback_by_index(&_cbt,
+                          113,
+                          success,
+                          (void *)egg_token_type_q);
 
-  nt = egg_token_new(egg_token_type_q);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      113,
-                      fail,
-                      (void *)egg_token_type_q);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x71)
-  {
+  if (_callbacks[113].fail)
     callback_by_index(&_cbt,
                       113,
-                      success,
+                      fail,
                       (void *)egg_token_type_q);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    113,
-                    fail,
-                    (void *)egg_token_type_q);
-
   return NULL;
 }
 
@@ -7699,52 +6997,44 @@ egg_token *q(void)
 egg_token *r(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    114,
-                    entry,
-                    (void *)egg_token_type_r);
+  if (_callbacks[114].entry)
+    callback_by_index(&_cbt,
+                      114,
+                      entry,
+                      (void *)egg_token_type_r);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x72)
+  {
+    nt = egg_token_new(egg_token_type_r);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[114].success)
+        callback_by_index(&_cbt,
+                          114,
+                          success,
+                          (void *)egg_token_type_r);
 
-  nt = egg_token_new(egg_token_type_r);
-  if (!nt)
-  {
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[114].fail)
     callback_by_index(&_cbt,
                       114,
                       fail,
                       (void *)egg_token_type_r);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if ((input_byte()) == 0x72)
-  {
-    callback_by_index(&_cbt,
-                      114,
-                      success,
-                      (void *)egg_token_type_r);
-
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    114,
-                    fail,
-                    (void *)egg_token_type_r);
 
   return NULL;
 }
@@ -7764,53 +7054,45 @@ egg_token *r(void)
 egg_token *s(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    115,
-                    entry,
-                    (void *)egg_token_type_s);
+  if (_callbacks[115].entry)
+    callback_by_index(&_cbt,
+                      115,
+                      entry,
+                      (void *)egg_token_type_s);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x73)
+  {
+    nt = egg_token_new(egg_token_type_s);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[115].success)
+        callback_by_index(&_cbt,
+                          115,
+                          success,
+                          (void *)egg_token_type_s);
 
-  nt = egg_token_new(egg_token_type_s);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      115,
-                      fail,
-                      (void *)egg_token_type_s);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x73)
-  {
+  if (_callbacks[115].fail)
     callback_by_index(&_cbt,
                       115,
-                      success,
+                      fail,
                       (void *)egg_token_type_s);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    115,
-                    fail,
-                    (void *)egg_token_type_s);
-
   return NULL;
 }
 
@@ -7829,53 +7111,45 @@ egg_token *s(void)
 egg_token *t(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    116,
-                    entry,
-                    (void *)egg_token_type_t);
+  if (_callbacks[116].entry)
+    callback_by_index(&_cbt,
+                      116,
+                      entry,
+                      (void *)egg_token_type_t);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x74)
+  {
+    nt = egg_token_new(egg_token_type_t);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[116].success)
+        callback_by_index(&_cbt,
+                          116,
+                          success,
+                          (void *)egg_token_type_t);
 
-  nt = egg_token_new(egg_token_type_t);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      116,
-                      fail,
-                      (void *)egg_token_type_t);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x74)
-  {
+  if (_callbacks[116].fail)
     callback_by_index(&_cbt,
                       116,
-                      success,
+                      fail,
                       (void *)egg_token_type_t);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    116,
-                    fail,
-                    (void *)egg_token_type_t);
-
   return NULL;
 }
 
@@ -7894,53 +7168,45 @@ egg_token *t(void)
 egg_token *u(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    117,
-                    entry,
-                    (void *)egg_token_type_u);
+  if (_callbacks[117].entry)
+    callback_by_index(&_cbt,
+                      117,
+                      entry,
+                      (void *)egg_token_type_u);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x75)
+  {
+    nt = egg_token_new(egg_token_type_u);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[117].success)
+        callback_by_index(&_cbt,
+                          117,
+                          success,
+                          (void *)egg_token_type_u);
 
-  nt = egg_token_new(egg_token_type_u);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      117,
-                      fail,
-                      (void *)egg_token_type_u);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x75)
-  {
+  if (_callbacks[117].fail)
     callback_by_index(&_cbt,
                       117,
-                      success,
+                      fail,
                       (void *)egg_token_type_u);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    117,
-                    fail,
-                    (void *)egg_token_type_u);
-
   return NULL;
 }
 
@@ -7959,53 +7225,45 @@ egg_token *u(void)
 egg_token *v(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    118,
-                    entry,
-                    (void *)egg_token_type_v);
+  if (_callbacks[118].entry)
+    callback_by_index(&_cbt,
+                      118,
+                      entry,
+                      (void *)egg_token_type_v);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x76)
+  {
+    nt = egg_token_new(egg_token_type_v);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[118].success)
+        callback_by_index(&_cbt,
+                          118,
+                          success,
+                          (void *)egg_token_type_v);
 
-  nt = egg_token_new(egg_token_type_v);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      118,
-                      fail,
-                      (void *)egg_token_type_v);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x76)
-  {
+  if (_callbacks[118].fail)
     callback_by_index(&_cbt,
                       118,
-                      success,
+                      fail,
                       (void *)egg_token_type_v);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    118,
-                    fail,
-                    (void *)egg_token_type_v);
-
   return NULL;
 }
 
@@ -8024,53 +7282,45 @@ egg_token *v(void)
 egg_token *w(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    119,
-                    entry,
-                    (void *)egg_token_type_w);
+  if (_callbacks[119].entry)
+    callback_by_index(&_cbt,
+                      119,
+                      entry,
+                      (void *)egg_token_type_w);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x77)
+  {
+    nt = egg_token_new(egg_token_type_w);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[119].success)
+        callback_by_index(&_cbt,
+                          119,
+                          success,
+                          (void *)egg_token_type_w);
 
-  nt = egg_token_new(egg_token_type_w);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      119,
-                      fail,
-                      (void *)egg_token_type_w);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x77)
-  {
+  if (_callbacks[119].fail)
     callback_by_index(&_cbt,
                       119,
-                      success,
+                      fail,
                       (void *)egg_token_type_w);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    119,
-                    fail,
-                    (void *)egg_token_type_w);
-
   return NULL;
 }
 
@@ -8089,53 +7339,45 @@ egg_token *w(void)
 egg_token *x(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    120,
-                    entry,
-                    (void *)egg_token_type_x);
+  if (_callbacks[120].entry)
+    callback_by_index(&_cbt,
+                      120,
+                      entry,
+                      (void *)egg_token_type_x);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x78)
+  {
+    nt = egg_token_new(egg_token_type_x);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[120].success)
+        callback_by_index(&_cbt,
+                          120,
+                          success,
+                          (void *)egg_token_type_x);
 
-  nt = egg_token_new(egg_token_type_x);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      120,
-                      fail,
-                      (void *)egg_token_type_x);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x78)
-  {
+  if (_callbacks[120].fail)
     callback_by_index(&_cbt,
                       120,
-                      success,
+                      fail,
                       (void *)egg_token_type_x);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    120,
-                    fail,
-                    (void *)egg_token_type_x);
-
   return NULL;
 }
 
@@ -8154,53 +7396,45 @@ egg_token *x(void)
 egg_token *y(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    121,
-                    entry,
-                    (void *)egg_token_type_y);
+  if (_callbacks[121].entry)
+    callback_by_index(&_cbt,
+                      121,
+                      entry,
+                      (void *)egg_token_type_y);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x79)
+  {
+    nt = egg_token_new(egg_token_type_y);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[121].success)
+        callback_by_index(&_cbt,
+                          121,
+                          success,
+                          (void *)egg_token_type_y);
 
-  nt = egg_token_new(egg_token_type_y);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      121,
-                      fail,
-                      (void *)egg_token_type_y);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x79)
-  {
+  if (_callbacks[121].fail)
     callback_by_index(&_cbt,
                       121,
-                      success,
+                      fail,
                       (void *)egg_token_type_y);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    121,
-                    fail,
-                    (void *)egg_token_type_y);
-
   return NULL;
 }
 
@@ -8219,53 +7453,45 @@ egg_token *y(void)
 egg_token *z(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    122,
-                    entry,
-                    (void *)egg_token_type_z);
+  if (_callbacks[122].entry)
+    callback_by_index(&_cbt,
+                      122,
+                      entry,
+                      (void *)egg_token_type_z);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x7A)
+  {
+    nt = egg_token_new(egg_token_type_z);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[122].success)
+        callback_by_index(&_cbt,
+                          122,
+                          success,
+                          (void *)egg_token_type_z);
 
-  nt = egg_token_new(egg_token_type_z);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      122,
-                      fail,
-                      (void *)egg_token_type_z);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x7A)
-  {
+  if (_callbacks[122].fail)
     callback_by_index(&_cbt,
                       122,
-                      success,
+                      fail,
                       (void *)egg_token_type_z);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    122,
-                    fail,
-                    (void *)egg_token_type_z);
-
   return NULL;
 }
 
@@ -8284,52 +7510,44 @@ egg_token *z(void)
 egg_token *open_brace(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    123,
-                    entry,
-                    (void *)egg_token_type_open_brace);
+  if (_callbacks[123].entry)
+    callback_by_index(&_cbt,
+                      123,
+                      entry,
+                      (void *)egg_token_type_open_brace);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x7B)
+  {
+    nt = egg_token_new(egg_token_type_open_brace);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[123].success)
+        callback_by_index(&_cbt,
+                          123,
+                          success,
+                          (void *)egg_token_type_open_brace);
 
-  nt = egg_token_new(egg_token_type_open_brace);
-  if (!nt)
-  {
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[123].fail)
     callback_by_index(&_cbt,
                       123,
                       fail,
                       (void *)egg_token_type_open_brace);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if ((input_byte()) == 0x7B)
-  {
-    callback_by_index(&_cbt,
-                      123,
-                      success,
-                      (void *)egg_token_type_open_brace);
-
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    123,
-                    fail,
-                    (void *)egg_token_type_open_brace);
 
   return NULL;
 }
@@ -8349,53 +7567,45 @@ egg_token *open_brace(void)
 egg_token *bar(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    124,
-                    entry,
-                    (void *)egg_token_type_bar);
+  if (_callbacks[124].entry)
+    callback_by_index(&_cbt,
+                      124,
+                      entry,
+                      (void *)egg_token_type_bar);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x7C)
+  {
+    nt = egg_token_new(egg_token_type_bar);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[124].success)
+        callback_by_index(&_cbt,
+                          124,
+                          success,
+                          (void *)egg_token_type_bar);
 
-  nt = egg_token_new(egg_token_type_bar);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      124,
-                      fail,
-                      (void *)egg_token_type_bar);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x7C)
-  {
+  if (_callbacks[124].fail)
     callback_by_index(&_cbt,
                       124,
-                      success,
+                      fail,
                       (void *)egg_token_type_bar);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    124,
-                    fail,
-                    (void *)egg_token_type_bar);
-
   return NULL;
 }
 
@@ -8414,53 +7624,45 @@ egg_token *bar(void)
 egg_token *close_brace(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    125,
-                    entry,
-                    (void *)egg_token_type_close_brace);
+  if (_callbacks[125].entry)
+    callback_by_index(&_cbt,
+                      125,
+                      entry,
+                      (void *)egg_token_type_close_brace);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x7D)
+  {
+    nt = egg_token_new(egg_token_type_close_brace);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[125].success)
+        callback_by_index(&_cbt,
+                          125,
+                          success,
+                          (void *)egg_token_type_close_brace);
 
-  nt = egg_token_new(egg_token_type_close_brace);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      125,
-                      fail,
-                      (void *)egg_token_type_close_brace);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x7D)
-  {
+  if (_callbacks[125].fail)
     callback_by_index(&_cbt,
                       125,
-                      success,
+                      fail,
                       (void *)egg_token_type_close_brace);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    125,
-                    fail,
-                    (void *)egg_token_type_close_brace);
-
   return NULL;
 }
 
@@ -8479,53 +7681,45 @@ egg_token *close_brace(void)
 egg_token *tilde(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    126,
-                    entry,
-                    (void *)egg_token_type_tilde);
+  if (_callbacks[126].entry)
+    callback_by_index(&_cbt,
+                      126,
+                      entry,
+                      (void *)egg_token_type_tilde);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x7E)
+  {
+    nt = egg_token_new(egg_token_type_tilde);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[126].success)
+        callback_by_index(&_cbt,
+                          126,
+                          success,
+                          (void *)egg_token_type_tilde);
 
-  nt = egg_token_new(egg_token_type_tilde);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      126,
-                      fail,
-                      (void *)egg_token_type_tilde);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x7E)
-  {
+  if (_callbacks[126].fail)
     callback_by_index(&_cbt,
                       126,
-                      success,
+                      fail,
                       (void *)egg_token_type_tilde);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    126,
-                    fail,
-                    (void *)egg_token_type_tilde);
-
   return NULL;
 }
 
@@ -8544,53 +7738,45 @@ egg_token *tilde(void)
 egg_token *del(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    127,
-                    entry,
-                    (void *)egg_token_type_del);
+  if (_callbacks[127].entry)
+    callback_by_index(&_cbt,
+                      127,
+                      entry,
+                      (void *)egg_token_type_del);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if (first == 0x7F)
+  {
+    nt = egg_token_new(egg_token_type_del);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[127].success)
+        callback_by_index(&_cbt,
+                          127,
+                          success,
+                          (void *)egg_token_type_del);
 
-  nt = egg_token_new(egg_token_type_del);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      127,
-                      fail,
-                      (void *)egg_token_type_del);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if ((input_byte()) == 0x7F)
-  {
+  if (_callbacks[127].fail)
     callback_by_index(&_cbt,
                       127,
-                      success,
+                      fail,
                       (void *)egg_token_type_del);
 
-    return nt;
-  }
-
-  egg_token_delete(nt);
-  input_set_position(pos);
-
-  callback_by_index(&_cbt,
-                    127,
-                    fail,
-                    (void *)egg_token_type_del);
-
   return NULL;
 }
 
@@ -8612,5978 +7798,11305 @@ egg_token *del(void)
 egg_token *control_character(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
+  egg_token *nt;
+  unsigned char first;
 
-  callback_by_index(&_cbt,
-                    128,
-                    entry,
-                    (void *)egg_token_type_control_character);
+  if (_callbacks[128].entry)
+    callback_by_index(&_cbt,
+                      128,
+                      entry,
+                      (void *)egg_token_type_control_character);
 
   if (input_eof())
     return NULL;
 
-  count = 0;
+  first = input_byte();
+  if ((first <= 0x08) ||
+      ((first >= 0x0E) && (first <= 0x1F)) ||
+      (first == 0x7F))
+  {
+    nt = egg_token_new(egg_token_type_control_character);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-  nt = t1 = t2 = NULL;
+      if (_callbacks[128].success)
+        callback_by_index(&_cbt,
+                          128,
+                          success,
+                          (void *)egg_token_type_control_character);
 
-  nt = egg_token_new(egg_token_type_control_character);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      128,
-                      fail,
-                      (void *)egg_token_type_control_character);
-    return NULL;
+      return nt;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = nul()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
+  if (_callbacks[128].fail)
     callback_by_index(&_cbt,
                       128,
-                      success,
+                      fail,
                       (void *)egg_token_type_control_character);
 
-    return nt;
-  }
+  return NULL;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = soh()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    upper-case-letter = A | B | C | D | E | F | G | H | I | J | K | L | M
+                      | N | O | P | Q | R | S | T | U | V | W | X | Y | Z
+                      ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = stx()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = etx()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
+egg_token *upper_case_letter(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[129].entry)
     callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+                      129,
+                      entry,
+                      (void *)egg_token_type_upper_case_letter);
 
-    return nt;
-  }
+  if (input_eof())
+    return NULL;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = eot()))
+  first = input_byte();
+  if ((first >= 0x41) && (first <= 0x5A))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+    nt = egg_token_new(egg_token_type_upper_case_letter);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[129].success)
+        callback_by_index(&_cbt,
+                          129,
+                          success,
+                          (void *)egg_token_type_upper_case_letter);
 
-    return nt;
+      return nt;
+    }
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = enq()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
+  input_set_position(pos);
+
+  if (_callbacks[129].fail)
     callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+                      129,
+                      fail,
+                      (void *)egg_token_type_upper_case_letter);
 
-    return nt;
-  }
+  return NULL;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = ack()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    lower-case-letter = a | b | c | d | e | f | g | h | i | j | k | l | m
+                      | n | o | p | q | r | s | t | u | v | w | x | y | z
+                      ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = bel()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = bs()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
+egg_token *lower_case_letter(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[130].entry)
     callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+                      130,
+                      entry,
+                      (void *)egg_token_type_lower_case_letter);
 
-    return nt;
-  }
+  if (input_eof())
+    return NULL;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = so()))
+  first = input_byte();
+  if ((first >= 0x61) && (first <= 0x7A))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+    nt = egg_token_new(egg_token_type_lower_case_letter);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-    return nt;
+      if (_callbacks[130].success)
+        callback_by_index(&_cbt,
+                          130,
+                          success,
+                          (void *)egg_token_type_lower_case_letter);
+
+      return nt;
+    }
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = si()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+  input_set_position(pos);
 
-    return nt;
-  }
+  if (_callbacks[130].fail)
+    callback_by_index(&_cbt,
+                      130,
+                      fail,
+                      (void *)egg_token_type_lower_case_letter);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = dle()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    letter = upper-case-letter | lower-case-letter ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *letter(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[131].entry)
     callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+                      131,
+                      entry,
+                      (void *)egg_token_type_letter);
 
-    return nt;
-  }
+  if (input_eof())
+    return NULL;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = dc1()))
+  first = input_byte();
+  if (((first >= 0x41) && (first <= 0x5A)) ||
+      ((first >= 0x61) && (first <= 0x7A)))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+    nt = egg_token_new(egg_token_type_letter);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[131].success)
+        callback_by_index(&_cbt,
+                          131,
+                          success,
+                          (void *)egg_token_type_letter);
 
-    return nt;
+      return nt;
+    }
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = dc2()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
+  input_set_position(pos);
+
+  if (_callbacks[131].fail)
     callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+                      131,
+                      fail,
+                      (void *)egg_token_type_letter);
 
-    return nt;
-  }
+  return NULL;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = dc3()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    binary-digit = zero | one ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *binary_digit(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[132].entry)
     callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+                      132,
+                      entry,
+                      (void *)egg_token_type_binary_digit);
 
-    return nt;
-  }
+  if (input_eof())
+    return NULL;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = dc4()))
+  first = input_byte();
+  if ((first >= 0x30) && (first <= 0x31))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+    nt = egg_token_new(egg_token_type_binary_digit);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
 
-    return nt;
+      if (_callbacks[132].success)
+        callback_by_index(&_cbt,
+                          132,
+                          success,
+                          (void *)egg_token_type_binary_digit);
+
+      return nt;
+    }
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = nak()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
+  input_set_position(pos);
+
+  if (_callbacks[132].fail)
     callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+                      132,
+                      fail,
+                      (void *)egg_token_type_binary_digit);
 
-    return nt;
-  }
+  return NULL;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = syn()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    octal-digit = zero | one | two | three | four | five | six | seven ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *octal_digit(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[133].entry)
     callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+                      133,
+                      entry,
+                      (void *)egg_token_type_octal_digit);
 
-    return nt;
-  }
+  if (input_eof())
+    return NULL;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = etb()))
+  first = input_byte();
+  if ((first >= 0x30) && (first <= 0x37))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+    nt = egg_token_new(egg_token_type_octal_digit);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[133].success)
+        callback_by_index(&_cbt,
+                          133,
+                          success,
+                          (void *)egg_token_type_octal_digit);
 
-    return nt;
+      return nt;
+    }
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = can()))
+  input_set_position(pos);
+
+  if (_callbacks[133].fail)
+    callback_by_index(&_cbt,
+                      133,
+                      fail,
+                      (void *)egg_token_type_octal_digit);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    decimal-digit = zero | one | two | three | four
+                  | five | six | seven | eight | nine ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *decimal_digit(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[134].entry)
+    callback_by_index(&_cbt,
+                      134,
+                      entry,
+                      (void *)egg_token_type_decimal_digit);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if ((first >= 0x30) && (first <= 0x39))
   {
-    dir = egg_token_after;
-    t1 = t2;
+    nt = egg_token_new(egg_token_type_decimal_digit);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[134].success)
+        callback_by_index(&_cbt,
+                          134,
+                          success,
+                          (void *)egg_token_type_decimal_digit);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[134].fail)
     callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+                      134,
+                      fail,
+                      (void *)egg_token_type_decimal_digit);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    hexadecimal-digit = zero | one | two | three | four
+                      | five | six | seven | eight | nine
+                      | A | B | C | D | E | F
+                      | a | b | c | d | e | f ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *hexadecimal_digit(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[135].entry)
+    callback_by_index(&_cbt,
+                      135,
+                      entry,
+                      (void *)egg_token_type_hexadecimal_digit);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if (((first >= 0x30) && (first <= 0x39)) ||
+      ((first >= 0x41) && (first <= 0x46)) ||
+      ((first >= 0x61) && (first <= 0x66)))
+  {
+    nt = egg_token_new(egg_token_type_hexadecimal_digit);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[135].success)
+        callback_by_index(&_cbt,
+                          135,
+                          success,
+                          (void *)egg_token_type_hexadecimal_digit);
 
-    return nt;
+      return nt;
+    }
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = em()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+  input_set_position(pos);
+
+  if (_callbacks[135].fail)
+    callback_by_index(&_cbt,
+                      135,
+                      fail,
+                      (void *)egg_token_type_hexadecimal_digit);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    white-space = space | ht | lf | vt | ff | cr ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *white_space(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[136].entry)
+    callback_by_index(&_cbt,
+                      136,
+                      entry,
+                      (void *)egg_token_type_white_space);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      (first == 0x20))
+  {
+    nt = egg_token_new(egg_token_type_white_space);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[136].success)
+        callback_by_index(&_cbt,
+                          136,
+                          success,
+                          (void *)egg_token_type_white_space);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[136].fail)
+    callback_by_index(&_cbt,
+                      136,
+                      fail,
+                      (void *)egg_token_type_white_space);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    common-character = exclamation-point | number-sign | dollar | percent
+                     | ampersand | plus | comma | minus | period | colon
+                     | semicolon | less-than | equal | greater-than
+                     | question-mark | at | open-bracket | back-slash
+                     | close-bracket | carat | underscore | back-quote
+                     | open-brace | bar | close-brace | tilde | letter
+                     | decimal-digit ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *common_character(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[137].entry)
+    callback_by_index(&_cbt,
+                      137,
+                      entry,
+                      (void *)egg_token_type_common_character);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if ((first == 0x21) ||
+      ((first >= 0x23) && (first <= 0x26)) ||
+      ((first >= 0x2B) && (first <= 0x2E)) ||
+      ((first >= 0x30) && (first <= 0x7E)))
+  {
+    nt = egg_token_new(egg_token_type_common_character);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[137].success)
+        callback_by_index(&_cbt,
+                          137,
+                          success,
+                          (void *)egg_token_type_common_character);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[137].fail)
+    callback_by_index(&_cbt,
+                      137,
+                      fail,
+                      (void *)egg_token_type_common_character);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    literal-character = common-character
+                      | space
+                      | open-parenthesis
+                      | close-parenthesis
+                      | asterisk ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *literal_character(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[138].entry)
+    callback_by_index(&_cbt,
+                      138,
+                      entry,
+                      (void *)egg_token_type_literal_character);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if (((first >= 0x20) && (first <= 0x21)) ||
+      ((first >= 0x23) && (first <= 0x26)) ||
+      ((first >= 0x28) && (first <= 0x2E)) ||
+      ((first >= 0x30) && (first <= 0x7E)))
+  {
+    nt = egg_token_new(egg_token_type_literal_character);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[138].success)
+        callback_by_index(&_cbt,
+                          138,
+                          success,
+                          (void *)egg_token_type_literal_character);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[138].fail)
+    callback_by_index(&_cbt,
+                      138,
+                      fail,
+                      (void *)egg_token_type_literal_character);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    comment-basic-character = common-character
+                            | white-space
+                            | quote
+                            | single-quote
+                            | slash ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *comment_basic_character(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[139].entry)
+    callback_by_index(&_cbt,
+                      139,
+                      entry,
+                      (void *)egg_token_type_comment_basic_character);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      ((first >= 0x20) && (first <= 0x27)) ||
+      ((first >= 0x2B) && (first <= 0x7E)))
+  {
+    nt = egg_token_new(egg_token_type_comment_basic_character);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[139].success)
+        callback_by_index(&_cbt,
+                          139,
+                          success,
+                          (void *)egg_token_type_comment_basic_character);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[139].fail)
+    callback_by_index(&_cbt,
+                      139,
+                      fail,
+                      (void *)egg_token_type_comment_basic_character);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    non-comment-start-character = comment-basic-character
+                                | close-parenthesis ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *non_comment_start_character(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[140].entry)
+    callback_by_index(&_cbt,
+                      140,
+                      entry,
+                      (void *)egg_token_type_non_comment_start_character);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      ((first >= 0x20) && (first <= 0x27)) ||
+      (first == 0x29) ||
+      ((first >= 0x2B) && (first <= 0x7E)))
+  {
+    nt = egg_token_new(egg_token_type_non_comment_start_character);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[140].success)
+        callback_by_index(&_cbt,
+                          140,
+                          success,
+                          (void *)egg_token_type_non_comment_start_character);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[140].fail)
+    callback_by_index(&_cbt,
+                      140,
+                      fail,
+                      (void *)egg_token_type_non_comment_start_character);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    non-comment-end-character = comment-basic-character
+                              | open-parenthesis ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *non_comment_end_character(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[141].entry)
+    callback_by_index(&_cbt,
+                      141,
+                      entry,
+                      (void *)egg_token_type_non_comment_end_character);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      ((first >= 0x20) && (first <= 0x28)) ||
+      ((first >= 0x2B) && (first <= 0x7E)))
+  {
+    nt = egg_token_new(egg_token_type_non_comment_end_character);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[141].success)
+        callback_by_index(&_cbt,
+                          141,
+                          success,
+                          (void *)egg_token_type_non_comment_end_character);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[141].fail)
+    callback_by_index(&_cbt,
+                      141,
+                      fail,
+                      (void *)egg_token_type_non_comment_end_character);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    non-comment-start-sequence = open-parenthesis
+                                 + non-comment-start-character ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *non_comment_start_sequence(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[142].entry)
+    callback_by_index(&_cbt,
+                      142,
+                      entry,
+                      (void *)egg_token_type_non_comment_start_sequence);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x28)
+  {
+    if (egg_token_add(t1, dir, t2 = open_parenthesis()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      if (egg_token_add(t1, dir, t2 = non_comment_start_character()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        nt = egg_token_new(egg_token_type_non_comment_start_sequence);
+        if (!nt)
+        {
+          egg_token_arena_rewind(mark);
+          input_set_position(pos);
+          if (_callbacks[142].fail)
+            callback_by_index(&_cbt,
+                              142,
+                              fail,
+                              (void *)egg_token_type_non_comment_start_sequence);
+
+          return NULL;
+        }
+        egg_token_set_offset(nt, pos);
+        egg_token_set_length(nt, input_get_position() - pos);
+        egg_token_add(nt, egg_token_below, head.descendant);
+
+        if (_callbacks[142].success)
+          callback_by_index(&_cbt,
+                            142,
+                            success,
+                            (void *)egg_token_type_non_comment_start_sequence);
+
+        return nt;
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[142].fail)
+    callback_by_index(&_cbt,
+                      142,
+                      fail,
+                      (void *)egg_token_type_non_comment_start_sequence);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    non-comment-end-sequence = asterisk
+                               + non-comment-end-character ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *non_comment_end_sequence(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[143].entry)
+    callback_by_index(&_cbt,
+                      143,
+                      entry,
+                      (void *)egg_token_type_non_comment_end_sequence);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x2A)
+  {
+    if (egg_token_add(t1, dir, t2 = asterisk()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      if (egg_token_add(t1, dir, t2 = non_comment_end_character()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        nt = egg_token_new(egg_token_type_non_comment_end_sequence);
+        if (!nt)
+        {
+          egg_token_arena_rewind(mark);
+          input_set_position(pos);
+          if (_callbacks[143].fail)
+            callback_by_index(&_cbt,
+                              143,
+                              fail,
+                              (void *)egg_token_type_non_comment_end_sequence);
+
+          return NULL;
+        }
+        egg_token_set_offset(nt, pos);
+        egg_token_set_length(nt, input_get_position() - pos);
+        egg_token_add(nt, egg_token_below, head.descendant);
+
+        if (_callbacks[143].success)
+          callback_by_index(&_cbt,
+                            143,
+                            success,
+                            (void *)egg_token_type_non_comment_end_sequence);
+
+        return nt;
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[143].fail)
+    callback_by_index(&_cbt,
+                      143,
+                      fail,
+                      (void *)egg_token_type_non_comment_end_sequence);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    comment-character = comment-basic-character
+                      | non-comment-start-sequence
+                      | non-comment-end-sequence
+                      | close-parenthesis ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *comment_character(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[144].entry)
+    callback_by_index(&_cbt,
+                      144,
+                      entry,
+                      (void *)egg_token_type_comment_character);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      ((first >= 0x20) && (first <= 0x27)) ||
+      ((first >= 0x2B) && (first <= 0x7E)))
+  {
+    if (egg_token_add(t1, dir, t2 = comment_basic_character()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_comment_character);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[144].fail)
+          callback_by_index(&_cbt,
+                            144,
+                            fail,
+                            (void *)egg_token_type_comment_character);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[144].success)
+        callback_by_index(&_cbt,
+                          144,
+                          success,
+                          (void *)egg_token_type_comment_character);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  head.descendant = NULL;
+  input_set_position(pos);
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x28)
+  {
+    if (egg_token_add(t1, dir, t2 = non_comment_start_sequence()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_comment_character);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[144].fail)
+          callback_by_index(&_cbt,
+                            144,
+                            fail,
+                            (void *)egg_token_type_comment_character);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[144].success)
+        callback_by_index(&_cbt,
+                          144,
+                          success,
+                          (void *)egg_token_type_comment_character);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  head.descendant = NULL;
+  input_set_position(pos);
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x2A)
+  {
+    if (egg_token_add(t1, dir, t2 = non_comment_end_sequence()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_comment_character);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[144].fail)
+          callback_by_index(&_cbt,
+                            144,
+                            fail,
+                            (void *)egg_token_type_comment_character);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[144].success)
+        callback_by_index(&_cbt,
+                          144,
+                          success,
+                          (void *)egg_token_type_comment_character);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  head.descendant = NULL;
+  input_set_position(pos);
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x29)
+  {
+    if (egg_token_add(t1, dir, t2 = close_parenthesis()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_comment_character);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[144].fail)
+          callback_by_index(&_cbt,
+                            144,
+                            fail,
+                            (void *)egg_token_type_comment_character);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[144].success)
+        callback_by_index(&_cbt,
+                          144,
+                          success,
+                          (void *)egg_token_type_comment_character);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[144].fail)
+    callback_by_index(&_cbt,
+                      144,
+                      fail,
+                      (void *)egg_token_type_comment_character);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    single-quoted-character = literal-character | quote ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *single_quoted_character(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[145].entry)
+    callback_by_index(&_cbt,
+                      145,
+                      entry,
+                      (void *)egg_token_type_single_quoted_character);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if (((first >= 0x20) && (first <= 0x26)) ||
+      ((first >= 0x28) && (first <= 0x2E)) ||
+      ((first >= 0x30) && (first <= 0x7E)))
+  {
+    nt = egg_token_new(egg_token_type_single_quoted_character);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[145].success)
+        callback_by_index(&_cbt,
+                          145,
+                          success,
+                          (void *)egg_token_type_single_quoted_character);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[145].fail)
+    callback_by_index(&_cbt,
+                      145,
+                      fail,
+                      (void *)egg_token_type_single_quoted_character);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    quoted-character = literal-character | single-quote ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *quoted_character(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[146].entry)
+    callback_by_index(&_cbt,
+                      146,
+                      entry,
+                      (void *)egg_token_type_quoted_character);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if (((first >= 0x20) && (first <= 0x21)) ||
+      ((first >= 0x23) && (first <= 0x2E)) ||
+      ((first >= 0x30) && (first <= 0x7E)))
+  {
+    nt = egg_token_new(egg_token_type_quoted_character);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[146].success)
+        callback_by_index(&_cbt,
+                          146,
+                          success,
+                          (void *)egg_token_type_quoted_character);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[146].fail)
+    callback_by_index(&_cbt,
+                      146,
+                      fail,
+                      (void *)egg_token_type_quoted_character);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    phrase-conjugator = underscore | minus ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *phrase_conjugator(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[147].entry)
+    callback_by_index(&_cbt,
+                      147,
+                      entry,
+                      (void *)egg_token_type_phrase_conjugator);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if ((first == 0x2D) ||
+      (first == 0x5F))
+  {
+    nt = egg_token_new(egg_token_type_phrase_conjugator);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[147].success)
+        callback_by_index(&_cbt,
+                          147,
+                          success,
+                          (void *)egg_token_type_phrase_conjugator);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[147].fail)
+    callback_by_index(&_cbt,
+                      147,
+                      fail,
+                      (void *)egg_token_type_phrase_conjugator);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    phrase-name-character = letter | decimal-digit | phrase-conjugator ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *phrase_name_character(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[148].entry)
+    callback_by_index(&_cbt,
+                      148,
+                      entry,
+                      (void *)egg_token_type_phrase_name_character);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if ("\x00\x00\x00\x00\x00\x20\xff\x03\xfe\xff\xff\x87\xfe\xff\xff\x07"
+      "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        [first >> 3] & (1 << (first & 7)))
+  {
+    nt = egg_token_new(egg_token_type_phrase_name_character);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[148].success)
+        callback_by_index(&_cbt,
+                          148,
+                          success,
+                          (void *)egg_token_type_phrase_name_character);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[148].fail)
+    callback_by_index(&_cbt,
+                      148,
+                      fail,
+                      (void *)egg_token_type_phrase_name_character);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    binary-indicator = b | B ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *binary_indicator(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[149].entry)
+    callback_by_index(&_cbt,
+                      149,
+                      entry,
+                      (void *)egg_token_type_binary_indicator);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if ((first == 0x42) ||
+      (first == 0x62))
+  {
+    nt = egg_token_new(egg_token_type_binary_indicator);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[149].success)
+        callback_by_index(&_cbt,
+                          149,
+                          success,
+                          (void *)egg_token_type_binary_indicator);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[149].fail)
+    callback_by_index(&_cbt,
+                      149,
+                      fail,
+                      (void *)egg_token_type_binary_indicator);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    octal-indicator = o | O ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *octal_indicator(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[150].entry)
+    callback_by_index(&_cbt,
+                      150,
+                      entry,
+                      (void *)egg_token_type_octal_indicator);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if ((first == 0x4F) ||
+      (first == 0x6F))
+  {
+    nt = egg_token_new(egg_token_type_octal_indicator);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[150].success)
+        callback_by_index(&_cbt,
+                          150,
+                          success,
+                          (void *)egg_token_type_octal_indicator);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[150].fail)
+    callback_by_index(&_cbt,
+                      150,
+                      fail,
+                      (void *)egg_token_type_octal_indicator);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    hexadecimal-indicator = x | X ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *hexadecimal_indicator(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[151].entry)
+    callback_by_index(&_cbt,
+                      151,
+                      entry,
+                      (void *)egg_token_type_hexadecimal_indicator);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if ((first == 0x58) ||
+      (first == 0x78))
+  {
+    nt = egg_token_new(egg_token_type_hexadecimal_indicator);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[151].success)
+        callback_by_index(&_cbt,
+                          151,
+                          success,
+                          (void *)egg_token_type_hexadecimal_indicator);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[151].fail)
+    callback_by_index(&_cbt,
+                      151,
+                      fail,
+                      (void *)egg_token_type_hexadecimal_indicator);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    comment-start-symbol = open-parenthesis + asterisk ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *comment_start_symbol(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[152].entry)
+    callback_by_index(&_cbt,
+                      152,
+                      entry,
+                      (void *)egg_token_type_comment_start_symbol);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x28)
+  {
+    if (egg_token_add(t1, dir, t2 = open_parenthesis()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      if (egg_token_add(t1, dir, t2 = asterisk()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        nt = egg_token_new(egg_token_type_comment_start_symbol);
+        if (!nt)
+        {
+          egg_token_arena_rewind(mark);
+          input_set_position(pos);
+          if (_callbacks[152].fail)
+            callback_by_index(&_cbt,
+                              152,
+                              fail,
+                              (void *)egg_token_type_comment_start_symbol);
+
+          return NULL;
+        }
+        egg_token_set_offset(nt, pos);
+        egg_token_set_length(nt, input_get_position() - pos);
+        egg_token_add(nt, egg_token_below, head.descendant);
+
+        if (_callbacks[152].success)
+          callback_by_index(&_cbt,
+                            152,
+                            success,
+                            (void *)egg_token_type_comment_start_symbol);
+
+        return nt;
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[152].fail)
+    callback_by_index(&_cbt,
+                      152,
+                      fail,
+                      (void *)egg_token_type_comment_start_symbol);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    comment-end-symbol = asterisk + close-parenthesis ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *comment_end_symbol(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[153].entry)
+    callback_by_index(&_cbt,
+                      153,
+                      entry,
+                      (void *)egg_token_type_comment_end_symbol);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x2A)
+  {
+    if (egg_token_add(t1, dir, t2 = asterisk()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      if (egg_token_add(t1, dir, t2 = close_parenthesis()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        nt = egg_token_new(egg_token_type_comment_end_symbol);
+        if (!nt)
+        {
+          egg_token_arena_rewind(mark);
+          input_set_position(pos);
+          if (_callbacks[153].fail)
+            callback_by_index(&_cbt,
+                              153,
+                              fail,
+                              (void *)egg_token_type_comment_end_symbol);
+
+          return NULL;
+        }
+        egg_token_set_offset(nt, pos);
+        egg_token_set_length(nt, input_get_position() - pos);
+        egg_token_add(nt, egg_token_below, head.descendant);
+
+        if (_callbacks[153].success)
+          callback_by_index(&_cbt,
+                            153,
+                            success,
+                            (void *)egg_token_type_comment_end_symbol);
+
+        return nt;
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[153].fail)
+    callback_by_index(&_cbt,
+                      153,
+                      fail,
+                      (void *)egg_token_type_comment_end_symbol);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    alternation-symbol = bar ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *alternation_symbol(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[154].entry)
+    callback_by_index(&_cbt,
+                      154,
+                      entry,
+                      (void *)egg_token_type_alternation_symbol);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if (first == 0x7C)
+  {
+    nt = egg_token_new(egg_token_type_alternation_symbol);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[154].success)
+        callback_by_index(&_cbt,
+                          154,
+                          success,
+                          (void *)egg_token_type_alternation_symbol);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[154].fail)
+    callback_by_index(&_cbt,
+                      154,
+                      fail,
+                      (void *)egg_token_type_alternation_symbol);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    concatenation-symbol = plus ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *concatenation_symbol(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[155].entry)
+    callback_by_index(&_cbt,
+                      155,
+                      entry,
+                      (void *)egg_token_type_concatenation_symbol);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if (first == 0x2B)
+  {
+    nt = egg_token_new(egg_token_type_concatenation_symbol);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[155].success)
+        callback_by_index(&_cbt,
+                          155,
+                          success,
+                          (void *)egg_token_type_concatenation_symbol);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[155].fail)
+    callback_by_index(&_cbt,
+                      155,
+                      fail,
+                      (void *)egg_token_type_concatenation_symbol);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    phrase-terminator-symbol = semicolon ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *phrase_terminator_symbol(void)
+{
+  long pos = input_get_position();
+  egg_token *nt;
+  unsigned char first;
+
+  if (_callbacks[156].entry)
+    callback_by_index(&_cbt,
+                      156,
+                      entry,
+                      (void *)egg_token_type_phrase_terminator_symbol);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  if (first == 0x3B)
+  {
+    nt = egg_token_new(egg_token_type_phrase_terminator_symbol);
+    if (nt)
+    {
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, 1);
+
+      if (_callbacks[156].success)
+        callback_by_index(&_cbt,
+                          156,
+                          success,
+                          (void *)egg_token_type_phrase_terminator_symbol);
+
+      return nt;
+    }
+  }
+
+  input_set_position(pos);
+
+  if (_callbacks[156].fail)
+    callback_by_index(&_cbt,
+                      156,
+                      fail,
+                      (void *)egg_token_type_phrase_terminator_symbol);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    binary-integer = zero
+                     + binary-indicator
+                     + binary-digit{1,*} ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *binary_integer(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[157].entry)
+    callback_by_index(&_cbt,
+                      157,
+                      entry,
+                      (void *)egg_token_type_binary_integer);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x30)
+  {
+    if (egg_token_add(t1, dir, t2 = zero()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      if (egg_token_add(t1, dir, t2 = binary_indicator()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        count=0;
+        while(TRUE)
+        {
+          if (egg_token_add(t1, dir, t2 = binary_digit()))
+          {
+            dir = egg_token_after;
+            t1 = t2;
+            ++count;
+          }
+          else
+            break;
+        }
+        if ((count >= 1))
+        {
+          nt = egg_token_new(egg_token_type_binary_integer);
+          if (!nt)
+          {
+            egg_token_arena_rewind(mark);
+            input_set_position(pos);
+            if (_callbacks[157].fail)
+              callback_by_index(&_cbt,
+                                157,
+                                fail,
+                                (void *)egg_token_type_binary_integer);
+
+            return NULL;
+          }
+          egg_token_set_offset(nt, pos);
+          egg_token_set_length(nt, input_get_position() - pos);
+          egg_token_add(nt, egg_token_below, head.descendant);
+
+          if (_callbacks[157].success)
+            callback_by_index(&_cbt,
+                              157,
+                              success,
+                              (void *)egg_token_type_binary_integer);
+
+          return nt;
+        }
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[157].fail)
+    callback_by_index(&_cbt,
+                      157,
+                      fail,
+                      (void *)egg_token_type_binary_integer);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    octal-integer = zero
+                    + octal-indicator
+                    + octal-digit{1,*} ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *octal_integer(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[158].entry)
+    callback_by_index(&_cbt,
+                      158,
+                      entry,
+                      (void *)egg_token_type_octal_integer);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x30)
+  {
+    if (egg_token_add(t1, dir, t2 = zero()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      if (egg_token_add(t1, dir, t2 = octal_indicator()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        count=0;
+        while(TRUE)
+        {
+          if (egg_token_add(t1, dir, t2 = octal_digit()))
+          {
+            dir = egg_token_after;
+            t1 = t2;
+            ++count;
+          }
+          else
+            break;
+        }
+        if ((count >= 1))
+        {
+          nt = egg_token_new(egg_token_type_octal_integer);
+          if (!nt)
+          {
+            egg_token_arena_rewind(mark);
+            input_set_position(pos);
+            if (_callbacks[158].fail)
+              callback_by_index(&_cbt,
+                                158,
+                                fail,
+                                (void *)egg_token_type_octal_integer);
+
+            return NULL;
+          }
+          egg_token_set_offset(nt, pos);
+          egg_token_set_length(nt, input_get_position() - pos);
+          egg_token_add(nt, egg_token_below, head.descendant);
+
+          if (_callbacks[158].success)
+            callback_by_index(&_cbt,
+                              158,
+                              success,
+                              (void *)egg_token_type_octal_integer);
+
+          return nt;
+        }
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[158].fail)
+    callback_by_index(&_cbt,
+                      158,
+                      fail,
+                      (void *)egg_token_type_octal_integer);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    hexadecimal-integer = zero
+                          + hexadecimal-indicator
+                          + hexadecimal-digit{1,*} ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *hexadecimal_integer(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[159].entry)
+    callback_by_index(&_cbt,
+                      159,
+                      entry,
+                      (void *)egg_token_type_hexadecimal_integer);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x30)
+  {
+    if (egg_token_add(t1, dir, t2 = zero()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      if (egg_token_add(t1, dir, t2 = hexadecimal_indicator()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        count=0;
+        while(TRUE)
+        {
+          if (egg_token_add(t1, dir, t2 = hexadecimal_digit()))
+          {
+            dir = egg_token_after;
+            t1 = t2;
+            ++count;
+          }
+          else
+            break;
+        }
+        if ((count >= 1))
+        {
+          nt = egg_token_new(egg_token_type_hexadecimal_integer);
+          if (!nt)
+          {
+            egg_token_arena_rewind(mark);
+            input_set_position(pos);
+            if (_callbacks[159].fail)
+              callback_by_index(&_cbt,
+                                159,
+                                fail,
+                                (void *)egg_token_type_hexadecimal_integer);
+
+            return NULL;
+          }
+          egg_token_set_offset(nt, pos);
+          egg_token_set_length(nt, input_get_position() - pos);
+          egg_token_add(nt, egg_token_below, head.descendant);
+
+          if (_callbacks[159].success)
+            callback_by_index(&_cbt,
+                              159,
+                              success,
+                              (void *)egg_token_type_hexadecimal_integer);
+
+          return nt;
+        }
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[159].fail)
+    callback_by_index(&_cbt,
+                      159,
+                      fail,
+                      (void *)egg_token_type_hexadecimal_integer);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    decimal-integer = decimal-digit{1,*} ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *decimal_integer(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[160].entry)
+    callback_by_index(&_cbt,
+                      160,
+                      entry,
+                      (void *)egg_token_type_decimal_integer);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if ((first >= 0x30) && (first <= 0x39))
+  {
+    count=0;
+    while(TRUE)
+    {
+      if (egg_token_add(t1, dir, t2 = decimal_digit()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        ++count;
+      }
+      else
+        break;
+    }
+    if ((count >= 1))
+    {
+      nt = egg_token_new(egg_token_type_decimal_integer);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[160].fail)
+          callback_by_index(&_cbt,
+                            160,
+                            fail,
+                            (void *)egg_token_type_decimal_integer);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[160].success)
+        callback_by_index(&_cbt,
+                          160,
+                          success,
+                          (void *)egg_token_type_decimal_integer);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[160].fail)
+    callback_by_index(&_cbt,
+                      160,
+                      fail,
+                      (void *)egg_token_type_decimal_integer);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    integer = binary-integer
+            | octal-integer
+            | hexadecimal-integer
+            | decimal-integer ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *integer(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[161].entry)
+    callback_by_index(&_cbt,
+                      161,
+                      entry,
+                      (void *)egg_token_type_integer);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x30)
+  {
+    if (egg_token_add(t1, dir, t2 = binary_integer()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_integer);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[161].fail)
+          callback_by_index(&_cbt,
+                            161,
+                            fail,
+                            (void *)egg_token_type_integer);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[161].success)
+        callback_by_index(&_cbt,
+                          161,
+                          success,
+                          (void *)egg_token_type_integer);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  head.descendant = NULL;
+  input_set_position(pos);
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x30)
+  {
+    if (egg_token_add(t1, dir, t2 = octal_integer()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_integer);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[161].fail)
+          callback_by_index(&_cbt,
+                            161,
+                            fail,
+                            (void *)egg_token_type_integer);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[161].success)
+        callback_by_index(&_cbt,
+                          161,
+                          success,
+                          (void *)egg_token_type_integer);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  head.descendant = NULL;
+  input_set_position(pos);
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x30)
+  {
+    if (egg_token_add(t1, dir, t2 = hexadecimal_integer()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_integer);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[161].fail)
+          callback_by_index(&_cbt,
+                            161,
+                            fail,
+                            (void *)egg_token_type_integer);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[161].success)
+        callback_by_index(&_cbt,
+                          161,
+                          success,
+                          (void *)egg_token_type_integer);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  head.descendant = NULL;
+  input_set_position(pos);
+  t1 = &head;
+
+  dir = egg_token_below;
+  if ((first >= 0x30) && (first <= 0x39))
+  {
+    if (egg_token_add(t1, dir, t2 = decimal_integer()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_integer);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[161].fail)
+          callback_by_index(&_cbt,
+                            161,
+                            fail,
+                            (void *)egg_token_type_integer);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[161].success)
+        callback_by_index(&_cbt,
+                          161,
+                          success,
+                          (void *)egg_token_type_integer);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[161].fail)
+    callback_by_index(&_cbt,
+                      161,
+                      fail,
+                      (void *)egg_token_type_integer);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    single-quoted-literal = single-quote
+                            + single-quoted-character{1,*}
+                            + single-quote ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *single_quoted_literal(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[162].entry)
+    callback_by_index(&_cbt,
+                      162,
+                      entry,
+                      (void *)egg_token_type_single_quoted_literal);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x27)
+  {
+    if (egg_token_add(t1, dir, t2 = single_quote()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      count=0;
+      while(TRUE)
+      {
+        if (egg_token_add(t1, dir, t2 = single_quoted_character()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          ++count;
+        }
+        else
+          break;
+      }
+      if ((count >= 1))
+      {
+        if (egg_token_add(t1, dir, t2 = single_quote()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          nt = egg_token_new(egg_token_type_single_quoted_literal);
+          if (!nt)
+          {
+            egg_token_arena_rewind(mark);
+            input_set_position(pos);
+            if (_callbacks[162].fail)
+              callback_by_index(&_cbt,
+                                162,
+                                fail,
+                                (void *)egg_token_type_single_quoted_literal);
+
+            return NULL;
+          }
+          egg_token_set_offset(nt, pos);
+          egg_token_set_length(nt, input_get_position() - pos);
+          egg_token_add(nt, egg_token_below, head.descendant);
+
+          if (_callbacks[162].success)
+            callback_by_index(&_cbt,
+                              162,
+                              success,
+                              (void *)egg_token_type_single_quoted_literal);
+
+          return nt;
+        }
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[162].fail)
+    callback_by_index(&_cbt,
+                      162,
+                      fail,
+                      (void *)egg_token_type_single_quoted_literal);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    quoted-literal = quote + quoted-character{1,*} + quote ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *quoted_literal(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[163].entry)
+    callback_by_index(&_cbt,
+                      163,
+                      entry,
+                      (void *)egg_token_type_quoted_literal);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x22)
+  {
+    if (egg_token_add(t1, dir, t2 = quote()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      count=0;
+      while(TRUE)
+      {
+        if (egg_token_add(t1, dir, t2 = quoted_character()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          ++count;
+        }
+        else
+          break;
+      }
+      if ((count >= 1))
+      {
+        if (egg_token_add(t1, dir, t2 = quote()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          nt = egg_token_new(egg_token_type_quoted_literal);
+          if (!nt)
+          {
+            egg_token_arena_rewind(mark);
+            input_set_position(pos);
+            if (_callbacks[163].fail)
+              callback_by_index(&_cbt,
+                                163,
+                                fail,
+                                (void *)egg_token_type_quoted_literal);
+
+            return NULL;
+          }
+          egg_token_set_offset(nt, pos);
+          egg_token_set_length(nt, input_get_position() - pos);
+          egg_token_add(nt, egg_token_below, head.descendant);
+
+          if (_callbacks[163].success)
+            callback_by_index(&_cbt,
+                              163,
+                              success,
+                              (void *)egg_token_type_quoted_literal);
+
+          return nt;
+        }
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[163].fail)
+    callback_by_index(&_cbt,
+                      163,
+                      fail,
+                      (void *)egg_token_type_quoted_literal);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    absolute-literal = slash + space{0,*} + integer + space{0,*} + slash ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *absolute_literal(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[164].entry)
+    callback_by_index(&_cbt,
+                      164,
+                      entry,
+                      (void *)egg_token_type_absolute_literal);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x2F)
+  {
+    if (egg_token_add(t1, dir, t2 = slash()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      count=0;
+      while(TRUE)
+      {
+        if (egg_token_add(t1, dir, t2 = space()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          ++count;
+        }
+        else
+          break;
+      }
+      if ((count >= 0))
+      {
+        if (egg_token_add(t1, dir, t2 = integer()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          count=0;
+          while(TRUE)
+          {
+            if (egg_token_add(t1, dir, t2 = space()))
+            {
+              dir = egg_token_after;
+              t1 = t2;
+              ++count;
+            }
+            else
+              break;
+          }
+          if ((count >= 0))
+          {
+            if (egg_token_add(t1, dir, t2 = slash()))
+            {
+              dir = egg_token_after;
+              t1 = t2;
+              nt = egg_token_new(egg_token_type_absolute_literal);
+              if (!nt)
+              {
+                egg_token_arena_rewind(mark);
+                input_set_position(pos);
+                if (_callbacks[164].fail)
+                  callback_by_index(&_cbt,
+                                    164,
+                                    fail,
+                                    (void *)egg_token_type_absolute_literal);
+
+                return NULL;
+              }
+              egg_token_set_offset(nt, pos);
+              egg_token_set_length(nt, input_get_position() - pos);
+              egg_token_add(nt, egg_token_below, head.descendant);
+
+              if (_callbacks[164].success)
+                callback_by_index(&_cbt,
+                                  164,
+                                  success,
+                                  (void *)egg_token_type_absolute_literal);
+
+              return nt;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[164].fail)
+    callback_by_index(&_cbt,
+                      164,
+                      fail,
+                      (void *)egg_token_type_absolute_literal);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    literal = single-quoted-literal | quoted-literal | absolute-literal ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *literal(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[165].entry)
+    callback_by_index(&_cbt,
+                      165,
+                      entry,
+                      (void *)egg_token_type_literal);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x27)
+  {
+    if (egg_token_add(t1, dir, t2 = single_quoted_literal()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_literal);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[165].fail)
+          callback_by_index(&_cbt,
+                            165,
+                            fail,
+                            (void *)egg_token_type_literal);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[165].success)
+        callback_by_index(&_cbt,
+                          165,
+                          success,
+                          (void *)egg_token_type_literal);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  head.descendant = NULL;
+  input_set_position(pos);
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x22)
+  {
+    if (egg_token_add(t1, dir, t2 = quoted_literal()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_literal);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[165].fail)
+          callback_by_index(&_cbt,
+                            165,
+                            fail,
+                            (void *)egg_token_type_literal);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[165].success)
+        callback_by_index(&_cbt,
+                          165,
+                          success,
+                          (void *)egg_token_type_literal);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  head.descendant = NULL;
+  input_set_position(pos);
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x2F)
+  {
+    if (egg_token_add(t1, dir, t2 = absolute_literal()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_literal);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[165].fail)
+          callback_by_index(&_cbt,
+                            165,
+                            fail,
+                            (void *)egg_token_type_literal);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[165].success)
+        callback_by_index(&_cbt,
+                          165,
+                          success,
+                          (void *)egg_token_type_literal);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[165].fail)
+    callback_by_index(&_cbt,
+                      165,
+                      fail,
+                      (void *)egg_token_type_literal);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    comment-item = comment | comment-character ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *comment_item(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[166].entry)
+    callback_by_index(&_cbt,
+                      166,
+                      entry,
+                      (void *)egg_token_type_comment_item);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x28)
+  {
+    if (egg_token_add(t1, dir, t2 = comment()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_comment_item);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[166].fail)
+          callback_by_index(&_cbt,
+                            166,
+                            fail,
+                            (void *)egg_token_type_comment_item);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[166].success)
+        callback_by_index(&_cbt,
+                          166,
+                          success,
+                          (void *)egg_token_type_comment_item);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  head.descendant = NULL;
+  input_set_position(pos);
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      ((first >= 0x20) && (first <= 0x7E)))
+  {
+    if (egg_token_add(t1, dir, t2 = comment_character()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_comment_item);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[166].fail)
+          callback_by_index(&_cbt,
+                            166,
+                            fail,
+                            (void *)egg_token_type_comment_item);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[166].success)
+        callback_by_index(&_cbt,
+                          166,
+                          success,
+                          (void *)egg_token_type_comment_item);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[166].fail)
+    callback_by_index(&_cbt,
+                      166,
+                      fail,
+                      (void *)egg_token_type_comment_item);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    comment = comment-start-symbol
+              + comment-item{0,*}
+              + comment-end-symbol ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *comment(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[167].entry)
+    callback_by_index(&_cbt,
+                      167,
+                      entry,
+                      (void *)egg_token_type_comment);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x28)
+  {
+    if (egg_token_add(t1, dir, t2 = comment_start_symbol()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      count=0;
+      while(TRUE)
+      {
+        if (egg_token_add(t1, dir, t2 = comment_item()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          ++count;
+        }
+        else
+          break;
+      }
+      if ((count >= 0))
+      {
+        if (egg_token_add(t1, dir, t2 = comment_end_symbol()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          nt = egg_token_new(egg_token_type_comment);
+          if (!nt)
+          {
+            egg_token_arena_rewind(mark);
+            input_set_position(pos);
+            if (_callbacks[167].fail)
+              callback_by_index(&_cbt,
+                                167,
+                                fail,
+                                (void *)egg_token_type_comment);
+
+            return NULL;
+          }
+          egg_token_set_offset(nt, pos);
+          egg_token_set_length(nt, input_get_position() - pos);
+          egg_token_add(nt, egg_token_below, head.descendant);
+
+          if (_callbacks[167].success)
+            callback_by_index(&_cbt,
+                              167,
+                              success,
+                              (void *)egg_token_type_comment);
+
+          return nt;
+        }
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[167].fail)
+    callback_by_index(&_cbt,
+                      167,
+                      fail,
+                      (void *)egg_token_type_comment);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    illumination = white-space | comment ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *illumination(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[168].entry)
+    callback_by_index(&_cbt,
+                      168,
+                      entry,
+                      (void *)egg_token_type_illumination);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      (first == 0x20))
+  {
+    if (egg_token_add(t1, dir, t2 = white_space()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_illumination);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[168].fail)
+          callback_by_index(&_cbt,
+                            168,
+                            fail,
+                            (void *)egg_token_type_illumination);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[168].success)
+        callback_by_index(&_cbt,
+                          168,
+                          success,
+                          (void *)egg_token_type_illumination);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  head.descendant = NULL;
+  input_set_position(pos);
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x28)
+  {
+    if (egg_token_add(t1, dir, t2 = comment()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_illumination);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[168].fail)
+          callback_by_index(&_cbt,
+                            168,
+                            fail,
+                            (void *)egg_token_type_illumination);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[168].success)
+        callback_by_index(&_cbt,
+                          168,
+                          success,
+                          (void *)egg_token_type_illumination);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[168].fail)
+    callback_by_index(&_cbt,
+                      168,
+                      fail,
+                      (void *)egg_token_type_illumination);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    non-grammar-item = control-character | illumination ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *non_grammar_item(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[169].entry)
+    callback_by_index(&_cbt,
+                      169,
+                      entry,
+                      (void *)egg_token_type_non_grammar_item);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if ((first <= 0x08) ||
+      ((first >= 0x0E) && (first <= 0x1F)) ||
+      (first == 0x7F))
+  {
+    if (egg_token_add(t1, dir, t2 = control_character()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_non_grammar_item);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[169].fail)
+          callback_by_index(&_cbt,
+                            169,
+                            fail,
+                            (void *)egg_token_type_non_grammar_item);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[169].success)
+        callback_by_index(&_cbt,
+                          169,
+                          success,
+                          (void *)egg_token_type_non_grammar_item);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  head.descendant = NULL;
+  input_set_position(pos);
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      (first == 0x20) ||
+      (first == 0x28))
+  {
+    if (egg_token_add(t1, dir, t2 = illumination()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_non_grammar_item);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[169].fail)
+          callback_by_index(&_cbt,
+                            169,
+                            fail,
+                            (void *)egg_token_type_non_grammar_item);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[169].success)
+        callback_by_index(&_cbt,
+                          169,
+                          success,
+                          (void *)egg_token_type_non_grammar_item);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[169].fail)
+    callback_by_index(&_cbt,
+                      169,
+                      fail,
+                      (void *)egg_token_type_non_grammar_item);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    non-grammar-element = non-grammar-item{1,*} ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *non_grammar_element(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[170].entry)
+    callback_by_index(&_cbt,
+                      170,
+                      entry,
+                      (void *)egg_token_type_non_grammar_element);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if ((first <= 0x20) ||
+      (first == 0x28) ||
+      (first == 0x7F))
+  {
+    count=0;
+    while(TRUE)
+    {
+      if (egg_token_add(t1, dir, t2 = non_grammar_item()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        ++count;
+      }
+      else
+        break;
+    }
+    if ((count >= 1))
+    {
+      nt = egg_token_new(egg_token_type_non_grammar_element);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[170].fail)
+          callback_by_index(&_cbt,
+                            170,
+                            fail,
+                            (void *)egg_token_type_non_grammar_element);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[170].success)
+        callback_by_index(&_cbt,
+                          170,
+                          success,
+                          (void *)egg_token_type_non_grammar_element);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[170].fail)
+    callback_by_index(&_cbt,
+                      170,
+                      fail,
+                      (void *)egg_token_type_non_grammar_element);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    phrase-name = letter + phrase-name-character{0,*} ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *phrase_name(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[171].entry)
+    callback_by_index(&_cbt,
+                      171,
+                      entry,
+                      (void *)egg_token_type_phrase_name);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (((first >= 0x41) && (first <= 0x5A)) ||
+      ((first >= 0x61) && (first <= 0x7A)))
+  {
+    if (egg_token_add(t1, dir, t2 = letter()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      count=0;
+      while(TRUE)
+      {
+        if (egg_token_add(t1, dir, t2 = phrase_name_character()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          ++count;
+        }
+        else
+          break;
+      }
+      if ((count >= 0))
+      {
+        nt = egg_token_new(egg_token_type_phrase_name);
+        if (!nt)
+        {
+          egg_token_arena_rewind(mark);
+          input_set_position(pos);
+          if (_callbacks[171].fail)
+            callback_by_index(&_cbt,
+                              171,
+                              fail,
+                              (void *)egg_token_type_phrase_name);
+
+          return NULL;
+        }
+        egg_token_set_offset(nt, pos);
+        egg_token_set_length(nt, input_get_position() - pos);
+        egg_token_add(nt, egg_token_below, head.descendant);
+
+        if (_callbacks[171].success)
+          callback_by_index(&_cbt,
+                            171,
+                            success,
+                            (void *)egg_token_type_phrase_name);
+
+        return nt;
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[171].fail)
+    callback_by_index(&_cbt,
+                      171,
+                      fail,
+                      (void *)egg_token_type_phrase_name);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    quantifier-item = integer | asterisk ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *quantifier_item(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[172].entry)
+    callback_by_index(&_cbt,
+                      172,
+                      entry,
+                      (void *)egg_token_type_quantifier_item);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if ((first >= 0x30) && (first <= 0x39))
+  {
+    if (egg_token_add(t1, dir, t2 = integer()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_quantifier_item);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[172].fail)
+          callback_by_index(&_cbt,
+                            172,
+                            fail,
+                            (void *)egg_token_type_quantifier_item);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[172].success)
+        callback_by_index(&_cbt,
+                          172,
+                          success,
+                          (void *)egg_token_type_quantifier_item);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  head.descendant = NULL;
+  input_set_position(pos);
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x2A)
+  {
+    if (egg_token_add(t1, dir, t2 = asterisk()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_quantifier_item);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[172].fail)
+          callback_by_index(&_cbt,
+                            172,
+                            fail,
+                            (void *)egg_token_type_quantifier_item);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[172].success)
+        callback_by_index(&_cbt,
+                          172,
+                          success,
+                          (void *)egg_token_type_quantifier_item);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[172].fail)
+    callback_by_index(&_cbt,
+                      172,
+                      fail,
+                      (void *)egg_token_type_quantifier_item);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    quantifier-option = comma + quantifier-item ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *quantifier_option(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[173].entry)
+    callback_by_index(&_cbt,
+                      173,
+                      entry,
+                      (void *)egg_token_type_quantifier_option);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x2C)
+  {
+    if (egg_token_add(t1, dir, t2 = comma()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      if (egg_token_add(t1, dir, t2 = quantifier_item()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        nt = egg_token_new(egg_token_type_quantifier_option);
+        if (!nt)
+        {
+          egg_token_arena_rewind(mark);
+          input_set_position(pos);
+          if (_callbacks[173].fail)
+            callback_by_index(&_cbt,
+                              173,
+                              fail,
+                              (void *)egg_token_type_quantifier_option);
+
+          return NULL;
+        }
+        egg_token_set_offset(nt, pos);
+        egg_token_set_length(nt, input_get_position() - pos);
+        egg_token_add(nt, egg_token_below, head.descendant);
+
+        if (_callbacks[173].success)
+          callback_by_index(&_cbt,
+                            173,
+                            success,
+                            (void *)egg_token_type_quantifier_option);
+
+        return nt;
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[173].fail)
+    callback_by_index(&_cbt,
+                      173,
+                      fail,
+                      (void *)egg_token_type_quantifier_option);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    quantifier = open-brace
+                 + integer
+                 + quantifier-option{0,1}
+                 + close-brace ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *quantifier(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[174].entry)
+    callback_by_index(&_cbt,
+                      174,
+                      entry,
+                      (void *)egg_token_type_quantifier);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (first == 0x7B)
+  {
+    if (egg_token_add(t1, dir, t2 = open_brace()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      if (egg_token_add(t1, dir, t2 = integer()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        count=0;
+        while(count < 1)
+        {
+          if (egg_token_add(t1, dir, t2 = quantifier_option()))
+          {
+            dir = egg_token_after;
+            t1 = t2;
+            ++count;
+          }
+          else
+            break;
+        }
+        if ((count >= 0) && (count <= 1))
+        {
+          if (egg_token_add(t1, dir, t2 = close_brace()))
+          {
+            dir = egg_token_after;
+            t1 = t2;
+            nt = egg_token_new(egg_token_type_quantifier);
+            if (!nt)
+            {
+              egg_token_arena_rewind(mark);
+              input_set_position(pos);
+              if (_callbacks[174].fail)
+                callback_by_index(&_cbt,
+                                  174,
+                                  fail,
+                                  (void *)egg_token_type_quantifier);
+
+              return NULL;
+            }
+            egg_token_set_offset(nt, pos);
+            egg_token_set_length(nt, input_get_position() - pos);
+            egg_token_add(nt, egg_token_below, head.descendant);
+
+            if (_callbacks[174].success)
+              callback_by_index(&_cbt,
+                                174,
+                                success,
+                                (void *)egg_token_type_quantifier);
+
+            return nt;
+          }
+        }
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[174].fail)
+    callback_by_index(&_cbt,
+                      174,
+                      fail,
+                      (void *)egg_token_type_quantifier);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    atom = literal | phrase-name ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *atom(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[175].entry)
+    callback_by_index(&_cbt,
+                      175,
+                      entry,
+                      (void *)egg_token_type_atom);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if ((first == 0x22) ||
+      (first == 0x27) ||
+      (first == 0x2F))
+  {
+    if (egg_token_add(t1, dir, t2 = literal()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_atom);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[175].fail)
+          callback_by_index(&_cbt,
+                            175,
+                            fail,
+                            (void *)egg_token_type_atom);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[175].success)
+        callback_by_index(&_cbt,
+                          175,
+                          success,
+                          (void *)egg_token_type_atom);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  head.descendant = NULL;
+  input_set_position(pos);
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (((first >= 0x41) && (first <= 0x5A)) ||
+      ((first >= 0x61) && (first <= 0x7A)))
+  {
+    if (egg_token_add(t1, dir, t2 = phrase_name()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      nt = egg_token_new(egg_token_type_atom);
+      if (!nt)
+      {
+        egg_token_arena_rewind(mark);
+        input_set_position(pos);
+        if (_callbacks[175].fail)
+          callback_by_index(&_cbt,
+                            175,
+                            fail,
+                            (void *)egg_token_type_atom);
+
+        return NULL;
+      }
+      egg_token_set_offset(nt, pos);
+      egg_token_set_length(nt, input_get_position() - pos);
+      egg_token_add(nt, egg_token_below, head.descendant);
+
+      if (_callbacks[175].success)
+        callback_by_index(&_cbt,
+                          175,
+                          success,
+                          (void *)egg_token_type_atom);
+
+      return nt;
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[175].fail)
+    callback_by_index(&_cbt,
+                      175,
+                      fail,
+                      (void *)egg_token_type_atom);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    item = atom + quantifier{0,1} ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *item(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[176].entry)
+    callback_by_index(&_cbt,
+                      176,
+                      entry,
+                      (void *)egg_token_type_item);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if ("\x00\x00\x00\x00\x84\x80\x00\x00\xfe\xff\xff\x07\xfe\xff\xff\x07"
+      "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        [first >> 3] & (1 << (first & 7)))
+  {
+    if (egg_token_add(t1, dir, t2 = atom()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      count=0;
+      while(count < 1)
+      {
+        if (egg_token_add(t1, dir, t2 = quantifier()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          ++count;
+        }
+        else
+          break;
+      }
+      if ((count >= 0) && (count <= 1))
+      {
+        nt = egg_token_new(egg_token_type_item);
+        if (!nt)
+        {
+          egg_token_arena_rewind(mark);
+          input_set_position(pos);
+          if (_callbacks[176].fail)
+            callback_by_index(&_cbt,
+                              176,
+                              fail,
+                              (void *)egg_token_type_item);
+
+          return NULL;
+        }
+        egg_token_set_offset(nt, pos);
+        egg_token_set_length(nt, input_get_position() - pos);
+        egg_token_add(nt, egg_token_below, head.descendant);
+
+        if (_callbacks[176].success)
+          callback_by_index(&_cbt,
+                            176,
+                            success,
+                            (void *)egg_token_type_item);
+
+        return nt;
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[176].fail)
+    callback_by_index(&_cbt,
+                      176,
+                      fail,
+                      (void *)egg_token_type_item);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    sequence-continuation = non-grammar-element{0,1}
+                            + concatenation-symbol
+                            + non-grammar-element{0,1}
+                            + item ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *sequence_continuation(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[177].entry)
+    callback_by_index(&_cbt,
+                      177,
+                      entry,
+                      (void *)egg_token_type_sequence_continuation);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if ((first <= 0x20) ||
+      (first == 0x28) ||
+      (first == 0x2B) ||
+      (first == 0x7F))
+  {
+    count=0;
+    while(count < 1)
+    {
+      if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        ++count;
+      }
+      else
+        break;
+    }
+    if ((count >= 0) && (count <= 1))
+    {
+      if (egg_token_add(t1, dir, t2 = concatenation_symbol()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        count=0;
+        while(count < 1)
+        {
+          if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+          {
+            dir = egg_token_after;
+            t1 = t2;
+            ++count;
+          }
+          else
+            break;
+        }
+        if ((count >= 0) && (count <= 1))
+        {
+          if (egg_token_add(t1, dir, t2 = item()))
+          {
+            dir = egg_token_after;
+            t1 = t2;
+            nt = egg_token_new(egg_token_type_sequence_continuation);
+            if (!nt)
+            {
+              egg_token_arena_rewind(mark);
+              input_set_position(pos);
+              if (_callbacks[177].fail)
+                callback_by_index(&_cbt,
+                                  177,
+                                  fail,
+                                  (void *)egg_token_type_sequence_continuation);
+
+              return NULL;
+            }
+            egg_token_set_offset(nt, pos);
+            egg_token_set_length(nt, input_get_position() - pos);
+            egg_token_add(nt, egg_token_below, head.descendant);
+
+            if (_callbacks[177].success)
+              callback_by_index(&_cbt,
+                                177,
+                                success,
+                                (void *)egg_token_type_sequence_continuation);
+
+            return nt;
+          }
+        }
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[177].fail)
+    callback_by_index(&_cbt,
+                      177,
+                      fail,
+                      (void *)egg_token_type_sequence_continuation);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    sequence = item + sequence-continuation{0,*} ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *sequence(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[178].entry)
+    callback_by_index(&_cbt,
+                      178,
+                      entry,
+                      (void *)egg_token_type_sequence);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if ("\x00\x00\x00\x00\x84\x80\x00\x00\xfe\xff\xff\x07\xfe\xff\xff\x07"
+      "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        [first >> 3] & (1 << (first & 7)))
+  {
+    if (egg_token_add(t1, dir, t2 = item()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      count=0;
+      while(TRUE)
+      {
+        if (egg_token_add(t1, dir, t2 = sequence_continuation()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          ++count;
+        }
+        else
+          break;
+      }
+      if ((count >= 0))
+      {
+        nt = egg_token_new(egg_token_type_sequence);
+        if (!nt)
+        {
+          egg_token_arena_rewind(mark);
+          input_set_position(pos);
+          if (_callbacks[178].fail)
+            callback_by_index(&_cbt,
+                              178,
+                              fail,
+                              (void *)egg_token_type_sequence);
+
+          return NULL;
+        }
+        egg_token_set_offset(nt, pos);
+        egg_token_set_length(nt, input_get_position() - pos);
+        egg_token_add(nt, egg_token_below, head.descendant);
+
+        if (_callbacks[178].success)
+          callback_by_index(&_cbt,
+                            178,
+                            success,
+                            (void *)egg_token_type_sequence);
+
+        return nt;
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[178].fail)
+    callback_by_index(&_cbt,
+                      178,
+                      fail,
+                      (void *)egg_token_type_sequence);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    definition-continuation = non-grammar-element{0,1}
+                              + alternation-symbol
+                              + non-grammar-element{0,1}
+                              + sequence ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *definition_continuation(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[179].entry)
+    callback_by_index(&_cbt,
+                      179,
+                      entry,
+                      (void *)egg_token_type_definition_continuation);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if ((first <= 0x20) ||
+      (first == 0x28) ||
+      (first == 0x7C) ||
+      (first == 0x7F))
+  {
+    count=0;
+    while(count < 1)
+    {
+      if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        ++count;
+      }
+      else
+        break;
+    }
+    if ((count >= 0) && (count <= 1))
+    {
+      if (egg_token_add(t1, dir, t2 = alternation_symbol()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        count=0;
+        while(count < 1)
+        {
+          if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+          {
+            dir = egg_token_after;
+            t1 = t2;
+            ++count;
+          }
+          else
+            break;
+        }
+        if ((count >= 0) && (count <= 1))
+        {
+          if (egg_token_add(t1, dir, t2 = sequence()))
+          {
+            dir = egg_token_after;
+            t1 = t2;
+            nt = egg_token_new(egg_token_type_definition_continuation);
+            if (!nt)
+            {
+              egg_token_arena_rewind(mark);
+              input_set_position(pos);
+              if (_callbacks[179].fail)
+                callback_by_index(&_cbt,
+                                  179,
+                                  fail,
+                                  (void *)egg_token_type_definition_continuation);
+
+              return NULL;
+            }
+            egg_token_set_offset(nt, pos);
+            egg_token_set_length(nt, input_get_position() - pos);
+            egg_token_add(nt, egg_token_below, head.descendant);
+
+            if (_callbacks[179].success)
+              callback_by_index(&_cbt,
+                                179,
+                                success,
+                                (void *)egg_token_type_definition_continuation);
+
+            return nt;
+          }
+        }
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[179].fail)
+    callback_by_index(&_cbt,
+                      179,
+                      fail,
+                      (void *)egg_token_type_definition_continuation);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    definition = sequence + definition-continuation{0,*} ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *definition(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[180].entry)
+    callback_by_index(&_cbt,
+                      180,
+                      entry,
+                      (void *)egg_token_type_definition);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if ("\x00\x00\x00\x00\x84\x80\x00\x00\xfe\xff\xff\x07\xfe\xff\xff\x07"
+      "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        [first >> 3] & (1 << (first & 7)))
+  {
+    if (egg_token_add(t1, dir, t2 = sequence()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      count=0;
+      while(TRUE)
+      {
+        if (egg_token_add(t1, dir, t2 = definition_continuation()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          ++count;
+        }
+        else
+          break;
+      }
+      if ((count >= 0))
+      {
+        nt = egg_token_new(egg_token_type_definition);
+        if (!nt)
+        {
+          egg_token_arena_rewind(mark);
+          input_set_position(pos);
+          if (_callbacks[180].fail)
+            callback_by_index(&_cbt,
+                              180,
+                              fail,
+                              (void *)egg_token_type_definition);
+
+          return NULL;
+        }
+        egg_token_set_offset(nt, pos);
+        egg_token_set_length(nt, input_get_position() - pos);
+        egg_token_add(nt, egg_token_below, head.descendant);
+
+        if (_callbacks[180].success)
+          callback_by_index(&_cbt,
+                            180,
+                            success,
+                            (void *)egg_token_type_definition);
+
+        return nt;
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[180].fail)
+    callback_by_index(&_cbt,
+                      180,
+                      fail,
+                      (void *)egg_token_type_definition);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    phrase = phrase-name
+             + non-grammar-element{0,1}
+             + equal
+             + non-grammar-element{0,1}
+             + definition
+             + non-grammar-element{0,1}
+             + phrase-terminator-symbol ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *phrase(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[181].entry)
+    callback_by_index(&_cbt,
+                      181,
+                      entry,
+                      (void *)egg_token_type_phrase);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if (((first >= 0x41) && (first <= 0x5A)) ||
+      ((first >= 0x61) && (first <= 0x7A)))
+  {
+    if (egg_token_add(t1, dir, t2 = phrase_name()))
+    {
+      dir = egg_token_after;
+      t1 = t2;
+      count=0;
+      while(count < 1)
+      {
+        if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          ++count;
+        }
+        else
+          break;
+      }
+      if ((count >= 0) && (count <= 1))
+      {
+        if (egg_token_add(t1, dir, t2 = equal()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          count=0;
+          while(count < 1)
+          {
+            if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+            {
+              dir = egg_token_after;
+              t1 = t2;
+              ++count;
+            }
+            else
+              break;
+          }
+          if ((count >= 0) && (count <= 1))
+          {
+            if (egg_token_add(t1, dir, t2 = definition()))
+            {
+              dir = egg_token_after;
+              t1 = t2;
+              count=0;
+              while(count < 1)
+              {
+                if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+                {
+                  dir = egg_token_after;
+                  t1 = t2;
+                  ++count;
+                }
+                else
+                  break;
+              }
+              if ((count >= 0) && (count <= 1))
+              {
+                if (egg_token_add(t1, dir, t2 = phrase_terminator_symbol()))
+                {
+                  dir = egg_token_after;
+                  t1 = t2;
+                  nt = egg_token_new(egg_token_type_phrase);
+                  if (!nt)
+                  {
+                    egg_token_arena_rewind(mark);
+                    input_set_position(pos);
+                    if (_callbacks[181].fail)
+                      callback_by_index(&_cbt,
+                                        181,
+                                        fail,
+                                        (void *)egg_token_type_phrase);
+
+                    return NULL;
+                  }
+                  egg_token_set_offset(nt, pos);
+                  egg_token_set_length(nt, input_get_position() - pos);
+                  egg_token_add(nt, egg_token_below, head.descendant);
+
+                  if (_callbacks[181].success)
+                    callback_by_index(&_cbt,
+                                      181,
+                                      success,
+                                      (void *)egg_token_type_phrase);
+
+                  return nt;
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[181].fail)
+    callback_by_index(&_cbt,
+                      181,
+                      fail,
+                      (void *)egg_token_type_phrase);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    grammar-element = non-grammar-element{0,1} + phrase ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *grammar_element(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[182].entry)
+    callback_by_index(&_cbt,
+                      182,
+                      entry,
+                      (void *)egg_token_type_grammar_element);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if ("\xff\xff\xff\xff\x01\x01\x00\x00\xfe\xff\xff\x07\xfe\xff\xff\x87"
+      "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        [first >> 3] & (1 << (first & 7)))
+  {
+    count=0;
+    while(count < 1)
+    {
+      if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        ++count;
+      }
+      else
+        break;
+    }
+    if ((count >= 0) && (count <= 1))
+    {
+      if (egg_token_add(t1, dir, t2 = phrase()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        nt = egg_token_new(egg_token_type_grammar_element);
+        if (!nt)
+        {
+          egg_token_arena_rewind(mark);
+          input_set_position(pos);
+          if (_callbacks[182].fail)
+            callback_by_index(&_cbt,
+                              182,
+                              fail,
+                              (void *)egg_token_type_grammar_element);
+
+          return NULL;
+        }
+        egg_token_set_offset(nt, pos);
+        egg_token_set_length(nt, input_get_position() - pos);
+        egg_token_add(nt, egg_token_below, head.descendant);
+
+        if (_callbacks[182].success)
+          callback_by_index(&_cbt,
+                            182,
+                            success,
+                            (void *)egg_token_type_grammar_element);
+
+        return nt;
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[182].fail)
+    callback_by_index(&_cbt,
+                      182,
+                      fail,
+                      (void *)egg_token_type_grammar_element);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    grammar = grammar-element{1,*} + non-grammar-element{0,1} ;
+    @endverbatim
+
+    @retval "egg_token *" on synctactical match of phrase
+    @retval NULL on error including NO MATCH
+
+ */
+
+egg_token *grammar(void)
+{
+  long pos = input_get_position();
+  egg_token_mark mark = egg_token_arena_mark();
+  egg_token head, *nt, *t1, *t2;
+  int count;
+  egg_token_direction dir;
+  unsigned char first;
+
+  if (_callbacks[183].entry)
+    callback_by_index(&_cbt,
+                      183,
+                      entry,
+                      (void *)egg_token_type_grammar);
+
+  if (input_eof())
+    return NULL;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  nt = t1 = t2 = NULL;
+
+    // Descendants are chained below head until the phrase matches
+
+  head.descendant = NULL;
+  t1 = &head;
+
+  dir = egg_token_below;
+  if ("\xff\xff\xff\xff\x01\x01\x00\x00\xfe\xff\xff\x07\xfe\xff\xff\x87"
+      "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        [first >> 3] & (1 << (first & 7)))
+  {
+    count=0;
+    while(TRUE)
+    {
+      if (egg_token_add(t1, dir, t2 = grammar_element()))
+      {
+        dir = egg_token_after;
+        t1 = t2;
+        ++count;
+      }
+      else
+        break;
+    }
+    if ((count >= 1))
+    {
+      count=0;
+      while(count < 1)
+      {
+        if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+        {
+          dir = egg_token_after;
+          t1 = t2;
+          ++count;
+        }
+        else
+          break;
+      }
+      if ((count >= 0) && (count <= 1))
+      {
+        nt = egg_token_new(egg_token_type_grammar);
+        if (!nt)
+        {
+          egg_token_arena_rewind(mark);
+          input_set_position(pos);
+          if (_callbacks[183].fail)
+            callback_by_index(&_cbt,
+                              183,
+                              fail,
+                              (void *)egg_token_type_grammar);
+
+          return NULL;
+        }
+        egg_token_set_offset(nt, pos);
+        egg_token_set_length(nt, input_get_position() - pos);
+        egg_token_add(nt, egg_token_below, head.descendant);
+
+        if (_callbacks[183].success)
+          callback_by_index(&_cbt,
+                            183,
+                            success,
+                            (void *)egg_token_type_grammar);
+
+        return nt;
+      }
+    }
+  }
+
+  egg_token_arena_rewind(mark);
+  input_set_position(pos);
+
+  if (_callbacks[183].fail)
+    callback_by_index(&_cbt,
+                      183,
+                      fail,
+                      (void *)egg_token_type_grammar);
+
+  return NULL;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    nul =               /0x00/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_nul(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x00)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    soh =               /0x01/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_soh(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x01)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    stx =               /0x02/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_stx(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x02)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    etx =               /0x03/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_etx(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x03)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    eot =               /0x04/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_eot(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x04)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    enq =               /0x05/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_enq(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x05)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    ack =               /0x06/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_ack(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x06)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    bel =               /0x07/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_bel(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x07)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    bs =                /0x08/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_bs(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x08)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    ht =                /0x09/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_ht(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x09)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    lf =                /0x0A/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_lf(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x0A)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    vt =                /0x0B/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_vt(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x0B)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    ff =                /0x0C/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_ff(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x0C)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    cr =                /0x0D/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_cr(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x0D)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    so =                /0x0E/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_so(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x0E)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    si =                /0x0F/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_si(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x0F)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    dle =               /0x10/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_dle(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x10)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    dc1 =               /0x11/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_dc1(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x11)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    dc2 =               /0x12/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_dc2(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x12)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    dc3 =               /0x13/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_dc3(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x13)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    dc4 =               /0x14/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_dc4(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x14)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    nak =               /0x15/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_nak(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x15)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    syn =               /0x16/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_syn(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x16)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    etb =               /0x17/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_etb(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x17)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    can =               /0x18/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_can(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x18)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    em =                /0x19/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_em(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x19)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    sub =               /0x1A/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_sub(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x1A)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    esc =               /0x1B/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_esc(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x1B)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    fs =                /0x1C/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_fs(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x1C)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    gs =                /0x1D/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_gs(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x1D)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    rs =                /0x1E/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_rs(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x1E)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    us =                /0x1F/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_us(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x1F)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    space =             /0x20/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_space(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x20)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    exclamation-point = /0x21/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_exclamation_point(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x21)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    quote =             /0x22/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_quote(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x22)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    number-sign =       /0x23/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_number_sign(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x23)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    dollar =            /0x24/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_dollar(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x24)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    percent =           /0x25/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_percent(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x25)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    ampersand =         /0x26/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_ampersand(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x26)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    single-quote =      /0x27/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_single_quote(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x27)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    open-parenthesis =  /0x28/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_open_parenthesis(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x28)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    close-parenthesis = /0x29/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_close_parenthesis(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x29)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    asterisk =          /0x2A/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_asterisk(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x2A)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    plus =              /0x2B/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_plus(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x2B)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    comma =             /0x2C/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_comma(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x2C)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    minus =             /0x2D/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_minus(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x2D)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    period =            /0x2E/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_period(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x2E)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    slash =             /0x2F/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_slash(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x2F)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    zero =              /0x30/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_zero(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x30)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    one =               /0x31/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_one(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x31)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    two =               /0x32/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_two(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x32)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    three =             /0x33/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_three(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x33)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    four =              /0x34/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_four(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x34)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    five =              /0x35/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_five(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x35)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    six =               /0x36/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_six(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x36)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    seven =             /0x37/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_seven(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x37)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    eight =             /0x38/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_eight(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x38)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    nine =              /0x39/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_nine(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x39)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    colon =             /0x3A/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_colon(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x3A)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    semicolon =         /0x3B/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_semicolon(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x3B)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    less-than =         /0x3C/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_less_than(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x3C)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    equal =             /0x3D/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_equal(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x3D)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    greater-than =      /0x3E/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_greater_than(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x3E)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    question-mark =     /0x3F/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_question_mark(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x3F)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    at =                /0x40/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_at(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x40)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    A =                 /0x41/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_A(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x41)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    B =                 /0x42/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_B(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x42)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    C =                 /0x43/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_C(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x43)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    D =                 /0x44/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_D(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x44)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    E =                 /0x45/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_E(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x45)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    F =                 /0x46/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_F(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x46)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    G =                 /0x47/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_G(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x47)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    H =                 /0x48/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_H(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x48)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    I =                 /0x49/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_I(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x49)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    J =                 /0x4A/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_J(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x4A)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    K =                 /0x4B/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_K(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x4B)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    L =                 /0x4C/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_L(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x4C)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    M =                 /0x4D/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_M(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x4D)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    N =                 /0x4E/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_N(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x4E)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    O =                 /0x4F/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_O(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x4F)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    P =                 /0x50/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_P(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x50)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    Q =                 /0x51/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_Q(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x51)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    R =                 /0x52/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_R(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x52)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    S =                 /0x53/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_S(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x53)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    T =                 /0x54/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_T(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x54)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    U =                 /0x55/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_U(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x55)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    V =                 /0x56/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_V(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x56)
+  {
+    return 1;
+  }
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    W =                 /0x57/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = sub()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+long recognize_W(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = esc()))
+  first = input_byte();
+  if (first == 0x57)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = fs()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = gs()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    X =                 /0x58/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = rs()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = us()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
+long recognize_X(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = del()))
+  first = input_byte();
+  if (first == 0x58)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      128,
-                      success,
-                      (void *)egg_token_type_control_character);
-
-    return nt;
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    128,
-                    fail,
-                    (void *)egg_token_type_control_character);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    upper-case-letter = A | B | C | D | E | F | G | H | I | J | K | L | M
-                      | N | O | P | Q | R | S | T | U | V | W | X | Y | Z
-                      ;
+    Y =                 /0x59/ ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *upper_case_letter(void)
+long recognize_Y(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    129,
-                    entry,
-                    (void *)egg_token_type_upper_case_letter);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
+    return -1;
 
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_upper_case_letter);
-  if (!nt)
+  first = input_byte();
+  if (first == 0x59)
   {
-    callback_by_index(&_cbt,
-                      129,
-                      fail,
-                      (void *)egg_token_type_upper_case_letter);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = A()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+  return -1;
+}
 
-    return nt;
-  }
+  /*!
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = B()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+    @par "EGG Phrase Definition"
+    @verbatim
+    Z =                 /0x5A/ ;
+    @endverbatim
 
-    return nt;
-  }
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = C()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+ */
 
-    return nt;
-  }
+long recognize_Z(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = D()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+  if (input_eof())
+    return -1;
 
-    return nt;
+  first = input_byte();
+  if (first == 0x5A)
+  {
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = E()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = F()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    open-bracket =      /0x5B/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = G()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = H()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+long recognize_open_bracket(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = I()))
+  first = input_byte();
+  if (first == 0x5B)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = J()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = K()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    back-slash =        /0x5C/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = L()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = M()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+long recognize_back_slash(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = N()))
+  first = input_byte();
+  if (first == 0x5C)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = O()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = P()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    close-bracket =     /0x5D/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = Q()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = R()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+long recognize_close_bracket(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = S()))
+  first = input_byte();
+  if (first == 0x5D)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = T()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    carat =             /0x5E/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
 
-    return nt;
-  }
+long recognize_carat(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = U()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+  if (input_eof())
+    return -1;
 
-    return nt;
+  first = input_byte();
+  if (first == 0x5E)
+  {
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = V()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = W()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    underscore =        /0x5F/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = X()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = Y()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
+long recognize_underscore(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = Z()))
+  first = input_byte();
+  if (first == 0x5F)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      129,
-                      success,
-                      (void *)egg_token_type_upper_case_letter);
-
-    return nt;
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    129,
-                    fail,
-                    (void *)egg_token_type_upper_case_letter);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    lower-case-letter = a | b | c | d | e | f | g | h | i | j | k | l | m
-                      | n | o | p | q | r | s | t | u | v | w | x | y | z
-                      ;
+    back-quote =        /0x60/ ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *lower_case_letter(void)
+long recognize_back_quote(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    130,
-                    entry,
-                    (void *)egg_token_type_lower_case_letter);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_lower_case_letter);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      130,
-                      fail,
-                      (void *)egg_token_type_lower_case_letter);
-    return NULL;
-  }
-
-  t1 = nt;
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = a()))
+  first = input_byte();
+  if (first == 0x60)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = b()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = c()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    a =                 /0x61/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = d()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = e()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+long recognize_a(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = f()))
+  first = input_byte();
+  if (first == 0x61)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = g()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = h()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    b =                 /0x62/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = i()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = j()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+long recognize_b(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = k()))
+  first = input_byte();
+  if (first == 0x62)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = l()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = m()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    c =                 /0x63/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = n()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = o()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+long recognize_c(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = p()))
+  first = input_byte();
+  if (first == 0x63)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = q()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = r()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    d =                 /0x64/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = s()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = t()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+long recognize_d(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = u()))
+  first = input_byte();
+  if (first == 0x64)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = v()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = w()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    e =                 /0x65/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = x()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = y()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
+long recognize_e(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = z()))
+  first = input_byte();
+  if (first == 0x65)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      130,
-                      success,
-                      (void *)egg_token_type_lower_case_letter);
-
-    return nt;
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    130,
-                    fail,
-                    (void *)egg_token_type_lower_case_letter);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    letter = upper-case-letter | lower-case-letter ;
+    f =                 /0x66/ ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *letter(void)
+long recognize_f(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    131,
-                    entry,
-                    (void *)egg_token_type_letter);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_letter);
-  if (!nt)
+  first = input_byte();
+  if (first == 0x66)
   {
-    callback_by_index(&_cbt,
-                      131,
-                      fail,
-                      (void *)egg_token_type_letter);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = upper_case_letter()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      131,
-                      success,
-                      (void *)egg_token_type_letter);
+  return -1;
+}
 
-    return nt;
-  }
+  /*!
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = lower_case_letter()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      131,
-                      success,
-                      (void *)egg_token_type_letter);
+    @par "EGG Phrase Definition"
+    @verbatim
+    g =                 /0x67/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
+ */
+
+long recognize_g(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x67)
+  {
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    131,
-                    fail,
-                    (void *)egg_token_type_letter);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    binary-digit = zero | one ;
+    h =                 /0x68/ ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *binary_digit(void)
+long recognize_h(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    132,
-                    entry,
-                    (void *)egg_token_type_binary_digit);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_binary_digit);
-  if (!nt)
+  first = input_byte();
+  if (first == 0x68)
   {
-    callback_by_index(&_cbt,
-                      132,
-                      fail,
-                      (void *)egg_token_type_binary_digit);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = zero()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      132,
-                      success,
-                      (void *)egg_token_type_binary_digit);
+  return -1;
+}
 
-    return nt;
-  }
+  /*!
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = one()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      132,
-                      success,
-                      (void *)egg_token_type_binary_digit);
+    @par "EGG Phrase Definition"
+    @verbatim
+    i =                 /0x69/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_i(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if (first == 0x69)
+  {
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    132,
-                    fail,
-                    (void *)egg_token_type_binary_digit);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    octal-digit = zero | one | two | three | four | five | six | seven ;
+    j =                 /0x6A/ ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *octal_digit(void)
+long recognize_j(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    133,
-                    entry,
-                    (void *)egg_token_type_octal_digit);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
+    return -1;
 
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_octal_digit);
-  if (!nt)
+  first = input_byte();
+  if (first == 0x6A)
   {
-    callback_by_index(&_cbt,
-                      133,
-                      fail,
-                      (void *)egg_token_type_octal_digit);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = zero()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      133,
-                      success,
-                      (void *)egg_token_type_octal_digit);
+  return -1;
+}
 
-    return nt;
-  }
+  /*!
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = one()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      133,
-                      success,
-                      (void *)egg_token_type_octal_digit);
+    @par "EGG Phrase Definition"
+    @verbatim
+    k =                 /0x6B/ ;
+    @endverbatim
 
-    return nt;
-  }
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = two()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      133,
-                      success,
-                      (void *)egg_token_type_octal_digit);
+ */
 
-    return nt;
-  }
+long recognize_k(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = three()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      133,
-                      success,
-                      (void *)egg_token_type_octal_digit);
+  if (input_eof())
+    return -1;
 
-    return nt;
+  first = input_byte();
+  if (first == 0x6B)
+  {
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = four()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      133,
-                      success,
-                      (void *)egg_token_type_octal_digit);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = five()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      133,
-                      success,
-                      (void *)egg_token_type_octal_digit);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    l =                 /0x6C/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = six()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      133,
-                      success,
-                      (void *)egg_token_type_octal_digit);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = seven()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      133,
-                      success,
-                      (void *)egg_token_type_octal_digit);
+long recognize_l(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
 
-    return nt;
+  first = input_byte();
+  if (first == 0x6C)
+  {
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    133,
-                    fail,
-                    (void *)egg_token_type_octal_digit);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    decimal-digit = zero | one | two | three | four
-                  | five | six | seven | eight | nine ;
+    m =                 /0x6D/ ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *decimal_digit(void)
+long recognize_m(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    134,
-                    entry,
-                    (void *)egg_token_type_decimal_digit);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
+    return -1;
 
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_decimal_digit);
-  if (!nt)
+  first = input_byte();
+  if (first == 0x6D)
   {
-    callback_by_index(&_cbt,
-                      134,
-                      fail,
-                      (void *)egg_token_type_decimal_digit);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = zero()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      134,
-                      success,
-                      (void *)egg_token_type_decimal_digit);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = one()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      134,
-                      success,
-                      (void *)egg_token_type_decimal_digit);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    n =                 /0x6E/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = two()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      134,
-                      success,
-                      (void *)egg_token_type_decimal_digit);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = three()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      134,
-                      success,
-                      (void *)egg_token_type_decimal_digit);
+long recognize_n(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = four()))
+  first = input_byte();
+  if (first == 0x6E)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      134,
-                      success,
-                      (void *)egg_token_type_decimal_digit);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = five()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      134,
-                      success,
-                      (void *)egg_token_type_decimal_digit);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = six()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      134,
-                      success,
-                      (void *)egg_token_type_decimal_digit);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    o =                 /0x6F/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = seven()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      134,
-                      success,
-                      (void *)egg_token_type_decimal_digit);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = eight()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      134,
-                      success,
-                      (void *)egg_token_type_decimal_digit);
+long recognize_o(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = nine()))
+  first = input_byte();
+  if (first == 0x6F)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      134,
-                      success,
-                      (void *)egg_token_type_decimal_digit);
-
-    return nt;
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    134,
-                    fail,
-                    (void *)egg_token_type_decimal_digit);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    hexadecimal-digit = zero | one | two | three | four
-                      | five | six | seven | eight | nine
-                      | A | B | C | D | E | F
-                      | a | b | c | d | e | f ;
+    p =                 /0x70/ ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *hexadecimal_digit(void)
+long recognize_p(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    135,
-                    entry,
-                    (void *)egg_token_type_hexadecimal_digit);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
+    return -1;
 
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_hexadecimal_digit);
-  if (!nt)
+  first = input_byte();
+  if (first == 0x70)
   {
-    callback_by_index(&_cbt,
-                      135,
-                      fail,
-                      (void *)egg_token_type_hexadecimal_digit);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = zero()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+  return -1;
+}
 
-    return nt;
-  }
+  /*!
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = one()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+    @par "EGG Phrase Definition"
+    @verbatim
+    q =                 /0x71/ ;
+    @endverbatim
 
-    return nt;
-  }
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = two()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+ */
 
-    return nt;
-  }
+long recognize_q(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = three()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+  if (input_eof())
+    return -1;
 
-    return nt;
+  first = input_byte();
+  if (first == 0x71)
+  {
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = four()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = five()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    r =                 /0x72/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = six()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = seven()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+long recognize_r(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = eight()))
+  first = input_byte();
+  if (first == 0x72)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = nine()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = A()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    s =                 /0x73/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = B()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = C()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+long recognize_s(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = D()))
+  first = input_byte();
+  if (first == 0x73)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = E()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = F()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    t =                 /0x74/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = a()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = b()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+long recognize_t(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = c()))
+  first = input_byte();
+  if (first == 0x74)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = d()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = e()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    u =                 /0x75/ ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
 
-    return nt;
-  }
+long recognize_u(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = f()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      135,
-                      success,
-                      (void *)egg_token_type_hexadecimal_digit);
+  if (input_eof())
+    return -1;
 
-    return nt;
+  first = input_byte();
+  if (first == 0x75)
+  {
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    135,
-                    fail,
-                    (void *)egg_token_type_hexadecimal_digit);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    white-space = space | ht | lf | vt | ff | cr ;
+    v =                 /0x76/ ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *white_space(void)
+long recognize_v(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    136,
-                    entry,
-                    (void *)egg_token_type_white_space);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_white_space);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      136,
-                      fail,
-                      (void *)egg_token_type_white_space);
-    return NULL;
-  }
-
-  t1 = nt;
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = space()))
+  first = input_byte();
+  if (first == 0x76)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      136,
-                      success,
-                      (void *)egg_token_type_white_space);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = ht()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      136,
-                      success,
-                      (void *)egg_token_type_white_space);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = lf()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      136,
-                      success,
-                      (void *)egg_token_type_white_space);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    w =                 /0x77/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = vt()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      136,
-                      success,
-                      (void *)egg_token_type_white_space);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = ff()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      136,
-                      success,
-                      (void *)egg_token_type_white_space);
+long recognize_w(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = cr()))
+  first = input_byte();
+  if (first == 0x77)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      136,
-                      success,
-                      (void *)egg_token_type_white_space);
-
-    return nt;
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    136,
-                    fail,
-                    (void *)egg_token_type_white_space);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    common-character = exclamation-point | number-sign | dollar | percent
-                     | ampersand | plus | comma | minus | period | colon
-                     | semicolon | less-than | equal | greater-than
-                     | question-mark | at | open-bracket | back-slash
-                     | close-bracket | carat | underscore | back-quote
-                     | open-brace | bar | close-brace | tilde | letter
-                     | decimal-digit ;
+    x =                 /0x78/ ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *common_character(void)
+long recognize_x(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    137,
-                    entry,
-                    (void *)egg_token_type_common_character);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
+    return -1;
 
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_common_character);
-  if (!nt)
+  first = input_byte();
+  if (first == 0x78)
   {
-    callback_by_index(&_cbt,
-                      137,
-                      fail,
-                      (void *)egg_token_type_common_character);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = exclamation_point()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+  return -1;
+}
 
-    return nt;
-  }
+  /*!
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = number_sign()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+    @par "EGG Phrase Definition"
+    @verbatim
+    y =                 /0x79/ ;
+    @endverbatim
 
-    return nt;
-  }
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = dollar()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+ */
 
-    return nt;
-  }
+long recognize_y(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = percent()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+  if (input_eof())
+    return -1;
 
-    return nt;
+  first = input_byte();
+  if (first == 0x79)
+  {
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = ampersand()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = plus()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    z =                 /0x7A/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = comma()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = minus()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+long recognize_z(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = period()))
+  first = input_byte();
+  if (first == 0x7A)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = colon()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = semicolon()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    open-brace =        /0x7B/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = less_than()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = equal()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+long recognize_open_brace(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = greater_than()))
+  first = input_byte();
+  if (first == 0x7B)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = question_mark()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = at()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    bar =               /0x7C/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = open_bracket()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = back_slash()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+long recognize_bar(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
 
-    return nt;
+  first = input_byte();
+  if (first == 0x7C)
+  {
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = close_bracket()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = carat()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    close-brace =       /0x7D/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = underscore()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = back_quote()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+long recognize_close_brace(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = open_brace()))
+  first = input_byte();
+  if (first == 0x7D)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
-
-    return nt;
+    return 1;
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = bar()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = close_brace()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    tilde =             /0x7E/ ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = tilde()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = letter()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
+long recognize_tilde(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = decimal_digit()))
+  first = input_byte();
+  if (first == 0x7E)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      137,
-                      success,
-                      (void *)egg_token_type_common_character);
-
-    return nt;
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    137,
-                    fail,
-                    (void *)egg_token_type_common_character);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    literal-character = common-character
-                      | space
-                      | open-parenthesis
-                      | close-parenthesis
-                      | asterisk ;
+    del =               /0x7F/ ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *literal_character(void)
+long recognize_del(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    138,
-                    entry,
-                    (void *)egg_token_type_literal_character);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_literal_character);
-  if (!nt)
+  first = input_byte();
+  if (first == 0x7F)
   {
-    callback_by_index(&_cbt,
-                      138,
-                      fail,
-                      (void *)egg_token_type_literal_character);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = common_character()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      138,
-                      success,
-                      (void *)egg_token_type_literal_character);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = space()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      138,
-                      success,
-                      (void *)egg_token_type_literal_character);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    control-character = nul | soh | stx | etx | eot | enq | ack | bel | bs
+                      | so | si | dle | dc1 | dc2 | dc3 | dc4 | nak | syn
+                      | etb | can | em | sub | esc | fs | gs | rs | us
+                      | del ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = open_parenthesis()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      138,
-                      success,
-                      (void *)egg_token_type_literal_character);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = close_parenthesis()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      138,
-                      success,
-                      (void *)egg_token_type_literal_character);
+long recognize_control_character(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = asterisk()))
+  first = input_byte();
+  if ((first <= 0x08) ||
+      ((first >= 0x0E) && (first <= 0x1F)) ||
+      (first == 0x7F))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      138,
-                      success,
-                      (void *)egg_token_type_literal_character);
-
-    return nt;
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    138,
-                    fail,
-                    (void *)egg_token_type_literal_character);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    comment-basic-character = common-character
-                            | white-space
-                            | quote
-                            | single-quote
-                            | slash ;
+    upper-case-letter = A | B | C | D | E | F | G | H | I | J | K | L | M
+                      | N | O | P | Q | R | S | T | U | V | W | X | Y | Z
+                      ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *comment_basic_character(void)
+long recognize_upper_case_letter(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    139,
-                    entry,
-                    (void *)egg_token_type_comment_basic_character);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_comment_basic_character);
-  if (!nt)
+  first = input_byte();
+  if ((first >= 0x41) && (first <= 0x5A))
   {
-    callback_by_index(&_cbt,
-                      139,
-                      fail,
-                      (void *)egg_token_type_comment_basic_character);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = common_character()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      139,
-                      success,
-                      (void *)egg_token_type_comment_basic_character);
+  input_set_position(pos);
 
-    return nt;
-  }
+  return -1;
+}
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = white_space()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      139,
-                      success,
-                      (void *)egg_token_type_comment_basic_character);
+  /*!
 
-    return nt;
-  }
+    @par "EGG Phrase Definition"
+    @verbatim
+    lower-case-letter = a | b | c | d | e | f | g | h | i | j | k | l | m
+                      | n | o | p | q | r | s | t | u | v | w | x | y | z
+                      ;
+    @endverbatim
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = quote()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      139,
-                      success,
-                      (void *)egg_token_type_comment_basic_character);
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-    return nt;
-  }
+ */
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = single_quote()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      139,
-                      success,
-                      (void *)egg_token_type_comment_basic_character);
+long recognize_lower_case_letter(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = slash()))
+  first = input_byte();
+  if ((first >= 0x61) && (first <= 0x7A))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      139,
-                      success,
-                      (void *)egg_token_type_comment_basic_character);
-
-    return nt;
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    139,
-                    fail,
-                    (void *)egg_token_type_comment_basic_character);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    non-comment-start-character = comment-basic-character
-                                | close-parenthesis ;
+    letter = upper-case-letter | lower-case-letter ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *non_comment_start_character(void)
+long recognize_letter(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    140,
-                    entry,
-                    (void *)egg_token_type_non_comment_start_character);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_non_comment_start_character);
-  if (!nt)
+  first = input_byte();
+  if (((first >= 0x41) && (first <= 0x5A)) ||
+      ((first >= 0x61) && (first <= 0x7A)))
   {
-    callback_by_index(&_cbt,
-                      140,
-                      fail,
-                      (void *)egg_token_type_non_comment_start_character);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = comment_basic_character()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      140,
-                      success,
-                      (void *)egg_token_type_non_comment_start_character);
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    binary-digit = zero | one ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_binary_digit(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-    return nt;
-  }
+  if (input_eof())
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = close_parenthesis()))
+  first = input_byte();
+  if ((first >= 0x30) && (first <= 0x31))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      140,
-                      success,
-                      (void *)egg_token_type_non_comment_start_character);
-
-    return nt;
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    140,
-                    fail,
-                    (void *)egg_token_type_non_comment_start_character);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    non-comment-end-character = comment-basic-character
-                              | open-parenthesis ;
+    octal-digit = zero | one | two | three | four | five | six | seven ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *non_comment_end_character(void)
+long recognize_octal_digit(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    141,
-                    entry,
-                    (void *)egg_token_type_non_comment_end_character);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_non_comment_end_character);
-  if (!nt)
+  first = input_byte();
+  if ((first >= 0x30) && (first <= 0x37))
   {
-    callback_by_index(&_cbt,
-                      141,
-                      fail,
-                      (void *)egg_token_type_non_comment_end_character);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = comment_basic_character()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      141,
-                      success,
-                      (void *)egg_token_type_non_comment_end_character);
+  return -1;
+}
 
-    return nt;
-  }
+  /*!
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = open_parenthesis()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      141,
-                      success,
-                      (void *)egg_token_type_non_comment_end_character);
+    @par "EGG Phrase Definition"
+    @verbatim
+    decimal-digit = zero | one | two | three | four
+                  | five | six | seven | eight | nine ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_decimal_digit(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
 
-    return nt;
+  first = input_byte();
+  if ((first >= 0x30) && (first <= 0x39))
+  {
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    141,
-                    fail,
-                    (void *)egg_token_type_non_comment_end_character);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    non-comment-start-sequence = open-parenthesis
-                                 + non-comment-start-character ;
+    hexadecimal-digit = zero | one | two | three | four
+                      | five | six | seven | eight | nine
+                      | A | B | C | D | E | F
+                      | a | b | c | d | e | f ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *non_comment_start_sequence(void)
+long recognize_hexadecimal_digit(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    142,
-                    entry,
-                    (void *)egg_token_type_non_comment_start_sequence);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_non_comment_start_sequence);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      142,
-                      fail,
-                      (void *)egg_token_type_non_comment_start_sequence);
-    return NULL;
-  }
-
-  t1 = nt;
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = open_parenthesis()))
+  first = input_byte();
+  if (((first >= 0x30) && (first <= 0x39)) ||
+      ((first >= 0x41) && (first <= 0x46)) ||
+      ((first >= 0x61) && (first <= 0x66)))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    if (egg_token_add(t1, dir, t2 = non_comment_start_character()))
-    {
-      dir = egg_token_after;
-      t1 = t2;
-      callback_by_index(&_cbt,
-                        142,
-                        success,
-                        (void *)egg_token_type_non_comment_start_sequence);
-
-      return nt;
-    }
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    142,
-                    fail,
-                    (void *)egg_token_type_non_comment_start_sequence);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    non-comment-end-sequence = asterisk
-                               + non-comment-end-character ;
+    white-space = space | ht | lf | vt | ff | cr ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *non_comment_end_sequence(void)
+long recognize_white_space(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    143,
-                    entry,
-                    (void *)egg_token_type_non_comment_end_sequence);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_non_comment_end_sequence);
-  if (!nt)
+  first = input_byte();
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      (first == 0x20))
   {
-    callback_by_index(&_cbt,
-                      143,
-                      fail,
-                      (void *)egg_token_type_non_comment_end_sequence);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = asterisk()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    if (egg_token_add(t1, dir, t2 = non_comment_end_character()))
-    {
-      dir = egg_token_after;
-      t1 = t2;
-      callback_by_index(&_cbt,
-                        143,
-                        success,
-                        (void *)egg_token_type_non_comment_end_sequence);
+  return -1;
+}
 
-      return nt;
-    }
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    common-character = exclamation-point | number-sign | dollar | percent
+                     | ampersand | plus | comma | minus | period | colon
+                     | semicolon | less-than | equal | greater-than
+                     | question-mark | at | open-bracket | back-slash
+                     | close-bracket | carat | underscore | back-quote
+                     | open-brace | bar | close-brace | tilde | letter
+                     | decimal-digit ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_common_character(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  if ((first == 0x21) ||
+      ((first >= 0x23) && (first <= 0x26)) ||
+      ((first >= 0x2B) && (first <= 0x2E)) ||
+      ((first >= 0x30) && (first <= 0x7E)))
+  {
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    143,
-                    fail,
-                    (void *)egg_token_type_non_comment_end_sequence);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    comment-character = comment-basic-character
-                      | non-comment-start-sequence
-                      | non-comment-end-sequence
-                      | close-parenthesis ;
+    literal-character = common-character
+                      | space
+                      | open-parenthesis
+                      | close-parenthesis
+                      | asterisk ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *comment_character(void)
+long recognize_literal_character(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    144,
-                    entry,
-                    (void *)egg_token_type_comment_character);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_comment_character);
-  if (!nt)
+  first = input_byte();
+  if (((first >= 0x20) && (first <= 0x21)) ||
+      ((first >= 0x23) && (first <= 0x26)) ||
+      ((first >= 0x28) && (first <= 0x2E)) ||
+      ((first >= 0x30) && (first <= 0x7E)))
   {
-    callback_by_index(&_cbt,
-                      144,
-                      fail,
-                      (void *)egg_token_type_comment_character);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = comment_basic_character()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      144,
-                      success,
-                      (void *)egg_token_type_comment_character);
+  return -1;
+}
 
-    return nt;
-  }
+  /*!
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = non_comment_start_sequence()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      144,
-                      success,
-                      (void *)egg_token_type_comment_character);
+    @par "EGG Phrase Definition"
+    @verbatim
+    comment-basic-character = common-character
+                            | white-space
+                            | quote
+                            | single-quote
+                            | slash ;
+    @endverbatim
 
-    return nt;
-  }
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = non_comment_end_sequence()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      144,
-                      success,
-                      (void *)egg_token_type_comment_character);
+ */
 
-    return nt;
-  }
+long recognize_comment_basic_character(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = close_parenthesis()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      144,
-                      success,
-                      (void *)egg_token_type_comment_character);
+  if (input_eof())
+    return -1;
 
-    return nt;
+  first = input_byte();
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      ((first >= 0x20) && (first <= 0x27)) ||
+      ((first >= 0x2B) && (first <= 0x7E)))
+  {
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    144,
-                    fail,
-                    (void *)egg_token_type_comment_character);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    single-quoted-character = literal-character | quote ;
+    non-comment-start-character = comment-basic-character
+                                | close-parenthesis ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *single_quoted_character(void)
+long recognize_non_comment_start_character(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    145,
-                    entry,
-                    (void *)egg_token_type_single_quoted_character);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_single_quoted_character);
-  if (!nt)
+  first = input_byte();
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      ((first >= 0x20) && (first <= 0x27)) ||
+      (first == 0x29) ||
+      ((first >= 0x2B) && (first <= 0x7E)))
   {
-    callback_by_index(&_cbt,
-                      145,
-                      fail,
-                      (void *)egg_token_type_single_quoted_character);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = literal_character()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      145,
-                      success,
-                      (void *)egg_token_type_single_quoted_character);
+  return -1;
+}
 
-    return nt;
-  }
+  /*!
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = quote()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      145,
-                      success,
-                      (void *)egg_token_type_single_quoted_character);
+    @par "EGG Phrase Definition"
+    @verbatim
+    non-comment-end-character = comment-basic-character
+                              | open-parenthesis ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_non_comment_end_character(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
 
-    return nt;
+  first = input_byte();
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      ((first >= 0x20) && (first <= 0x28)) ||
+      ((first >= 0x2B) && (first <= 0x7E)))
+  {
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    145,
-                    fail,
-                    (void *)egg_token_type_single_quoted_character);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    quoted-character = literal-character | single-quote ;
+    non-comment-start-sequence = open-parenthesis
+                                 + non-comment-start-character ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *quoted_character(void)
+long recognize_non_comment_start_sequence(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    146,
-                    entry,
-                    (void *)egg_token_type_quoted_character);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_quoted_character);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      146,
-                      fail,
-                      (void *)egg_token_type_quoted_character);
-    return NULL;
-  }
-
-  t1 = nt;
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = literal_character()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      146,
-                      success,
-                      (void *)egg_token_type_quoted_character);
+  first = input_byte();
+  input_set_position(pos);
 
-    return nt;
-  }
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = single_quote()))
+  if (first == 0x28)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      146,
-                      success,
-                      (void *)egg_token_type_quoted_character);
-
-    return nt;
+    if (recognize_open_parenthesis() >= 0)
+    {
+      if (recognize_non_comment_start_character() >= 0)
+      {
+        return input_get_position() - pos;
+      }
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    146,
-                    fail,
-                    (void *)egg_token_type_quoted_character);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    phrase-conjugator = underscore | minus ;
+    non-comment-end-sequence = asterisk
+                               + non-comment-end-character ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *phrase_conjugator(void)
+long recognize_non_comment_end_sequence(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    147,
-                    entry,
-                    (void *)egg_token_type_phrase_conjugator);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_phrase_conjugator);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      147,
-                      fail,
-                      (void *)egg_token_type_phrase_conjugator);
-    return NULL;
-  }
+    return -1;
 
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = underscore()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      147,
-                      success,
-                      (void *)egg_token_type_phrase_conjugator);
+  first = input_byte();
+  input_set_position(pos);
 
-    return nt;
-  }
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = minus()))
+  if (first == 0x2A)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      147,
-                      success,
-                      (void *)egg_token_type_phrase_conjugator);
-
-    return nt;
+    if (recognize_asterisk() >= 0)
+    {
+      if (recognize_non_comment_end_character() >= 0)
+      {
+        return input_get_position() - pos;
+      }
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    147,
-                    fail,
-                    (void *)egg_token_type_phrase_conjugator);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    phrase-name-character = letter | decimal-digit | phrase-conjugator ;
+    comment-character = comment-basic-character
+                      | non-comment-start-sequence
+                      | non-comment-end-sequence
+                      | close-parenthesis ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *phrase_name_character(void)
+long recognize_comment_character(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    148,
-                    entry,
-                    (void *)egg_token_type_phrase_name_character);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
+    return -1;
 
-  count = 0;
+  first = input_byte();
+  input_set_position(pos);
 
-  nt = t1 = t2 = NULL;
+  count = 0;
 
-  nt = egg_token_new(egg_token_type_phrase_name_character);
-  if (!nt)
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      ((first >= 0x20) && (first <= 0x27)) ||
+      ((first >= 0x2B) && (first <= 0x7E)))
   {
-    callback_by_index(&_cbt,
-                      148,
-                      fail,
-                      (void *)egg_token_type_phrase_name_character);
-    return NULL;
+    if (recognize_comment_basic_character() >= 0)
+    {
+      return input_get_position() - pos;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = letter()))
+  if (first == 0x28)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      148,
-                      success,
-                      (void *)egg_token_type_phrase_name_character);
-
-    return nt;
+    if (recognize_non_comment_start_sequence() >= 0)
+    {
+      return input_get_position() - pos;
+    }
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = decimal_digit()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      148,
-                      success,
-                      (void *)egg_token_type_phrase_name_character);
+  input_set_position(pos);
 
-    return nt;
+  if (first == 0x2A)
+  {
+    if (recognize_non_comment_end_sequence() >= 0)
+    {
+      return input_get_position() - pos;
+    }
   }
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = phrase_conjugator()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      148,
-                      success,
-                      (void *)egg_token_type_phrase_name_character);
+  input_set_position(pos);
 
-    return nt;
+  if (first == 0x29)
+  {
+    if (recognize_close_parenthesis() >= 0)
+    {
+      return input_get_position() - pos;
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    148,
-                    fail,
-                    (void *)egg_token_type_phrase_name_character);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    binary-indicator = b | B ;
+    single-quoted-character = literal-character | quote ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *binary_indicator(void)
+long recognize_single_quoted_character(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    149,
-                    entry,
-                    (void *)egg_token_type_binary_indicator);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_binary_indicator);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      149,
-                      fail,
-                      (void *)egg_token_type_binary_indicator);
-    return NULL;
-  }
-
-  t1 = nt;
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = b()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      149,
-                      success,
-                      (void *)egg_token_type_binary_indicator);
-
-    return nt;
-  }
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = B()))
+  first = input_byte();
+  if (((first >= 0x20) && (first <= 0x26)) ||
+      ((first >= 0x28) && (first <= 0x2E)) ||
+      ((first >= 0x30) && (first <= 0x7E)))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      149,
-                      success,
-                      (void *)egg_token_type_binary_indicator);
-
-    return nt;
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    149,
-                    fail,
-                    (void *)egg_token_type_binary_indicator);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    octal-indicator = o | O ;
+    quoted-character = literal-character | single-quote ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *octal_indicator(void)
+long recognize_quoted_character(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    150,
-                    entry,
-                    (void *)egg_token_type_octal_indicator);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_octal_indicator);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      150,
-                      fail,
-                      (void *)egg_token_type_octal_indicator);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = o()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      150,
-                      success,
-                      (void *)egg_token_type_octal_indicator);
-
-    return nt;
-  }
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = O()))
+  first = input_byte();
+  if (((first >= 0x20) && (first <= 0x21)) ||
+      ((first >= 0x23) && (first <= 0x2E)) ||
+      ((first >= 0x30) && (first <= 0x7E)))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      150,
-                      success,
-                      (void *)egg_token_type_octal_indicator);
-
-    return nt;
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    150,
-                    fail,
-                    (void *)egg_token_type_octal_indicator);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    hexadecimal-indicator = x | X ;
+    phrase-conjugator = underscore | minus ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *hexadecimal_indicator(void)
+long recognize_phrase_conjugator(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    151,
-                    entry,
-                    (void *)egg_token_type_hexadecimal_indicator);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_hexadecimal_indicator);
-  if (!nt)
+  first = input_byte();
+  if ((first == 0x2D) ||
+      (first == 0x5F))
   {
-    callback_by_index(&_cbt,
-                      151,
-                      fail,
-                      (void *)egg_token_type_hexadecimal_indicator);
-    return NULL;
+    return 1;
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = x()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      151,
-                      success,
-                      (void *)egg_token_type_hexadecimal_indicator);
+  return -1;
+}
 
-    return nt;
-  }
+  /*!
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = X()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      151,
-                      success,
-                      (void *)egg_token_type_hexadecimal_indicator);
+    @par "EGG Phrase Definition"
+    @verbatim
+    phrase-name-character = letter | decimal-digit | phrase-conjugator ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_phrase_name_character(void)
+{
+  long pos = input_get_position();
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
 
-    return nt;
+  first = input_byte();
+  if ("\x00\x00\x00\x00\x00\x20\xff\x03\xfe\xff\xff\x87\xfe\xff\xff\x07"
+      "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        [first >> 3] & (1 << (first & 7)))
+  {
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    151,
-                    fail,
-                    (void *)egg_token_type_hexadecimal_indicator);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    comment-start-symbol = open-parenthesis + asterisk ;
+    binary-indicator = b | B ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *comment_start_symbol(void)
+long recognize_binary_indicator(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    152,
-                    entry,
-                    (void *)egg_token_type_comment_start_symbol);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_comment_start_symbol);
-  if (!nt)
+  first = input_byte();
+  if ((first == 0x42) ||
+      (first == 0x62))
   {
-    callback_by_index(&_cbt,
-                      152,
-                      fail,
-                      (void *)egg_token_type_comment_start_symbol);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = open_parenthesis()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    if (egg_token_add(t1, dir, t2 = asterisk()))
-    {
-      dir = egg_token_after;
-      t1 = t2;
-      callback_by_index(&_cbt,
-                        152,
-                        success,
-                        (void *)egg_token_type_comment_start_symbol);
-
-      return nt;
-    }
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    152,
-                    fail,
-                    (void *)egg_token_type_comment_start_symbol);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    comment-end-symbol = asterisk + close-parenthesis ;
+    octal-indicator = o | O ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *comment_end_symbol(void)
+long recognize_octal_indicator(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    153,
-                    entry,
-                    (void *)egg_token_type_comment_end_symbol);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_comment_end_symbol);
-  if (!nt)
+  first = input_byte();
+  if ((first == 0x4F) ||
+      (first == 0x6F))
   {
-    callback_by_index(&_cbt,
-                      153,
-                      fail,
-                      (void *)egg_token_type_comment_end_symbol);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = asterisk()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    if (egg_token_add(t1, dir, t2 = close_parenthesis()))
-    {
-      dir = egg_token_after;
-      t1 = t2;
-      callback_by_index(&_cbt,
-                        153,
-                        success,
-                        (void *)egg_token_type_comment_end_symbol);
-
-      return nt;
-    }
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    153,
-                    fail,
-                    (void *)egg_token_type_comment_end_symbol);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    alternation-symbol = bar ;
+    hexadecimal-indicator = x | X ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *alternation_symbol(void)
+long recognize_hexadecimal_indicator(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    154,
-                    entry,
-                    (void *)egg_token_type_alternation_symbol);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_alternation_symbol);
-  if (!nt)
+  first = input_byte();
+  if ((first == 0x58) ||
+      (first == 0x78))
   {
-    callback_by_index(&_cbt,
-                      154,
-                      fail,
-                      (void *)egg_token_type_alternation_symbol);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = bar()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      154,
-                      success,
-                      (void *)egg_token_type_alternation_symbol);
-
-    return nt;
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    154,
-                    fail,
-                    (void *)egg_token_type_alternation_symbol);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    concatenation-symbol = plus ;
+    comment-start-symbol = open-parenthesis + asterisk ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *concatenation_symbol(void)
+long recognize_comment_start_symbol(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    155,
-                    entry,
-                    (void *)egg_token_type_concatenation_symbol);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
+    return -1;
 
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_concatenation_symbol);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      155,
-                      fail,
-                      (void *)egg_token_type_concatenation_symbol);
-    return NULL;
-  }
+  first = input_byte();
+  input_set_position(pos);
 
-  t1 = nt;
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = plus()))
+  if (first == 0x28)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      155,
-                      success,
-                      (void *)egg_token_type_concatenation_symbol);
-
-    return nt;
+    if (recognize_open_parenthesis() >= 0)
+    {
+      if (recognize_asterisk() >= 0)
+      {
+        return input_get_position() - pos;
+      }
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    155,
-                    fail,
-                    (void *)egg_token_type_concatenation_symbol);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    phrase-terminator-symbol = semicolon ;
+    comment-end-symbol = asterisk + close-parenthesis ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *phrase_terminator_symbol(void)
+long recognize_comment_end_symbol(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    156,
-                    entry,
-                    (void *)egg_token_type_phrase_terminator_symbol);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
+    return -1;
 
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_phrase_terminator_symbol);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      156,
-                      fail,
-                      (void *)egg_token_type_phrase_terminator_symbol);
-    return NULL;
-  }
+  first = input_byte();
+  input_set_position(pos);
 
-  t1 = nt;
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = semicolon()))
+  if (first == 0x2A)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      156,
-                      success,
-                      (void *)egg_token_type_phrase_terminator_symbol);
-
-    return nt;
+    if (recognize_asterisk() >= 0)
+    {
+      if (recognize_close_parenthesis() >= 0)
+      {
+        return input_get_position() - pos;
+      }
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    156,
-                    fail,
-                    (void *)egg_token_type_phrase_terminator_symbol);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    binary-integer = zero
-                     + binary-indicator
-                     + binary-digit{1,*} ;
+    alternation-symbol = bar ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *binary_integer(void)
+long recognize_alternation_symbol(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    157,
-                    entry,
-                    (void *)egg_token_type_binary_integer);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_binary_integer);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      157,
-                      fail,
-                      (void *)egg_token_type_binary_integer);
-    return NULL;
-  }
-
-  t1 = nt;
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = zero()))
+  first = input_byte();
+  if (first == 0x7C)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    if (egg_token_add(t1, dir, t2 = binary_indicator()))
-    {
-      dir = egg_token_after;
-      t1 = t2;
-      count=0;
-      while(TRUE)
-      {
-        if (egg_token_add(t1, dir, t2 = binary_digit()))
-        {
-          dir = egg_token_after;
-          t1 = t2;
-          ++count;
-        }
-        else
-          break;
-      }
-      if ((count >= 1))
-      {
-        callback_by_index(&_cbt,
-                          157,
-                          success,
-                          (void *)egg_token_type_binary_integer);
-
-        return nt;
-      }
-    }
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    157,
-                    fail,
-                    (void *)egg_token_type_binary_integer);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    octal-integer = zero
-                    + octal-indicator
-                    + octal-digit{1,*} ;
+    concatenation-symbol = plus ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *octal_integer(void)
+long recognize_concatenation_symbol(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    158,
-                    entry,
-                    (void *)egg_token_type_octal_integer);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_octal_integer);
-  if (!nt)
+  first = input_byte();
+  if (first == 0x2B)
   {
-    callback_by_index(&_cbt,
-                      158,
-                      fail,
-                      (void *)egg_token_type_octal_integer);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = zero()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    if (egg_token_add(t1, dir, t2 = octal_indicator()))
-    {
-      dir = egg_token_after;
-      t1 = t2;
-      count=0;
-      while(TRUE)
-      {
-        if (egg_token_add(t1, dir, t2 = octal_digit()))
-        {
-          dir = egg_token_after;
-          t1 = t2;
-          ++count;
-        }
-        else
-          break;
-      }
-      if ((count >= 1))
-      {
-        callback_by_index(&_cbt,
-                          158,
-                          success,
-                          (void *)egg_token_type_octal_integer);
-
-        return nt;
-      }
-    }
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    158,
-                    fail,
-                    (void *)egg_token_type_octal_integer);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    hexadecimal-integer = zero
-                          + hexadecimal-indicator
-                          + hexadecimal-digit{1,*} ;
+    phrase-terminator-symbol = semicolon ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *hexadecimal_integer(void)
+long recognize_phrase_terminator_symbol(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
-  int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    159,
-                    entry,
-                    (void *)egg_token_type_hexadecimal_integer);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_hexadecimal_integer);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      159,
-                      fail,
-                      (void *)egg_token_type_hexadecimal_integer);
-    return NULL;
-  }
-
-  t1 = nt;
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = zero()))
+  first = input_byte();
+  if (first == 0x3B)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    if (egg_token_add(t1, dir, t2 = hexadecimal_indicator()))
-    {
-      dir = egg_token_after;
-      t1 = t2;
-      count=0;
-      while(TRUE)
-      {
-        if (egg_token_add(t1, dir, t2 = hexadecimal_digit()))
-        {
-          dir = egg_token_after;
-          t1 = t2;
-          ++count;
-        }
-        else
-          break;
-      }
-      if ((count >= 1))
-      {
-        callback_by_index(&_cbt,
-                          159,
-                          success,
-                          (void *)egg_token_type_hexadecimal_integer);
-
-        return nt;
-      }
-    }
+    return 1;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    159,
-                    fail,
-                    (void *)egg_token_type_hexadecimal_integer);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    decimal-integer = decimal-digit{1,*} ;
+    binary-integer = zero
+                     + binary-indicator
+                     + binary-digit{1,*} ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *decimal_integer(void)
+long recognize_binary_integer(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    160,
-                    entry,
-                    (void *)egg_token_type_decimal_integer);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_decimal_integer);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      160,
-                      fail,
-                      (void *)egg_token_type_decimal_integer);
-    return NULL;
-  }
+  first = input_byte();
+  input_set_position(pos);
 
-  t1 = nt;
+  count = 0;
 
-  dir = egg_token_below;
-  count=0;
-  while(TRUE)
+  if (first == 0x30)
   {
-    if (egg_token_add(t1, dir, t2 = decimal_digit()))
+    if (recognize_zero() >= 0)
     {
-      dir = egg_token_after;
-      t1 = t2;
-      ++count;
+      if (recognize_binary_indicator() >= 0)
+      {
+        count = scan_run("\x00\x00\x00\x00\x00\x00\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+                         "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+                         1, "\x30\x31", -1);
+        if ((count >= 1))
+        {
+          return input_get_position() - pos;
+        }
+      }
     }
-    else
-      break;
-  }
-  if ((count >= 1))
-  {
-    callback_by_index(&_cbt,
-                      160,
-                      success,
-                      (void *)egg_token_type_decimal_integer);
-
-    return nt;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    160,
-                    fail,
-                    (void *)egg_token_type_decimal_integer);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    integer = binary-integer
-            | octal-integer
-            | hexadecimal-integer
-            | decimal-integer ;
+    octal-integer = zero
+                    + octal-indicator
+                    + octal-digit{1,*} ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *integer(void)
+long recognize_octal_integer(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    161,
-                    entry,
-                    (void *)egg_token_type_integer);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
+    return -1;
 
-  count = 0;
+  first = input_byte();
+  input_set_position(pos);
 
-  nt = t1 = t2 = NULL;
+  count = 0;
 
-  nt = egg_token_new(egg_token_type_integer);
-  if (!nt)
+  if (first == 0x30)
   {
-    callback_by_index(&_cbt,
-                      161,
-                      fail,
-                      (void *)egg_token_type_integer);
-    return NULL;
+    if (recognize_zero() >= 0)
+    {
+      if (recognize_octal_indicator() >= 0)
+      {
+        count = scan_run("\x00\x00\x00\x00\x00\x00\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+                         "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+                         1, "\x30\x37", -1);
+        if ((count >= 1))
+        {
+          return input_get_position() - pos;
+        }
+      }
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = binary_integer()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      161,
-                      success,
-                      (void *)egg_token_type_integer);
+  return -1;
+}
 
-    return nt;
-  }
+  /*!
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = octal_integer()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      161,
-                      success,
-                      (void *)egg_token_type_integer);
+    @par "EGG Phrase Definition"
+    @verbatim
+    hexadecimal-integer = zero
+                          + hexadecimal-indicator
+                          + hexadecimal-digit{1,*} ;
+    @endverbatim
 
-    return nt;
-  }
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = hexadecimal_integer()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      161,
-                      success,
-                      (void *)egg_token_type_integer);
+ */
 
-    return nt;
-  }
+long recognize_hexadecimal_integer(void)
+{
+  long pos = input_get_position();
+  int count;
+  unsigned char first;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = decimal_integer()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      161,
-                      success,
-                      (void *)egg_token_type_integer);
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
 
-    return nt;
+  if (first == 0x30)
+  {
+    if (recognize_zero() >= 0)
+    {
+      if (recognize_hexadecimal_indicator() >= 0)
+      {
+        count = scan_run("\x00\x00\x00\x00\x00\x00\xff\x03\x7e\x00\x00\x00\x7e\x00\x00\x00"
+                         "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+                         3, "\x30\x39\x41\x46\x61\x66", -1);
+        if ((count >= 1))
+        {
+          return input_get_position() - pos;
+        }
+      }
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    161,
-                    fail,
-                    (void *)egg_token_type_integer);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    single-quoted-literal = single-quote
-                            + single-quoted-character{1,*}
-                            + single-quote ;
+    decimal-integer = decimal-digit{1,*} ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *single_quoted_literal(void)
+long recognize_decimal_integer(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    162,
-                    entry,
-                    (void *)egg_token_type_single_quoted_literal);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
+    return -1;
 
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_single_quoted_literal);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      162,
-                      fail,
-                      (void *)egg_token_type_single_quoted_literal);
-    return NULL;
-  }
+  first = input_byte();
+  input_set_position(pos);
 
-  t1 = nt;
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = single_quote()))
+  if ((first >= 0x30) && (first <= 0x39))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    count=0;
-    while(TRUE)
-    {
-      if (egg_token_add(t1, dir, t2 = single_quoted_character()))
-      {
-        dir = egg_token_after;
-        t1 = t2;
-        ++count;
-      }
-      else
-        break;
-    }
+    count = scan_run("\x00\x00\x00\x00\x00\x00\xff\x03\x00\x00\x00\x00\x00\x00\x00\x00"
+                     "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+                     1, "\x30\x39", -1);
     if ((count >= 1))
     {
-      if (egg_token_add(t1, dir, t2 = single_quote()))
-      {
-        dir = egg_token_after;
-        t1 = t2;
-        callback_by_index(&_cbt,
-                          162,
-                          success,
-                          (void *)egg_token_type_single_quoted_literal);
-
-        return nt;
-      }
+      return input_get_position() - pos;
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    162,
-                    fail,
-                    (void *)egg_token_type_single_quoted_literal);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    quoted-literal = quote + quoted-character{1,*} + quote ;
+    integer = binary-integer
+            | octal-integer
+            | hexadecimal-integer
+            | decimal-integer ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *quoted_literal(void)
+long recognize_integer(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    163,
-                    entry,
-                    (void *)egg_token_type_quoted_literal);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
+    return -1;
 
-  count = 0;
+  first = input_byte();
+  input_set_position(pos);
 
-  nt = t1 = t2 = NULL;
+  count = 0;
 
-  nt = egg_token_new(egg_token_type_quoted_literal);
-  if (!nt)
+  if (first == 0x30)
   {
-    callback_by_index(&_cbt,
-                      163,
-                      fail,
-                      (void *)egg_token_type_quoted_literal);
-    return NULL;
+    if (recognize_binary_integer() >= 0)
+    {
+      return input_get_position() - pos;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = quote()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    count=0;
-    while(TRUE)
-    {
-      if (egg_token_add(t1, dir, t2 = quoted_character()))
-      {
-        dir = egg_token_after;
-        t1 = t2;
-        ++count;
-      }
-      else
-        break;
-    }
-    if ((count >= 1))
-    {
-      if (egg_token_add(t1, dir, t2 = quote()))
-      {
-        dir = egg_token_after;
-        t1 = t2;
-        callback_by_index(&_cbt,
-                          163,
-                          success,
-                          (void *)egg_token_type_quoted_literal);
+  if (first == 0x30)
+  {
+    if (recognize_octal_integer() >= 0)
+    {
+      return input_get_position() - pos;
+    }
+  }
 
-        return nt;
-      }
+  input_set_position(pos);
+
+  if (first == 0x30)
+  {
+    if (recognize_hexadecimal_integer() >= 0)
+    {
+      return input_get_position() - pos;
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    163,
-                    fail,
-                    (void *)egg_token_type_quoted_literal);
+  if ((first >= 0x30) && (first <= 0x39))
+  {
+    if (recognize_decimal_integer() >= 0)
+    {
+      return input_get_position() - pos;
+    }
+  }
 
-  return NULL;
+  input_set_position(pos);
+
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    absolute-literal = slash + space{0,*} + integer + space{0,*} + slash ;
+    single-quoted-literal = single-quote
+                            + single-quoted-character{1,*}
+                            + single-quote ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *absolute_literal(void)
+long recognize_single_quoted_literal(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    164,
-                    entry,
-                    (void *)egg_token_type_absolute_literal);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_absolute_literal);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      164,
-                      fail,
-                      (void *)egg_token_type_absolute_literal);
-    return NULL;
-  }
+  first = input_byte();
+  input_set_position(pos);
 
-  t1 = nt;
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = slash()))
+  if (first == 0x27)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    count=0;
-    while(TRUE)
-    {
-      if (egg_token_add(t1, dir, t2 = space()))
-      {
-        dir = egg_token_after;
-        t1 = t2;
-        ++count;
-      }
-      else
-        break;
-    }
-    if ((count >= 0))
+    if (recognize_single_quote() >= 0)
     {
-      if (egg_token_add(t1, dir, t2 = integer()))
+      count = scan_run("\x00\x00\x00\x00\x7f\x7f\xff\xff\xff\xff\xff\xff\xff\xff\xff\x7f"
+                       "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+                       3, "\x20\x26\x28\x2e\x30\x7e", -1);
+      if ((count >= 1))
       {
-        dir = egg_token_after;
-        t1 = t2;
-        count=0;
-        while(TRUE)
-        {
-          if (egg_token_add(t1, dir, t2 = space()))
-          {
-            dir = egg_token_after;
-            t1 = t2;
-            ++count;
-          }
-          else
-            break;
-        }
-        if ((count >= 0))
+        if (recognize_single_quote() >= 0)
         {
-          if (egg_token_add(t1, dir, t2 = slash()))
-          {
-            dir = egg_token_after;
-            t1 = t2;
-            callback_by_index(&_cbt,
-                              164,
-                              success,
-                              (void *)egg_token_type_absolute_literal);
-
-            return nt;
-          }
+          return input_get_position() - pos;
         }
       }
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    164,
-                    fail,
-                    (void *)egg_token_type_absolute_literal);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    literal = single-quoted-literal | quoted-literal | absolute-literal ;
+    quoted-literal = quote + quoted-character{1,*} + quote ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *literal(void)
+long recognize_quoted_literal(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    165,
-                    entry,
-                    (void *)egg_token_type_literal);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_literal);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      165,
-                      fail,
-                      (void *)egg_token_type_literal);
-    return NULL;
-  }
-
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = single_quoted_literal()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      165,
-                      success,
-                      (void *)egg_token_type_literal);
+    return -1;
 
-    return nt;
-  }
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = quoted_literal()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      165,
-                      success,
-                      (void *)egg_token_type_literal);
+  first = input_byte();
+  input_set_position(pos);
 
-    return nt;
-  }
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = absolute_literal()))
+  if (first == 0x22)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      165,
-                      success,
-                      (void *)egg_token_type_literal);
-
-    return nt;
+    if (recognize_quote() >= 0)
+    {
+      count = scan_run("\x00\x00\x00\x00\xfb\x7f\xff\xff\xff\xff\xff\xff\xff\xff\xff\x7f"
+                       "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+                       3, "\x20\x21\x23\x2e\x30\x7e", -1);
+      if ((count >= 1))
+      {
+        if (recognize_quote() >= 0)
+        {
+          return input_get_position() - pos;
+        }
+      }
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    165,
-                    fail,
-                    (void *)egg_token_type_literal);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    comment-item = comment | comment-character ;
+    absolute-literal = slash + space{0,*} + integer + space{0,*} + slash ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *comment_item(void)
+long recognize_absolute_literal(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    166,
-                    entry,
-                    (void *)egg_token_type_comment_item);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_comment_item);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      166,
-                      fail,
-                      (void *)egg_token_type_comment_item);
-    return NULL;
-  }
+    return -1;
 
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = comment()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      166,
-                      success,
-                      (void *)egg_token_type_comment_item);
+  first = input_byte();
+  input_set_position(pos);
 
-    return nt;
-  }
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = comment_character()))
+  if (first == 0x2F)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      166,
-                      success,
-                      (void *)egg_token_type_comment_item);
-
-    return nt;
+    if (recognize_slash() >= 0)
+    {
+      count = scan_run("\x00\x00\x00\x00\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+                       "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+                       1, "\x20\x20", -1);
+      if ((count >= 0))
+      {
+        if (recognize_integer() >= 0)
+        {
+          count = scan_run("\x00\x00\x00\x00\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+                           "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+                           1, "\x20\x20", -1);
+          if ((count >= 0))
+          {
+            if (recognize_slash() >= 0)
+            {
+              return input_get_position() - pos;
+            }
+          }
+        }
+      }
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    166,
-                    fail,
-                    (void *)egg_token_type_comment_item);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    comment = comment-start-symbol
-              + comment-item{0,*}
-              + comment-end-symbol ;
+    literal = single-quoted-literal | quoted-literal | absolute-literal ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *comment(void)
+long recognize_literal(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    167,
-                    entry,
-                    (void *)egg_token_type_comment);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
+    return -1;
 
-  count = 0;
+  first = input_byte();
+  input_set_position(pos);
 
-  nt = t1 = t2 = NULL;
+  count = 0;
 
-  nt = egg_token_new(egg_token_type_comment);
-  if (!nt)
+  if (first == 0x27)
   {
-    callback_by_index(&_cbt,
-                      167,
-                      fail,
-                      (void *)egg_token_type_comment);
-    return NULL;
+    if (recognize_single_quoted_literal() >= 0)
+    {
+      return input_get_position() - pos;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = comment_start_symbol()))
+  if (first == 0x22)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    count=0;
-    while(TRUE)
+    if (recognize_quoted_literal() >= 0)
     {
-      if (egg_token_add(t1, dir, t2 = comment_item()))
-      {
-        dir = egg_token_after;
-        t1 = t2;
-        ++count;
-      }
-      else
-        break;
+      return input_get_position() - pos;
     }
-    if ((count >= 0))
-    {
-      if (egg_token_add(t1, dir, t2 = comment_end_symbol()))
-      {
-        dir = egg_token_after;
-        t1 = t2;
-        callback_by_index(&_cbt,
-                          167,
-                          success,
-                          (void *)egg_token_type_comment);
+  }
 
-        return nt;
-      }
+  input_set_position(pos);
+
+  if (first == 0x2F)
+  {
+    if (recognize_absolute_literal() >= 0)
+    {
+      return input_get_position() - pos;
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    167,
-                    fail,
-                    (void *)egg_token_type_comment);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    illumination = white-space | comment ;
+    comment-item = comment | comment-character ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *illumination(void)
+long recognize_comment_item(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    168,
-                    entry,
-                    (void *)egg_token_type_illumination);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_illumination);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      168,
-                      fail,
-                      (void *)egg_token_type_illumination);
-    return NULL;
-  }
-
-  t1 = nt;
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = white_space()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      168,
-                      success,
-                      (void *)egg_token_type_illumination);
+  first = input_byte();
+  input_set_position(pos);
 
-    return nt;
-  }
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = comment()))
+  if (first == 0x28)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      168,
-                      success,
-                      (void *)egg_token_type_illumination);
-
-    return nt;
+    if (recognize_comment() >= 0)
+    {
+      return input_get_position() - pos;
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    168,
-                    fail,
-                    (void *)egg_token_type_illumination);
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      ((first >= 0x20) && (first <= 0x7E)))
+  {
+    if (recognize_comment_character() >= 0)
+    {
+      return input_get_position() - pos;
+    }
+  }
+
+  input_set_position(pos);
 
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    non-grammar-item = control-character | illumination ;
+    comment = comment-start-symbol
+              + comment-item{0,*}
+              + comment-end-symbol ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *non_grammar_item(void)
+long recognize_comment(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    169,
-                    entry,
-                    (void *)egg_token_type_non_grammar_item);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_non_grammar_item);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      169,
-                      fail,
-                      (void *)egg_token_type_non_grammar_item);
-    return NULL;
-  }
+    return -1;
 
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = control_character()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      169,
-                      success,
-                      (void *)egg_token_type_non_grammar_item);
+  first = input_byte();
+  input_set_position(pos);
 
-    return nt;
-  }
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = illumination()))
+  if (first == 0x28)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      169,
-                      success,
-                      (void *)egg_token_type_non_grammar_item);
+    if (recognize_comment_start_symbol() >= 0)
+    {
+      count=0;
+      while(TRUE)
+      {
+        long skip = scan_run("\x00\x3e\x00\x00\xff\xfa\xff\xff\xff\xff\xff\xff\xff\xff\xff\x7f"
+                             "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+                             4, "\x09\x0d\x20\x27\x29\x29\x2b\x7e", -1);
 
-    return nt;
+        if (skip > 0)
+          ++count;
+        else if (recognize_comment_item() >= 0)
+          ++count;
+        else
+          break;
+      }
+      if ((count >= 0))
+      {
+        if (recognize_comment_end_symbol() >= 0)
+        {
+          return input_get_position() - pos;
+        }
+      }
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    169,
-                    fail,
-                    (void *)egg_token_type_non_grammar_item);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    non-grammar-element = non-grammar-item{1,*} ;
+    illumination = white-space | comment ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *non_grammar_element(void)
+long recognize_illumination(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    170,
-                    entry,
-                    (void *)egg_token_type_non_grammar_element);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
+    return -1;
 
-  count = 0;
+  first = input_byte();
+  input_set_position(pos);
 
-  nt = t1 = t2 = NULL;
+  count = 0;
 
-  nt = egg_token_new(egg_token_type_non_grammar_element);
-  if (!nt)
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      (first == 0x20))
   {
-    callback_by_index(&_cbt,
-                      170,
-                      fail,
-                      (void *)egg_token_type_non_grammar_element);
-    return NULL;
+    if (recognize_white_space() >= 0)
+    {
+      return input_get_position() - pos;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  count=0;
-  while(TRUE)
+  if (first == 0x28)
   {
-    if (egg_token_add(t1, dir, t2 = non_grammar_item()))
+    if (recognize_comment() >= 0)
     {
-      dir = egg_token_after;
-      t1 = t2;
-      ++count;
+      return input_get_position() - pos;
     }
-    else
-      break;
-  }
-  if ((count >= 1))
-  {
-    callback_by_index(&_cbt,
-                      170,
-                      success,
-                      (void *)egg_token_type_non_grammar_element);
-
-    return nt;
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    170,
-                    fail,
-                    (void *)egg_token_type_non_grammar_element);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    phrase-name = letter + phrase-name-character{0,*} ;
+    non-grammar-item = control-character | illumination ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *phrase_name(void)
+long recognize_non_grammar_item(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    171,
-                    entry,
-                    (void *)egg_token_type_phrase_name);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
+    return -1;
 
-  count = 0;
+  first = input_byte();
+  input_set_position(pos);
 
-  nt = t1 = t2 = NULL;
+  count = 0;
 
-  nt = egg_token_new(egg_token_type_phrase_name);
-  if (!nt)
+  if ((first <= 0x08) ||
+      ((first >= 0x0E) && (first <= 0x1F)) ||
+      (first == 0x7F))
   {
-    callback_by_index(&_cbt,
-                      171,
-                      fail,
-                      (void *)egg_token_type_phrase_name);
-    return NULL;
+    if (recognize_control_character() >= 0)
+    {
+      return input_get_position() - pos;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = letter()))
+  if (((first >= 0x09) && (first <= 0x0D)) ||
+      (first == 0x20) ||
+      (first == 0x28))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    count=0;
-    while(TRUE)
-    {
-      if (egg_token_add(t1, dir, t2 = phrase_name_character()))
-      {
-        dir = egg_token_after;
-        t1 = t2;
-        ++count;
-      }
-      else
-        break;
-    }
-    if ((count >= 0))
+    if (recognize_illumination() >= 0)
     {
-      callback_by_index(&_cbt,
-                        171,
-                        success,
-                        (void *)egg_token_type_phrase_name);
-
-      return nt;
+      return input_get_position() - pos;
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    171,
-                    fail,
-                    (void *)egg_token_type_phrase_name);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    quantifier-item = integer | asterisk ;
+    non-grammar-element = non-grammar-item{1,*} ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *quantifier_item(void)
+long recognize_non_grammar_element(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    172,
-                    entry,
-                    (void *)egg_token_type_quantifier_item);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_quantifier_item);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      172,
-                      fail,
-                      (void *)egg_token_type_quantifier_item);
-    return NULL;
-  }
-
-  t1 = nt;
+    return -1;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = integer()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      172,
-                      success,
-                      (void *)egg_token_type_quantifier_item);
+  first = input_byte();
+  input_set_position(pos);
 
-    return nt;
-  }
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = asterisk()))
+  if ((first <= 0x20) ||
+      (first == 0x28) ||
+      (first == 0x7F))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      172,
-                      success,
-                      (void *)egg_token_type_quantifier_item);
+    count=0;
+    while(TRUE)
+    {
+      long skip = scan_run("\xff\xff\xff\xff\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x80"
+                           "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+                           2, "\x00\x20\x7f\x7f", -1);
 
-    return nt;
+      if (skip > 0)
+        ++count;
+      else if (recognize_non_grammar_item() >= 0)
+        ++count;
+      else
+        break;
+    }
+    if ((count >= 1))
+    {
+      return input_get_position() - pos;
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    172,
-                    fail,
-                    (void *)egg_token_type_quantifier_item);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    quantifier-option = comma + quantifier-item ;
+    phrase-name = letter + phrase-name-character{0,*} ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *quantifier_option(void)
+long recognize_phrase_name(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    173,
-                    entry,
-                    (void *)egg_token_type_quantifier_option);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_quantifier_option);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      173,
-                      fail,
-                      (void *)egg_token_type_quantifier_option);
-    return NULL;
-  }
+  first = input_byte();
+  input_set_position(pos);
 
-  t1 = nt;
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = comma()))
+  if (((first >= 0x41) && (first <= 0x5A)) ||
+      ((first >= 0x61) && (first <= 0x7A)))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    if (egg_token_add(t1, dir, t2 = quantifier_item()))
+    if (recognize_letter() >= 0)
     {
-      dir = egg_token_after;
-      t1 = t2;
-      callback_by_index(&_cbt,
-                        173,
-                        success,
-                        (void *)egg_token_type_quantifier_option);
-
-      return nt;
+      count = scan_run("\x00\x00\x00\x00\x00\x20\xff\x03\xfe\xff\xff\x87\xfe\xff\xff\x07"
+                       "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+                       0, "", -1);
+      if ((count >= 0))
+      {
+        return input_get_position() - pos;
+      }
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    173,
-                    fail,
-                    (void *)egg_token_type_quantifier_option);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    quantifier = open-brace
-                 + integer
-                 + quantifier-option{0,1}
-                 + close-brace ;
+    quantifier-item = integer | asterisk ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *quantifier(void)
+long recognize_quantifier_item(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    174,
-                    entry,
-                    (void *)egg_token_type_quantifier);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_quantifier);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      174,
-                      fail,
-                      (void *)egg_token_type_quantifier);
-    return NULL;
-  }
+    return -1;
 
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = open_brace()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    if (egg_token_add(t1, dir, t2 = integer()))
-    {
-      dir = egg_token_after;
-      t1 = t2;
-      count=0;
-      while(count < 1)
-      {
-        if (egg_token_add(t1, dir, t2 = quantifier_option()))
-        {
-          dir = egg_token_after;
-          t1 = t2;
-          ++count;
-        }
-        else
-          break;
-      }
-      if ((count >= 0) && (count <= 1))
-      {
-        if (egg_token_add(t1, dir, t2 = close_brace()))
-        {
-          dir = egg_token_after;
-          t1 = t2;
-          callback_by_index(&_cbt,
-                            174,
-                            success,
-                            (void *)egg_token_type_quantifier);
+  first = input_byte();
+  input_set_position(pos);
 
-          return nt;
-        }
-      }
+  count = 0;
+
+  if ((first >= 0x30) && (first <= 0x39))
+  {
+    if (recognize_integer() >= 0)
+    {
+      return input_get_position() - pos;
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    174,
-                    fail,
-                    (void *)egg_token_type_quantifier);
+  if (first == 0x2A)
+  {
+    if (recognize_asterisk() >= 0)
+    {
+      return input_get_position() - pos;
+    }
+  }
 
-  return NULL;
+  input_set_position(pos);
+
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    atom = literal | phrase-name ;
+    quantifier-option = comma + quantifier-item ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *atom(void)
+long recognize_quantifier_option(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    175,
-                    entry,
-                    (void *)egg_token_type_atom);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
-
-  nt = egg_token_new(egg_token_type_atom);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      175,
-                      fail,
-                      (void *)egg_token_type_atom);
-    return NULL;
-  }
+    return -1;
 
-  t1 = nt;
-
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = literal()))
-  {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      175,
-                      success,
-                      (void *)egg_token_type_atom);
+  first = input_byte();
+  input_set_position(pos);
 
-    return nt;
-  }
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = phrase_name()))
+  if (first == 0x2C)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    callback_by_index(&_cbt,
-                      175,
-                      success,
-                      (void *)egg_token_type_atom);
-
-    return nt;
+    if (recognize_comma() >= 0)
+    {
+      if (recognize_quantifier_item() >= 0)
+      {
+        return input_get_position() - pos;
+      }
+    }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    175,
-                    fail,
-                    (void *)egg_token_type_atom);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    item = atom + quantifier{0,1} ;
+    quantifier = open-brace
+                 + integer
+                 + quantifier-option{0,1}
+                 + close-brace ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *item(void)
+long recognize_quantifier(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    176,
-                    entry,
-                    (void *)egg_token_type_item);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_item);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      176,
-                      fail,
-                      (void *)egg_token_type_item);
-    return NULL;
-  }
+  first = input_byte();
+  input_set_position(pos);
 
-  t1 = nt;
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = atom()))
+  if (first == 0x7B)
   {
-    dir = egg_token_after;
-    t1 = t2;
-    count=0;
-    while(count < 1)
+    if (recognize_open_brace() >= 0)
     {
-      if (egg_token_add(t1, dir, t2 = quantifier()))
+      if (recognize_integer() >= 0)
       {
-        dir = egg_token_after;
-        t1 = t2;
-        ++count;
+        count=0;
+        while(count < 1)
+        {
+          if (recognize_quantifier_option() >= 0)
+          {
+            ++count;
+          }
+          else
+            break;
+        }
+        if ((count >= 0) && (count <= 1))
+        {
+          if (recognize_close_brace() >= 0)
+          {
+            return input_get_position() - pos;
+          }
+        }
       }
-      else
-        break;
-    }
-    if ((count >= 0) && (count <= 1))
-    {
-      callback_by_index(&_cbt,
-                        176,
-                        success,
-                        (void *)egg_token_type_item);
-
-      return nt;
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    176,
-                    fail,
-                    (void *)egg_token_type_item);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    sequence-continuation = non-grammar-element{0,1}
-                            + concatenation-symbol
-                            + non-grammar-element{0,1}
-                            + item ;
+    atom = literal | phrase-name ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *sequence_continuation(void)
+long recognize_atom(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    177,
-                    entry,
-                    (void *)egg_token_type_sequence_continuation);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
+    return -1;
 
-  count = 0;
+  first = input_byte();
+  input_set_position(pos);
 
-  nt = t1 = t2 = NULL;
+  count = 0;
 
-  nt = egg_token_new(egg_token_type_sequence_continuation);
-  if (!nt)
+  if ((first == 0x22) ||
+      (first == 0x27) ||
+      (first == 0x2F))
   {
-    callback_by_index(&_cbt,
-                      177,
-                      fail,
-                      (void *)egg_token_type_sequence_continuation);
-    return NULL;
+    if (recognize_literal() >= 0)
+    {
+      return input_get_position() - pos;
+    }
   }
 
-  t1 = nt;
+  input_set_position(pos);
 
-  dir = egg_token_below;
-  count=0;
-  while(count < 1)
+  if (((first >= 0x41) && (first <= 0x5A)) ||
+      ((first >= 0x61) && (first <= 0x7A)))
   {
-    if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+    if (recognize_phrase_name() >= 0)
     {
-      dir = egg_token_after;
-      t1 = t2;
-      ++count;
+      return input_get_position() - pos;
     }
-    else
-      break;
   }
-  if ((count >= 0) && (count <= 1))
+
+  input_set_position(pos);
+
+  return -1;
+}
+
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    item = atom + quantifier{0,1} ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_item(void)
+{
+  long pos = input_get_position();
+  int count;
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  if ("\x00\x00\x00\x00\x84\x80\x00\x00\xfe\xff\xff\x07\xfe\xff\xff\x07"
+      "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        [first >> 3] & (1 << (first & 7)))
   {
-    if (egg_token_add(t1, dir, t2 = concatenation_symbol()))
+    if (recognize_atom() >= 0)
     {
-      dir = egg_token_after;
-      t1 = t2;
       count=0;
       while(count < 1)
       {
-        if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+        if (recognize_quantifier() >= 0)
         {
-          dir = egg_token_after;
-          t1 = t2;
           ++count;
         }
         else
@@ -14591,299 +19104,270 @@ egg_token *sequence_continuation(void)
       }
       if ((count >= 0) && (count <= 1))
       {
-        if (egg_token_add(t1, dir, t2 = item()))
-        {
-          dir = egg_token_after;
-          t1 = t2;
-          callback_by_index(&_cbt,
-                            177,
-                            success,
-                            (void *)egg_token_type_sequence_continuation);
-
-          return nt;
-        }
+        return input_get_position() - pos;
       }
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    177,
-                    fail,
-                    (void *)egg_token_type_sequence_continuation);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    sequence = item + sequence-continuation{0,*} ;
+    sequence-continuation = non-grammar-element{0,1}
+                            + concatenation-symbol
+                            + non-grammar-element{0,1}
+                            + item ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *sequence(void)
+long recognize_sequence_continuation(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    178,
-                    entry,
-                    (void *)egg_token_type_sequence);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_sequence);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      178,
-                      fail,
-                      (void *)egg_token_type_sequence);
-    return NULL;
-  }
+  first = input_byte();
+  input_set_position(pos);
 
-  t1 = nt;
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = item()))
+  if ((first <= 0x20) ||
+      (first == 0x28) ||
+      (first == 0x2B) ||
+      (first == 0x7F))
   {
-    dir = egg_token_after;
-    t1 = t2;
     count=0;
-    while(TRUE)
+    while(count < 1)
     {
-      if (egg_token_add(t1, dir, t2 = sequence_continuation()))
+      if (recognize_non_grammar_element() >= 0)
       {
-        dir = egg_token_after;
-        t1 = t2;
         ++count;
       }
       else
         break;
     }
-    if ((count >= 0))
+    if ((count >= 0) && (count <= 1))
     {
-      callback_by_index(&_cbt,
-                        178,
-                        success,
-                        (void *)egg_token_type_sequence);
-
-      return nt;
+      if (recognize_concatenation_symbol() >= 0)
+      {
+        count=0;
+        while(count < 1)
+        {
+          if (recognize_non_grammar_element() >= 0)
+          {
+            ++count;
+          }
+          else
+            break;
+        }
+        if ((count >= 0) && (count <= 1))
+        {
+          if (recognize_item() >= 0)
+          {
+            return input_get_position() - pos;
+          }
+        }
+      }
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    178,
-                    fail,
-                    (void *)egg_token_type_sequence);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    definition-continuation = non-grammar-element{0,1}
-                              + alternation-symbol
-                              + non-grammar-element{0,1}
-                              + sequence ;
+    sequence = item + sequence-continuation{0,*} ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *definition_continuation(void)
+long recognize_sequence(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    179,
-                    entry,
-                    (void *)egg_token_type_definition_continuation);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_definition_continuation);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      179,
-                      fail,
-                      (void *)egg_token_type_definition_continuation);
-    return NULL;
-  }
+  first = input_byte();
+  input_set_position(pos);
 
-  t1 = nt;
+  count = 0;
 
-  dir = egg_token_below;
-  count=0;
-  while(count < 1)
-  {
-    if (egg_token_add(t1, dir, t2 = non_grammar_element()))
-    {
-      dir = egg_token_after;
-      t1 = t2;
-      ++count;
-    }
-    else
-      break;
-  }
-  if ((count >= 0) && (count <= 1))
+  if ("\x00\x00\x00\x00\x84\x80\x00\x00\xfe\xff\xff\x07\xfe\xff\xff\x07"
+      "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        [first >> 3] & (1 << (first & 7)))
   {
-    if (egg_token_add(t1, dir, t2 = alternation_symbol()))
+    if (recognize_item() >= 0)
     {
-      dir = egg_token_after;
-      t1 = t2;
       count=0;
-      while(count < 1)
+      while(TRUE)
       {
-        if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+        if (recognize_sequence_continuation() >= 0)
         {
-          dir = egg_token_after;
-          t1 = t2;
           ++count;
         }
         else
           break;
       }
-      if ((count >= 0) && (count <= 1))
+      if ((count >= 0))
       {
-        if (egg_token_add(t1, dir, t2 = sequence()))
-        {
-          dir = egg_token_after;
-          t1 = t2;
-          callback_by_index(&_cbt,
-                            179,
-                            success,
-                            (void *)egg_token_type_definition_continuation);
-
-          return nt;
-        }
+        return input_get_position() - pos;
       }
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    179,
-                    fail,
-                    (void *)egg_token_type_definition_continuation);
-
-  return NULL;
+  return -1;
 }
 
   /*!
 
     @par "EGG Phrase Definition"
     @verbatim
-    definition = sequence + definition-continuation{0,*} ;
+    definition-continuation = non-grammar-element{0,1}
+                              + alternation-symbol
+                              + non-grammar-element{0,1}
+                              + sequence ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *definition(void)
+long recognize_definition_continuation(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    180,
-                    entry,
-                    (void *)egg_token_type_definition);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_definition);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      180,
-                      fail,
-                      (void *)egg_token_type_definition);
-    return NULL;
-  }
+  first = input_byte();
+  input_set_position(pos);
 
-  t1 = nt;
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = sequence()))
+  if ((first <= 0x20) ||
+      (first == 0x28) ||
+      (first == 0x7C) ||
+      (first == 0x7F))
   {
-    dir = egg_token_after;
-    t1 = t2;
     count=0;
-    while(TRUE)
+    while(count < 1)
     {
-      if (egg_token_add(t1, dir, t2 = definition_continuation()))
+      if (recognize_non_grammar_element() >= 0)
       {
-        dir = egg_token_after;
-        t1 = t2;
         ++count;
       }
       else
         break;
     }
-    if ((count >= 0))
+    if ((count >= 0) && (count <= 1))
     {
-      callback_by_index(&_cbt,
-                        180,
-                        success,
-                        (void *)egg_token_type_definition);
-
-      return nt;
+      if (recognize_alternation_symbol() >= 0)
+      {
+        count=0;
+        while(count < 1)
+        {
+          if (recognize_non_grammar_element() >= 0)
+          {
+            ++count;
+          }
+          else
+            break;
+        }
+        if ((count >= 0) && (count <= 1))
+        {
+          if (recognize_sequence() >= 0)
+          {
+            return input_get_position() - pos;
+          }
+        }
+      }
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    180,
-                    fail,
-                    (void *)egg_token_type_definition);
+  return -1;
+}
 
-  return NULL;
+  /*!
+
+    @par "EGG Phrase Definition"
+    @verbatim
+    definition = sequence + definition-continuation{0,*} ;
+    @endverbatim
+
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
+
+ */
+
+long recognize_definition(void)
+{
+  long pos = input_get_position();
+  int count;
+  unsigned char first;
+
+  if (input_eof())
+    return -1;
+
+  first = input_byte();
+  input_set_position(pos);
+
+  count = 0;
+
+  if ("\x00\x00\x00\x00\x84\x80\x00\x00\xfe\xff\xff\x07\xfe\xff\xff\x07"
+      "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        [first >> 3] & (1 << (first & 7)))
+  {
+    if (recognize_sequence() >= 0)
+    {
+      count=0;
+      while(TRUE)
+      {
+        if (recognize_definition_continuation() >= 0)
+        {
+          ++count;
+        }
+        else
+          break;
+      }
+      if ((count >= 0))
+      {
+        return input_get_position() - pos;
+      }
+    }
+  }
+
+  input_set_position(pos);
+
+  return -1;
 }
 
   /*!
@@ -14899,107 +19383,74 @@ egg_token *definition(void)
              + phrase-terminator-symbol ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *phrase(void)
+long recognize_phrase(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    181,
-                    entry,
-                    (void *)egg_token_type_phrase);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_phrase);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      181,
-                      fail,
-                      (void *)egg_token_type_phrase);
-    return NULL;
-  }
+  first = input_byte();
+  input_set_position(pos);
 
-  t1 = nt;
+  count = 0;
 
-  dir = egg_token_below;
-  if (egg_token_add(t1, dir, t2 = phrase_name()))
+  if (((first >= 0x41) && (first <= 0x5A)) ||
+      ((first >= 0x61) && (first <= 0x7A)))
   {
-    dir = egg_token_after;
-    t1 = t2;
-    count=0;
-    while(count < 1)
+    if (recognize_phrase_name() >= 0)
     {
-      if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+      count=0;
+      while(count < 1)
       {
-        dir = egg_token_after;
-        t1 = t2;
-        ++count;
+        if (recognize_non_grammar_element() >= 0)
+        {
+          ++count;
+        }
+        else
+          break;
       }
-      else
-        break;
-    }
-    if ((count >= 0) && (count <= 1))
-    {
-      if (egg_token_add(t1, dir, t2 = equal()))
+      if ((count >= 0) && (count <= 1))
       {
-        dir = egg_token_after;
-        t1 = t2;
-        count=0;
-        while(count < 1)
+        if (recognize_equal() >= 0)
         {
-          if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+          count=0;
+          while(count < 1)
           {
-            dir = egg_token_after;
-            t1 = t2;
-            ++count;
+            if (recognize_non_grammar_element() >= 0)
+            {
+              ++count;
+            }
+            else
+              break;
           }
-          else
-            break;
-        }
-        if ((count >= 0) && (count <= 1))
-        {
-          if (egg_token_add(t1, dir, t2 = definition()))
+          if ((count >= 0) && (count <= 1))
           {
-            dir = egg_token_after;
-            t1 = t2;
-            count=0;
-            while(count < 1)
+            if (recognize_definition() >= 0)
             {
-              if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+              count=0;
+              while(count < 1)
               {
-                dir = egg_token_after;
-                t1 = t2;
-                ++count;
+                if (recognize_non_grammar_element() >= 0)
+                {
+                  ++count;
+                }
+                else
+                  break;
               }
-              else
-                break;
-            }
-            if ((count >= 0) && (count <= 1))
-            {
-              if (egg_token_add(t1, dir, t2 = phrase_terminator_symbol()))
+              if ((count >= 0) && (count <= 1))
               {
-                dir = egg_token_after;
-                t1 = t2;
-                callback_by_index(&_cbt,
-                                  181,
-                                  success,
-                                  (void *)egg_token_type_phrase);
-
-                return nt;
+                if (recognize_phrase_terminator_symbol() >= 0)
+                {
+                  return input_get_position() - pos;
+                }
               }
             }
           }
@@ -15008,15 +19459,9 @@ egg_token *phrase(void)
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    181,
-                    fail,
-                    (void *)egg_token_type_phrase);
-
-  return NULL;
+  return -1;
 }
 
   /*!
@@ -15026,79 +19471,51 @@ egg_token *phrase(void)
     grammar-element = non-grammar-element{0,1} + phrase ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *grammar_element(void)
+long recognize_grammar_element(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    182,
-                    entry,
-                    (void *)egg_token_type_grammar_element);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_grammar_element);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      182,
-                      fail,
-                      (void *)egg_token_type_grammar_element);
-    return NULL;
-  }
+  first = input_byte();
+  input_set_position(pos);
 
-  t1 = nt;
+  count = 0;
 
-  dir = egg_token_below;
-  count=0;
-  while(count < 1)
+  if ("\xff\xff\xff\xff\x01\x01\x00\x00\xfe\xff\xff\x07\xfe\xff\xff\x87"
+      "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        [first >> 3] & (1 << (first & 7)))
   {
-    if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+    count=0;
+    while(count < 1)
     {
-      dir = egg_token_after;
-      t1 = t2;
-      ++count;
+      if (recognize_non_grammar_element() >= 0)
+      {
+        ++count;
+      }
+      else
+        break;
     }
-    else
-      break;
-  }
-  if ((count >= 0) && (count <= 1))
-  {
-    if (egg_token_add(t1, dir, t2 = phrase()))
+    if ((count >= 0) && (count <= 1))
     {
-      dir = egg_token_after;
-      t1 = t2;
-      callback_by_index(&_cbt,
-                        182,
-                        success,
-                        (void *)egg_token_type_grammar_element);
-
-      return nt;
+      if (recognize_phrase() >= 0)
+      {
+        return input_get_position() - pos;
+      }
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    182,
-                    fail,
-                    (void *)egg_token_type_grammar_element);
-
-  return NULL;
+  return -1;
 }
 
   /*!
@@ -15108,88 +19525,60 @@ egg_token *grammar_element(void)
     grammar = grammar-element{1,*} + non-grammar-element{0,1} ;
     @endverbatim
 
-    @retval "egg_token *" on synctactical match of phrase
-    @retval NULL on error including NO MATCH
+    @retval long length of input on synctactical match of phrase
+    @retval -1 on error including NO MATCH
 
  */
 
-egg_token *grammar(void)
+long recognize_grammar(void)
 {
   long pos = input_get_position();
-  egg_token *nt, *t1, *t2;
   int count;
-  egg_token_direction dir;
-
-  callback_by_index(&_cbt,
-                    183,
-                    entry,
-                    (void *)egg_token_type_grammar);
+  unsigned char first;
 
   if (input_eof())
-    return NULL;
-
-  count = 0;
-
-  nt = t1 = t2 = NULL;
+    return -1;
 
-  nt = egg_token_new(egg_token_type_grammar);
-  if (!nt)
-  {
-    callback_by_index(&_cbt,
-                      183,
-                      fail,
-                      (void *)egg_token_type_grammar);
-    return NULL;
-  }
+  first = input_byte();
+  input_set_position(pos);
 
-  t1 = nt;
+  count = 0;
 
-  dir = egg_token_below;
-  count=0;
-  while(TRUE)
-  {
-    if (egg_token_add(t1, dir, t2 = grammar_element()))
-    {
-      dir = egg_token_after;
-      t1 = t2;
-      ++count;
-    }
-    else
-      break;
-  }
-  if ((count >= 1))
+  if ("\xff\xff\xff\xff\x01\x01\x00\x00\xfe\xff\xff\x07\xfe\xff\xff\x87"
+      "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+        [first >> 3] & (1 << (first & 7)))
   {
     count=0;
-    while(count < 1)
+    while(TRUE)
     {
-      if (egg_token_add(t1, dir, t2 = non_grammar_element()))
+      if (recognize_grammar_element() >= 0)
       {
-        dir = egg_token_after;
-        t1 = t2;
         ++count;
       }
       else
         break;
     }
-    if ((count >= 0) && (count <= 1))
+    if ((count >= 1))
     {
-      callback_by_index(&_cbt,
-                        183,
-                        success,
-                        (void *)egg_token_type_grammar);
-
-      return nt;
+      count=0;
+      while(count < 1)
+      {
+        if (recognize_non_grammar_element() >= 0)
+        {
+          ++count;
+        }
+        else
+          break;
+      }
+      if ((count >= 0) && (count <= 1))
+      {
+        return input_get_position() - pos;
+      }
     }
   }
 
-  egg_token_delete(nt);
   input_set_position(pos);
 
-  callback_by_index(&_cbt,
-                    183,
-                    fail,
-                    (void *)egg_token_type_grammar);
-
-  return NULL;
+  return -1;
 }
 
@@ -0,0 +1,1254 @@
+/*!
+
+  @file egg-token-tree.c
+
+  @brief Source code for grammer specific compact token tree functions
+
+  @version 0.4.1
+
+  @author Patrick Head mailto:patrickhead@gmail.com
+
+  @copyright Copyright (C) 2013-2014 Patrick Head
+
+  @license
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.@n
+  @n
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.@n
+  @n
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see   \<http://www.gnu.org/licenses/\>.
+
+*/
+
+  /*!
+
+    @file egg-token-tree.c
+
+    This is the source code file for the egg grammar compact token tree
+    module.
+
+  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "egg-token.h"
+#include "egg-token-util.h"
+#include "egg-token-tree.h"
+
+#define EGG_TOKEN_TREE_HASH_BASIS 0xcbf29ce484222325ULL
+#define EGG_TOKEN_TREE_HASH_PRIME 0x100000001b3ULL
+
+static egg_token_index subtree_end(egg_token_tree *tree, egg_token_index i);
+static egg_token_index child_slot(egg_token_tree *tree,
+  egg_token_index a,
+  egg_token_type type);
+static long snapshot_layout(egg_token_index count,
+  long source_length,
+  long *at);
+static int snapshot_write(FILE *f, void *data, long size, long at);
+static int index_lines(egg_token_tree *tree);
+static int check_nodes(egg_token_tree *tree,
+  egg_token_tree_snapshot_header *header);
+static void hash_input(long *length, uint64_t *hash);
+static uint64_t snapshot_hash(uint64_t hash,
+  unsigned char *bytes,
+  long count);
+
+  /*!
+
+    @brief Create a new egg_token_tree from a egg_token tree
+
+    The compact tree holds t, its descendants, and each following sibling
+    of t along with its descendants.  They are copied in the order of a
+    egg_token_iterator pre-order walk.  The egg_token tree itself is not
+    modified, and remains valid.
+
+    @warning This function returns a pointer to dynamically allocated memory.
+             It is the caller's responsibility to free this memory with
+             egg_token_tree_free() when appropriate.
+
+    @param t egg_token * to root of egg_token tree
+
+    @retval "egg_token_tree *" new egg_token_tree
+    @retval NULL failure
+
+  */
+
+egg_token_tree *egg_token_tree_new(egg_token *t)
+{
+  egg_token_tree *tree;
+  egg_token_iterator it;
+  egg_token *p;
+  egg_token_index count;
+  egg_token_index i;
+  egg_token_index a;
+  egg_token_index previous;
+  int depth;
+  int d;
+
+  if (!t)
+    return NULL;
+
+  count = 0;
+  egg_token_iterator_init(&it, t, egg_token_pre_order);
+  while (egg_token_iterator_next(&it))
+    ++count;
+
+  tree = malloc(sizeof(egg_token_tree));
+  if (!tree)
+    return NULL;
+
+  tree->count = count;
+  tree->child_index = NULL;
+  tree->child_index_size = 0;
+  tree->source = NULL;
+  tree->source_length = 0;
+  tree->line_start = NULL;
+  tree->line_count = 0;
+  tree->mapping = NULL;
+  tree->mapping_size = 0;
+  tree->type = malloc(count * sizeof(egg_token_type));
+  tree->ascendant = malloc(count * sizeof(egg_token_index));
+  tree->descendant = malloc(count * sizeof(egg_token_index));
+  tree->next = malloc(count * sizeof(egg_token_index));
+  tree->offset = malloc(count * sizeof(long));
+  tree->length = malloc(count * sizeof(long));
+
+  if (!tree->type || !tree->ascendant || !tree->descendant ||
+      !tree->next || !tree->offset || !tree->length)
+  {
+    egg_token_tree_free(tree);
+    return NULL;
+  }
+
+  i = 0;
+  depth = 0;
+  egg_token_iterator_init(&it, t, egg_token_pre_order);
+  while ((p = egg_token_iterator_next(&it)))
+  {
+    d = egg_token_iterator_get_depth(&it);
+
+      // A deeper node is the first descendant of the node before it,
+      // otherwise it follows the node at the same depth on the path
+      // back up from the node before it
+
+    a = EGG_TOKEN_INDEX_NONE;
+    if (d > depth)
+    {
+      a = i - 1;
+      tree->descendant[a] = i;
+    }
+    else if (i > 0)
+    {
+      for (previous = i - 1; depth > d; --depth)
+        previous = tree->ascendant[previous];
+      tree->next[previous] = i;
+      a = tree->ascendant[previous];
+    }
+    depth = d;
+
+    tree->type[i] = p->type;
+    tree->ascendant[i] = a;
+    tree->descendant[i] = EGG_TOKEN_INDEX_NONE;
+    tree->next[i] = EGG_TOKEN_INDEX_NONE;
+    tree->offset[i] = p->offset;
+    tree->length[i] = p->length;
+
+    ++i;
+  }
+
+  return tree;
+}
+
+  /*!
+
+    @brief Free the memory associated with egg_token_tree
+
+    @param tree egg_token_tree *
+
+  */
+
+void egg_token_tree_free(egg_token_tree *tree)
+{
+  if (!tree)
+    return;
+
+    // A loaded tree's arrays live in the snapshot mapping
+
+  if (tree->mapping)
+    munmap(tree->mapping, tree->mapping_size);
+  else
+  {
+    free(tree->type);
+    free(tree->ascendant);
+    free(tree->descendant);
+    free(tree->next);
+    free(tree->offset);
+    free(tree->length);
+  }
+
+  free(tree->child_index);
+  free(tree->line_start);
+  free(tree);
+
+  return;
+}
+
+  /*!
+
+    @brief Returns count of nodes in egg_token_tree
+
+    @param tree egg_token_tree *
+
+    @retval "egg_token_index" count
+
+  */
+
+egg_token_index egg_token_tree_get_count(egg_token_tree *tree)
+{
+  if (!tree)
+    return 0;
+
+  return tree->count;
+}
+
+  /*!
+
+    @brief Returns type of node in egg_token_tree
+
+    @param tree egg_token_tree *
+    @param i    egg_token_index of node
+
+    @retval "egg_token_type" type
+    @retval egg_token_type_none failure
+
+  */
+
+egg_token_type egg_token_tree_get_type(egg_token_tree *tree,
+  egg_token_index i)
+{
+  if (!tree || (i >= tree->count))
+    return egg_token_type_none;
+
+  return tree->type[i];
+}
+
+  /*!
+
+    @brief Returns index of ascendant (parent) of node in egg_token_tree
+
+    @param tree egg_token_tree *
+    @param i    egg_token_index of node
+
+    @retval "egg_token_index" ascendant
+    @retval EGG_TOKEN_INDEX_NONE no ascendant, or failure
+
+  */
+
+egg_token_index egg_token_tree_get_ascendant(egg_token_tree *tree,
+  egg_token_index i)
+{
+  if (!tree || (i >= tree->count))
+    return EGG_TOKEN_INDEX_NONE;
+
+  return tree->ascendant[i];
+}
+
+  /*!
+
+    @brief Returns index of first descendant (child) of node in
+    egg_token_tree
+
+    @param tree egg_token_tree *
+    @param i    egg_token_index of node
+
+    @retval "egg_token_index" descendant
+    @retval EGG_TOKEN_INDEX_NONE no descendant, or failure
+
+  */
+
+egg_token_index egg_token_tree_get_descendant(egg_token_tree *tree,
+  egg_token_index i)
+{
+  if (!tree || (i >= tree->count))
+    return EGG_TOKEN_INDEX_NONE;
+
+  return tree->descendant[i];
+}
+
+  /*!
+
+    @brief Returns index of next (sibling) of node in egg_token_tree
+
+    @param tree egg_token_tree *
+    @param i    egg_token_index of node
+
+    @retval "egg_token_index" next
+    @retval EGG_TOKEN_INDEX_NONE no next, or failure
+
+  */
+
+egg_token_index egg_token_tree_get_next(egg_token_tree *tree,
+  egg_token_index i)
+{
+  if (!tree || (i >= tree->count))
+    return EGG_TOKEN_INDEX_NONE;
+
+  return tree->next[i];
+}
+
+  /*!
+
+    @brief Returns input offset of first byte matched by node in
+    egg_token_tree
+
+    @param tree egg_token_tree *
+    @param i    egg_token_index of node
+
+    @retval long offset
+
+  */
+
+long egg_token_tree_get_offset(egg_token_tree *tree, egg_token_index i)
+{
+  if (!tree || (i >= tree->count))
+    return 0;
+
+  return tree->offset[i];
+}
+
+  /*!
+
+    @brief Returns count of input bytes matched by node in egg_token_tree
+
+    @param tree egg_token_tree *
+    @param i    egg_token_index of node
+
+    @retval long length
+
+  */
+
+long egg_token_tree_get_length(egg_token_tree *tree, egg_token_index i)
+{
+  if (!tree || (i >= tree->count))
+    return 0;
+
+  return tree->length[i];
+}
+
+  /*!
+
+    @brief Find node of specified egg_token_type in egg_token_tree
+
+    Like egg_token_find(), the search covers the node itself, its
+    descendants, and its following siblings along with their descendants.
+    Since nodes are stored in pre-order, this is a linear scan of one
+    contiguous range of indices.
+
+    @param tree egg_token_tree *
+    @param i    egg_token_index of node where search begins
+    @param type egg_token_type
+
+    @retval "egg_token_index" found node
+    @retval EGG_TOKEN_INDEX_NONE failure, including NOT FOUND
+
+  */
+
+egg_token_index egg_token_tree_find(egg_token_tree *tree,
+  egg_token_index i,
+  egg_token_type type)
+{
+  egg_token_index end;
+
+  if (!tree || (i >= tree->count))
+    return EGG_TOKEN_INDEX_NONE;
+
+  end = subtree_end(tree, tree->ascendant[i]);
+
+  for (; i < end; ++i)
+    if (tree->type[i] == type)
+      return i;
+
+  return EGG_TOKEN_INDEX_NONE;
+}
+
+  /*!
+
+    @brief Build first-child-by-type index for egg_token_tree
+
+    After indexing, egg_token_tree_find_child() answers in constant
+    expected time instead of scanning the children of a node.  The index
+    is an open-addressing hash keyed by (ascendant, type) holding the
+    first child of each type, and is freed by egg_token_tree_free().
+
+    @param tree egg_token_tree *
+
+    @retval 1 success, including tree already indexed
+    @retval 0 failure
+
+  */
+
+int egg_token_tree_index_children(egg_token_tree *tree)
+{
+  egg_token_index size;
+  egg_token_index i;
+  egg_token_index s;
+
+  if (!tree)
+    return 0;
+
+  if (tree->child_index)
+    return 1;
+
+  size = 1;
+  while (size < (2 * tree->count))
+    size <<= 1;
+
+  tree->child_index = malloc(size * sizeof(egg_token_index));
+  if (!tree->child_index)
+    return 0;
+
+  tree->child_index_size = size;
+  for (s = 0; s < size; ++s)
+    tree->child_index[s] = EGG_TOKEN_INDEX_NONE;
+
+    // Nodes are in pre-order, so the first child of each type is seen first
+  for (i = 0; i < tree->count; ++i)
+  {
+    s = child_slot(tree, tree->ascendant[i], tree->type[i]);
+    if (tree->child_index[s] == EGG_TOKEN_INDEX_NONE)
+      tree->child_index[s] = i;
+  }
+
+  return 1;
+}
+
+  /*!
+
+    @brief Find first child node of specified egg_token_type
+
+    Only the direct descendants of node i are considered.  When the tree
+    has been indexed by egg_token_tree_index_children() the lookup is a
+    hash probe, otherwise it walks the child list of node i.
+
+    @param tree egg_token_tree *
+    @param i    egg_token_index of parent node
+    @param type egg_token_type
+
+    @retval "egg_token_index" found node
+    @retval EGG_TOKEN_INDEX_NONE failure, including NOT FOUND
+
+  */
+
+egg_token_index egg_token_tree_find_child(egg_token_tree *tree,
+  egg_token_index i,
+  egg_token_type type)
+{
+  egg_token_index c;
+
+  if (!tree || (i >= tree->count))
+    return EGG_TOKEN_INDEX_NONE;
+
+  if (tree->child_index)
+    return tree->child_index[child_slot(tree, i, type)];
+
+  for (c = tree->descendant[i]; c != EGG_TOKEN_INDEX_NONE; c = tree->next[c])
+    if (tree->type[c] == type)
+      return c;
+
+  return EGG_TOKEN_INDEX_NONE;
+}
+
+  /*!
+
+    @brief Returns string representation of node in egg_token_tree
+
+    Like egg_token_to_string(), the text of the node, its descendants,
+    and its following siblings along with their descendants is appended.
+
+    @warning This function returns a pointer to dynamically allocated memory.
+             It is the caller's responsibility to free this memory when
+             appropriate.
+
+    @param tree egg_token_tree *
+    @param i    egg_token_index of node
+    @param s    char * of existing string, can be NULL
+
+    @retval "char *" string, can be NULL if s is NULL
+
+  */
+
+char *egg_token_tree_to_string(egg_token_tree *tree,
+  egg_token_index i,
+  char *s)
+{
+  char *ns;
+  long used;
+  long length;
+
+  if (!tree || (i >= tree->count))
+    return s;
+
+    // Size the string once, then fill it in place
+
+  length = egg_token_tree_to_buffer(tree, i, NULL, 0);
+  used = (s) ? strlen(s) : 0;
+
+  ns = realloc(s, used + length + 1);
+  if (!ns)
+    return s;
+
+  egg_token_tree_to_buffer(tree, i, ns + used, length + 1);
+
+  return ns;
+}
+
+  /*!
+
+    @brief Writes string representation of node in egg_token_tree to a
+    buffer
+
+    The text is the same as from egg_token_tree_to_string(), and it is
+    written with the same rules as egg_token_to_buffer().
+
+    @param tree   egg_token_tree *
+    @param i      egg_token_index of node
+    @param buffer char * to receive the text, can be NULL
+    @param size   long size of buffer in bytes
+
+    @retval long length of the complete text, not counting the NUL byte
+
+  */
+
+long egg_token_tree_to_buffer(egg_token_tree *tree,
+  egg_token_index i,
+  char *buffer,
+  long size)
+{
+  egg_token leaf;
+  egg_token_index end;
+  char *text;
+  long length;
+  long room;
+  long n;
+
+  length = 0;
+
+  if (buffer && (size > 0))
+    buffer[0] = 0;
+
+  if (!tree || (i >= tree->count))
+    return length;
+
+  end = subtree_end(tree, tree->ascendant[i]);
+
+  for (; i < end; ++i)
+  {
+    if (tree->descendant[i] != EGG_TOKEN_INDEX_NONE)
+      continue;
+
+    memset(&leaf, 0, sizeof(egg_token));
+    leaf.type = tree->type[i];
+    leaf.offset = tree->offset[i];
+    leaf.length = tree->length[i];
+
+    if (!tree->source)
+    {
+      length += egg_token_to_buffer(&leaf,
+                  (buffer && (length < size)) ? buffer + length : NULL,
+                  size - length);
+      continue;
+    }
+
+      // Embedded input text is copied directly, without the input source
+
+    text = NULL;
+    n = 0;
+    if (leaf.length <= 0)
+    {
+      text = egg_token_type_to_string(&leaf);
+      n = strlen(text);
+    }
+    else if (leaf.offset + leaf.length <= tree->source_length)
+    {
+      text = tree->source + leaf.offset;
+      n = leaf.length;
+    }
+
+    room = (buffer && (size - 1 > length)) ? size - 1 - length : 0;
+    if (text && (room > 0))
+      memcpy(buffer + length, text, (n < room) ? n : room);
+
+    length += n;
+
+    if (buffer && (size > 0))
+      buffer[(length < size) ? length : size - 1] = 0;
+  }
+
+  return length;
+}
+
+  /*!
+
+    @brief Write egg_token_tree to a snapshot file
+
+    The snapshot holds the node arrays of the tree in a form that
+    egg_token_tree_load() can map straight into memory, so that later
+    processes can use the tree without parsing the input again.  When
+    with_source is non-zero the input text is embedded as well, and the
+    loaded tree no longer needs the input source for text or locations.
+
+    @param tree        egg_token_tree *
+    @param file_name   name of snapshot file to write
+    @param with_source non-zero to embed the input text
+
+    @retval 1 success
+    @retval 0 failure
+
+  */
+
+int egg_token_tree_save(egg_token_tree *tree,
+  char *file_name,
+  int with_source)
+{
+  egg_token_tree_snapshot_header header;
+  FILE *f;
+  long at[7];
+  long pos;
+  long length;
+  uint64_t hash;
+  int ok;
+
+  if (!tree || !file_name)
+    return 0;
+
+  if (tree->source)
+  {
+    length = tree->source_length;
+    hash = snapshot_hash(EGG_TOKEN_TREE_HASH_BASIS,
+                         (unsigned char *)tree->source,
+                         length);
+  }
+  else
+    hash_input(&length, &hash);
+
+  f = fopen(file_name, "wb");
+  if (!f)
+    return 0;
+
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, "EMBTREE", 8);
+  strncpy(header.parser, "egg", sizeof(header.parser) - 1);
+  header.version = EGG_TOKEN_TREE_SNAPSHOT_VERSION;
+  header.byte_order = 0x01020304;
+  header.type_size = sizeof(egg_token_type);
+  header.long_size = sizeof(long);
+  header.count = tree->count;
+  header.has_source = (with_source) ? 1 : 0;
+  header.source_length = (with_source) ? length : 0;
+  header.input_length = length;
+  header.input_hash = hash;
+
+  snapshot_layout(tree->count, 0, at);
+
+  ok = snapshot_write(f, &header, sizeof(header), 0) &&
+       snapshot_write(f, tree->type,
+                      tree->count * sizeof(egg_token_type), at[0]) &&
+       snapshot_write(f, tree->ascendant,
+                      tree->count * sizeof(egg_token_index), at[1]) &&
+       snapshot_write(f, tree->descendant,
+                      tree->count * sizeof(egg_token_index), at[2]) &&
+       snapshot_write(f, tree->next,
+                      tree->count * sizeof(egg_token_index), at[3]) &&
+       snapshot_write(f, tree->offset, tree->count * sizeof(long), at[4]) &&
+       snapshot_write(f, tree->length, tree->count * sizeof(long), at[5]) &&
+       snapshot_write(f, NULL, 0, at[6]);
+
+  if (ok && with_source)
+  {
+    if (tree->source)
+      ok = snapshot_write(f, tree->source, tree->source_length, at[6]);
+    else
+    {
+      pos = input_get_position();
+      input_set_position(0);
+      while (ok && !input_eof())
+        ok = (fputc(input_byte(), f) != EOF);
+      input_set_position(pos);
+    }
+  }
+
+  if (fclose(f))
+    ok = 0;
+
+  return ok;
+}
+
+  /*!
+
+    @brief Load egg_token_tree from a snapshot file
+
+    The file is mapped into memory, and the node arrays of the returned
+    tree point into the mapping, so loading costs no per-node allocation
+    or copying however large the tree is.  The mapping is released by
+    egg_token_tree_free().
+
+    Every node index and span is checked, so a damaged or altered snapshot
+    is refused.  A tree without embedded input text should be checked
+    against the input source with egg_token_tree_match_input().
+
+    @param file_name name of snapshot file to read
+
+    @retval "egg_token_tree *" success
+    @retval NULL failure, including a snapshot from another parser, format
+                version, incompatible host or inconsistent nodes
+
+  */
+
+egg_token_tree *egg_token_tree_load(char *file_name)
+{
+  egg_token_tree_snapshot_header *header;
+  egg_token_tree *tree;
+  struct stat st;
+  long at[7];
+  char *map;
+  int fd;
+
+  if (!file_name)
+    return NULL;
+
+  fd = open(file_name, O_RDONLY);
+  if (fd < 0)
+    return NULL;
+
+  if (fstat(fd, &st) ||
+      (st.st_size < (off_t)sizeof(*header)))
+  {
+    close(fd);
+    return NULL;
+  }
+
+  map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED)
+    return NULL;
+
+  header = (egg_token_tree_snapshot_header *)map;
+  if (memcmp(header->magic, "EMBTREE", 8) ||
+      strncmp(header->parser, "egg", sizeof(header->parser)) ||
+      (header->version != EGG_TOKEN_TREE_SNAPSHOT_VERSION) ||
+      (header->byte_order != 0x01020304) ||
+      (header->type_size != sizeof(egg_token_type)) ||
+      (header->long_size != sizeof(long)) ||
+      (header->has_source &&
+       (header->source_length != header->input_length)) ||
+      (header->source_length > (uint64_t)st.st_size) ||
+      (snapshot_layout(header->count, header->source_length, at) >
+       (long)st.st_size))
+  {
+    munmap(map, st.st_size);
+    return NULL;
+  }
+
+  tree = malloc(sizeof(egg_token_tree));
+  if (!tree)
+  {
+    munmap(map, st.st_size);
+    return NULL;
+  }
+
+  tree->count = header->count;
+  tree->type = (egg_token_type *)(map + at[0]);
+  tree->ascendant = (egg_token_index *)(map + at[1]);
+  tree->descendant = (egg_token_index *)(map + at[2]);
+  tree->next = (egg_token_index *)(map + at[3]);
+  tree->offset = (long *)(map + at[4]);
+  tree->length = (long *)(map + at[5]);
+  tree->child_index = NULL;
+  tree->child_index_size = 0;
+  tree->source = (header->has_source) ? map + at[6] : NULL;
+  tree->source_length = (header->has_source) ? header->source_length : 0;
+  tree->line_start = NULL;
+  tree->line_count = 0;
+  tree->mapping = map;
+  tree->mapping_size = st.st_size;
+
+  if (!check_nodes(tree, header))
+  {
+    egg_token_tree_free(tree);
+    return NULL;
+  }
+
+  return tree;
+}
+  /*!
+
+    @brief Check that the input source is the one a tree was parsed from
+
+    A snapshot records the length and a hash of the input it was parsed
+    from.  The offsets of a tree loaded without embedded input text refer
+    to the input source, so it should be checked with this function before
+    text or locations are read through it.
+
+    @param tree egg_token_tree *
+
+    @retval 1 input source matches, or tree was not loaded from a snapshot
+    @retval 0 input source differs
+
+  */
+
+int egg_token_tree_match_input(egg_token_tree *tree)
+{
+  egg_token_tree_snapshot_header *header;
+  long length;
+  uint64_t hash;
+
+  if (!tree)
+    return 0;
+
+  if (!tree->mapping)
+    return 1;
+
+  header = (egg_token_tree_snapshot_header *)tree->mapping;
+
+  hash_input(&length, &hash);
+
+  return ((uint64_t)length == header->input_length) &&
+         (hash == header->input_hash);
+}
+
+  /*!
+
+    @brief Returns input text embedded in egg_token_tree
+
+    @param tree   egg_token_tree *
+    @param length long * to receive count of bytes, or NULL
+
+    @retval "char *" embedded input text, which is not NUL terminated
+    @retval NULL no text is embedded, it is read from the input source
+
+  */
+
+char *egg_token_tree_get_source(egg_token_tree *tree, long *length)
+{
+  if (length)
+    *length = (tree) ? tree->source_length : 0;
+
+  if (!tree)
+    return NULL;
+
+  return tree->source;
+}
+
+  /*!
+
+    @brief Gets line + offset location of node in egg_token_tree
+
+    When input text is embedded in the tree, an index of its line starts
+    is built the first time a location is asked for.  Otherwise the
+    location comes from egg_token_get_location(), which reads the input
+    source.
+
+    @param tree     egg_token_tree *
+    @param i        egg_token_index of node
+    @param location input_location * to receive the location
+
+  */
+
+void egg_token_tree_get_location(egg_token_tree *tree,
+  egg_token_index i,
+  input_location *location)
+{
+  egg_token leaf;
+  long lo;
+  long hi;
+  long mid;
+
+  if (!location)
+    return;
+
+  location->line_number = 0;
+  location->character_offset = 0;
+
+  if (!tree || (i >= tree->count))
+    return;
+
+  if (!tree->source)
+  {
+    memset(&leaf, 0, sizeof(egg_token));
+    leaf.offset = tree->offset[i];
+    egg_token_get_location(&leaf, location);
+    return;
+  }
+
+  if (!tree->line_start && !index_lines(tree))
+    return;
+
+  lo = 0;
+  hi = tree->line_count - 1;
+  while (lo < hi)
+  {
+    mid = (lo + hi + 1) / 2;
+    if (tree->line_start[mid] <= tree->offset[i])
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+
+  location->line_number = lo + 1;
+  location->character_offset = tree->offset[i] - tree->line_start[lo];
+}
+
+  /*!
+
+    @brief Append input text matched by one node to a string
+
+    Unlike egg_token_tree_to_string(), only the text of node i itself is
+    appended, not the text of its following siblings.
+
+    @param tree egg_token_tree *
+    @param i    egg_token_index of node
+    @param s    existing string to append to, or NULL
+
+    @retval "char *" s with the text of node i appended
+
+  */
+
+char *egg_token_tree_span_to_string(egg_token_tree *tree,
+  egg_token_index i,
+  char *s)
+{
+  egg_token leaf;
+  char *ns;
+  long used;
+
+  if (!tree || (i >= tree->count))
+    return s;
+
+  if (!tree->source)
+  {
+    memset(&leaf, 0, sizeof(egg_token));
+    leaf.type = tree->type[i];
+    leaf.offset = tree->offset[i];
+    leaf.length = tree->length[i];
+    return egg_token_span_to_string(&leaf, s);
+  }
+
+  if ((tree->length[i] <= 0) ||
+      (tree->offset[i] + tree->length[i] > tree->source_length))
+    return s;
+
+  used = (s) ? strlen(s) : 0;
+
+  ns = realloc(s, used + tree->length[i] + 1);
+  if (!ns)
+    return s;
+
+  memcpy(ns + used, tree->source + tree->offset[i], tree->length[i]);
+  ns[used + tree->length[i]] = 0;
+
+  return ns;
+}
+
+  /*!
+
+    @brief Returns the index just past the subtree of a node
+
+    @param tree egg_token_tree *
+    @param i    egg_token_index of node, or EGG_TOKEN_INDEX_NONE for
+                the whole tree
+
+    @retval "egg_token_index" end of subtree
+
+  */
+
+static egg_token_index subtree_end(egg_token_tree *tree, egg_token_index i)
+{
+  while ((i != EGG_TOKEN_INDEX_NONE) &&
+         (tree->next[i] == EGG_TOKEN_INDEX_NONE))
+    i = tree->ascendant[i];
+
+  if (i == EGG_TOKEN_INDEX_NONE)
+    return tree->count;
+
+  return tree->next[i];
+}
+
+  /*!
+
+    @brief Locate child index slot for (ascendant, type) key
+
+    @param tree egg_token_tree * with child index
+    @param a    egg_token_index of ascendant
+    @param type egg_token_type
+
+    @retval "egg_token_index" slot holding the key, or the empty slot
+                where it would be inserted
+
+  */
+
+static egg_token_index child_slot(egg_token_tree *tree,
+  egg_token_index a,
+  egg_token_type type)
+{
+  egg_token_index mask;
+  egg_token_index s;
+  egg_token_index c;
+
+  mask = tree->child_index_size - 1;
+  s = ((a * 2654435761u) ^ (egg_token_index)type) & mask;
+
+  while ((c = tree->child_index[s]) != EGG_TOKEN_INDEX_NONE)
+  {
+    if ((tree->ascendant[c] == a) && (tree->type[c] == type))
+      break;
+
+    s = (s + 1) & mask;
+  }
+
+  return s;
+}
+
+  /*!
+
+    @brief Compute where each part of a snapshot file starts
+
+    @param count         count of nodes in tree
+    @param source_length count of bytes of embedded input text
+    @param at            array of 7 longs to receive the starting offsets
+                         of the type, ascendant, descendant, next, offset
+                         and length arrays, and of the input text
+
+    @retval long total size of snapshot file
+
+  */
+
+static long snapshot_layout(egg_token_index count,
+  long source_length,
+  long *at)
+{
+  long size[6];
+  long end;
+  int k;
+
+  size[0] = count * (long)sizeof(egg_token_type);
+  size[1] = count * (long)sizeof(egg_token_index);
+  size[2] = size[1];
+  size[3] = size[1];
+  size[4] = count * (long)sizeof(long);
+  size[5] = size[4];
+
+  end = sizeof(egg_token_tree_snapshot_header);
+  for (k = 0; k < 6; ++k)
+  {
+    at[k] = (end + 7) & ~7L;
+    end = at[k] + size[k];
+  }
+  at[6] = (end + 7) & ~7L;
+
+  return at[6] + source_length;
+}
+
+  /*!
+
+    @brief Write part of a snapshot file at a given offset
+
+    The file is padded with zero bytes up to the offset first, so parts
+    must be written in order.
+
+    @param f    FILE * of open snapshot file
+    @param data bytes to write, or NULL to only pad
+    @param size count of bytes to write
+    @param at   offset in file at which data starts
+
+    @retval 1 success
+    @retval 0 failure
+
+  */
+
+static int snapshot_write(FILE *f, void *data, long size, long at)
+{
+  long pos;
+
+  pos = ftell(f);
+  if (pos < 0)
+    return 0;
+
+  for (; pos < at; ++pos)
+    if (fputc(0, f) == EOF)
+      return 0;
+
+  if (!data || (size <= 0))
+    return 1;
+
+  return (fwrite(data, 1, size, f) == (size_t)size);
+}
+
+  /*!
+
+    @brief Build index of line starts of input text embedded in tree
+
+    @param tree egg_token_tree * with embedded input text
+
+    @retval 1 success
+    @retval 0 failure
+
+  */
+
+static int index_lines(egg_token_tree *tree)
+{
+  char *p;
+  char *end;
+  long n;
+
+  end = tree->source + tree->source_length;
+
+  n = 1;
+  for (p = tree->source; (p = memchr(p, '\n', end - p)); ++p)
+    ++n;
+
+  tree->line_start = malloc(n * sizeof(long));
+  if (!tree->line_start)
+    return 0;
+
+  tree->line_start[0] = 0;
+  tree->line_count = 1;
+  for (p = tree->source; (p = memchr(p, '\n', end - p)); ++p)
+    tree->line_start[tree->line_count++] = p + 1 - tree->source;
+
+  return 1;
+}
+
+  /*!
+
+    @brief Check the node arrays of a loaded snapshot
+
+    Nodes are stored in pre-order, so the ascendant of a node comes before
+    it, its first descendant directly follows it, and its next sibling
+    comes later and shares its ascendant.  Every type must be known, every
+    span must lie within the input the tree was parsed from, and embedded
+    input text must match the recorded hash.
+
+    @param tree   egg_token_tree * just loaded
+    @param header egg_token_tree_snapshot_header * of its snapshot
+
+    @retval 1 nodes are consistent
+    @retval 0 snapshot is damaged or altered
+
+  */
+
+static int check_nodes(egg_token_tree *tree,
+  egg_token_tree_snapshot_header *header)
+{
+  egg_token_index i;
+  egg_token_index n;
+  long length;
+
+  length = (long)header->input_length;
+
+  if (tree->source &&
+      (snapshot_hash(EGG_TOKEN_TREE_HASH_BASIS,
+                     (unsigned char *)tree->source,
+                     tree->source_length) != header->input_hash))
+    return 0;
+
+  for (i = 0; i < tree->count; ++i)
+  {
+    if ((unsigned long)tree->type[i] >= EGG_TOKEN_TYPE_COUNT)
+      return 0;
+
+    n = tree->ascendant[i];
+    if ((n != EGG_TOKEN_INDEX_NONE) && (n >= i))
+      return 0;
+
+    n = tree->descendant[i];
+    if ((n != EGG_TOKEN_INDEX_NONE) &&
+        ((n != i + 1) || (n >= tree->count) || (tree->ascendant[n] != i)))
+      return 0;
+
+    n = tree->next[i];
+    if ((n != EGG_TOKEN_INDEX_NONE) &&
+        ((n <= i) || (n >= tree->count) ||
+         (tree->ascendant[n] != tree->ascendant[i])))
+      return 0;
+
+    if ((tree->offset[i] < 0) || (tree->length[i] < 0) ||
+        (tree->offset[i] > length) ||
+        (tree->length[i] > length - tree->offset[i]))
+      return 0;
+  }
+
+  return 1;
+}
+
+  /*!
+
+    @brief Measure and hash the whole input source
+
+    The input position is restored afterwards.
+
+    @param length long * to receive count of bytes of input
+    @param hash   uint64_t * to receive hash of input
+
+  */
+
+static void hash_input(long *length, uint64_t *hash)
+{
+  unsigned char b;
+  long pos;
+
+  *length = 0;
+  *hash = EGG_TOKEN_TREE_HASH_BASIS;
+
+  pos = input_get_position();
+  input_set_position(0);
+  while (!input_eof())
+  {
+    b = input_byte();
+    *hash = snapshot_hash(*hash, &b, 1);
+    ++*length;
+  }
+  input_set_position(pos);
+
+  return;
+}
+
+  /*!
+
+    @brief Continue an FNV-1a hash over a run of bytes
+
+    @param hash   uint64_t hash so far, EGG_TOKEN_TREE_HASH_BASIS to start
+    @param bytes unsigned char * to bytes to hash
+    @param count long count of bytes
+
+    @retval uint64_t hash including the bytes
+
+  */
+
+static uint64_t snapshot_hash(uint64_t hash,
+  unsigned char *bytes,
+  long count)
+{
+  long i;
+
+  for (i = 0; i < count; ++i)
+  {
+    hash ^= bytes[i];
+    hash *= EGG_TOKEN_TREE_HASH_PRIME;
+  }
+
+  return hash;
+}
+
@@ -46,13 +46,36 @@
 #define FALSE 0
 #define TRUE 1
 
+#define EGG_TOKEN_ARENA_BLOCK_SIZE 4096
+#define EGG_TOKEN_LINE_INDEX_SIZE 256
+
+typedef struct egg_token_arena_block
+{
+  struct egg_token_arena_block *previous;
+  long base;
+  long used;
+  egg_token tokens[EGG_TOKEN_ARENA_BLOCK_SIZE];
+} egg_token_arena_block;
+
+static egg_token_arena_block *_arena = NULL;
+static egg_token_arena_block *_arena_spare = NULL;
+
+static long *_line_start = NULL;
+static long _line_count = 0;
+static long _line_size = 0;
+static long _line_scanned = 0;
+
+static int extend_line_index(long offset);
+
   /*!
 
     @brief Create a new egg_token
 
-    @warning This function returns a pointer to dynamically allocated memory.
-             It is the caller's responsibility to free this memory when 
-             appropriate.
+    The new token is allocated from the token arena.
+
+    @warning This function returns a pointer to memory owned by the token arena.
+             This memory is reclaimed by egg_token_arena_rewind() or
+             egg_token_arena_release().
 
     @param type egg_token_type
 
@@ -64,16 +87,35 @@
 egg_token *egg_token_new(egg_token_type type)
 {
   egg_token *new = NULL;
+  egg_token_arena_block *b;
 
-  new = malloc(sizeof(egg_token));
-  if (!new)
-    return NULL;
+  if (!_arena || (_arena->used >= EGG_TOKEN_ARENA_BLOCK_SIZE))
+  {
+    if (_arena_spare)
+    {
+      b = _arena_spare;
+      _arena_spare = b->previous;
+    }
+    else
+    {
+      b = malloc(sizeof(egg_token_arena_block));
+      if (!b)
+        return NULL;
+    }
+
+    b->previous = _arena;
+    b->base = (_arena) ? _arena->base + _arena->used : 0;
+    b->used = 0;
+    _arena = b;
+  }
+
+  new = &(_arena->tokens[_arena->used++]);
 
   memset(new, 0, sizeof(egg_token));
 
   new->type = type;
 
-  input_get_location(&(new->location));
+  new->offset = input_get_position();
 
   return new;
 }
@@ -82,6 +124,10 @@ egg_token *egg_token_new(egg_token_type type)
 
     @brief Free the memory associated with egg_token
 
+    Only the most recently allocated token is returned to the token arena
+    immediately.  The memory of any other token is reclaimed by
+    egg_token_arena_rewind() or egg_token_arena_release().
+
     @warning This function does NOT perform any unlinking of the freed token.
     @sa egg_token_unlink()
 
@@ -94,7 +140,9 @@ void egg_token_free(egg_token *t)
   if (!t)
     return;
 
-  free(t);
+  if (_arena && _arena->used &&
+      (t == &(_arena->tokens[_arena->used - 1])))
+    --_arena->used;
 
   return;
 }
@@ -107,6 +155,9 @@ void egg_token_free(egg_token *t)
     @param dir egg_token_direction
     @param n   egg_token * to link
 
+    When linking below, any tokens following n are linked below t with it,
+    so a whole chain of siblings is attached in one step.
+
     @retval TRUE  success
     @retval FALSE failure
 
@@ -157,7 +208,8 @@ unsigned char egg_token_add(egg_token *t, egg_token_direction dir, egg_token *n)
       if (t->descendant)
         return FALSE;
       t->descendant = n;
-      n->ascendant = t;
+      for (; n; n = n->next)
+        n->ascendant = t;
 
       break;
   }
@@ -395,6 +447,271 @@ void egg_token_set_next(egg_token *t, egg_token *n)
   t->next = n;
 }
 
+  /*!
+
+    @brief Returns input offset of first byte matched by egg_token
+
+    @param t egg_token *
+
+    @retval long offset
+
+  */
+
+long egg_token_get_offset(egg_token *t)
+{
+  if (!t)
+    return 0;
+
+  return t->offset;
+}
+
+  /*!
+
+    @brief Sets input offset of first byte matched by egg_token
+
+    @param t existing egg_token *
+    @param offset long offset
+
+  */
+
+void egg_token_set_offset(egg_token *t, long offset)
+{
+  if (!t)
+    return;
+
+  t->offset = offset;
+}
+
+  /*!
+
+    @brief Returns count of input bytes matched by egg_token
+
+    @param t egg_token *
+
+    @retval long length
+
+  */
+
+long egg_token_get_length(egg_token *t)
+{
+  if (!t)
+    return 0;
+
+  return t->length;
+}
+
+  /*!
+
+    @brief Sets count of input bytes matched by egg_token
+
+    @param t existing egg_token *
+    @param length long length
+
+  */
+
+void egg_token_set_length(egg_token *t, long length)
+{
+  if (!t)
+    return;
+
+  t->length = length;
+}
+
+  /*!
+
+    @brief Gets line + offset location of egg_token in input source
+
+    The location is not stored in the token.  It is computed from the
+    token's input offset using an index of line starts, which is built
+    from the input source the first time a location is asked for, and
+    extended as later tokens require.  Lines are numbered from 1, and the
+    character offset is the count of bytes preceding the token on its
+    line.
+
+    @param t        existing egg_token *
+    @param location input_location * to receive the location
+
+  */
+
+void egg_token_get_location(egg_token *t, input_location *location)
+{
+  long lo;
+  long hi;
+  long mid;
+
+  if (!location)
+    return;
+
+  location->line_number = 0;
+  location->character_offset = 0;
+
+  if (!t)
+    return;
+
+  if (!extend_line_index(t->offset))
+    return;
+
+  lo = 0;
+  hi = _line_count - 1;
+  while (lo < hi)
+  {
+    mid = (lo + hi + 1) / 2;
+    if (_line_start[mid] <= t->offset)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+
+  location->line_number = lo + 1;
+  location->character_offset = t->offset - _line_start[lo];
+}
+
+  /*!
+
+    @brief Initialize a egg_token_iterator
+
+    A pre-order or post-order walk visits t, its descendants, and then each
+    following sibling of t along with its descendants, in the same order
+    as the egg_token tree would be walked recursively.  A children walk
+    visits only the direct descendants of t.
+
+    The walk follows the ascendant links set by egg_token_add(), so it
+    needs no stack, and its memory use does not depend on the depth or
+    the width of the tree.
+
+    @warning The tree must not be changed while it is being walked.
+
+    @param it    egg_token_iterator * to initialize
+    @param t     egg_token * to start the walk from
+    @param order egg_token_order
+
+  */
+
+void egg_token_iterator_init(egg_token_iterator *it,
+  egg_token *t,
+  egg_token_order order)
+{
+  if (!it)
+    return;
+
+  it->order = order;
+  it->first = t;
+  it->current = NULL;
+  it->depth = 0;
+
+  return;
+}
+
+  /*!
+
+    @brief Returns next egg_token of a walk
+
+    @param it existing egg_token_iterator *
+
+    @retval "egg_token *" next token
+    @retval NULL walk is complete
+
+  */
+
+egg_token *egg_token_iterator_next(egg_token_iterator *it)
+{
+  egg_token *t;
+
+  if (!it)
+    return NULL;
+
+  t = it->current;
+
+  switch (it->order)
+  {
+    case egg_token_pre_order:
+
+      if (it->first)
+        t = it->first;
+      else if (t && t->descendant)
+      {
+        t = t->descendant;
+        ++it->depth;
+      }
+      else
+      {
+        while (t && !t->next && (it->depth > 0))
+        {
+          t = t->ascendant;
+          --it->depth;
+        }
+        t = (t) ? t->next : NULL;
+      }
+
+      break;
+
+    case egg_token_post_order:
+
+      if (it->first)
+        t = it->first;
+      else if (t && t->next)
+        t = t->next;
+      else if (t && (it->depth > 0))
+      {
+        t = t->ascendant;
+        --it->depth;
+        break;
+      }
+      else
+      {
+        t = NULL;
+        break;
+      }
+
+        // Descend to the first leaf below t
+
+      while (t && t->descendant)
+      {
+        t = t->descendant;
+        ++it->depth;
+      }
+
+      break;
+
+    case egg_token_children:
+
+      if (it->first)
+      {
+        t = it->first->descendant;
+        it->depth = 1;
+      }
+      else
+        t = (t) ? t->next : NULL;
+
+      break;
+  }
+
+  it->first = NULL;
+  it->current = t;
+
+  return t;
+}
+
+  /*!
+
+    @brief Returns depth of the current egg_token of a walk
+
+    The token a walk starts from, and its siblings, are at depth 0.
+
+    @param it existing egg_token_iterator *
+
+    @retval int depth below the first token
+
+  */
+
+int egg_token_iterator_get_depth(egg_token_iterator *it)
+{
+  if (!it)
+    return 0;
+
+  return it->depth;
+}
+
   /*!
 
     @brief Find next egg_token of specified egg_token_type
@@ -409,21 +726,95 @@ void egg_token_set_next(egg_token *t, egg_token *n)
 
 egg_token *egg_token_find(egg_token *t, egg_token_type type)
 {
+  egg_token_iterator it;
   egg_token *f;
 
+  egg_token_iterator_init(&it, t, egg_token_pre_order);
+  while ((f = egg_token_iterator_next(&it)))
+    if (f->type == type)
+      return f;
+
+  return NULL;
+}
+
+  /*!
+
+    @brief Find first child egg_token of specified egg_token_type
+
+    Unlike egg_token_find(), only the direct descendants of t are
+    searched, so the cost is bounded by the number of children of t.
+
+    @param t    existing egg_token *
+    @param type egg_token_type
+
+    @retval "egg_token *" found egg_token
+    @retval NULL failure, including NOT FOUND
+
+  */
+
+egg_token *egg_token_find_child(egg_token *t, egg_token_type type)
+{
+  egg_token *c;
+
   if (!t)
     return NULL;
 
-  if (t->type == type)
-    return t;
+  for (c = t->descendant; c; c = c->next)
+    if (c->type == type)
+      return c;
+
+  return NULL;
+}
+
+  /*!
+
+    @brief Find egg_token of specified egg_token_type below a token
+
+    The descendants of t are searched in pre-order, but no deeper than
+    depth levels below t.  A depth of 1 searches only the children of t,
+    and a depth of 0 or less searches the whole subtree of t.  Neither t
+    nor its siblings are searched.
+
+    @param t     existing egg_token *
+    @param type  egg_token_type
+    @param depth int maximum depth below t
+
+    @retval "egg_token *" found egg_token
+    @retval NULL failure, including NOT FOUND
+
+  */
+
+egg_token *egg_token_find_within(egg_token *t,
+  egg_token_type type,
+  int depth)
+{
+  egg_token *p;
+  int d;
 
-  f = egg_token_find(t->descendant, type);
-  if (f)
-    return f;
+  if (!t)
+    return NULL;
 
-  f = egg_token_find(t->next, type);
-  if (f)
-    return f;
+  d = 1;
+  p = t->descendant;
+  while (p)
+  {
+    if (p->type == type)
+      return p;
+
+    if (p->descendant && ((depth <= 0) || (d < depth)))
+    {
+      p = p->descendant;
+      ++d;
+      continue;
+    }
+
+    while (!p->next && (d > 1))
+    {
+      p = p->ascendant;
+      --d;
+    }
+    p = p->next;
+  }
 
   return NULL;
 }
@@ -432,8 +823,11 @@ egg_token *egg_token_find(egg_token *t, egg_token_type type)
 
     @brief Returns string representation of egg_token
 
-    @warning This is a recursive function, therefore parameter s can NOT point to static
-              memory.
+    The text of each leaf token is read from the input source span it
+    matched.  The text is measured first, so s is grown only once.
+    @sa egg_token_span_to_string(), egg_token_to_buffer()
+
+    @warning Parameter s can NOT point to static memory.
 
     @warning This function returns a pointer to dynamically allocated memory.
              It is the caller's responsibility to free this memory when
@@ -448,16 +842,321 @@ egg_token *egg_token_find(egg_token *t, egg_token_type type)
 
 char *egg_token_to_string(egg_token *t, char *s)
 {
+  char *ns;
+  long used;
+  long length;
+
   if (!t)
     return s;
 
-  if (!t->descendant)
-    s = strapp(s , egg_token_type_to_string(t));
-  else
-    s = egg_token_to_string(t->descendant, s);
+    // Size the string once, then fill it in place
+
+  length = egg_token_to_buffer(t, NULL, 0);
+  used = (s) ? strlen(s) : 0;
+
+  ns = realloc(s, used + length + 1);
+  if (!ns)
+    return s;
+
+  egg_token_to_buffer(t, ns + used, length + 1);
+
+  return ns;
+}
+
+  /*!
+
+    @brief Writes string representation of egg_token to a buffer
+
+    The text is the same as from egg_token_to_string(), but it is written
+    into a caller provided buffer.  At most size - 1 bytes of text are
+    written, followed by a terminating NUL byte.  Calling this function
+    with a NULL buffer only measures the text, so a buffer of the right
+    size can be allocated before it is filled.
+
+    @param t      existing egg_token *
+    @param buffer char * to receive the text, can be NULL
+    @param size   long size of buffer in bytes
+
+    @retval long length of the complete text, not counting the NUL byte
+
+  */
+
+long egg_token_to_buffer(egg_token *t, char *buffer, long size)
+{
+  egg_token_iterator it;
+  egg_token *l;
+  char *name;
+  long length;
+  long room;
+  long pos;
+  long n;
+  long i;
+
+  length = 0;
+  pos = input_get_position();
+
+  egg_token_iterator_init(&it, t, egg_token_pre_order);
+  while ((l = egg_token_iterator_next(&it)))
+  {
+    if (l->descendant)
+      continue;
+
+    room = (buffer && (size - 1 > length)) ? size - 1 - length : 0;
+
+    if (l->length > 0)
+    {
+      n = l->length;
+      if (room > 0)
+      {
+        input_set_position(l->offset);
+        for (i = 0; (i < n) && (i < room); ++i)
+          buffer[length + i] = input_byte();
+      }
+    }
+    else
+    {
+      name = egg_token_type_to_string(l);
+      n = strlen(name);
+      if (room > 0)
+        memcpy(buffer + length, name, (n < room) ? n : room);
+    }
+
+    length += n;
+  }
+
+  input_set_position(pos);
+
+  if (buffer && (size > 0))
+    buffer[(length < size) ? length : size - 1] = 0;
+
+  return length;
+}
+
+  /*!
+
+    @brief Appends the input text matched by egg_token to a string
+
+    The text is read back from the input source using the offset and
+    length recorded in the token, therefore the input source must not
+    have been cleaned up.  Unlike egg_token_to_string(), neither the
+    descendants nor the siblings of the token are visited.
+
+    @warning This function returns a pointer to dynamically allocated memory.
+             It is the caller's responsibility to free this memory when
+             appropriate.
+
+    @param t existing egg_token *
+    @param s char * of existing string, can be NULL
+
+    @retval "char *" string, can be NULL if s is NULL
+
+  */
+
+char *egg_token_span_to_string(egg_token *t, char *s)
+{
+  char *ns;
+  long used;
+  long pos;
+  long i;
+
+  if (!t)
+    return s;
+
+  if (t->length <= 0)
+    return s;
+
+  used = (s) ? strlen(s) : 0;
+
+  ns = realloc(s, used + t->length + 1);
+  if (!ns)
+    return s;
+
+  pos = input_get_position();
+  input_set_position(t->offset);
+  for (i = 0; i < t->length; ++i)
+    ns[used + i] = input_byte();
+  ns[used + i] = 0;
+  input_set_position(pos);
+
+  return ns;
+}
+
+  /*!
+
+    @brief Mark the current allocation point of the token arena
 
-  s = egg_token_to_string(t->next, s);
+    The returned mark can later be given to egg_token_arena_rewind()
+    to reclaim, in one step, every token allocated after the mark was
+    taken.
 
-  return s;
+    @retval "egg_token_mark" current allocation point
+
+  */
+
+egg_token_mark egg_token_arena_mark(void)
+{
+  egg_token_mark mark;
+
+  mark.block = _arena;
+  mark.used = (_arena) ? _arena->used : 0;
+  mark.index = (_arena) ? _arena->base + _arena->used : 0;
+
+  return mark;
+}
+
+  /*!
+
+    @brief Rewind the token arena to a previously taken mark
+
+    Every token allocated after the mark was taken is reclaimed.  Blocks
+    emptied by the rewind are kept for reuse by egg_token_new().
+
+    @warning Any pointer to a token allocated after the mark was taken
+             is invalid after this call.
+
+    @param mark egg_token_mark from egg_token_arena_mark()
+
+  */
+
+void egg_token_arena_rewind(egg_token_mark mark)
+{
+  egg_token_arena_block *b;
+
+  while (_arena && (_arena != mark.block))
+  {
+    b = _arena;
+    _arena = b->previous;
+    b->previous = _arena_spare;
+    _arena_spare = b;
+  }
+
+  if (_arena)
+    _arena->used = mark.used;
+
+  return;
+}
+
+  /*!
+
+    @brief Release all memory held by the token arena
+
+    This frees every token, and therefore every token tree, at once.
+    The line start index used by egg_token_get_location() is discarded
+    as well, by egg_token_line_index_release().
+
+    @warning Any pointer to a token is invalid after this call.
+
+  */
+
+void egg_token_arena_release(void)
+{
+  egg_token_arena_block *b;
+
+  while (_arena)
+  {
+    b = _arena;
+    _arena = b->previous;
+    free(b);
+  }
+
+  while (_arena_spare)
+  {
+    b = _arena_spare;
+    _arena_spare = b->previous;
+    free(b);
+  }
+
+  egg_token_line_index_release();
+
+  return;
+}
+
+  /*!
+
+    @brief Discard the line start index
+
+    The index used by egg_token_get_location() is built lazily from the
+    input source, so it must be discarded whenever a different input is
+    parsed.  egg_input_initialize() does so.
+
+  */
+
+void egg_token_line_index_release(void)
+{
+  free(_line_start);
+  _line_start = NULL;
+  _line_count = 0;
+  _line_size = 0;
+  _line_scanned = 0;
+
+  return;
+}
+
+  /*!
+
+    @brief Extends the line start index to cover an input offset
+
+    Every input byte before offset, not already scanned, is read from the
+    input source, and the offset of each line following a newline is
+    appended to the index.  The input position is restored afterwards.
+
+    @param offset long input offset to cover
+
+    @retval TRUE  index covers offset
+    @retval FALSE out of memory
+
+  */
+
+static int extend_line_index(long offset)
+{
+  long *ls;
+  long pos;
+  byte b;
+
+  if (!_line_start)
+  {
+    _line_start = malloc(EGG_TOKEN_LINE_INDEX_SIZE * sizeof(long));
+    if (!_line_start)
+      return FALSE;
+
+    _line_size = EGG_TOKEN_LINE_INDEX_SIZE;
+    _line_start[0] = 0;
+    _line_count = 1;
+    _line_scanned = 0;
+  }
+
+  if (offset <= _line_scanned)
+    return TRUE;
+
+  pos = input_get_position();
+  input_set_position(_line_scanned);
+
+  while ((_line_scanned < offset) && !input_eof())
+  {
+    b = input_byte();
+    ++_line_scanned;
+
+    if (b != '\n')
+      continue;
+
+    if (_line_count >= _line_size)
+    {
+      ls = realloc(_line_start, 2 * _line_size * sizeof(long));
+      if (!ls)
+      {
+        input_set_position(pos);
+        return FALSE;
+      }
+
+      _line_start = ls;
+      _line_size *= 2;
+    }
+
+    _line_start[_line_count++] = _line_scanned;
+  }
+
+  input_set_position(pos);
+
+  return TRUE;
 }
 
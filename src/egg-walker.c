@@ -34,6 +34,7 @@
 #include "gray/input.h"
 #include "egg-token.h"
 #include "egg-token-util.h"
+#include "egg-token-tree.h"
 #include "egg-parser.h"
 
 #define FALSE 0
@@ -42,6 +43,9 @@
 static void usage(void);
 static void version(void);
 static void walk(egg_token *t, int level);
+static void walk_tree(egg_token_tree *tree);
+static void print_text(char *s);
+static int walk_snapshot(char *snapshot_file, char *input_file);
 
   /*!
 
@@ -75,11 +79,17 @@ int main(int argc, char **argv)
     { 0, 0, 0, 0 }
   };
   unsigned char syntax_only = FALSE;
+  unsigned char compact = FALSE;
+  unsigned char embed_source = FALSE;
+  char *snapshot_in = NULL;
+  char *snapshot_out = NULL;
   unsigned char walk_grammar = FALSE;
-  egg_token *t;
+  egg_token *t = NULL;
+  egg_token_tree *tree;
+  unsigned char passed = FALSE;
   char *input_file;
 
-  while ((c = getopt_long(argc, argv, "svh", long_opts, &long_index)) != -1)
+  while ((c = getopt_long(argc, argv, "cel:o:svh", long_opts, &long_index)) != -1)
   {
     switch (c)
     {
@@ -93,6 +103,18 @@ int main(int argc, char **argv)
             break;
         }
         break;
+      case 'c':
+        compact = TRUE;
+        break;
+      case 'e':
+        embed_source = TRUE;
+        break;
+      case 'l':
+        snapshot_in = optarg;
+        break;
+      case 'o':
+        snapshot_out = optarg;
+        break;
       case 's':
         syntax_only = TRUE;
         break;
@@ -112,16 +134,40 @@ int main(int argc, char **argv)
     if (strcmp(argv[optind], "-"))
       input_file = strdup(argv[optind]);
 
-  if (!input_initialize(input_file))
+  if (snapshot_in)
+    return walk_snapshot(snapshot_in, input_file);
+
+  if (!egg_input_initialize(input_file))
     return 1;
 
-  if (walk_grammar)
+  egg_input_buffer_load();
+
+  if (walk_grammar && syntax_only)
+  {
+    passed = (recognize_grammar() >= 0);
+    printf("%s.\n", (passed) ? "Passed" : "Failed");
+  }
+  else if (walk_grammar)
   {
     t = grammar();
     if (t)
     {
-      if (syntax_only)
-        printf("Passed.\n");
+      if (snapshot_out)
+      {
+        tree = egg_token_tree_new(t);
+        if (!egg_token_tree_save(tree, snapshot_out, embed_source))
+        {
+          fprintf(stderr, "Unable to write %s\n", snapshot_out);
+          t = NULL;
+        }
+        egg_token_tree_free(tree);
+      }
+      else if (compact)
+      {
+        tree = egg_token_tree_new(t);
+        walk_tree(tree);
+        egg_token_tree_free(tree);
+      }
       else
         walk(t, 0);
     }
@@ -129,9 +175,12 @@ int main(int argc, char **argv)
       printf("Failed.\n");
   }
 
+  egg_input_buffer_release();
   input_cleanup();
 
-  if (!t)
+  egg_token_arena_release();
+
+  if (!t && !passed)
     return 1;
 
   return 0;
@@ -171,27 +220,193 @@ static void version(void)
      @brief Walks a egg_token tree.
 
      This function walks egg_token tree, and displays each egg_token.
+     Leaf tokens are followed by the input text of their span, as
+     displayed by print_text().
 
      @param t egg_token * to root of egg_token tree
-     @param level int depth level of recursion during walk
+     @param level int indentation level of t
 
   */
 
 static void walk(egg_token *t, int level)
 {
-  if (!t)
-    return;
+  egg_token_iterator it;
+  input_location location;
+  int depth;
+  char *s;
 
-  printf("%*.*s%s@%d.%d\n",
-           level, level, " ",
+  egg_token_iterator_init(&it, t, egg_token_pre_order);
+  while ((t = egg_token_iterator_next(&it)))
+  {
+    depth = level + egg_token_iterator_get_depth(&it);
+
+    egg_token_get_location(t, &location);
+
+    s = NULL;
+    if (!t->descendant)
+      s = egg_token_span_to_string(t, s);
+
+    printf("%*.*s%s@%d.%d",
+           depth, depth, " ",
            egg_token_type_to_string(t),
-           t->location.line_number,
-           t->location.character_offset);
+           location.line_number,
+           location.character_offset);
 
-  walk(t->descendant, level+1);
+    if (s)
+    {
+      putchar(' ');
+      print_text(s);
+      free(s);
+    }
+    putchar('\n');
+  }
 
-  walk(t->next, level);
+  return;
+}
+
+  /*!
+
+     @brief Walks a egg_token_tree.
+
+     This function walks a egg_token_tree in index order, which is the
+     same pre-order as walk(), and displays each token with its location.
+     Leaf tokens are followed by the input text of their span, as
+     displayed by print_text().
+
+     @param tree  egg_token_tree * to walk
+
+  */
+
+static void walk_tree(egg_token_tree *tree)
+{
+  egg_token leaf;
+  input_location location;
+  egg_token_index i;
+  egg_token_index a;
+  int level;
+  char *s;
+
+  for (i = 0; i < egg_token_tree_get_count(tree); ++i)
+  {
+    level = 0;
+    for (a = egg_token_tree_get_ascendant(tree, i);
+         a != EGG_TOKEN_INDEX_NONE;
+         a = egg_token_tree_get_ascendant(tree, a))
+      ++level;
+
+    memset(&leaf, 0, sizeof(egg_token));
+    leaf.type = egg_token_tree_get_type(tree, i);
+    egg_token_tree_get_location(tree, i, &location);
+
+    s = NULL;
+    if (egg_token_tree_get_descendant(tree, i) == EGG_TOKEN_INDEX_NONE)
+      s = egg_token_tree_span_to_string(tree, i, s);
+
+    printf("%*.*s%s@%d.%d",
+           level, level, " ",
+           egg_token_type_to_string(&leaf),
+           location.line_number,
+           location.character_offset);
+
+    if (s)
+    {
+      putchar(' ');
+      print_text(s);
+      free(s);
+    }
+    putchar('\n');
+  }
 
   return;
 }
 
+  /*!
+
+     @brief Displays the input text of a token span.
+
+     This function displays text on one line.  Newline, tab, carriage
+     return and backslash bytes are displayed as C escape sequences, and
+     any other control byte as a hexadecimal escape sequence, so each
+     token keeps to one line of output.
+
+     @param s string of text
+
+  */
+
+static void print_text(char *s)
+{
+  unsigned char c;
+
+  for (; *s; ++s)
+  {
+    c = (unsigned char)*s;
+    if (c == '\n')
+      printf("\\n");
+    else if (c == '\t')
+      printf("\\t");
+    else if (c == '\r')
+      printf("\\r");
+    else if (c == '\\')
+      printf("\\\\");
+    else if ((c < 0x20) || (c == 0x7f))
+      printf("\\x%02x", c);
+    else
+      putchar(c);
+  }
+
+  return;
+}
+
+  /*!
+
+     @brief Walks a egg_token_tree snapshot.
+
+     This function loads a snapshot written with the -o option, and walks
+     it like walk_tree().  The input source is only opened when the
+     snapshot does not embed the input text.
+
+     @param snapshot_file name of snapshot file
+     @param input_file    name of input file, or NULL for STDIN
+
+     @retval 0 success
+     @retval 1 any failure
+
+  */
+
+static int walk_snapshot(char *snapshot_file, char *input_file)
+{
+  egg_token_tree *tree;
+  unsigned char use_input;
+
+  tree = egg_token_tree_load(snapshot_file);
+  if (!tree)
+  {
+    fprintf(stderr, "Unable to load %s\n", snapshot_file);
+    return 1;
+  }
+
+  use_input = !egg_token_tree_get_source(tree, NULL);
+  if (use_input && !egg_input_initialize(input_file))
+  {
+    egg_token_tree_free(tree);
+    return 1;
+  }
+
+  if (use_input && !egg_token_tree_match_input(tree))
+  {
+    fprintf(stderr, "%s was not parsed from this input\n", snapshot_file);
+    egg_token_tree_free(tree);
+    input_cleanup();
+    return 1;
+  }
+
+  walk_tree(tree);
+
+  egg_token_tree_free(tree);
+
+  if (use_input)
+    input_cleanup();
+
+  return 0;
+}
+
@@ -90,6 +90,21 @@ int main(int argc, char **argv)
       { "first-year", 1, 0, 1004 },
       { "license-text", 1, 0, 1005 },
       { "use-external-usage", 1, 0, 1006 },
+      { "use-memo", 1, 0, 1007 },
+      { "memo-phrases", 1, 0, 1008 },
+      { "use-run-tokens", 1, 0, 1009 },
+      { "use-callbacks", 1, 0, 1010 },
+      { "use-context", 1, 0, 1011 },
+      { "use-parallel", 1, 0, 1012 },
+      { "use-stream", 1, 0, 1013 },
+      { "use-push", 1, 0, 1014 },
+      { "use-vm", 1, 0, 1015 },
+      { "use-inline", 1, 0, 1016 },
+      { "use-recognizer", 1, 0, 1017 },
+      { "use-events", 1, 0, 1018 },
+      { "trivia-phrases", 1, 0, 1019 },
+      { "use-trivia-drop", 1, 0, 1020 },
+      { "push-stack-size", 1, 0, 1021 },
       { "version", 0, 0, 'v' },
       { "help", 0, 0, 'h' },
       { 0, 0, 0, 0 }
@@ -106,6 +121,21 @@ int main(int argc, char **argv)
   unsigned char gen_makefile = FALSE;
   unsigned char use_doxygen = FALSE;
   unsigned char use_external_usage = FALSE;
+  unsigned char use_memo = FALSE;
+  char *memo_phrases = NULL;
+  unsigned char use_run_tokens = FALSE;
+  unsigned char use_callbacks = TRUE;
+  unsigned char use_context = FALSE;
+  unsigned char use_parallel = FALSE;
+  unsigned char use_stream = FALSE;
+  unsigned char use_push = FALSE;
+  unsigned char use_vm = FALSE;
+  unsigned char use_inline = FALSE;
+  unsigned char use_recognizer = FALSE;
+  unsigned char use_events = FALSE;
+  char *trivia_phrases = NULL;
+  unsigned char use_trivia_drop = FALSE;
+  long push_stack_size = 0;
   char *code_version = NULL;
   char *author = NULL;
   char *email = NULL;
@@ -169,6 +199,135 @@ int main(int argc, char **argv)
         else
           use_external_usage = FALSE;
         break;
+      case 1007:
+        if (!strcmp(optarg, "true"))
+          use_memo = TRUE;
+        else if (!strcmp(optarg, "on"))
+          use_memo = TRUE;
+        else if (!strcmp(optarg, "1"))
+          use_memo = TRUE;
+        else
+          use_memo = FALSE;
+        break;
+      case 1008:
+        memo_phrases = strdup(optarg);
+        break;
+      case 1009:
+        if (!strcmp(optarg, "true"))
+          use_run_tokens = TRUE;
+        else if (!strcmp(optarg, "on"))
+          use_run_tokens = TRUE;
+        else if (!strcmp(optarg, "1"))
+          use_run_tokens = TRUE;
+        else
+          use_run_tokens = FALSE;
+        break;
+      case 1010:
+        if (!strcmp(optarg, "true"))
+          use_callbacks = TRUE;
+        else if (!strcmp(optarg, "on"))
+          use_callbacks = TRUE;
+        else if (!strcmp(optarg, "1"))
+          use_callbacks = TRUE;
+        else
+          use_callbacks = FALSE;
+        break;
+      case 1011:
+        if (!strcmp(optarg, "true"))
+          use_context = TRUE;
+        else if (!strcmp(optarg, "on"))
+          use_context = TRUE;
+        else if (!strcmp(optarg, "1"))
+          use_context = TRUE;
+        else
+          use_context = FALSE;
+        break;
+      case 1012:
+        if (!strcmp(optarg, "true"))
+          use_parallel = TRUE;
+        else if (!strcmp(optarg, "on"))
+          use_parallel = TRUE;
+        else if (!strcmp(optarg, "1"))
+          use_parallel = TRUE;
+        else
+          use_parallel = FALSE;
+        break;
+      case 1013:
+        if (!strcmp(optarg, "true"))
+          use_stream = TRUE;
+        else if (!strcmp(optarg, "on"))
+          use_stream = TRUE;
+        else if (!strcmp(optarg, "1"))
+          use_stream = TRUE;
+        else
+          use_stream = FALSE;
+        break;
+      case 1014:
+        if (!strcmp(optarg, "true"))
+          use_push = TRUE;
+        else if (!strcmp(optarg, "on"))
+          use_push = TRUE;
+        else if (!strcmp(optarg, "1"))
+          use_push = TRUE;
+        else
+          use_push = FALSE;
+        break;
+      case 1015:
+        if (!strcmp(optarg, "true"))
+          use_vm = TRUE;
+        else if (!strcmp(optarg, "on"))
+          use_vm = TRUE;
+        else if (!strcmp(optarg, "1"))
+          use_vm = TRUE;
+        else
+          use_vm = FALSE;
+        break;
+      case 1016:
+        if (!strcmp(optarg, "true"))
+          use_inline = TRUE;
+        else if (!strcmp(optarg, "on"))
+          use_inline = TRUE;
+        else if (!strcmp(optarg, "1"))
+          use_inline = TRUE;
+        else
+          use_inline = FALSE;
+        break;
+      case 1017:
+        if (!strcmp(optarg, "true"))
+          use_recognizer = TRUE;
+        else if (!strcmp(optarg, "on"))
+          use_recognizer = TRUE;
+        else if (!strcmp(optarg, "1"))
+          use_recognizer = TRUE;
+        else
+          use_recognizer = FALSE;
+        break;
+      case 1018:
+        if (!strcmp(optarg, "true"))
+          use_events = TRUE;
+        else if (!strcmp(optarg, "on"))
+          use_events = TRUE;
+        else if (!strcmp(optarg, "1"))
+          use_events = TRUE;
+        else
+          use_events = FALSE;
+        break;
+      case 1019:
+        trivia_phrases = strdup(optarg);
+        break;
+      case 1020:
+        if (!strcmp(optarg, "true"))
+          use_trivia_drop = TRUE;
+        else if (!strcmp(optarg, "on"))
+          use_trivia_drop = TRUE;
+        else if (!strcmp(optarg, "1"))
+          use_trivia_drop = TRUE;
+        else
+          use_trivia_drop = FALSE;
+        break;
+      case 1021:
+        push_stack_size = atol(optarg);
+        break;
       case 'v':
         version();
         return 0;
@@ -219,6 +378,30 @@ int main(int argc, char **argv)
 
   generator_set_external_usage_flag(use_external_usage);
 
+  generator_set_memo_flag(use_memo);
+
+  if (memo_phrases)
+    generator_set_memo_phrases(memo_phrases);
+
+  generator_set_run_tokens_flag(use_run_tokens);
+  generator_set_callbacks_flag(use_callbacks);
+  generator_set_context_flag(use_context);
+  generator_set_parallel_flag(use_parallel);
+  generator_set_stream_flag(use_stream);
+  generator_set_push_flag(use_push);
+  generator_set_vm_flag(use_vm);
+  generator_set_inline_flag(use_inline);
+  generator_set_recognizer_flag(use_recognizer);
+  generator_set_events_flag(use_events);
+
+  if (trivia_phrases)
+    generator_set_trivia_phrases(trivia_phrases);
+
+  generator_set_trivia_drop_flag(use_trivia_drop);
+
+  if (push_stack_size > 0)
+    generator_set_push_stack_size(push_stack_size);
+
   input_file = NULL;
   if (optind < argc)
     if (strcmp(argv[optind], "-"))
@@ -229,9 +412,11 @@ int main(int argc, char **argv)
   else
     directory = strdup(".");
 
-  if (!input_initialize(input_file))
+  if (!egg_input_initialize(input_file))
     return 1;
 
+  egg_input_buffer_load();
+
   t = grammar();
 
   if (gen_headers)
@@ -307,6 +492,24 @@ int main(int argc, char **argv)
           fclose(fo);
       }
     }
+
+    path = build_path(directory, "include");
+    fn = build_file_name(path, project_name, "token-tree.h");
+    if (path && fn)
+    {
+      if (output_type)
+        fo = fopen(fn, "w");
+      else
+        fo = stdout;
+      free(path);
+      free(fn);
+      if (fo)
+      {
+        generate_token_tree_header(fo, project_name);
+        if (output_type)
+          fclose(fo);
+      }
+    }
   }
 
   if (gen_sources)
@@ -368,6 +571,25 @@ int main(int argc, char **argv)
       }
     }
 
+    path = build_path(directory, "src");
+    fn = build_file_name(path, project_name, "token-tree.c");
+    if (path && fn)
+    {
+      if (output_type)
+        fo = fopen(fn, "w");
+      else
+        fo = stdout;
+      free(path);
+      free(fn);
+      if (fo)
+      {
+        generator_set_project_brief("grammer specific compact token tree functions");
+        generate_token_tree_source(fo, project_name);
+        if (output_type)
+          fclose(fo);
+      }
+    }
+
     path = build_path(directory, "src");
     fn = build_file_name(path, project_name, "walker.c");
     if (path && fn)
@@ -400,8 +622,11 @@ int main(int argc, char **argv)
       fclose(fo);
   }
 
+  egg_input_buffer_release();
   input_cleanup();
 
+  egg_token_arena_release();
+
   if (directory)
     free(directory);
 
@@ -64,6 +64,22 @@
 
 #include "generator.h"
 
+  // Module types
+
+typedef struct first_set
+{
+  unsigned char bytes[32];
+  unsigned char nullable;
+} first_set;
+
+typedef struct alternative
+{
+  egg_token *seq;
+  egg_token **items;
+  char **texts;
+  int count;
+} alternative;
+
   // Module function declarations
 
 static void generate_grammar(FILE *of,
@@ -79,6 +95,20 @@ static void generate_definition(FILE *of,
 static void generate_sequence(FILE *of,
                               char *parser_name,
                               egg_token *t);
+static void emit_sequence_commit(FILE *of, char *parser_name);
+static void generate_alternatives(FILE *of,
+                                  char *parser_name,
+                                  alternative *alts,
+                                  int n,
+                                  int depth);
+static int get_alternatives(egg_token *t, alternative **alts);
+static void free_alternatives(alternative *alts, int n);
+static int get_alternative_group(alternative *alts,
+                                 int n,
+                                 int depth,
+                                 int *length);
+static unsigned char is_same_item(alternative *a, alternative *b, int depth);
+static unsigned char is_guarded_group(alternative *alts, int n, first_set *fs);
 static void generate_item(FILE *of,
                           char *parser_name,
                           egg_token *t);
@@ -91,6 +121,46 @@ static void generate_literal(FILE *of,
 static void generate_phrase_name(FILE *of,
                                 char *parser_name,
                                 egg_token *t);
+static void generate_class_phrase(FILE *of,
+                                  char *parser_name,
+                                  first_set *fs);
+static void generate_run(FILE *of,
+                         char *parser_name,
+                         egg_token *t,
+                         first_set *fs,
+                         char *pns);
+static void generate_skip(FILE *of,
+                          char *parser_name,
+                          egg_token *t,
+                          char *pn);
+static void generate_trivia_phrase(FILE *of, char *parser_name);
+static void generate_context_functions(FILE *of, char *parser_name);
+static void generate_parallel_functions(FILE *of,
+                                        char *parser_name,
+                                        char *u_parser_name);
+static void generate_stream_functions(FILE *of,
+                                      char *parser_name,
+                                      char *u_parser_name);
+static void generate_vm(FILE *of, char *parser_name, egg_token *t);
+static void emit_vm_interpreter(FILE *of,
+                                char *parser_name,
+                                int *flags,
+                                int count);
+static unsigned char emit_vm_callback(FILE *of, int level, char *type);
+static void emit_vm_byte_set(FILE *of, first_set *fs, unsigned char more);
+static void vm_compile_phrase(egg_token *t, int *flags, int *starts);
+static unsigned char vm_compile_alternatives(alternative *alts,
+                                             int n,
+                                             int depth,
+                                             int nest);
+static void vm_compile_item(egg_token *t);
+static unsigned char vm_compile_atom(egg_token *t);
+static int vm_phrase_index(egg_token *t);
+static int vm_append(int v);
+static int vm_add_literal(char *s);
+static int vm_add_set(first_set *fs);
+static void vm_release(void);
+static unsigned char get_run_set(egg_token *t, first_set *fs, char **pns);
 static int get_minimum(egg_token *t);
 static int get_maximum(egg_token *t);
 static char *fix_identifier(char *pn);
@@ -98,23 +168,88 @@ static char *fix_quotes(char *s);
 static char *str_toupper(char *s);
 static char *build_literal(egg_token *t);
 static char *literal_or_phrase_name(egg_token *t);
+static phrase_map_item *find_single_byte_phrases(egg_token *t);
+static phrase_map_item *find_inline_phrases(egg_token *t);
+static unsigned char is_inline_definition(egg_token *t, char *pn);
+static void emit_phrase_head(FILE *of, char *parser_name);
+static void emit_inline_wrapper(FILE *of, char *parser_name);
+static unsigned char is_single_byte_definition(egg_token *t,
+                                               phrase_map_item *list);
+static unsigned char is_single_byte_sequence(egg_token *t,
+                                             phrase_map_item *list);
+static first_set *find_first_sets(egg_token *t);
+static first_set *find_skip_sets(egg_token *t);
+static void get_skip_set_of_definition(egg_token *t,
+                                       first_set *sets,
+                                       first_set *fs);
+static void get_first_set_of_definition(egg_token *t,
+                                        first_set *sets,
+                                        first_set *fs);
+static void get_first_set_of_sequence(egg_token *t,
+                                      first_set *sets,
+                                      first_set *fs);
+static int get_byte_ranges(first_set *fs, int *lo, int *hi);
+static void emit_byte_test(FILE *of, first_set *fs, char *var);
+static void emit_scan_run(FILE *of, char *lead, first_set *fs, int max);
+static unsigned char emit_first_guard(FILE *of, first_set *fs);
+static unsigned char is_guarded_sequence(egg_token *t, first_set *fs);
+static unsigned char emit_callback(FILE *of,
+                                   char *parser_name,
+                                   int level,
+                                   char *type);
+static void emit_context_input_functions(FILE *of, char *parser_name);
+static void make_context_parameters(char *parser_name);
+static void free_context_parameters(void);
 static char *long_to_bytes(unsigned long l);
 static int get_year(void);
 static void emit_indent(FILE *of);
 static void emit_phrase_comment_lines(FILE *of, char *s);
+static void emit_phrase_comment_block(FILE *of,
+                                      char *parser_name,
+                                      egg_token *t);
 static void emit_source_comment_header(FILE *of);
 static char * make_file_name(char *project, char *file_name);
+static unsigned char is_memo_phrase(char *pn);
+static unsigned char is_trivia_phrase(char *pn);
+static unsigned char is_listed_phrase(char *list, char *pn);
 
   // Module constants
 #define FALSE 0
 #define TRUE 1
 
+  // Module constants: instructions and phrase flags of VM programs
+
+#define VM_CHOICE 0
+#define VM_GUARD 1
+#define VM_BYTE 2
+#define VM_LITERAL 3
+#define VM_CALL 4
+#define VM_REPEAT 5
+#define VM_RUN 6
+#define VM_COMMIT 7
+#define VM_FAIL 8
+#define VM_SAVE 9
+#define VM_BRANCH 10
+#define VM_DROP 11
+
+#define VM_CLASS 1
+#define VM_GUARDED 2
+#define VM_COLLAPSE 4
+#define VM_MEMO 8
+
   // Module global values
 
 static phrase_map_item *_pml = NULL;
+static phrase_map_item *_sbl = NULL;
+static phrase_map_item *_inl = NULL;
+static first_set *_first = NULL;
+static first_set *_skip = NULL;
 static int _current_level = 0;
 static char *_pns = NULL;
 static char *_pns_f = NULL;
+static unsigned char _collapse_phrase = FALSE;
+static unsigned char _inline_phrase = FALSE;
+static unsigned char _recognize = FALSE;
 static unsigned char _use_doxygen = FALSE;
 static char * _file_name = "Unknown";
 static char * _project_brief = "";
@@ -151,6 +286,46 @@ static char * _license_with_doxygen =
     "  along with this program.  If not, see "
     "  \\<http://www.gnu.org/licenses/\\>.";
 static unsigned char _use_external_usage = FALSE;
+static unsigned char _use_memo = FALSE;
+static char * _memo_phrases = NULL;
+static unsigned char _memo_phrase = FALSE;
+static unsigned char _use_run_tokens = FALSE;
+static unsigned char _use_callbacks = TRUE;
+static unsigned char _use_context = FALSE;
+static unsigned char _use_parallel = FALSE;
+static unsigned char _use_stream = FALSE;
+static unsigned char _use_push = FALSE;
+static long _push_stack_size = 8L * 1024L * 1024L;
+static unsigned char _use_vm = FALSE;
+static unsigned char _use_inline = FALSE;
+static unsigned char _use_recognizer = FALSE;
+static unsigned char _use_events = FALSE;
+static char * _trivia_phrases = NULL;
+static unsigned char _use_trivia_drop = FALSE;
+static char * _in = "input";    // Prefix of emitted input functions
+static char * _in_arg = "";     // Argument of emitted input and phrase calls
+static char * _in_args = "";    // Leading arguments of other emitted calls
+static char * _sp = "_";        // Prefix of emitted parser state values
+static char * _ctx_void = NULL; // Parameter list of emitted phrase functions
+static char * _ctx_lead = NULL; // Leading parameters of emitted helpers
+static char * _rewind = NULL;   // Emitted call rewinding within phrases
+static char * _new = NULL;      // Emitted call creating parsed tokens
+static int *_vm_code = NULL;    // VM program being compiled
+static int _vm_count = 0;
+static int _vm_size = 0;
+static char **_vm_literals = NULL;
+static int _vm_literal_count = 0;
+static first_set *_vm_sets = NULL;
+static int _vm_set_count = 0;
+static unsigned char _vm_runs = FALSE;
+static int _vm_saves = 0;
+static char *_vm_op_names[] = { "VM_CHOICE", "VM_GUARD", "VM_BYTE",
+                                "VM_LITERAL", "VM_CALL", "VM_REPEAT",
+                                "VM_RUN", "VM_COMMIT", "VM_FAIL",
+                                "VM_SAVE", "VM_BRANCH", "VM_DROP" };
+static int _vm_op_sizes[] = { 2, 2, 2, 2, 2, 3, 5, 1, 1, 2, 2, 1 };
+static char *_vm_flag_names[] = { "VM_CLASS", "VM_GUARDED", "VM_COLLAPSE",
+                                  "VM_MEMO" };
 
   /*!
 
@@ -176,6 +351,9 @@ void generate_parser_source(FILE *of,
 {
   phrase_map_item *pmi;  // Generic phrase map item pointer
   char *fn;              // A generated file name for emitted documentation
+  char *u_parser_name;   // Parser name forced to upper case
+  char *fn_inline;       // Function name of an inline phrase
+  unsigned char quoted;  // Grammar contains quoted literals
 
     // Sanity check parameters
 
@@ -188,12 +366,46 @@ void generate_parser_source(FILE *of,
   if (!t)
     return;
 
+    // Force parser name to upper case
+
+  u_parser_name = str_toupper(strdup(parser_name));
+
+    // Find whether quoted literals are matched, needing match_literal()
+
+  quoted = (egg_token_find(t, egg_token_type_quoted_literal) ||
+            egg_token_find(t, egg_token_type_single_quoted_literal));
+
     // Create a top level phrase map of all grammar phrases
 
   _pml = phrase_map(t);
   if (!_pml)
     return;
 
+    // Find all phrases whose tokens are collapsed into single byte spans
+
+  _sbl = find_single_byte_phrases(t);
+
+    // Find the bytes that can begin each phrase, to guard alternatives
+
+  _first = find_first_sets(t);
+
+    // Find the bytes each phrase matches alone, to skip runs of them in
+    // recognizers, which report no events for the skipped phrases
+
+  if (_use_recognizer && !_use_events)
+    _skip = find_skip_sets(t);
+
+    // Find all trivial phrases inlined at their uses, when inlining is in
+    // use
+
+  if (_use_inline && !_use_vm)
+    _inl = find_inline_phrases(t);
+
+    // Make the parameter lists of emitted functions, which take a parser
+    // context when contexts are in use
+
+  make_context_parameters(parser_name);
+
     // Emit the file level comment block
 
   fn = make_file_name(parser_name, "parser.c");
@@ -217,10 +429,13 @@ void generate_parser_source(FILE *of,
   fprintf(of, "    An individual phrase parsing function exists for each\n");
   fprintf(of, "    %s grammar phrase.\n", parser_name);
   fprintf(of, "\n");
-  fprintf(of, "    Also the %s_get_callback_table function is defined in\n",
-                parser_name);
-  fprintf(of, "    this module.\n");
-  fprintf(of, "\n");
+  if (_use_callbacks)
+  {
+    fprintf(of, "    Also the %s_get_callback_table function is defined in\n",
+                  parser_name);
+    fprintf(of, "    this module.\n");
+    fprintf(of, "\n");
+  }
   fprintf(of, "  */\n");
   fprintf(of, "\n");
 
@@ -238,13 +453,16 @@ void generate_parser_source(FILE *of,
                   "@par \"Description of Parsing Functions\"" :
                   "",
                 (_use_doxygen) ? "\n" : "");
-  fprintf(of, "    With the exception of the %s_get_callback_table() "
-              "function,\n", parser_name);
+  if (_use_callbacks)
+    fprintf(of, "    With the exception of the %s_get_callback_table() "
+                "function,\n", parser_name);
+  else
+    fprintf(of, "    With the exception of the utility functions,\n");
   fprintf(of, "    every function in this parser has the same calling "
               "signature and \n");
   fprintf(of, "    return value pattern:\n");
   fprintf(of, "    %s\n", (_use_doxygen) ? "@n@n" : "");
-  fprintf(of, "      %s_token * <phrase-name>(void);\n", parser_name);
+  fprintf(of, "      %s_token * <phrase-name>(%s);\n", parser_name, _ctx_void);
   fprintf(of, "    %s\n", (_use_doxygen) ? "@n@n" : "");
   fprintf(of, "    Each function returns a pointer to a struct of type "
               "%s_token,\n", parser_name);
@@ -258,6 +476,24 @@ void generate_parser_source(FILE *of,
     // Emit code for included header files
 
   fprintf(of, "#include <stdlib.h>\n");
+  if (quoted || _use_context || _use_memo || _memo_phrases)
+    fprintf(of, "#include <string.h>\n");
+  if (_use_parallel)
+  {
+    fprintf(of, "#include <unistd.h>\n");
+    fprintf(of, "#include <pthread.h>\n");
+  }
+  if (_use_push)
+    fprintf(of, "#include <ucontext.h>\n");
+  if (_use_run_tokens || _skip)
+  {
+    fprintf(of, "#ifdef __SSE2__\n");
+    fprintf(of, "#include <emmintrin.h>\n");
+    fprintf(of, "#endif\n");
+    fprintf(of, "#ifdef __AVX2__\n");
+    fprintf(of, "#include <immintrin.h>\n");
+    fprintf(of, "#endif\n");
+  }
   fprintf(of, "\n");
   fprintf(of, "#include \"%s-token.h\"\n", parser_name);
   fprintf(of, "#include \"%s-parser.h\"\n", parser_name);
@@ -268,410 +504,1269 @@ void generate_parser_source(FILE *of,
   fprintf(of, "#define FALSE 0\n");
   fprintf(of, "#define TRUE 1\n");
   fprintf(of, "\n");
-
-    // Emit code for array of callback entries
-
-  fprintf(of, "static callback_entry _callbacks[] =\n");
-  fprintf(of, "{\n");
-  pmi = _pml;
-  while (pmi)
+  if (quoted)
   {
-    fprintf(of, "  { \"%s\", NULL, NULL, NULL }", pmi->name);
-    if (pmi->next)
-      fprintf(of, ",");
+    fprintf(of, "#define MATCH_LITERAL(s) "
+                "match_literal(%s(s), sizeof(s) - 1)\n", _in_args);
     fprintf(of, "\n");
-    pmi = pmi->next;
   }
-  fprintf(of, "};\n");
-  fprintf(of, "\n");
-
-    // Emit code for actual callback table structure
 
-  fprintf(of, "static callback_table _cbt = { %d, _callbacks };\n",
-              phrase_map_list_count_items(_pml));
-  fprintf(of, "\n");
+  if (_use_callbacks)
+  {
+      // Emit code for array of callback entries
 
-    // Emit comment block for <PROJECT>_get_callback_table()
+    fprintf(of, "static callback_entry _callbacks[] =\n");
+    fprintf(of, "{\n");
+    pmi = _pml;
+    while (pmi)
+    {
+      fprintf(of, "  { \"%s\", NULL, NULL, NULL }", pmi->name);
+      if (pmi->next)
+        fprintf(of, ",");
+      fprintf(of, "\n");
+      pmi = pmi->next;
+    }
+    fprintf(of, "};\n");
+    fprintf(of, "\n");
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sReturns pointer to callback table.\n",
-                (_use_doxygen) ? "@brief " : "");
-  fprintf(of, "\n");
-  fprintf(of, "    This function returns a pointer to the parser's callback "
-              "table.  The\n");
-  fprintf(of, "    caller can use this to register its own callback functions "
-              "for additional\n");
-  fprintf(of, "    parsing actions.\n");
-  fprintf(of, "\n");
-  fprintf(of, "    %s\"callback_table *\" pointer to head of parser "
-              "callback table\n",
-                (_use_doxygen) ? "@retval " : "Returns: ");
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+      // Emit code for actual callback table structure, which is copied
+      // into each parser context when contexts are in use
 
-    // Emit code for <PROJECT>_get_callback_table()
+    if (!_use_context)
+    {
+      fprintf(of, "static callback_table _cbt = { %d, _callbacks };\n",
+                  phrase_map_list_count_items(_pml));
+      fprintf(of, "\n");
+    }
+  }
 
-  fprintf(of, "callback_table *%s_get_callback_table(void)\n", parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  return &_cbt;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+  if (_use_context)
+  {
+    if (_use_push)
+    {
+        // Emit code for push parse constants and types
 
-    // Emit code for each phrase parsing function
+      fprintf(of, "#ifndef %s_PUSH_STACK_SIZE\n", u_parser_name);
+      fprintf(of, "#define %s_PUSH_STACK_SIZE %ldL\n",
+                    u_parser_name, _push_stack_size);
+      fprintf(of, "#endif\n");
+      fprintf(of, "\n");
+      fprintf(of, "#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= "
+                  "201112L)\n");
+      fprintf(of, "#define THREAD_LOCAL _Thread_local\n");
+      fprintf(of, "#else\n");
+      fprintf(of, "#define THREAD_LOCAL __thread\n");
+      fprintf(of, "#endif\n");
+      fprintf(of, "\n");
+      fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+      fprintf(of, "    %sDefinition of %s_push_state, the parse of an element "
+                  "of a push\n",
+                    (_use_doxygen) ? "@brief " : "",
+                    parser_name);
+      fprintf(of, "    context, which is suspended while it waits for more "
+                  "input bytes\n");
+      fprintf(of, "  */\n");
+      fprintf(of, "\n");
+      fprintf(of, "typedef struct %s_push_state\n", parser_name);
+      fprintf(of, "{\n");
+      fprintf(of, "    /*%s %sStack the element is parsed on */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  void *stack;\n");
+      fprintf(of, "    /*%s %sMachine context of parse of element */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  ucontext_t parser;\n");
+      fprintf(of, "    /*%s %sMachine context of caller of %s_stream_next() "
+                  "*/\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "",
+                    parser_name);
+      fprintf(of, "  ucontext_t caller;\n");
+      fprintf(of, "    /*%s %sPhrase function of element */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  %s_phrase_function element;\n", parser_name);
+      fprintf(of, "    /*%s %sInput offset of first byte of element */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  long position;\n");
+      fprintf(of, "    /*%s %sToken of element once it is parsed */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  %s_token *t;\n", parser_name);
+      fprintf(of, "    /*%s %sTRUE while element is parsed on its stack */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  unsigned char running;\n");
+      fprintf(of, "    /*%s %sTRUE while parse of element waits for more input "
+                  "bytes */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  unsigned char suspended;\n");
+      fprintf(of, "} %s_push_state;\n", parser_name);
+      fprintf(of, "\n");
+      fprintf(of, "static THREAD_LOCAL %s_context *_push_context = NULL;\n",
+                    parser_name);
+      fprintf(of, "\n");
+    }
 
-  generate_grammar(of, parser_name, t, 0);
+      // Emit code for context input functions
 
-    // Clean up and return
+    emit_context_input_functions(of, parser_name);
+  }
+  else
+  {
+      // Emit code for input buffer module global values
 
-  phrase_map_list_delete(_pml);
-  free(fn);
+    fprintf(of, "static unsigned char *_input_buffer = NULL;\n");
+    fprintf(of, "static long _input_length = 0;\n");
+    fprintf(of, "\n");
+  }
 
-  return;
-}
+    // Emit code for packrat memo helper functions, when memo is in use
 
-  /*!
+  if (_use_memo || _memo_phrases)
+  {
+      // Emit code for memo constants and types
 
-     \brief Generates \<PROJECT\>-parser.h source code file.
-    
-     This function generates the source code for \<PROJECT\>-parser.h\n
-     \n
-     The parser header file contains exactly one function declaration for each
-     phrase in the supplied EGG grammar.  Also, a function declartion for the
-     utility getter function named \<PROJECT\>_get_callback_table is included.
-    
-     \param of          FILE * of open output file to write source code
-     \param parser_name string containing name of parser (ie. \<PROJECT\>)
-     \param t           \e egg_token * containing the root token from which
-                        the source code is generated
+    fprintf(of, "#define %s_MEMO_TABLE_SIZE 1024\n", u_parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "typedef struct %s_memo_entry\n", parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  long position;\n");
+    fprintf(of, "  int phrase;\n");
+    fprintf(of, "  long end;\n");
+    fprintf(of, "  long last;\n");
+    fprintf(of, "  %s_token *t;\n", parser_name);
+    fprintf(of, "} %s_memo_entry;\n", parser_name);
+    fprintf(of, "\n");
 
-  */
+      // Emit code for memo module global values, which are held by each
+      // parser context when contexts are in use
 
-void generate_parser_header(FILE *of,
-                            char *parser_name,
-                            egg_token *t)
-{
-  egg_token *ge, *p, *pn;
-  char *hn;
-  int hnl;
-  char *pns;
-  char *fn;
+    if (!_use_context)
+    {
+      fprintf(of, "static %s_memo_entry *_memo_table = NULL;\n",
+                    parser_name);
+      fprintf(of, "static long _memo_size = 0;\n");
+      fprintf(of, "static long _memo_count = 0;\n");
+      fprintf(of, "static %s_token_mark _memo_floor;\n", parser_name);
+      fprintf(of, "\n");
+    }
 
-    // Sanity check parameters
+      // Emit comment block for memo_copy()
 
-  if (!of)
-    of = stdout;
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sCopy a token and all of its descendants into the token "
+                "arena\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    The siblings of the token are not copied.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %st %s_token * of token to copy\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "    %s%s%s_token *%s of copy on success\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ",
+                  (_use_doxygen) ? "\"" : "",
+                  parser_name,
+                  (_use_doxygen) ? "\"" : "");
+    fprintf(of, "    %sNULL on failure\n",
+                  (_use_doxygen) ? "@retval " : "         ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-  if (!parser_name)
-    return;
+      // Emit code for memo_copy()
 
-  if (!t)
-    return;
+    fprintf(of, "static %s_token *memo_copy(%s_token *t)\n",
+                  parser_name, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  %s_token *r, *s, *d, *c;\n", parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  if (!(r = %s_token_new(%s_token_type_none)))\n",
+                  parser_name, parser_name);
+    fprintf(of, "    return NULL;\n");
+    fprintf(of, "  *r = *t;\n");
+    fprintf(of, "  r->ascendant = r->descendant = r->previous = r->next = "
+                "NULL;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  s = t;\n");
+    fprintf(of, "  d = r;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  while (s)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    if (s->descendant)\n");
+    fprintf(of, "    {\n");
+    fprintf(of, "      s = s->descendant;\n");
+    fprintf(of, "      if (!(c = %s_token_new(%s_token_type_none)))\n",
+                  parser_name, parser_name);
+    fprintf(of, "        return NULL;\n");
+    fprintf(of, "      *c = *s;\n");
+    fprintf(of, "      c->ascendant = d;\n");
+    fprintf(of, "      c->descendant = c->previous = c->next = NULL;\n");
+    fprintf(of, "      d->descendant = c;\n");
+    fprintf(of, "      d = c;\n");
+    fprintf(of, "      continue;\n");
+    fprintf(of, "    }\n");
+    fprintf(of, "\n");
+    fprintf(of, "    while ((s != t) && !s->next)\n");
+    fprintf(of, "    {\n");
+    fprintf(of, "      s = s->ascendant;\n");
+    fprintf(of, "      d = d->ascendant;\n");
+    fprintf(of, "    }\n");
+    fprintf(of, "\n");
+    fprintf(of, "    if (s == t)\n");
+    fprintf(of, "      break;\n");
+    fprintf(of, "\n");
+    fprintf(of, "    s = s->next;\n");
+    fprintf(of, "    if (!(c = %s_token_new(%s_token_type_none)))\n",
+                  parser_name, parser_name);
+    fprintf(of, "      return NULL;\n");
+    fprintf(of, "    *c = *s;\n");
+    fprintf(of, "    c->ascendant = d->ascendant;\n");
+    fprintf(of, "    c->previous = d;\n");
+    fprintf(of, "    c->descendant = c->next = NULL;\n");
+    fprintf(of, "    d->next = c;\n");
+    fprintf(of, "    d = c;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return r;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
 
-    // Create header include guard name
+      // Emit comment block for memo_rewind()
 
-  hnl = strlen(parser_name) + strlen("_parser_h") + 1;
-  hn = malloc(hnl);
-  memset(hn, 0, hnl);
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sRewind the token arena, keeping every memoized match\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    The memo refers to the tokens of each recorded match "
+                "where the parse\n");
+    fprintf(of, "    left them in the token arena, so the arena is never "
+                "rewound past the\n");
+    fprintf(of, "    tokens of the most recent match recorded.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %smark %s_token_mark to rewind to\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-  sprintf(hn, "%s_parser_h", parser_name);
+      // Emit code for memo_rewind()
 
-  hn = str_toupper(hn);
+    fprintf(of, "static void memo_rewind(%s%s_token_mark mark)\n",
+                  _ctx_lead, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  if (mark.index < %smemo_floor.index)\n", _sp);
+    fprintf(of, "    mark = %smemo_floor;\n", _sp);
+    fprintf(of, "\n");
+    fprintf(of, "  %s_token_arena_rewind(mark);\n", parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
 
-    // Emit the file level comment block
+      // Emit comment block for memo_slot()
 
-  fn = make_file_name(parser_name, "parser.h");
-  generator_set_file_name(fn);
-  emit_source_comment_header(of);
-  free(fn);
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sFind the memo table slot for a phrase at an input "
+                "position\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %stable    %s_memo_entry * of memo table to search\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "    %ssize     count of entries in memo table, a power of 2\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "    %sphrase   index of phrase in callback table\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "    %sposition input position where phrase was tried\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "\n");
+    fprintf(of, "    %s%s%s_memo_entry *%s of matching or empty slot\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ",
+                  (_use_doxygen) ? "\"" : "",
+                  parser_name,
+                  (_use_doxygen) ? "\"" : "");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-    // Emit file description comment block
+      // Emit code for memo_slot()
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  if (_use_doxygen)
-  {
-    fprintf(of, "    @file %s-parser.h\n", parser_name);
+    fprintf(of, "static %s_memo_entry *memo_slot(%s_memo_entry *table,\n",
+                  parser_name, parser_name);
+    fprintf(of, "                                  long size,\n");
+    fprintf(of, "                                  int phrase,\n");
+    fprintf(of, "                                  long position)\n");
+    fprintf(of, "{\n");
+    fprintf(of, "  unsigned long h;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  h = ((unsigned long)position * 31 + phrase) & "
+                "(size - 1);\n");
+    fprintf(of, "\n");
+    fprintf(of, "  while ((table[h].position != -1) &&\n");
+    fprintf(of, "         ((table[h].position != position) || (table[h].phrase "
+                "!= phrase)))\n");
+    fprintf(of, "    h = (h + 1) & (size - 1);\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return &(table[h]);\n");
+    fprintf(of, "}\n");
     fprintf(of, "\n");
-  }
-  fprintf(of, "    This is the header file for the %s grammar phrase parsing\n",
-                parser_name);
-  fprintf(of, "    functions module.\n");
-  fprintf(of, "\n");
-  fprintf(of, "    An individual phrase parsing function exists for each\n");
-  fprintf(of, "    %s grammar phrase.\n", parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    Also the %s_get_callback_table function is defined in\n",
-                parser_name);
-  fprintf(of, "    this module.\n");
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
 
-    // Emit header include guard
+      // Emit comment block for memo_grow()
 
-  fprintf(of, "#ifndef %s\n", hn);
-  fprintf(of, "#define %s\n", hn);
-  fprintf(of, "\n");
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sDouble the size of the memo table\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sTRUE on success\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "    %sFALSE on failure\n",
+                  (_use_doxygen) ? "@retval " : "         ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-     // Emit includes
+      // Emit code for memo_grow()
 
-  fprintf(of, "#include \"gray/callback.h\"\n");
-  fprintf(of, "\n");
+    fprintf(of, "static int memo_grow(%s)\n", _ctx_void);
+    fprintf(of, "{\n");
+    fprintf(of, "  %s_memo_entry *table, *e;\n", parser_name);
+    fprintf(of, "  long size, i;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  size = (%smemo_size) ? %smemo_size * 2 : "
+                "%s_MEMO_TABLE_SIZE;\n",
+                  _sp, _sp, u_parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  table = malloc(size * sizeof(%s_memo_entry));\n",
+                  parser_name);
+    fprintf(of, "  if (!table)\n");
+    fprintf(of, "    return FALSE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  for (i = 0; i < size; i++)\n");
+    fprintf(of, "    table[i].position = -1;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  for (i = 0; i < %smemo_size; i++)\n", _sp);
+    fprintf(of, "  {\n");
+    fprintf(of, "    if (%smemo_table[i].position != -1)\n", _sp);
+    fprintf(of, "    {\n");
+    fprintf(of, "      e = memo_slot(table,\n");
+    fprintf(of, "                    size,\n");
+    fprintf(of, "                    %smemo_table[i].phrase,\n", _sp);
+    fprintf(of, "                    %smemo_table[i].position);\n", _sp);
+    fprintf(of, "      *e = %smemo_table[i];\n", _sp);
+    fprintf(of, "    }\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  free(%smemo_table);\n", _sp);
+    fprintf(of, "  %smemo_table = table;\n", _sp);
+    fprintf(of, "  %smemo_size = size;\n", _sp);
+    fprintf(of, "\n");
+    fprintf(of, "  return TRUE;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
 
-    // Emit function declaration for utility functions
+      // Emit comment block for memo_lookup()
 
-  fprintf(of, "callback_table *%s_get_callback_table(void);\n", parser_name);
-  fprintf(of, "\n");
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sLook up the recorded outcome of a phrase at an input "
+                "position\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    On a recorded match a copy of the tokens of the match is "
+                "returned, and\n");
+    fprintf(of, "    the input position is moved past the match.  The "
+                "recorded tokens are\n");
+    fprintf(of, "    never relinked, since they may already be part of "
+                "another recorded\n");
+    fprintf(of, "    match.  A match whose tokens are no longer in the token "
+                "arena is not\n");
+    fprintf(of, "    reported.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %sphrase   index of phrase in callback table\n",
+                  (_use_doxygen) ? "@param " : "Param: ");
+    fprintf(of, "    %sposition input position where phrase is tried\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "    %st        %s_token ** to receive the matched tokens, or "
+                "NULL\n",
+                  (_use_doxygen) ? "@param " : "       ",
+                  parser_name);
+    fprintf(of, "                    when the phrase is recorded as not "
+                "matching\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %sTRUE when an outcome is recorded\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "    %sFALSE otherwise\n",
+                  (_use_doxygen) ? "@retval " : "         ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-    // Emit function declarations for each phrase parsing function
+      // Emit code for memo_lookup()
 
-  if ((ge = egg_token_find(t->descendant, egg_token_type_grammar_element)))
-  {
-    while (ge)
-    {
-      if ((p = egg_token_find(ge->descendant, egg_token_type_phrase)))
-      {
-        if ((pn = egg_token_find(p->descendant, egg_token_type_phrase_name)))
-        {
-          pns = NULL;
-          pns = egg_token_to_string(pn->descendant, pns);
-          pns = fix_identifier(pns);
+    fprintf(of, "static unsigned char memo_lookup(%sint phrase, long position, "
+                "%s_token **t)\n",
+                  _ctx_lead, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  %s_memo_entry *e;\n", parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  if (!%smemo_table)\n", _sp);
+    fprintf(of, "    return FALSE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  e = memo_slot(%smemo_table, %smemo_size, phrase, "
+                "position);\n",
+                  _sp, _sp);
+    fprintf(of, "  if (e->position == -1)\n");
+    fprintf(of, "    return FALSE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  *t = NULL;\n");
+    fprintf(of, "  if (e->t)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    if (e->last > %s_token_arena_mark().index)\n",
+                  parser_name);
+    fprintf(of, "      return FALSE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "    if (!(*t = memo_copy(e->t)))\n");
+    fprintf(of, "      return FALSE;\n");
+    fprintf(of, "    %s_set_position(%se->end);\n", _in, _in_args);
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return TRUE;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
 
-          fprintf(of, "%s_token *%s(void);\n",
-                        parser_name, pns);
+      // Emit comment block for memo_store()
 
-          free(pns);
-        }
-      }
-      ge = ge->next;
-    }
-  }
-
-    // Emit close-out for header include guard
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sRecord the outcome of a phrase at an input position\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    A match is recorded by its token, and by the token "
+                "arena index just\n");
+    fprintf(of, "    past its tokens, below which memo_rewind() no longer "
+                "rewinds.  Nothing\n");
+    fprintf(of, "    is copied, so recording costs the same for any size of "
+                "match.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %sphrase   index of phrase in callback table\n",
+                  (_use_doxygen) ? "@param " : "Param: ");
+    fprintf(of, "    %sposition input position where phrase was tried\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "    %st        %s_token * of matched tokens, or NULL on no "
+                "match\n",
+                  (_use_doxygen) ? "@param " : "       ",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-  fprintf(of, "\n");
-  fprintf(of, "#endif // %s\n", hn);
+      // Emit code for memo_store()
 
-    // Clean up
+    fprintf(of, "static void memo_store(%sint phrase, long position, %s_token "
+                "*t)\n",
+                  _ctx_lead, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  %s_memo_entry *e;\n", parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  if ((%smemo_count + 1) * 2 > %smemo_size)\n", _sp, _sp);
+    fprintf(of, "    if (!memo_grow(%s))\n", _in_arg);
+    fprintf(of, "      return;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  e = memo_slot(%smemo_table, %smemo_size, phrase, "
+                "position);\n",
+                  _sp, _sp);
+    fprintf(of, "  if (e->position != -1)\n");
+    fprintf(of, "    return;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  e->position = position;\n");
+    fprintf(of, "  e->phrase = phrase;\n");
+    fprintf(of, "  e->end = %s_get_position(%s);\n", _in, _in_arg);
+    fprintf(of, "  e->t = t;\n");
+    fprintf(of, "  e->last = 0;\n");
+    fprintf(of, "  if (t)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    %smemo_floor = %s_token_arena_mark();\n",
+                  _sp, parser_name);
+    fprintf(of, "    e->last = %smemo_floor.index;\n", _sp);
+    fprintf(of, "  }\n");
+    fprintf(of, "  ++%smemo_count;\n", _sp);
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
 
-  free(hn);
+    // Emit code for event helper functions, when events are in use
 
-  return;
-}
+  if (_use_events)
+  {
+      // Emit code for event constants and types
 
-  /*!
+    fprintf(of, "#define %s_EVENT_BLOCK_SIZE 1024\n", u_parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "typedef struct %s_event\n", parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  %s_token_type phrase;\n", parser_name);
+    fprintf(of, "  long start;\n");
+    fprintf(of, "  long end;\n");
+    fprintf(of, "} %s_event;\n", parser_name);
+    fprintf(of, "\n");
 
-     \brief Generates \<PROJECT\>-token.h source code file.
-    
-     This function generates the source code for \<PROJECT\>-token.h\n
-     \n
-     The token header file contains:
-       - an enum typedef for the \<PROJECT\>_token_direction values
-       - a struct typedef for the \<PROJECT\>_token structure
-       - the declaration for several \<PROJECT\>_token management functions
-    
-     \param of          FILE * of open output file to write source code
-     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+      // Emit code for event module global values, which are held by each
+      // parser context when contexts are in use
 
-  */
+    if (!_use_context)
+    {
+      fprintf(of, "static %s_event_handler _event_handler = NULL;\n",
+                    parser_name);
+      fprintf(of, "static void *_event_data = NULL;\n");
+      fprintf(of, "static %s_event *_events = NULL;\n", parser_name);
+      fprintf(of, "static long _events_size = 0;\n");
+      fprintf(of, "static long _events_count = 0;\n");
+      fprintf(of, "static long _events_base = 0;\n");
+      fprintf(of, "static int _events_hold = 0;\n");
+      fprintf(of, "\n");
+    }
 
-void generate_token_header(FILE *of,
-                           char *parser_name)
-{
-  char *u_parser_name;
-  char *fn;
+      // Emit comment block for event_flush()
 
-    // Sanity check parameters
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sReport all events held back to the event handler\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-  if (!of)
-    of = stdout;
+      // Emit code for event_flush()
 
-  if (!parser_name)
-    return;
+    fprintf(of, "static void event_flush(%s)\n", _ctx_void);
+    fprintf(of, "{\n");
+    fprintf(of, "  long i;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  for (i = 0; i < %sevents_count; i++)\n", _sp);
+    fprintf(of, "    %sevent_handler(%sevents[i].phrase,\n", _sp, _sp);
+    fprintf(of, "                    %sevents[i].start,\n", _sp);
+    fprintf(of, "                    %sevents[i].end,\n", _sp);
+    fprintf(of, "                    %sevent_data);\n", _sp);
+    fprintf(of, "\n");
+    fprintf(of, "  %sevents_base += %sevents_count;\n", _sp, _sp);
+    fprintf(of, "  %sevents_count = 0;\n", _sp);
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
 
-    // Force parser name to upper case
+      // Emit comment block for event_add()
 
-  u_parser_name = str_toupper(strdup(parser_name));
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sAdd the event of a phrase match\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    The event is held back while an alternative or "
+                "repetition around the\n");
+    fprintf(of, "    match may still be given up, and is otherwise reported "
+                "at once,\n");
+    fprintf(of, "    after the events held back before it.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %sphrase index of phrase matched\n",
+                  (_use_doxygen) ? "@param " : "Param: ");
+    fprintf(of, "    %sstart  input offset of start of match\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "    %send    input offset of end of match\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-    // Emit the file level comment block
+      // Emit code for event_add()
 
-  fn = make_file_name(parser_name, "token.h");
-  generator_set_file_name(fn);
-  emit_source_comment_header(of);
-  free(fn);
+    fprintf(of, "static void event_add(%s%s_token_type phrase, long start, "
+                "long end)\n",
+                  _ctx_lead, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  %s_event *e;\n", parser_name);
+    fprintf(of, "  long size;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!%sevent_handler)\n", _sp);
+    fprintf(of, "    return;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (%sevents_count == %sevents_size)\n", _sp, _sp);
+    fprintf(of, "  {\n");
+    fprintf(of, "    size = (%sevents_size) ? %sevents_size * 2 : "
+                "%s_EVENT_BLOCK_SIZE;\n",
+                  _sp, _sp, u_parser_name);
+    fprintf(of, "    e = realloc(%sevents, size * sizeof(%s_event));\n",
+                  _sp, parser_name);
+    fprintf(of, "    if (!e)\n");
+    fprintf(of, "      return;\n");
+    fprintf(of, "    %sevents = e;\n", _sp);
+    fprintf(of, "    %sevents_size = size;\n", _sp);
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  e = &(%sevents[%sevents_count++]);\n", _sp, _sp);
+    fprintf(of, "  e->phrase = phrase;\n");
+    fprintf(of, "  e->start = start;\n");
+    fprintf(of, "  e->end = end;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!%sevents_hold)\n", _sp);
+    fprintf(of, "    event_flush(%s);\n", _in_arg);
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
 
-    // Emit file description comment block
+      // Emit comment block for event_mark()
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  if (_use_doxygen)
-  {
-    fprintf(of, "    @file %s-token.h\n", parser_name);
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sMark the events added so far\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %slong count of events added so far\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
     fprintf(of, "\n");
-  }
-  fprintf(of, "    This is the header file for the %s grammar token and\n",
-                parser_name);
-  fprintf(of, "    token tree management functions module.\n");
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
 
-    // Emit header include guard
+      // Emit code for event_mark()
 
-  fprintf(of, "#ifndef %s_TOKEN_H\n", u_parser_name);
-  fprintf(of, "#define %s_TOKEN_H\n", u_parser_name);
-  fprintf(of, "\n");
+    fprintf(of, "static long event_mark(%s)\n", _ctx_void);
+    fprintf(of, "{\n");
+    fprintf(of, "  return %sevents_base + %sevents_count;\n", _sp, _sp);
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
 
-    // Emit extra library related includes
+      // Emit comment block for event_rewind()
 
-  fprintf(of, "#include \"gray/input.h\"\n");
-  fprintf(of, "\n");
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sDrop the events held back since a mark\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %smark count of events from event_mark()\n",
+                  (_use_doxygen) ? "@param " : "Param: ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-    // Emit module related includes
+      // Emit code for event_rewind()
 
-  fprintf(of, "#include \"%s-token-type.h\"\n", parser_name);
-  fprintf(of, "\n");
+    fprintf(of, "static void event_rewind(%slong mark)\n", _ctx_lead);
+    fprintf(of, "{\n");
+    fprintf(of, "  %sevents_count = (mark > %sevents_base) ? "
+                "mark - %sevents_base : 0;\n",
+                  _sp, _sp, _sp);
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
 
-    // Emit <PROJECT>_token_direction annotation
+      // Emit comment block for event_unhold()
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "    %sDefinition of allowed directions for %s_token_add "
-              "function.\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name);
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sLeave an alternative or repetition which may be given "
+                "up\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    The events held back are reported when no other one is "
+                "left.\n");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-    // Emit <PROJECT>_token_direction enum
+      // Emit code for event_unhold()
 
-  fprintf(of, "typedef enum\n");
-  fprintf(of, "{\n");
-  fprintf(of, "    /*%s %sAdd new token before token (as sibling) */\n",
-                (_use_doxygen) ? "!" : "",
-                (_use_doxygen) ? "@brief " : "");
-  fprintf(of, "  %s_token_before,\n", parser_name);
-  fprintf(of, "    /*%s %sAdd new token after token (as sibling) */\n",
-                (_use_doxygen) ? "!" : "",
-                (_use_doxygen) ? "@brief " : "");
-  fprintf(of, "  %s_token_after,\n", parser_name);
-  fprintf(of, "    /*%s %sAdd new token below token (as descendant) */\n",
-                (_use_doxygen) ? "!" : "",
-                (_use_doxygen) ? "@brief " : "");
-  fprintf(of, "  %s_token_below\n", parser_name);
-  fprintf(of, "} %s_token_direction;\n", parser_name);
-  fprintf(of, "\n");
+    fprintf(of, "static void event_unhold(%s)\n", _ctx_void);
+    fprintf(of, "{\n");
+    fprintf(of, "  if (!--%sevents_hold && %sevents_count)\n", _sp, _sp);
+    fprintf(of, "    event_flush(%s);\n", _in_arg);
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
 
-    // Emit <PROJECT>_token annotation
+  if (_use_callbacks && !_use_context)
+  {
+      // Emit comment block for <PROJECT>_get_callback_table()
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "    %sDefinition of %s_token\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name);
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sReturns pointer to callback table.\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    This function returns a pointer to the parser's callback "
+                "table.  The\n");
+    fprintf(of, "    caller can use this to register its own callback "
+                "functions for additional\n");
+    fprintf(of, "    parsing actions.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %s\"callback_table *\" pointer to head of parser "
+                "callback table\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-    // Emit <PROJECT>_token typedef
+      // Emit code for <PROJECT>_get_callback_table()
 
-  fprintf(of, "typedef struct %s_token\n", parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "    /*%s %sType of token */\n",
-                (_use_doxygen) ? "!" : "",
-                (_use_doxygen) ? "@brief " : "");
-  fprintf(of, "  %s_token_type type;\n", parser_name);
-  fprintf(of, "    /*%s %sPointer to ascendant (parent) token */\n",
-                (_use_doxygen) ? "!" : "",
-                (_use_doxygen) ? "@brief " : "");
-  fprintf(of, "  struct %s_token *ascendant;\n", parser_name);
-  fprintf(of, "    /*%s %sPointer to descendant (child) token */\n",
-                (_use_doxygen) ? "!" : "",
-                (_use_doxygen) ? "@brief " : "");
-  fprintf(of, "  struct %s_token *descendant;\n", parser_name);
-  fprintf(of, "    /*%s %sPointer to previous (sibling) token */\n",
-                (_use_doxygen) ? "!" : "",
-                (_use_doxygen) ? "@brief " : "");
-  fprintf(of, "  struct %s_token *previous;\n", parser_name);
-  fprintf(of, "    /*%s %sPointer to next (sibling) token */\n",
-                (_use_doxygen) ? "!" : "",
-                (_use_doxygen) ? "@brief " : "");
-  fprintf(of, "  struct %s_token *next;\n", parser_name);
-  fprintf(of, "    /*%s %sLine + offset location of token in input source */\n",
-                (_use_doxygen) ? "!" : "",
-                (_use_doxygen) ? "@brief " : "");
-  fprintf(of, "  input_location location;\n");
-  fprintf(of, "} %s_token;\n", parser_name);
-  fprintf(of, "\n");
+    fprintf(of, "callback_table *%s_get_callback_table(void)\n",
+                  parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  return &_cbt;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
 
-    // Emit function declarations
+  if (_use_memo || _memo_phrases)
+  {
+      // Emit comment block for <PROJECT>_memo_release()
 
-  fprintf(of, "%s_token *%s_token_new(%s_token_type type);\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "\n");
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sRelease all memory held by the packrat memo\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    if (_use_context)
+      fprintf(of, "    The memo of a context is released when the context is "
+                  "deleted.\n");
+    else
+    {
+      fprintf(of, "    The memo records phrase outcomes by input position, and "
+                  "refers to the\n");
+      fprintf(of, "    tokens of each match in the token arena.  It is "
+                  "released by\n");
+      fprintf(of, "    %s_input_initialize(), and must be released whenever "
+                  "the token arena\n",
+                    parser_name);
+      fprintf(of, "    is released or rewound to a mark taken before a "
+                  "parse.\n");
+    }
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-  fprintf(of, "void %s_token_free(%s_token *t);\n",
-                parser_name, parser_name);
-  fprintf(of, "\n");
+      // Emit code for <PROJECT>_memo_release()
 
-  fprintf(of, "unsigned char %s_token_add(%s_token *t,\n",
-                parser_name, parser_name);
-  fprintf(of, "  %s_token_direction dir,\n", parser_name);
-  fprintf(of, "  %s_token *n);\n", parser_name);
-  fprintf(of, "\n");
+    if (_use_context)
+      fprintf(of, "static void memo_release(%s)\n", _ctx_void);
+    else
+      fprintf(of, "void %s_memo_release(void)\n", parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  free(%smemo_table);\n", _sp);
+    fprintf(of, "  %smemo_table = NULL;\n", _sp);
+    fprintf(of, "  %smemo_size = 0;\n", _sp);
+    fprintf(of, "  %smemo_count = 0;\n", _sp);
+    fprintf(of, "  memset(&%smemo_floor, 0, sizeof(%s_token_mark));\n",
+                  _sp, parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
 
-  fprintf(of, "void %s_token_delete(%s_token *t);\n",
-                parser_name, parser_name);
-  fprintf(of, "\n");
+  if (_use_events && !_use_context)
+  {
+      // Emit comment block for <PROJECT>_set_event_handler()
 
-  fprintf(of, "void %s_token_unlink(%s_token *t);\n",
-                parser_name, parser_name);
-  fprintf(of, "\n");
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sSet the function called for each phrase matched by "
+                "the recognizers\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    Matches are reported in the order they end, each phrase "
+                "after the\n");
+    fprintf(of, "    phrases within it.  Matches in alternatives which are "
+                "given up are\n");
+    fprintf(of, "    never reported.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %shandler %s_event_handler to call, or NULL for none\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "    %sdata    user data given to each call of handler\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-  fprintf(of, "%s_token_type %s_token_get_type(%s_token *t);\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "void %s_token_set_type(%s_token *t, %s_token_type type);\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "\n");
+      // Emit code for <PROJECT>_set_event_handler()
 
-  fprintf(of, "%s_token *%s_token_get_ascendant(%s_token *t);\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "void %s_token_set_ascendant(%s_token *t, %s_token *a);\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "\n");
+    fprintf(of, "void %s_set_event_handler(%s_event_handler handler, "
+                "void *data)\n",
+                  parser_name, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  _event_handler = handler;\n");
+    fprintf(of, "  _event_data = data;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
 
-  fprintf(of, "%s_token *%s_token_get_descendant(%s_token *t);\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "void %s_token_set_descendant(%s_token *t, %s_token *d);\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "\n");
+      // Emit comment block for <PROJECT>_events_release()
 
-  fprintf(of, "%s_token *%s_token_get_previous(%s_token *t);\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "void %s_token_set_previous(%s_token *t, %s_token *p);\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "\n");
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sRelease all memory held for events held back\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-  fprintf(of, "%s_token *%s_token_get_next(%s_token *t);\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "void %s_token_set_next(%s_token *t, %s_token *n);\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "\n");
+      // Emit code for <PROJECT>_events_release()
 
-  fprintf(of, "%s_token *%s_token_find(%s_token *t, %s_token_type type);\n",
-                parser_name, parser_name, parser_name, parser_name);
-  fprintf(of, "\n");
+    fprintf(of, "void %s_events_release(void)\n", parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  free(_events);\n");
+    fprintf(of, "  _events = NULL;\n");
+    fprintf(of, "  _events_size = 0;\n");
+    fprintf(of, "  _events_count = 0;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
 
-  fprintf(of, "char *%s_token_to_string(%s_token *t, char *s);\n",
-                parser_name, parser_name);
-  fprintf(of, "\n");
+  if (_use_context)
+  {
+      // Emit code for parser context functions
 
-    // Emit close-out for header include guard
+    generate_context_functions(of, parser_name);
 
-  fprintf(of, "#endif // %s_TOKEN_H\n", u_parser_name);
-  fprintf(of, "\n");
+      // Emit code for parallel parse functions
 
-    // Clean up
+    if (_use_parallel)
+      generate_parallel_functions(of, parser_name, u_parser_name);
+
+      // Emit code for streaming parse functions
+
+    if (_use_stream)
+      generate_stream_functions(of, parser_name, u_parser_name);
+  }
+  else
+  {
+      // Emit comment block for <PROJECT>_input_initialize()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sInitialize the input source for parsing\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    This calls input_initialize(), after discarding "
+                "everything the parser\n");
+    fprintf(of, "    and the token module derived from the previous input "
+                "source.  Use it\n");
+    fprintf(of, "    instead of input_initialize() whenever more than one "
+                "input is parsed.\n");
+    fprintf(of, "    An input buffer that was loaded is loaded again from the "
+                "new input\n");
+    fprintf(of, "    source.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %sfile_name char * name of input file, NULL for "
+                "standard input\n",
+                  (_use_doxygen) ? "@param " : "Param: ");
+    fprintf(of, "\n");
+    fprintf(of, "    %sTRUE  success\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "    %sFALSE failure\n",
+                  (_use_doxygen) ? "@retval " : "         ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for <PROJECT>_input_initialize()
+
+    fprintf(of, "unsigned char %s_input_initialize(char *file_name)\n",
+                  parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  unsigned char reload = (_input_buffer != NULL);\n");
+    fprintf(of, "\n");
+    fprintf(of, "  %s_token_line_index_release();\n", parser_name);
+    if (_use_memo || _memo_phrases)
+      fprintf(of, "  %s_memo_release();\n", parser_name);
+    fprintf(of, "  %s_input_buffer_release();\n", parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  if (!input_initialize(file_name))\n");
+    fprintf(of, "    return FALSE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (reload)\n");
+    fprintf(of, "    %s_input_buffer_load();\n", parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  return TRUE;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+
+      // Emit comment block for <PROJECT>_input_buffer_load()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sCopy the whole input source into a contiguous buffer\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    With the input in one buffer, the parser can match runs "
+                "of bytes and\n");
+    fprintf(of, "    literals against it directly instead of reading one byte "
+                "at a time.\n");
+    fprintf(of, "    The input position is not changed.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %sThe buffer holds the input source it was loaded "
+                "from.  Change\n",
+                  (_use_doxygen) ? "@warning " : "Warning: ");
+    fprintf(of, "             input sources with %s_input_initialize(), "
+                "which loads\n",
+                  parser_name);
+    fprintf(of, "             it again, rather than input_initialize().\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %slong count of bytes in buffer\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "    %s-1 on failure, in which case the parser reads the input "
+                "source\n",
+                  (_use_doxygen) ? "@retval " : "         ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for <PROJECT>_input_buffer_load()
+
+    fprintf(of, "long %s_input_buffer_load(void)\n", parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  long pos = input_get_position();\n");
+    fprintf(of, "  unsigned char *b;\n");
+    fprintf(of, "  long size = 4096;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  %s_input_buffer_release();\n", parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  if (!(_input_buffer = malloc(size)))\n");
+    fprintf(of, "    return -1;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  input_set_position(0);\n");
+    fprintf(of, "  while (!input_eof())\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    if (_input_length == size)\n");
+    fprintf(of, "    {\n");
+    fprintf(of, "      if (!(b = realloc(_input_buffer, size * 2)))\n");
+    fprintf(of, "      {\n");
+    fprintf(of, "        %s_input_buffer_release();\n", parser_name);
+    fprintf(of, "        input_set_position(pos);\n");
+    fprintf(of, "        return -1;\n");
+    fprintf(of, "      }\n");
+    fprintf(of, "      _input_buffer = b;\n");
+    fprintf(of, "      size *= 2;\n");
+    fprintf(of, "    }\n");
+    fprintf(of, "    _input_buffer[_input_length++] = input_byte();\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "  input_set_position(pos);\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return _input_length;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+
+      // Emit comment block for <PROJECT>_input_buffer_release()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sRelease the input buffer\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    The parser reads the input source one byte at a time "
+                "again after this\n");
+    fprintf(of, "    call.\n");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for <PROJECT>_input_buffer_release()
+
+    fprintf(of, "void %s_input_buffer_release(void)\n", parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  free(_input_buffer);\n");
+    fprintf(of, "  _input_buffer = NULL;\n");
+    fprintf(of, "  _input_length = 0;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
+
+    // Emit code for run scanning helper function, when run tokens are in use
+    // or recognizers skip runs
+
+  if (_use_run_tokens || _skip)
+  {
+      // Emit comment block for scan_run()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sMatch a run of bytes from a byte class\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    The run starts at the current input position, and the "
+                "input position\n");
+    fprintf(of, "    is moved past it.  When the input buffer is loaded, the "
+                "run is scanned\n");
+    fprintf(of, "    in the buffer 32 or 16 bytes at a time where AVX2 or SSE2 "
+                "is\n");
+    fprintf(of, "    available, and the class is given as byte ranges.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %sbits   string of 32 bytes holding a bitmap of the "
+                "class\n",
+                  (_use_doxygen) ? "@param " : "Param: ");
+    fprintf(of, "    %sranges count of byte ranges in class, or 0 if there are "
+                "more\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "                  than 4\n");
+    fprintf(of, "    %slohi   string holding the first and last byte of each "
+                "range\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "    %smax    maximum length of run, or -1 for no maximum\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "\n");
+    fprintf(of, "    %slong length of run\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for scan_run()
+
+    fprintf(of, "static long scan_run(%sconst char *bits, int ranges, const "
+                "char *lohi, long max)\n",
+                  _ctx_lead);
+    fprintf(of, "{\n");
+    fprintf(of, "  const unsigned char *map = (const unsigned char *)bits;\n");
+    fprintf(of, "  long pos = %s_get_position(%s);\n", _in, _in_arg);
+    fprintf(of, "  long end, i;\n");
+    fprintf(of, "  unsigned char c;\n");
+    fprintf(of, "  int r;\n");
+    fprintf(of, "#ifdef __AVX2__\n");
+    fprintf(of, "  __m256i lo32[4], span32[4], x32, m32;\n");
+    fprintf(of, "#endif\n");
+    fprintf(of, "#ifdef __SSE2__\n");
+    fprintf(of, "  __m128i lo16[4], span16[4], x16, m16;\n");
+    fprintf(of, "#endif\n");
+    fprintf(of, "\n");
+    if (_use_stream)
+      fprintf(of, "  if (!%sinput_buffer || %sinput_stream)\n", _sp, _sp);
+    else
+      fprintf(of, "  if (!%sinput_buffer)\n", _sp);
+    fprintf(of, "  {\n");
+    fprintf(of, "    for (i = 0; ((max < 0) || (i < max)) && !%s_eof(%s); "
+                "++i)\n",
+                  _in, _in_arg);
+    fprintf(of, "    {\n");
+    fprintf(of, "      c = %s_byte(%s);\n", _in, _in_arg);
+    fprintf(of, "      if (!(map[c >> 3] & (1 << (c & 7))))\n");
+    fprintf(of, "        break;\n");
+    fprintf(of, "    }\n");
+    fprintf(of, "    %s_set_position(%spos + i);\n", _in, _in_args);
+    fprintf(of, "    return i;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  end = %sinput_length;\n", _sp);
+    fprintf(of, "  if ((max >= 0) && (max < end - pos))\n");
+    fprintf(of, "    end = pos + max;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  i = pos;\n");
+    fprintf(of, "\n");
+    fprintf(of, "#ifdef __AVX2__\n");
+    fprintf(of, "  for (r = 0; r < ranges; ++r)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    lo32[r] = _mm256_set1_epi8(lohi[r * 2]);\n");
+    fprintf(of, "    span32[r] = _mm256_set1_epi8((char)(lohi[r * 2 + 1] - "
+                "lohi[r * 2]));\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "  while (ranges && (end - i >= 32))\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    x32 = _mm256_loadu_si256((const __m256i *)(%sinput_buffer "
+                "+ i));\n",
+                  _sp);
+    fprintf(of, "    m32 = _mm256_setzero_si256();\n");
+    fprintf(of, "    for (r = 0; r < ranges; ++r)\n");
+    fprintf(of, "      m32 = _mm256_or_si256(m32,\n");
+    fprintf(of, "              _mm256_cmpeq_epi8(\n");
+    fprintf(of, "                _mm256_subs_epu8(_mm256_sub_epi8(x32, "
+                "lo32[r]), span32[r]),\n");
+    fprintf(of, "                _mm256_setzero_si256()));\n");
+    fprintf(of, "    if (_mm256_movemask_epi8(m32) != -1)\n");
+    fprintf(of, "      break;\n");
+    fprintf(of, "    i += 32;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "#endif\n");
+    fprintf(of, "#ifdef __SSE2__\n");
+    fprintf(of, "  for (r = 0; r < ranges; ++r)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    lo16[r] = _mm_set1_epi8(lohi[r * 2]);\n");
+    fprintf(of, "    span16[r] = _mm_set1_epi8((char)(lohi[r * 2 + 1] - lohi[r "
+                "* 2]));\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "  while (ranges && (end - i >= 16))\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    x16 = _mm_loadu_si128((const __m128i *)(%sinput_buffer + "
+                "i));\n",
+                  _sp);
+    fprintf(of, "    m16 = _mm_setzero_si128();\n");
+    fprintf(of, "    for (r = 0; r < ranges; ++r)\n");
+    fprintf(of, "      m16 = _mm_or_si128(m16,\n");
+    fprintf(of, "              _mm_cmpeq_epi8(\n");
+    fprintf(of, "                _mm_subs_epu8(_mm_sub_epi8(x16, lo16[r]), "
+                "span16[r]),\n");
+    fprintf(of, "                _mm_setzero_si128()));\n");
+    fprintf(of, "    if (_mm_movemask_epi8(m16) != 0xFFFF)\n");
+    fprintf(of, "      break;\n");
+    fprintf(of, "    i += 16;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "#endif\n");
+    fprintf(of, "\n");
+    fprintf(of, "  while ((i < end) &&\n");
+    fprintf(of, "         (map[%sinput_buffer[i] >> 3] & (1 << "
+                "(%sinput_buffer[i] & 7))))\n",
+                  _sp, _sp);
+    fprintf(of, "    ++i;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  %s_set_position(%si);\n", _in, _in_args);
+    fprintf(of, "\n");
+    fprintf(of, "  return i - pos;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
+
+    // Emit code for literal matching helper function, when quoted literals
+    // are in use
+
+  if (quoted)
+  {
+      // Emit comment block for match_literal()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sMatch a literal string at the current input position\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    When the input buffer is loaded, the first byte is tested "
+                "before the\n");
+    fprintf(of, "    whole literal is compared with memcmp().  On a match the "
+                "input\n");
+    fprintf(of, "    position is moved past the literal, otherwise it is left "
+                "unchanged.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %ss      string containing literal\n",
+                  (_use_doxygen) ? "@param " : "Param: ");
+    fprintf(of, "    %slength count of bytes in literal\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "\n");
+    fprintf(of, "    %sTRUE on match\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "    %sFALSE otherwise\n",
+                  (_use_doxygen) ? "@retval " : "         ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for match_literal()
+
+    fprintf(of, "static unsigned char match_literal(%sconst char *s, long "
+                "length)\n",
+                  _ctx_lead);
+    fprintf(of, "{\n");
+    fprintf(of, "  long pos = %s_get_position(%s);\n", _in, _in_arg);
+    fprintf(of, "  long i;\n");
+    fprintf(of, "\n");
+    if (_use_stream)
+      fprintf(of, "  if (%sinput_buffer && !%sinput_stream)\n", _sp, _sp);
+    else
+      fprintf(of, "  if (%sinput_buffer)\n", _sp);
+    fprintf(of, "  {\n");
+    fprintf(of, "    if ((length > %sinput_length - pos) ||\n", _sp);
+    fprintf(of, "        ((length > 0) && (%sinput_buffer[pos] != (unsigned "
+                "char)*s)) ||\n",
+                  _sp);
+    fprintf(of, "        memcmp(%sinput_buffer + pos, s, length))\n", _sp);
+    fprintf(of, "      return FALSE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %s_set_position(%spos + length);\n", _in, _in_args);
+    fprintf(of, "    return TRUE;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  for (i = 0; (i < length) && ((%s_byte(%s)) == (unsigned "
+                "char)s[i]); ++i) ;\n",
+                  _in, _in_arg);
+    fprintf(of, "  if (i == length)\n");
+    fprintf(of, "    return TRUE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  %s_set_position(%spos);\n", _in, _in_args);
+    fprintf(of, "  return FALSE;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
+
+    // Emit prototypes of inline phrase functions, which are called before
+    // they are defined
+
+  if (_inl)
+  {
+    fprintf(of, "  /*\n");
+    fprintf(of, "    Inline phrase parsing functions, called by the other "
+                "phrase parsing\n");
+    fprintf(of, "    functions in place of the public ones\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+    pmi = _inl;
+    while (pmi)
+    {
+      fn_inline = fix_identifier(strdup(pmi->name));
+      fprintf(of, "static inline %s_token *inline_%s(%s);\n",
+                    parser_name, fn_inline, _ctx_void);
+      free(fn_inline);
+      pmi = pmi->next;
+    }
+    fprintf(of, "\n");
+  }
+
+    // Emit code for each phrase parsing function, as one interpreter of
+    // phrase programs when the VM backend is in use
+
+  if (_use_vm)
+    generate_vm(of, parser_name, t);
+  else
+    generate_grammar(of, parser_name, t, 0);
+
+    // Emit code for each phrase recognizer function, when recognizers are
+    // in use
+
+  if (_use_recognizer)
+  {
+    _recognize = TRUE;
+    generate_grammar(of, parser_name, t, 0);
+    _recognize = FALSE;
+  }
+
+    // Clean up and return
 
+  phrase_map_list_delete(_pml);
+  phrase_map_list_delete(_sbl);
+  _sbl = NULL;
+  phrase_map_list_delete(_inl);
+  _inl = NULL;
+  free(_first);
+  _first = NULL;
+  free(_skip);
+  _skip = NULL;
+  free_context_parameters();
+  free(fn);
   free(u_parser_name);
 
   return;
@@ -679,22 +1774,30 @@ void generate_token_header(FILE *of,
 
   /*!
 
-     \brief Generates \<PROJECT\>-token.c source code file.
+     \brief Generates \<PROJECT\>-parser.h source code file.
     
-     This function generates the source code for \<PROJECT\>-token.c\n
+     This function generates the source code for \<PROJECT\>-parser.h\n
      \n
-     The token source file contains:
-       - the definitions for several \<PROJECT\>_token management functions
+     The parser header file contains exactly one function declaration for each
+     phrase in the supplied EGG grammar.  Also, a function declartion for the
+     utility getter function named \<PROJECT\>_get_callback_table is included.
     
      \param of          FILE * of open output file to write source code
      \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the root token from which
+                        the source code is generated
 
   */
 
-void generate_token_source(FILE *of,
-                           char *parser_name)
+void generate_parser_header(FILE *of,
+                            char *parser_name,
+                            egg_token *t)
 {
-  char *fn;              // A generated file name for emitted documentation
+  egg_token *ge, *p, *pn;
+  char *hn;
+  int hnl;
+  char *pns;
+  char *fn;
 
     // Sanity check parameters
 
@@ -704,9 +1807,26 @@ void generate_token_source(FILE *of,
   if (!parser_name)
     return;
 
+  if (!t)
+    return;
+
+    // Create header include guard name
+
+  hnl = strlen(parser_name) + strlen("_parser_h") + 1;
+  hn = malloc(hnl);
+  memset(hn, 0, hnl);
+
+  sprintf(hn, "%s_parser_h", parser_name);
+
+  hn = str_toupper(hn);
+
+    // Make the parameter list of phrase parsing functions
+
+  make_context_parameters(parser_name);
+
     // Emit the file level comment block
 
-  fn = make_file_name(parser_name, "token.c");
+  fn = make_file_name(parser_name, "parser.h");
   generator_set_file_name(fn);
   emit_source_comment_header(of);
   free(fn);
@@ -717,1033 +1837,10175 @@ void generate_token_source(FILE *of,
   fprintf(of, "\n");
   if (_use_doxygen)
   {
-    fprintf(of, "    @file %s-token.c\n", parser_name);
+    fprintf(of, "    @file %s-parser.h\n", parser_name);
     fprintf(of, "\n");
   }
-  fprintf(of, "    This is the source code file for the %s grammar token and\n",
+  fprintf(of, "    This is the header file for the %s grammar phrase parsing\n",
                 parser_name);
-  fprintf(of, "    token tree management functions module.\n");
+  fprintf(of, "    functions module.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    An individual phrase parsing function exists for each\n");
+  fprintf(of, "    %s grammar phrase.\n", parser_name);
   fprintf(of, "\n");
+  if (_use_callbacks)
+  {
+    fprintf(of, "    Also the %s_get_callback_table function is defined in\n",
+                  parser_name);
+    fprintf(of, "    this module.\n");
+    fprintf(of, "\n");
+  }
   fprintf(of, "  */\n");
   fprintf(of, "\n");
 
-    // Emit code for included header files
+    // Emit header include guard
 
-  fprintf(of, "#include <stdlib.h>\n");
-  fprintf(of, "#include <string.h>\n");
+  fprintf(of, "#ifndef %s\n", hn);
+  fprintf(of, "#define %s\n", hn);
   fprintf(of, "\n");
 
-    // Emit code for extra library related header files
+  if (_use_callbacks)
+  {
+       // Emit includes
 
-  fprintf(of, "#include \"gray/strapp.h\"\n");
-  fprintf(of, "\n");
+    fprintf(of, "#include \"gray/callback.h\"\n");
+    fprintf(of, "\n");
 
-    // Emit code for project related header files
+      // Emit function declaration for utility functions
 
-  fprintf(of, "#include \"%s-token.h\"\n", parser_name);
-  fprintf(of, "#include \"%s-token-util.h\"\n", parser_name);
-  fprintf(of, "\n");
+    if (!_use_context)
+    {
+      fprintf(of, "callback_table *%s_get_callback_table(void);\n",
+                    parser_name);
+      fprintf(of, "\n");
+    }
+  }
 
-    // Emit code for module constants
+  if (_use_events)
+  {
+      // Emit comment block for <PROJECT>_event_handler typedef
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "    %sDefinition of %s_event_handler, a function called by "
+                "the\n",
+                  (_use_doxygen) ? "@brief " : "",
+                  parser_name);
+    fprintf(of, "    recognizers for each phrase matched, with the phrase "
+                "index, the\n");
+    fprintf(of, "    offsets of the start and end of the match, and the user "
+                "data\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit <PROJECT>_event_handler typedef
+
+    fprintf(of, "typedef void (*%s_event_handler)(%s_token_type phrase,\n",
+                  parser_name, parser_name);
+    fprintf(of, "  long start,\n");
+    fprintf(of, "  long end,\n");
+    fprintf(of, "  void *data);\n");
+    fprintf(of, "\n");
+  }
+
+  if (_use_context)
+  {
+      // Emit comment block for <PROJECT>_context typedef
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "    %sDefinition of %s_context, the state of one parse\n",
+                  (_use_doxygen) ? "@brief " : "",
+                  parser_name);
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit <PROJECT>_context typedef
+
+    fprintf(of, "typedef struct %s_context\n", parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "    /*%s %sInput bytes being parsed */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  const unsigned char *input_buffer;\n");
+    fprintf(of, "    /*%s %sCount of input bytes */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  long input_length;\n");
+    fprintf(of, "    /*%s %sCurrent input position */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  long input_position;\n");
+    fprintf(of, "    /*%s %sTRUE when input bytes are freed with context */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  unsigned char owns_input_buffer;\n");
+    fprintf(of, "    /*%s %sInput bytes and line index read back by tokens "
+                "*/\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  %s_token_source source;\n", parser_name);
+    fprintf(of, "    /*%s %sSource given to new tokens, of this context or "
+                "of the context\n"
+                "        it parses part of */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  %s_token_source *token_source;\n", parser_name);
+    if (_use_stream)
+    {
+      fprintf(of, "    /*%s %sInput offset of first byte of input bytes */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  long input_base;\n");
+      fprintf(of, "    /*%s %sCount of bytes allocated for input bytes */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  long input_size;\n");
+      fprintf(of, "    /*%s %sTRUE when input bytes are read from input source "
+                  "*/\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  unsigned char input_stream;\n");
+      fprintf(of, "    /*%s %sToken arena mark taken before last element "
+                  "*/\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  %s_token_mark stream_mark;\n", parser_name);
+    }
+    if (_use_push)
+    {
+      fprintf(of, "    /*%s %sTRUE when input bytes are fed by caller */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  unsigned char input_push;\n");
+      fprintf(of, "    /*%s %sTRUE when no more input bytes will be fed */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  unsigned char input_finished;\n");
+      fprintf(of, "    /*%s %sTRUE when a byte not yet fed was needed */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  unsigned char input_starved;\n");
+      fprintf(of, "    /*%s %sParse of element waiting for more input bytes "
+                  "*/\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  struct %s_push_state *push;\n", parser_name);
+    }
+    if (_use_callbacks)
+    {
+      fprintf(of, "    /*%s %sCallback entries of context, one per phrase */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  callback_entry *callbacks;\n");
+      fprintf(of, "    /*%s %sCallback table of context */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  callback_table cbt;\n");
+    }
+    if (_use_memo || _memo_phrases)
+    {
+      fprintf(of, "    /*%s %sMemo table */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  struct %s_memo_entry *memo_table;\n", parser_name);
+      fprintf(of, "    /*%s %sCount of entries in memo table */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  long memo_size;\n");
+      fprintf(of, "    /*%s %sCount of used entries in memo table */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  long memo_count;\n");
+      fprintf(of, "    /*%s %sToken arena mark past the most recent memoized "
+                  "match */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  %s_token_mark memo_floor;\n", parser_name);
+    }
+    if (_use_events)
+    {
+      fprintf(of, "    /*%s %sEvent handler of context */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  %s_event_handler event_handler;\n", parser_name);
+      fprintf(of, "    /*%s %sUser data given to event handler */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  void *event_data;\n");
+      fprintf(of, "    /*%s %sEvents held back until they are certain */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  struct %s_event *events;\n", parser_name);
+      fprintf(of, "    /*%s %sCount of events allocated */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  long events_size;\n");
+      fprintf(of, "    /*%s %sCount of events held back */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  long events_count;\n");
+      fprintf(of, "    /*%s %sCount of events already reported */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  long events_base;\n");
+      fprintf(of, "    /*%s %sCount of alternatives and repetitions which "
+                  "may be given up */\n",
+                    (_use_doxygen) ? "!" : "",
+                    (_use_doxygen) ? "@brief " : "");
+      fprintf(of, "  int events_hold;\n");
+    }
+    fprintf(of, "    /*%s %sCount of phrase function calls */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  long calls;\n");
+    fprintf(of, "} %s_context;\n", parser_name);
+    fprintf(of, "\n");
+
+      // Emit function declarations for parser context functions
+
+    fprintf(of, "%s_context *%s_context_new(const unsigned char *buffer, long "
+                "length);\n",
+                  parser_name, parser_name);
+    fprintf(of, "%s_context *%s_context_new_from_input(void);\n",
+                  parser_name, parser_name);
+    fprintf(of, "void %s_context_delete(%s_context *ctx);\n",
+                  parser_name, parser_name);
+    if (_use_callbacks)
+      fprintf(of, "callback_table *%s_context_get_callback_table(%s_context "
+                  "*ctx);\n",
+                    parser_name, parser_name);
+    if (_use_events)
+      fprintf(of, "void %s_context_set_event_handler(%s_context *ctx,\n"
+                  "  %s_event_handler handler,\n"
+                  "  void *data);\n",
+                    parser_name, parser_name, parser_name);
+    fprintf(of, "\n");
+
+    if (_use_parallel || _use_stream)
+    {
+        // Emit comment block for <PROJECT>_phrase_function typedef
+
+      fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+      fprintf(of, "    %sDefinition of %s_phrase_function, a pointer to a "
+                  "phrase\n",
+                    (_use_doxygen) ? "@brief " : "",
+                    parser_name);
+      fprintf(of, "    parsing function\n");
+      fprintf(of, "  */\n");
+      fprintf(of, "\n");
+
+        // Emit <PROJECT>_phrase_function typedef
+
+      fprintf(of, "typedef %s_token *(*%s_phrase_function)(%s_context "
+                  "*ctx);\n",
+                    parser_name, parser_name, parser_name);
+      fprintf(of, "\n");
+    }
+
+    if (_use_parallel)
+    {
+        // Emit function declaration for parallel parse function
+
+      fprintf(of, "%s_token *%s_parse_parallel(%s_context *ctx,\n",
+                    parser_name, parser_name, parser_name);
+      fprintf(of, "  %s_token_type type,\n", parser_name);
+      fprintf(of, "  %s_phrase_function element,\n", parser_name);
+      fprintf(of, "  %s_phrase_function terminator,\n", parser_name);
+      fprintf(of, "  int threads);\n");
+      fprintf(of, "\n");
+    }
+
+    if (_use_stream)
+    {
+        // Emit function declarations for streaming parse functions
+
+      fprintf(of, "%s_context *%s_context_new_stream(void);\n",
+                    parser_name, parser_name);
+      fprintf(of, "%s_token *%s_stream_next(%s_context *ctx,\n",
+                    parser_name, parser_name, parser_name);
+      fprintf(of, "  %s_phrase_function element);\n", parser_name);
+      fprintf(of, "void %s_stream_release(%s_context *ctx);\n",
+                    parser_name, parser_name);
+      fprintf(of, "unsigned char %s_stream_eof(%s_context *ctx);\n",
+                    parser_name, parser_name);
+      fprintf(of, "\n");
+    }
+
+    if (_use_push)
+    {
+        // Emit function declarations for push parse functions
+
+      fprintf(of, "%s_context *%s_context_new_push(void);\n",
+                    parser_name, parser_name);
+      fprintf(of, "unsigned char %s_parser_feed(%s_context *ctx,\n",
+                    parser_name, parser_name);
+      fprintf(of, "  const unsigned char *buffer,\n");
+      fprintf(of, "  long length);\n");
+      fprintf(of, "void %s_parser_finish(%s_context *ctx);\n",
+                    parser_name, parser_name);
+      fprintf(of, "unsigned char %s_parser_needs_input(%s_context *ctx);\n",
+                    parser_name, parser_name);
+      fprintf(of, "\n");
+    }
+  }
+  else
+  {
+      // Emit function declarations for input functions
+
+    fprintf(of, "unsigned char %s_input_initialize(char *file_name);\n",
+                  parser_name);
+    fprintf(of, "long %s_input_buffer_load(void);\n", parser_name);
+    fprintf(of, "void %s_input_buffer_release(void);\n", parser_name);
+    fprintf(of, "\n");
+
+      // Emit function declaration for memo release function
+
+    if (_use_memo || _memo_phrases)
+    {
+      fprintf(of, "void %s_memo_release(void);\n", parser_name);
+      fprintf(of, "\n");
+    }
+
+      // Emit function declarations for event functions
+
+    if (_use_events)
+    {
+      fprintf(of, "void %s_set_event_handler(%s_event_handler handler, "
+                  "void *data);\n",
+                    parser_name, parser_name);
+      fprintf(of, "void %s_events_release(void);\n", parser_name);
+      fprintf(of, "\n");
+    }
+  }
+
+    // Emit function declarations for each phrase parsing function
+
+  if ((ge = egg_token_find_child(t, egg_token_type_grammar_element)))
+  {
+    while (ge)
+    {
+      if ((p = egg_token_find_child(ge, egg_token_type_phrase)))
+      {
+        if ((pn = egg_token_find_child(p, egg_token_type_phrase_name)))
+        {
+          pns = NULL;
+          pns = egg_token_to_string(pn->descendant, pns);
+          pns = fix_identifier(pns);
+
+          fprintf(of, "%s_token *%s(%s);\n",
+                        parser_name, pns, _ctx_void);
+
+          free(pns);
+        }
+      }
+      ge = ge->next;
+    }
+  }
+
+    // Emit function declarations for each phrase recognizer function
+
+  if (_use_recognizer)
+  {
+    fprintf(of, "\n");
+    ge = egg_token_find_child(t, egg_token_type_grammar_element);
+    while (ge)
+    {
+      if ((p = egg_token_find_child(ge, egg_token_type_phrase)))
+      {
+        if ((pn = egg_token_find_child(p, egg_token_type_phrase_name)))
+        {
+          pns = NULL;
+          pns = egg_token_to_string(pn->descendant, pns);
+          pns = fix_identifier(pns);
+
+          fprintf(of, "long recognize_%s(%s);\n", pns, _ctx_void);
+
+          free(pns);
+        }
+      }
+      ge = ge->next;
+    }
+  }
+
+    // Emit close-out for header include guard
 
-  fprintf(of, "#define FALSE 0\n");
-  fprintf(of, "#define TRUE 1\n");
   fprintf(of, "\n");
+  fprintf(of, "#endif // %s\n", hn);
 
-    // Emit comment block for <PROJECT>_token_new()
+    // Clean up
+
+  free_context_parameters();
+  free(hn);
+
+  return;
+}
+
+  /*!
+
+     \brief Generates \<PROJECT\>-token.h source code file.
+    
+     This function generates the source code for \<PROJECT\>-token.h\n
+     \n
+     The token header file contains:
+       - an enum typedef for the \<PROJECT\>_token_direction values
+       - a struct typedef for the \<PROJECT\>_token structure
+       - the declaration for several \<PROJECT\>_token management functions
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+
+  */
+
+void generate_token_header(FILE *of,
+                           char *parser_name)
+{
+  char *u_parser_name;
+  char *fn;
+
+    // Sanity check parameters
+
+  if (!of)
+    of = stdout;
+
+  if (!parser_name)
+    return;
+
+    // Force parser name to upper case
+
+  u_parser_name = str_toupper(strdup(parser_name));
+
+    // Emit the file level comment block
+
+  fn = make_file_name(parser_name, "token.h");
+  generator_set_file_name(fn);
+  emit_source_comment_header(of);
+  free(fn);
+
+    // Emit file description comment block
 
   fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
   fprintf(of, "\n");
-  fprintf(of, "    %sCreate a new %s_token\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %sThis function returns a pointer to dynamically "
-              "allocated memory.\n",
-                (_use_doxygen) ? "@warning " : "Warning: ");
-  fprintf(of, "             It is the caller's responsibility to free this "
-              "memory when \n");
-  fprintf(of, "             appropriate.\n");
-  fprintf(of, "\n");
-  fprintf(of, "    %stype %s_token_type\n",
-                (_use_doxygen) ? "@param " : "Parameters: ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %s%s%s_token *%s new %s_token\n",
-                (_use_doxygen) ? "@retval " : "Returns: ",
-                (_use_doxygen) ? "\"" : "",
-                parser_name,
-                (_use_doxygen) ? "\"" : "",
+  if (_use_doxygen)
+  {
+    fprintf(of, "    @file %s-token.h\n", parser_name);
+    fprintf(of, "\n");
+  }
+  fprintf(of, "    This is the header file for the %s grammar token and\n",
                 parser_name);
-  fprintf(of, "    %sNULL failure\n",
-                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "    token tree management functions module.\n");
   fprintf(of, "\n");
   fprintf(of, "  */\n");
   fprintf(of, "\n");
 
-    // Emit code for <PROJECT>_token_new()
+    // Emit header include guard
 
-  fprintf(of, "%s_token *%s_token_new(%s_token_type type)\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  %s_token *new = NULL;\n",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "  new = malloc(sizeof(%s_token));\n",
-                parser_name);
-  fprintf(of, "  if (!new)\n");
-  fprintf(of, "    return NULL;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  memset(new, 0, sizeof(%s_token));\n",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "  new->type = type;\n");
+  fprintf(of, "#ifndef %s_TOKEN_H\n", u_parser_name);
+  fprintf(of, "#define %s_TOKEN_H\n", u_parser_name);
   fprintf(of, "\n");
-  fprintf(of, "  input_get_location(&(new->location));\n");
+
+    // Emit extra library related includes
+
+  fprintf(of, "#include \"gray/input.h\"\n");
   fprintf(of, "\n");
-  fprintf(of, "  return new;\n");
-  fprintf(of, "}\n");
+
+    // Emit module related includes
+
+  fprintf(of, "#include \"%s-token-type.h\"\n", parser_name);
   fprintf(of, "\n");
 
-    // Emit comment block for <PROJECT>_token_free()
+    // Emit <PROJECT>_token_direction annotation
 
   fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sFree the memory associated with %s_token\n",
+  fprintf(of, "    %sDefinition of allowed directions for %s_token_add "
+              "function.\n",
                 (_use_doxygen) ? "@brief " : "",
                 parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %sThis function does NOT perform any unlinking of "
-              "the freed token.\n",
-                (_use_doxygen) ? "@warning " : "Warning: ");
-  fprintf(of, "    %s%s_token_unlink()\n",
-                (_use_doxygen) ? "@sa " : "See: ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %st %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "\n");
   fprintf(of, "  */\n");
   fprintf(of, "\n");
 
-    // Emit code for <PROJECT>_token_free()
+    // Emit <PROJECT>_token_direction enum
 
-  fprintf(of, "void %s_token_free(%s_token *t)\n",
-                parser_name, parser_name);
+  fprintf(of, "typedef enum\n");
   fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  free(t);\n");
-  fprintf(of, "\n");
-  fprintf(of, "  return;\n");
-  fprintf(of, "}\n");
+  fprintf(of, "    /*%s %sAdd new token before token (as sibling) */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_before,\n", parser_name);
+  fprintf(of, "    /*%s %sAdd new token after token (as sibling) */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_after,\n", parser_name);
+  fprintf(of, "    /*%s %sAdd new token below token (as descendant) */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_below\n", parser_name);
+  fprintf(of, "} %s_token_direction;\n", parser_name);
   fprintf(of, "\n");
 
-    // Emit comment block for <PROJECT>_token_add()
+    // Emit <PROJECT>_token_source annotation and typedef, when parser
+    // contexts are in use, so that tokens read back the input they were
+    // parsed from
+
+  if (_use_context)
+  {
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "    %sDefinition of %s_token_source, the input bytes that "
+                "the offsets of\n",
+                  (_use_doxygen) ? "@brief " : "",
+                  parser_name);
+    fprintf(of, "    tokens parsed with a parser context refer to, along "
+                "with an index of\n");
+    fprintf(of, "    their line starts\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+    fprintf(of, "typedef struct %s_token_source\n", parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "    /*%s %sInput bytes held */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  const unsigned char *buffer;\n");
+    fprintf(of, "    /*%s %sInput offset of first byte held */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  long base;\n");
+    fprintf(of, "    /*%s %sInput offset following last byte held */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  long length;\n");
+    fprintf(of, "    /*%s %sInput offset of each line start found */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  long *line_start;\n");
+    fprintf(of, "    /*%s %sCount of line starts found */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  long line_count;\n");
+    fprintf(of, "    /*%s %sCount of line starts allocated */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  long line_size;\n");
+    fprintf(of, "    /*%s %sInput offset up to which line starts are "
+                "found */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  long line_scanned;\n");
+    fprintf(of, "    /*%s %sCount of line starts dropped from front of index "
+                "*/\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  long line_dropped;\n");
+    fprintf(of, "} %s_token_source;\n", parser_name);
+    fprintf(of, "\n");
+  }
+
+    // Emit <PROJECT>_token annotation
 
   fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sLink %s_token into an existing token tree\n",
+  fprintf(of, "    %sDefinition of %s_token\n",
                 (_use_doxygen) ? "@brief " : "",
                 parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %st   existing %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "    %sdir %s_token_direction\n",
-                (_use_doxygen) ? "@param " : "       ",
-                parser_name);
-  fprintf(of, "    %sn   %s_token * to link\n",
-                (_use_doxygen) ? "@param " : "       ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %sTRUE  success\n",
-                (_use_doxygen) ? "@retval " : "Returns: ");
-  fprintf(of, "    %sFALSE failure\n",
-                (_use_doxygen) ? "@retval " : "         ");
-  fprintf(of, "\n");
   fprintf(of, "  */\n");
   fprintf(of, "\n");
 
-    // Emit code for <PROJECT>_token_add()
+    // Emit <PROJECT>_token typedef
 
-  fprintf(of, "unsigned char %s_token_add(%s_token *t, "
-              "%s_token_direction dir, "
-              "%s_token *n)\n",
-                parser_name, parser_name, parser_name, parser_name);
+  fprintf(of, "typedef struct %s_token\n", parser_name);
   fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return FALSE;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  if (!n)\n");
-  fprintf(of, "    return FALSE;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  switch (dir)\n");
-  fprintf(of, "  {\n");
-  fprintf(of, "    case %s_token_before:\n",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "      n->previous = t->previous;\n");
-  fprintf(of, "      n->next = t;\n");
-  fprintf(of, "      if (t->previous)\n");
-  fprintf(of, "        t->previous->next = n;\n");
-  fprintf(of, "      t->previous = n;\n");
-  fprintf(of, "      n->ascendant = t->ascendant;\n");
-  fprintf(of, "\n");
-  fprintf(of, "        // Fix ascendant's descendant pointer, if it is t.\n");
-  fprintf(of, "        // We always want the ascendant's descendent pointer to "
-              "point to\n");
-  fprintf(of, "        //   the beginning of the list of descendents.\n");
-  fprintf(of, "\n");
-  fprintf(of, "      if (t->ascendant)\n");
-  fprintf(of, "        if (t->ascendant->descendant == t)\n");
-  fprintf(of, "          t->ascendant->descendant = n;\n");
-  fprintf(of, "\n");
-  fprintf(of, "      break;\n");
-  fprintf(of, "\n");
-  fprintf(of, "    case %s_token_after:\n",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "      n->previous = t;\n");
-  fprintf(of, "      n->next = t->next;\n");
-  fprintf(of, "      if (t->next)\n");
-  fprintf(of, "        t->next->previous = n;\n");
-  fprintf(of, "      t->next = n;\n");
-  fprintf(of, "      n->ascendant = t->ascendant;\n");
-  fprintf(of, "\n");
-  fprintf(of, "      break;\n");
+  fprintf(of, "    /*%s %sType of token */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_type type;\n", parser_name);
+  fprintf(of, "    /*%s %sPointer to ascendant (parent) token */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  struct %s_token *ascendant;\n", parser_name);
+  fprintf(of, "    /*%s %sPointer to descendant (child) token */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  struct %s_token *descendant;\n", parser_name);
+  fprintf(of, "    /*%s %sPointer to previous (sibling) token */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  struct %s_token *previous;\n", parser_name);
+  fprintf(of, "    /*%s %sPointer to next (sibling) token */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  struct %s_token *next;\n", parser_name);
+  fprintf(of, "    /*%s %sInput offset of first byte matched by token */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  long offset;\n");
+  fprintf(of, "    /*%s %sCount of input bytes matched by token */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  long length;\n");
+  if (_use_context)
+  {
+    fprintf(of, "    /*%s %sInput bytes read back by token, NULL for the "
+                "input source */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  %s_token_source *source;\n", parser_name);
+  }
+  fprintf(of, "} %s_token;\n", parser_name);
   fprintf(of, "\n");
-  fprintf(of, "    case %s_token_below:\n",
+
+    // Emit <PROJECT>_token_mark annotation
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "    %sDefinition of %s_token_mark, a saved allocation point "
+              "in the\n",
+                (_use_doxygen) ? "@brief " : "",
                 parser_name);
+  fprintf(of, "    %s_token arena\n", parser_name);
+  fprintf(of, "  */\n");
   fprintf(of, "\n");
-  fprintf(of, "      if (t->descendant)\n");
-  fprintf(of, "        return FALSE;\n");
-  fprintf(of, "      t->descendant = n;\n");
-  fprintf(of, "      n->ascendant = t;\n");
-  fprintf(of, "\n");
-  fprintf(of, "      break;\n");
-  fprintf(of, "  }\n");
-  fprintf(of, "\n");
-  fprintf(of, "  return TRUE;\n");
-  fprintf(of, "}\n");
+
+    // Emit <PROJECT>_token_mark typedef
+
+  fprintf(of, "typedef struct\n");
+  fprintf(of, "{\n");
+  fprintf(of, "    /*%s %sArena block in use when mark was taken */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  void *block;\n");
+  fprintf(of, "    /*%s %sCount of tokens used in block when mark was "
+              "taken */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  long used;\n");
+  fprintf(of, "    /*%s %sCount of tokens in arena when mark was taken, "
+              "so that\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "        the later of two marks has the larger index */\n");
+  fprintf(of, "  long index;\n");
+  fprintf(of, "} %s_token_mark;\n", parser_name);
   fprintf(of, "\n");
 
-    // Emit comment block for <PROJECT>_token_delete()
+    // Emit <PROJECT>_token_order annotation
 
   fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sDelete %s_token from an existing token tree, if any\n",
+  fprintf(of, "    %sDefinition of traversal orders for %s_token_iterator.\n",
                 (_use_doxygen) ? "@brief " : "",
                 parser_name);
+  fprintf(of, "  */\n");
   fprintf(of, "\n");
-  fprintf(of, "    This function unlinks %s_token from an existing token \n"
-              "    tree, if required.\n",
-                parser_name);
-  fprintf(of, "    Also, the memory associated with %s_token is freed.\n",
-                parser_name);
+
+    // Emit <PROJECT>_token_order enum
+
+  fprintf(of, "typedef enum\n");
+  fprintf(of, "{\n");
+  fprintf(of, "    /*%s %sVisit token before its descendants */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_pre_order,\n", parser_name);
+  fprintf(of, "    /*%s %sVisit token after its descendants */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_post_order,\n", parser_name);
+  fprintf(of, "    /*%s %sVisit only the descendants (children) of token */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_children\n", parser_name);
+  fprintf(of, "} %s_token_order;\n", parser_name);
   fprintf(of, "\n");
-  fprintf(of, "    %st %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
+
+    // Emit <PROJECT>_token_iterator annotation
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "    %sDefinition of %s_token_iterator, the state of a walk over "
+              "a\n",
+                (_use_doxygen) ? "@brief " : "",
                 parser_name);
-  fprintf(of, "\n");
+  fprintf(of, "    %s_token tree\n", parser_name);
   fprintf(of, "  */\n");
   fprintf(of, "\n");
 
-    // Emit code for <PROJECT>_token_delete()
+    // Emit <PROJECT>_token_iterator typedef
 
-  fprintf(of, "void %s_token_delete(%s_token *t)\n",
-                parser_name, parser_name);
+  fprintf(of, "typedef struct\n");
   fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  while (t->descendant)\n");
-  fprintf(of, "    %s_token_delete(t->descendant);\n",
-                parser_name);
+  fprintf(of, "    /*%s %sOrder in which tokens are visited */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_order order;\n", parser_name);
+  fprintf(of, "    /*%s %sToken the walk starts from, NULL once started */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token *first;\n", parser_name);
+  fprintf(of, "    /*%s %sToken most recently visited */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token *current;\n", parser_name);
+  fprintf(of, "    /*%s %sDepth of current token below first token */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  int depth;\n");
+  fprintf(of, "} %s_token_iterator;\n", parser_name);
   fprintf(of, "\n");
-  fprintf(of, "  %s_token_unlink(t);\n",
-                parser_name);
-  fprintf(of, "  %s_token_free(t);\n",
-                parser_name);
+
+    // Emit function declarations
+
+  fprintf(of, "%s_token *%s_token_new(%s_token_type type);\n",
+                parser_name, parser_name, parser_name);
   fprintf(of, "\n");
-  fprintf(of, "  return;\n");
-  fprintf(of, "}\n");
+
+  fprintf(of, "void %s_token_free(%s_token *t);\n",
+                parser_name, parser_name);
   fprintf(of, "\n");
 
-    // Emit comment block for <PROJECT>_token_unlink()
+  fprintf(of, "unsigned char %s_token_add(%s_token *t,\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token_direction dir,\n", parser_name);
+  fprintf(of, "  %s_token *n);\n", parser_name);
+  fprintf(of, "\n");
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "void %s_token_delete(%s_token *t);\n",
+                parser_name, parser_name);
   fprintf(of, "\n");
-  fprintf(of, "    %sUnlink %s_token from an existing token tree\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name);
+
+  fprintf(of, "void %s_token_unlink(%s_token *t);\n",
+                parser_name, parser_name);
   fprintf(of, "\n");
-  fprintf(of, "    %sThis function does NOT perform any freeing of "
-              "the unlinked token.\n",
-                (_use_doxygen) ? "@warning " : "Warning: ");
-  fprintf(of, "    %s%s_token_free()\n",
-                (_use_doxygen) ? "@sa " : "See: ",
-                parser_name);
+
+  fprintf(of, "%s_token_type %s_token_get_type(%s_token *t);\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "void %s_token_set_type(%s_token *t, %s_token_type type);\n",
+                parser_name, parser_name, parser_name);
   fprintf(of, "\n");
-  fprintf(of, "    %st %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
+
+  fprintf(of, "%s_token *%s_token_get_ascendant(%s_token *t);\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "void %s_token_set_ascendant(%s_token *t, %s_token *a);\n",
+                parser_name, parser_name, parser_name);
   fprintf(of, "\n");
-  fprintf(of, "  */\n");
+
+  fprintf(of, "%s_token *%s_token_get_descendant(%s_token *t);\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "void %s_token_set_descendant(%s_token *t, %s_token *d);\n",
+                parser_name, parser_name, parser_name);
   fprintf(of, "\n");
 
-    // Emit code for <PROJECT>_token_unlink()
+  fprintf(of, "%s_token *%s_token_get_previous(%s_token *t);\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "void %s_token_set_previous(%s_token *t, %s_token *p);\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "\n");
+
+  fprintf(of, "%s_token *%s_token_get_next(%s_token *t);\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "void %s_token_set_next(%s_token *t, %s_token *n);\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "\n");
+
+  fprintf(of, "long %s_token_get_offset(%s_token *t);\n",
+                parser_name, parser_name);
+  fprintf(of, "void %s_token_set_offset(%s_token *t, long offset);\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+
+  fprintf(of, "long %s_token_get_length(%s_token *t);\n",
+                parser_name, parser_name);
+  fprintf(of, "void %s_token_set_length(%s_token *t, long length);\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+
+  if (_use_context)
+  {
+    fprintf(of, "%s_token_source *%s_token_get_source(%s_token *t);\n",
+                  parser_name, parser_name, parser_name);
+    fprintf(of, "void %s_token_set_source(%s_token *t, "
+                "%s_token_source *source);\n",
+                  parser_name, parser_name, parser_name);
+    fprintf(of, "\n");
+  }
+
+  fprintf(of, "void %s_token_get_location(%s_token *t, "
+              "input_location *location);\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+
+  fprintf(of, "%s_token *%s_token_find(%s_token *t, %s_token_type type);\n",
+                parser_name, parser_name, parser_name, parser_name);
+  fprintf(of, "%s_token *%s_token_find_child(%s_token *t, "
+              "%s_token_type type);\n",
+                parser_name, parser_name, parser_name, parser_name);
+  fprintf(of, "%s_token *%s_token_find_within(%s_token *t,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_type type,\n", parser_name);
+  fprintf(of, "  int depth);\n");
+  fprintf(of, "\n");
+
+  fprintf(of, "char *%s_token_to_string(%s_token *t, char *s);\n",
+                parser_name, parser_name);
+  fprintf(of, "char *%s_token_span_to_string(%s_token *t, char *s);\n",
+                parser_name, parser_name);
+  fprintf(of, "long %s_token_to_buffer(%s_token *t, char *buffer, "
+              "long size);\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+
+  fprintf(of, "void %s_token_iterator_init(%s_token_iterator *it,\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token *t,\n", parser_name);
+  fprintf(of, "  %s_token_order order);\n", parser_name);
+  fprintf(of, "%s_token *%s_token_iterator_next(%s_token_iterator *it);\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "int %s_token_iterator_get_depth(%s_token_iterator *it);\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+
+  fprintf(of, "%s_token_mark %s_token_arena_mark(void);\n",
+                parser_name, parser_name);
+  fprintf(of, "void %s_token_arena_rewind(%s_token_mark mark);\n",
+                parser_name, parser_name);
+  fprintf(of, "void %s_token_arena_release(void);\n", parser_name);
+  fprintf(of, "void %s_token_line_index_release(void);\n", parser_name);
+  if (_use_context)
+  {
+    fprintf(of, "int %s_token_source_index(%s_token_source *source, "
+                "long offset);\n",
+                  parser_name, parser_name);
+    fprintf(of, "void %s_token_source_drop(%s_token_source *source, "
+                "long offset);\n",
+                  parser_name, parser_name);
+    fprintf(of, "void %s_token_source_release(%s_token_source *source);\n",
+                  parser_name, parser_name);
+  }
+  if (_use_parallel)
+  {
+    fprintf(of, "void *%s_token_arena_detach(void);\n", parser_name);
+    fprintf(of, "void %s_token_arena_attach(void *arena);\n", parser_name);
+  }
+  fprintf(of, "\n");
+
+    // Emit close-out for header include guard
+
+  fprintf(of, "#endif // %s_TOKEN_H\n", u_parser_name);
+  fprintf(of, "\n");
+
+    // Clean up
+
+  free(u_parser_name);
+
+  return;
+}
+
+  /*!
+
+     \brief Generates \<PROJECT\>-token.c source code file.
+    
+     This function generates the source code for \<PROJECT\>-token.c\n
+     \n
+     The token source file contains:
+       - the definitions for several \<PROJECT\>_token management functions
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+
+  */
+
+void generate_token_source(FILE *of,
+                           char *parser_name)
+{
+  char *u_parser_name;   // Upper case version of parser name
+  char *fn;              // A generated file name for emitted documentation
+  char *tls;             // Storage class of module globals
+  char *lp;              // Prefix of line index values
+
+    // Sanity check parameters
+
+  if (!of)
+    of = stdout;
+
+  if (!parser_name)
+    return;
+
+    // Force parser name to upper case
+
+  u_parser_name = str_toupper(strdup(parser_name));
+
+    // Module globals are thread local when parser contexts are in use
+
+  tls = (_use_context) ? "THREAD_LOCAL " : "";
+  lp = (_use_context) ? "s->" : "_";
+
+    // Emit the file level comment block
+
+  fn = make_file_name(parser_name, "token.c");
+  generator_set_file_name(fn);
+  emit_source_comment_header(of);
+  free(fn);
+
+    // Emit file description comment block
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  if (_use_doxygen)
+  {
+    fprintf(of, "    @file %s-token.c\n", parser_name);
+    fprintf(of, "\n");
+  }
+  fprintf(of, "    This is the source code file for the %s grammar token and\n",
+                parser_name);
+  fprintf(of, "    token tree management functions module.\n");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for included header files
+
+  fprintf(of, "#include <stdlib.h>\n");
+  fprintf(of, "#include <string.h>\n");
+  fprintf(of, "\n");
+
+    // Emit code for extra library related header files
+
+  fprintf(of, "#include \"gray/strapp.h\"\n");
+  fprintf(of, "\n");
+
+    // Emit code for project related header files
+
+  fprintf(of, "#include \"%s-token.h\"\n", parser_name);
+  fprintf(of, "#include \"%s-token-util.h\"\n", parser_name);
+  fprintf(of, "\n");
+
+    // Emit code for module constants
+
+  fprintf(of, "#define FALSE 0\n");
+  fprintf(of, "#define TRUE 1\n");
+  fprintf(of, "\n");
+  fprintf(of, "#define %s_TOKEN_ARENA_BLOCK_SIZE 4096\n", u_parser_name);
+  fprintf(of, "#define %s_TOKEN_LINE_INDEX_SIZE 256\n", u_parser_name);
+  fprintf(of, "\n");
+
+    // Emit code for module types
+
+  fprintf(of, "typedef struct %s_token_arena_block\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  struct %s_token_arena_block *previous;\n", parser_name);
+  fprintf(of, "  long base;\n");
+  fprintf(of, "  long used;\n");
+  fprintf(of, "  %s_token tokens[%s_TOKEN_ARENA_BLOCK_SIZE];\n",
+                parser_name, u_parser_name);
+  fprintf(of, "} %s_token_arena_block;\n", parser_name);
+  fprintf(of, "\n");
+
+    // Emit code for thread local storage class, when parser contexts are in
+    // use, so that each thread allocates tokens from its own arena
+
+  if (_use_context)
+  {
+    fprintf(of, "#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= "
+                "201112L)\n");
+    fprintf(of, "#define THREAD_LOCAL _Thread_local\n");
+    fprintf(of, "#else\n");
+    fprintf(of, "#define THREAD_LOCAL __thread\n");
+    fprintf(of, "#endif\n");
+    fprintf(of, "\n");
+  }
+
+    // Emit code for module globals
+
+  fprintf(of, "static %s%s_token_arena_block *_arena = NULL;\n",
+                tls, parser_name);
+  fprintf(of, "static %s%s_token_arena_block *_arena_spare = NULL;\n",
+                tls, parser_name);
+  fprintf(of, "\n");
+  if (_use_context)
+    fprintf(of, "static %s%s_token_source _input_source;\n",
+                  tls, parser_name);
+  else
+  {
+    fprintf(of, "static %slong *_line_start = NULL;\n", tls);
+    fprintf(of, "static %slong _line_count = 0;\n", tls);
+    fprintf(of, "static %slong _line_size = 0;\n", tls);
+    fprintf(of, "static %slong _line_scanned = 0;\n", tls);
+  }
+  fprintf(of, "\n");
+
+    // Emit code for function declarations
+
+  if (_use_context)
+    fprintf(of, "static void read_input(%s_token *t, long offset, "
+                "long length, char *to);\n",
+                  parser_name);
+  else
+    fprintf(of, "static int extend_line_index(long offset);\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_new()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sCreate a new %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    The new token is allocated from the token arena.");
+  if (_use_context)
+    fprintf(of, "  Its input offset\n"
+                "    and source are left for the caller to set.");
+  fprintf(of, "\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sThis function returns a pointer to memory owned by "
+              "the token arena.\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "             This memory is reclaimed by "
+              "%s_token_arena_rewind() or\n",
+                parser_name);
+  fprintf(of, "             %s_token_arena_release().\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %stype %s_token_type\n",
+                (_use_doxygen) ? "@param " : "Parameters: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token *%s new %s_token\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "",
+                parser_name);
+  fprintf(of, "    %sNULL failure\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_new()
+
+  fprintf(of, "%s_token *%s_token_new(%s_token_type type)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token *new = NULL;\n",
+                parser_name);
+  fprintf(of, "  %s_token_arena_block *b;\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  if (!_arena || (_arena->used >= %s_TOKEN_ARENA_BLOCK_SIZE))\n",
+                u_parser_name);
+  fprintf(of, "  {\n");
+  fprintf(of, "    if (_arena_spare)\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      b = _arena_spare;\n");
+  fprintf(of, "      _arena_spare = b->previous;\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "    else\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      b = malloc(sizeof(%s_token_arena_block));\n",
+                parser_name);
+  fprintf(of, "      if (!b)\n");
+  fprintf(of, "        return NULL;\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "\n");
+  fprintf(of, "    b->previous = _arena;\n");
+  fprintf(of, "    b->base = (_arena) ? _arena->base + _arena->used : 0;\n");
+  fprintf(of, "    b->used = 0;\n");
+  fprintf(of, "    _arena = b;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  new = &(_arena->tokens[_arena->used++]);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  memset(new, 0, sizeof(%s_token));\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  new->type = type;\n");
+  fprintf(of, "\n");
+  if (!_use_context)
+  {
+    fprintf(of, "  new->offset = input_get_position();\n");
+    fprintf(of, "\n");
+  }
+  fprintf(of, "  return new;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_free()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sFree the memory associated with %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    Only the most recently allocated token is returned to "
+              "the token arena\n");
+  fprintf(of, "    immediately.  The memory of any other token is "
+              "reclaimed by\n");
+  fprintf(of, "    %s_token_arena_rewind() or %s_token_arena_release().\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sThis function does NOT perform any unlinking of "
+              "the freed token.\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "    %s%s_token_unlink()\n",
+                (_use_doxygen) ? "@sa " : "See: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_free()
+
+  fprintf(of, "void %s_token_free(%s_token *t)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (_arena && _arena->used &&\n");
+  fprintf(of, "      (t == &(_arena->tokens[_arena->used - 1])))\n");
+  fprintf(of, "    --_arena->used;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_add()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sLink %s_token into an existing token tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st   existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %sdir %s_token_direction\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "    %sn   %s_token * to link\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    When linking below, any tokens following n are linked "
+              "below t with it,\n");
+  fprintf(of, "    so a whole chain of siblings is attached in one step.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sTRUE  success\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "    %sFALSE failure\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_add()
+
+  fprintf(of, "unsigned char %s_token_add(%s_token *t, "
+              "%s_token_direction dir, "
+              "%s_token *n)\n",
+                parser_name, parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return FALSE;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!n)\n");
+  fprintf(of, "    return FALSE;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  switch (dir)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    case %s_token_before:\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "      n->previous = t->previous;\n");
+  fprintf(of, "      n->next = t;\n");
+  fprintf(of, "      if (t->previous)\n");
+  fprintf(of, "        t->previous->next = n;\n");
+  fprintf(of, "      t->previous = n;\n");
+  fprintf(of, "      n->ascendant = t->ascendant;\n");
+  fprintf(of, "\n");
+  fprintf(of, "        // Fix ascendant's descendant pointer, if it is t.\n");
+  fprintf(of, "        // We always want the ascendant's descendent pointer to "
+              "point to\n");
+  fprintf(of, "        //   the beginning of the list of descendents.\n");
+  fprintf(of, "\n");
+  fprintf(of, "      if (t->ascendant)\n");
+  fprintf(of, "        if (t->ascendant->descendant == t)\n");
+  fprintf(of, "          t->ascendant->descendant = n;\n");
+  fprintf(of, "\n");
+  fprintf(of, "      break;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    case %s_token_after:\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "      n->previous = t;\n");
+  fprintf(of, "      n->next = t->next;\n");
+  fprintf(of, "      if (t->next)\n");
+  fprintf(of, "        t->next->previous = n;\n");
+  fprintf(of, "      t->next = n;\n");
+  fprintf(of, "      n->ascendant = t->ascendant;\n");
+  fprintf(of, "\n");
+  fprintf(of, "      break;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    case %s_token_below:\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "      if (t->descendant)\n");
+  fprintf(of, "        return FALSE;\n");
+  fprintf(of, "      t->descendant = n;\n");
+  fprintf(of, "      for (; n; n = n->next)\n");
+  fprintf(of, "        n->ascendant = t;\n");
+  fprintf(of, "\n");
+  fprintf(of, "      break;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return TRUE;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_delete()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sDelete %s_token from an existing token tree, if any\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    This function unlinks %s_token from an existing token \n"
+              "    tree, if required.\n",
+                parser_name);
+  fprintf(of, "    Also, the memory associated with %s_token is freed.\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_delete()
+
+  fprintf(of, "void %s_token_delete(%s_token *t)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  while (t->descendant)\n");
+  fprintf(of, "    %s_token_delete(t->descendant);\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  %s_token_unlink(t);\n",
+                parser_name);
+  fprintf(of, "  %s_token_free(t);\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_unlink()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sUnlink %s_token from an existing token tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sThis function does NOT perform any freeing of "
+              "the unlinked token.\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "    %s%s_token_free()\n",
+                (_use_doxygen) ? "@sa " : "See: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_unlink()
+
+  fprintf(of, "void %s_token_unlink(%s_token *t)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (t->ascendant)\n");
+  fprintf(of, "    if (t->ascendant->descendant == t)\n");
+  fprintf(of, "      t->ascendant->descendant = t->next;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (t->previous)\n");
+  fprintf(of, "    t->previous->next = t->next;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (t->next)\n");
+  fprintf(of, "    t->next->previous = t->previous;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_get_type()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns %s_token_type of %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s_token_type\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_get_type()
+
+  fprintf(of, "%s_token_type %s_token_get_type(%s_token *t)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return %s_token_type_none;\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  return t->type;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_set_type()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sSets %s_token_type of %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st    %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %stype %s_token_type\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_set_type()
+
+  fprintf(of, "void %s_token_set_type(%s_token *t, %s_token_type type)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  t->type = type;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_get_ascendant()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns pointer to ascendant of %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token *%s\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_get_ascendant()
+
+  fprintf(of, "%s_token *%s_token_get_ascendant(%s_token *t)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return t->ascendant;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_set_ascendant()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sSets pointer to ascendant of %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %sa ascendant of %s_token *\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_set_ascendant()
+
+  fprintf(of, "void %s_token_set_ascendant(%s_token *t, %s_token *a)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  t->ascendant = a;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_get_descendant()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns pointer to descendant of %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token *%s\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_get_descendant()
+
+  fprintf(of, "%s_token *%s_token_get_descendant(%s_token *t)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return t->descendant;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_set_descendant()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sSets pointer to descendant of %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %sd descendant of %s_token *\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_set_descendant()
+
+  fprintf(of, "void %s_token_set_descendant(%s_token *t, %s_token *d)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  t->descendant = d;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_get_previous()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns pointer to previous %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token *%s\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_get_previous()
+
+  fprintf(of, "%s_token *%s_token_get_previous(%s_token *t)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return t->previous;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_set_previous()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sSets pointer to previous %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %sp previous %s_token *\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_set_previous()
+
+  fprintf(of, "void %s_token_set_previous(%s_token *t, %s_token *p)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  t->previous = p;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_get_next()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns pointer to next %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token *%s\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_get_next()
+
+  fprintf(of, "%s_token *%s_token_get_next(%s_token *t)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return t->next;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_set_next()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sSets pointer to next %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %sn next %s_token *\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_set_next()
+
+  fprintf(of, "void %s_token_set_next(%s_token *t, %s_token *n)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  t->next = n;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_get_offset()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns input offset of first byte matched by %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %slong offset\n", (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_get_offset()
+
+  fprintf(of, "long %s_token_get_offset(%s_token *t)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return t->offset;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_set_offset()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sSets input offset of first byte matched by %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %soffset long offset\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_set_offset()
+
+  fprintf(of, "void %s_token_set_offset(%s_token *t, long offset)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  t->offset = offset;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_get_length()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns count of input bytes matched by %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %slong length\n", (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_get_length()
+
+  fprintf(of, "long %s_token_get_length(%s_token *t)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return t->length;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_set_length()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sSets count of input bytes matched by %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %slength long length\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_set_length()
+
+  fprintf(of, "void %s_token_set_length(%s_token *t, long length)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  t->length = length;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit code for source accessors, when parser contexts are in use
+
+  if (_use_context)
+  {
+      // Emit comment block for <PROJECT>_token_get_source()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sReturns input bytes read back by %s_token\n",
+                  (_use_doxygen) ? "@brief " : "",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "    %st %s_token *\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "    %s%s%s_token_source *%s source, NULL for the input "
+                "source\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ",
+                  (_use_doxygen) ? "\"" : "",
+                  parser_name,
+                  (_use_doxygen) ? "\"" : "");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for <PROJECT>_token_get_source()
+
+    fprintf(of, "%s_token_source *%s_token_get_source(%s_token *t)\n",
+                  parser_name, parser_name, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  if (!t)\n");
+    fprintf(of, "    return NULL;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return t->source;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+
+      // Emit comment block for <PROJECT>_token_set_source()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sSets input bytes read back by %s_token\n",
+                  (_use_doxygen) ? "@brief " : "",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "    The text and location of the token are read from the "
+                "source, which\n");
+    fprintf(of, "    must be kept until they are no longer used.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %st      existing %s_token *\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "    %ssource %s_token_source *, NULL for the input source\n",
+                  (_use_doxygen) ? "@param " : "       ",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for <PROJECT>_token_set_source()
+
+    fprintf(of, "void %s_token_set_source(%s_token *t, %s_token_source "
+                "*source)\n",
+                  parser_name, parser_name, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  if (!t)\n");
+    fprintf(of, "    return;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  t->source = source;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
+
+    // Emit comment block for <PROJECT>_token_get_location()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sGets line + offset location of %s_token in input source\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    The location is not stored in the token.  It is computed "
+              "from the\n");
+  fprintf(of, "    token's input offset using an index of line starts, which "
+              "is built\n");
+  if (_use_context)
+    fprintf(of, "    from the input bytes of the token the first time a "
+                "location is asked\n"
+                "    for, and");
+  else
+    fprintf(of, "    from the input source the first time a location is asked "
+                "for, and");
+  fprintf(of, "\n");
+  fprintf(of, "    extended as later tokens require.  Lines are numbered from "
+              "1, and the\n");
+  fprintf(of, "    character offset is the count of bytes preceding the token "
+              "on its\n");
+  fprintf(of, "    line.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %st        existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %slocation input_location * to receive the location\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_get_location()
+
+  fprintf(of, "void %s_token_get_location(%s_token *t, input_location "
+              "*location)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  if (_use_context)
+    fprintf(of, "  %s_token_source *s;\n", parser_name);
+  fprintf(of, "  long lo;\n");
+  fprintf(of, "  long hi;\n");
+  fprintf(of, "  long mid;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!location)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  location->line_number = 0;\n");
+  fprintf(of, "  location->character_offset = 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  if (_use_context)
+  {
+    fprintf(of, "  s = (t->source) ? t->source : &_input_source;\n");
+    fprintf(of, "  if (!%s_token_source_index(s, t->offset))\n", parser_name);
+  }
+  else
+    fprintf(of, "  if (!extend_line_index(t->offset))\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  lo = 0;\n");
+  fprintf(of, "  hi = %sline_count - 1;\n", lp);
+  fprintf(of, "  while (lo < hi)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    mid = (lo + hi + 1) / 2;\n");
+  fprintf(of, "    if (%sline_start[mid] <= t->offset)\n", lp);
+  fprintf(of, "      lo = mid;\n");
+  fprintf(of, "    else\n");
+  fprintf(of, "      hi = mid - 1;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  if (_use_context)
+    fprintf(of, "  location->line_number = s->line_dropped + lo + 1;\n");
+  else
+    fprintf(of, "  location->line_number = lo + 1;\n");
+  fprintf(of, "  location->character_offset = t->offset - %sline_start[lo];\n",
+                lp);
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_iterator_init()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sInitialize a %s_token_iterator\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    A pre-order or post-order walk visits t, its descendants, "
+              "and then each\n");
+  fprintf(of, "    following sibling of t along with its descendants, in the "
+              "same order\n");
+  fprintf(of, "    as the %s_token tree would be walked recursively.  A "
+              "children walk\n",
+                parser_name);
+  fprintf(of, "    visits only the direct descendants of t.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    The walk follows the ascendant links set by %s_token_add(), "
+              "so it\n",
+                parser_name);
+  fprintf(of, "    needs no stack, and its memory use does not depend on the "
+              "depth or\n");
+  fprintf(of, "    the width of the tree.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sThe tree must not be changed while it is being walked.\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "\n");
+  fprintf(of, "    %sit    %s_token_iterator * to initialize\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %st     %s_token * to start the walk from\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "    %sorder %s_token_order\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_iterator_init()
+
+  fprintf(of, "void %s_token_iterator_init(%s_token_iterator *it,\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token *t,\n", parser_name);
+  fprintf(of, "  %s_token_order order)\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!it)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  it->order = order;\n");
+  fprintf(of, "  it->first = t;\n");
+  fprintf(of, "  it->current = NULL;\n");
+  fprintf(of, "  it->depth = 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_iterator_next()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns next %s_token of a walk\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sit existing %s_token_iterator *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token *%s next token\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "    %sNULL walk is complete\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_iterator_next()
+
+  fprintf(of, "%s_token *%s_token_iterator_next(%s_token_iterator *it)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token *t;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  if (!it)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  t = it->current;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  switch (it->order)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    case %s_token_pre_order:\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "      if (it->first)\n");
+  fprintf(of, "        t = it->first;\n");
+  fprintf(of, "      else if (t && t->descendant)\n");
+  fprintf(of, "      {\n");
+  fprintf(of, "        t = t->descendant;\n");
+  fprintf(of, "        ++it->depth;\n");
+  fprintf(of, "      }\n");
+  fprintf(of, "      else\n");
+  fprintf(of, "      {\n");
+  fprintf(of, "        while (t && !t->next && (it->depth > 0))\n");
+  fprintf(of, "        {\n");
+  fprintf(of, "          t = t->ascendant;\n");
+  fprintf(of, "          --it->depth;\n");
+  fprintf(of, "        }\n");
+  fprintf(of, "        t = (t) ? t->next : NULL;\n");
+  fprintf(of, "      }\n");
+  fprintf(of, "\n");
+  fprintf(of, "      break;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    case %s_token_post_order:\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "      if (it->first)\n");
+  fprintf(of, "        t = it->first;\n");
+  fprintf(of, "      else if (t && t->next)\n");
+  fprintf(of, "        t = t->next;\n");
+  fprintf(of, "      else if (t && (it->depth > 0))\n");
+  fprintf(of, "      {\n");
+  fprintf(of, "        t = t->ascendant;\n");
+  fprintf(of, "        --it->depth;\n");
+  fprintf(of, "        break;\n");
+  fprintf(of, "      }\n");
+  fprintf(of, "      else\n");
+  fprintf(of, "      {\n");
+  fprintf(of, "        t = NULL;\n");
+  fprintf(of, "        break;\n");
+  fprintf(of, "      }\n");
+  fprintf(of, "\n");
+  fprintf(of, "        // Descend to the first leaf below t\n");
+  fprintf(of, "\n");
+  fprintf(of, "      while (t && t->descendant)\n");
+  fprintf(of, "      {\n");
+  fprintf(of, "        t = t->descendant;\n");
+  fprintf(of, "        ++it->depth;\n");
+  fprintf(of, "      }\n");
+  fprintf(of, "\n");
+  fprintf(of, "      break;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    case %s_token_children:\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "      if (it->first)\n");
+  fprintf(of, "      {\n");
+  fprintf(of, "        t = it->first->descendant;\n");
+  fprintf(of, "        it->depth = 1;\n");
+  fprintf(of, "      }\n");
+  fprintf(of, "      else\n");
+  fprintf(of, "        t = (t) ? t->next : NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "      break;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  it->first = NULL;\n");
+  fprintf(of, "  it->current = t;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return t;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_iterator_get_depth()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns depth of the current %s_token of a walk\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    The token a walk starts from, and its siblings, are at "
+              "depth 0.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sit existing %s_token_iterator *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sint depth below the first token\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_iterator_get_depth()
+
+  fprintf(of, "int %s_token_iterator_get_depth(%s_token_iterator *it)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!it)\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return it->depth;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_find_next()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sFind next %s_token of specified %s_token_type\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st    existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %stype %s_token_type\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token *%s found %s_token\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "",
+                parser_name);
+  fprintf(of, "    %sNULL failure, including NOT FOUND\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_find_next()
+
+  fprintf(of, "%s_token *%s_token_find(%s_token *t, %s_token_type type)\n",
+                parser_name, parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_iterator it;\n", parser_name);
+  fprintf(of, "  %s_token *f;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  %s_token_iterator_init(&it, t, %s_token_pre_order);\n",
+                parser_name, parser_name);
+  fprintf(of, "  while ((f = %s_token_iterator_next(&it)))\n", parser_name);
+  fprintf(of, "    if (f->type == type)\n");
+  fprintf(of, "      return f;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return NULL;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_find_child()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sFind first child %s_token of specified %s_token_type\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    Unlike %s_token_find(), only the direct descendants of t "
+              "are\n",
+                parser_name);
+  fprintf(of, "    searched, so the cost is bounded by the number of children "
+              "of t.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %st    existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %stype %s_token_type\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token *%s found %s_token\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "",
+                parser_name);
+  fprintf(of, "    %sNULL failure, including NOT FOUND\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_find_child()
+
+  fprintf(of, "%s_token *%s_token_find_child(%s_token *t, "
+              "%s_token_type type)\n",
+                parser_name, parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token *c;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  for (c = t->descendant; c; c = c->next)\n");
+  fprintf(of, "    if (c->type == type)\n");
+  fprintf(of, "      return c;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return NULL;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_find_within()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sFind %s_token of specified %s_token_type below a token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    The descendants of t are searched in pre-order, but no "
+              "deeper than\n");
+  fprintf(of, "    depth levels below t.  A depth of 1 searches only the "
+              "children of t,\n");
+  fprintf(of, "    and a depth of 0 or less searches the whole subtree of t.  "
+              "Neither t\n");
+  fprintf(of, "    nor its siblings are searched.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %st     existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %stype  %s_token_type\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "    %sdepth int maximum depth below t\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token *%s found %s_token\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "",
+                parser_name);
+  fprintf(of, "    %sNULL failure, including NOT FOUND\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_find_within()
+
+  fprintf(of, "%s_token *%s_token_find_within(%s_token *t,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_type type,\n", parser_name);
+  fprintf(of, "  int depth)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token *p;\n", parser_name);
+  fprintf(of, "  int d;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  d = 1;\n");
+  fprintf(of, "  p = t->descendant;\n");
+  fprintf(of, "  while (p)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    if (p->type == type)\n");
+  fprintf(of, "      return p;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    if (p->descendant && ((depth <= 0) || (d < depth)))\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      p = p->descendant;\n");
+  fprintf(of, "      ++d;\n");
+  fprintf(of, "      continue;\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "\n");
+  fprintf(of, "    while (!p->next && (d > 1))\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      p = p->ascendant;\n");
+  fprintf(of, "      --d;\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "    p = p->next;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return NULL;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_to_string()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns string representation of %s_token\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    The text of each leaf token is read from the input source "
+              "span it\n");
+  fprintf(of, "    matched.  The text is measured first, so s is grown only "
+              "once.\n");
+  fprintf(of, "    %s%s_token_span_to_string(), %s_token_to_buffer()\n",
+                (_use_doxygen) ? "@sa " : "See: ",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sParameter s can NOT point to static memory.\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "\n");
+  fprintf(of, "    %sThis function returns a pointer to dynamically "
+              "allocated memory.\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "             It is the caller's responsibility to free this "
+              "memory when\n");
+  fprintf(of, "             appropriate.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %st existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %ss char * of existing string, can be NULL\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%schar *%s string, can be NULL if s is NULL\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_to_string()
+
+  fprintf(of, "char *%s_token_to_string(%s_token *t, char *s)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  char *ns;\n");
+  fprintf(of, "  long used;\n");
+  fprintf(of, "  long length;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return s;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    // Size the string once, then fill it in place\n");
+  fprintf(of, "\n");
+  fprintf(of, "  length = %s_token_to_buffer(t, NULL, 0);\n", parser_name);
+  fprintf(of, "  used = (s) ? strlen(s) : 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  ns = realloc(s, used + length + 1);\n");
+  fprintf(of, "  if (!ns)\n");
+  fprintf(of, "    return s;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  %s_token_to_buffer(t, ns + used, length + 1);\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  return ns;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_to_buffer()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sWrites string representation of %s_token to a buffer\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    The text is the same as from %s_token_to_string(), but it "
+              "is written\n",
+                parser_name);
+  fprintf(of, "    into a caller provided buffer.  At most size - 1 bytes of "
+              "text are\n");
+  fprintf(of, "    written, followed by a terminating NUL byte.  Calling this "
+              "function\n");
+  fprintf(of, "    with a NULL buffer only measures the text, so a buffer of "
+              "the right\n");
+  fprintf(of, "    size can be allocated before it is filled.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %st      existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %sbuffer char * to receive the text, can be NULL\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "    %ssize   long size of buffer in bytes\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "    %slong length of the complete text, not counting the NUL "
+              "byte\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_to_buffer()
+
+  fprintf(of, "long %s_token_to_buffer(%s_token *t, char *buffer, long size)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_iterator it;\n", parser_name);
+  fprintf(of, "  %s_token *l;\n", parser_name);
+  fprintf(of, "  char *name;\n");
+  fprintf(of, "  long length;\n");
+  fprintf(of, "  long room;\n");
+  if (!_use_context)
+    fprintf(of, "  long pos;\n");
+  fprintf(of, "  long n;\n");
+  if (!_use_context)
+    fprintf(of, "  long i;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  length = 0;\n");
+  if (!_use_context)
+    fprintf(of, "  pos = input_get_position();\n");
+  fprintf(of, "\n");
+  fprintf(of, "  %s_token_iterator_init(&it, t, %s_token_pre_order);\n",
+                parser_name, parser_name);
+  fprintf(of, "  while ((l = %s_token_iterator_next(&it)))\n", parser_name);
+  fprintf(of, "  {\n");
+  fprintf(of, "    if (l->descendant)\n");
+  fprintf(of, "      continue;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    room = (buffer && (size - 1 > length)) ? size - 1 - length "
+              ": 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    if (l->length > 0)\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      n = l->length;\n");
+  fprintf(of, "      if (room > 0)\n");
+  if (_use_context)
+    fprintf(of, "        read_input(l, l->offset, (n < room) ? n : room, "
+                "buffer + length);\n");
+  else
+  {
+    fprintf(of, "      {\n");
+    fprintf(of, "        input_set_position(l->offset);\n");
+    fprintf(of, "        for (i = 0; (i < n) && (i < room); ++i)\n");
+    fprintf(of, "          buffer[length + i] = input_byte();\n");
+    fprintf(of, "      }\n");
+  }
+  fprintf(of, "    }\n");
+  fprintf(of, "    else\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      name = %s_token_type_to_string(l);\n", parser_name);
+  fprintf(of, "      n = strlen(name);\n");
+  fprintf(of, "      if (room > 0)\n");
+  fprintf(of, "        memcpy(buffer + length, name, (n < room) ? n : room);\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "\n");
+  fprintf(of, "    length += n;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  if (!_use_context)
+  {
+    fprintf(of, "  input_set_position(pos);\n");
+    fprintf(of, "\n");
+  }
+  fprintf(of, "  if (buffer && (size > 0))\n");
+  fprintf(of, "    buffer[(length < size) ? length : size - 1] = 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return length;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_span_to_string()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sAppends the input text matched by %s_token to a string\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  if (_use_context)
+  {
+    fprintf(of, "    The text is read back from the input bytes of the token "
+                "using the\n");
+    fprintf(of, "    offset and length recorded in it, therefore the parser "
+                "context it was\n");
+    fprintf(of, "    parsed with must not have been deleted.  Unlike "
+                "%s_token_to_string(),\n",
+                  parser_name);
+    fprintf(of, "    neither the descendants nor the siblings of the token are "
+                "visited.\n");
+  }
+  else
+  {
+    fprintf(of, "    The text is read back from the input source using the "
+                "offset and\n");
+    fprintf(of, "    length recorded in the token, therefore the input source "
+                "must not\n");
+    fprintf(of, "    have been cleaned up.  Unlike %s_token_to_string(), "
+                "neither the\n",
+                  parser_name);
+    fprintf(of, "    descendants nor the siblings of the token are "
+                "visited.\n");
+  }
+  fprintf(of, "\n");
+  fprintf(of, "    %sThis function returns a pointer to dynamically allocated "
+              "memory.\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "             It is the caller's responsibility to free this "
+              "memory when\n");
+  fprintf(of, "             appropriate.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %st existing %s_token *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %ss char * of existing string, can be NULL\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "    %s%schar *%s string, can be NULL if s is NULL\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_span_to_string()
+
+  fprintf(of, "char *%s_token_span_to_string(%s_token *t, char *s)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  char *ns;\n");
+  fprintf(of, "  long used;\n");
+  if (!_use_context)
+  {
+    fprintf(of, "  long pos;\n");
+    fprintf(of, "  long i;\n");
+  }
+  fprintf(of, "\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return s;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (t->length <= 0)\n");
+  fprintf(of, "    return s;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  used = (s) ? strlen(s) : 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  ns = realloc(s, used + t->length + 1);\n");
+  fprintf(of, "  if (!ns)\n");
+  fprintf(of, "    return s;\n");
+  fprintf(of, "\n");
+  if (_use_context)
+  {
+    fprintf(of, "  read_input(t, t->offset, t->length, ns + used);\n");
+    fprintf(of, "  ns[used + t->length] = 0;\n");
+  }
+  else
+  {
+    fprintf(of, "  pos = input_get_position();\n");
+    fprintf(of, "  input_set_position(t->offset);\n");
+    fprintf(of, "  for (i = 0; i < t->length; ++i)\n");
+    fprintf(of, "    ns[used + i] = input_byte();\n");
+    fprintf(of, "  ns[used + i] = 0;\n");
+    fprintf(of, "  input_set_position(pos);\n");
+  }
+  fprintf(of, "\n");
+  fprintf(of, "  return ns;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_arena_mark()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sMark the current allocation point of the token arena\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    The returned mark can later be given to "
+              "%s_token_arena_rewind()\n",
+                parser_name);
+  fprintf(of, "    to reclaim, in one step, every token allocated after the "
+              "mark was\n");
+  fprintf(of, "    taken.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token_mark%s current allocation point\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_arena_mark()
+
+  fprintf(of, "%s_token_mark %s_token_arena_mark(void)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_mark mark;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  mark.block = _arena;\n");
+  fprintf(of, "  mark.used = (_arena) ? _arena->used : 0;\n");
+  fprintf(of, "  mark.index = (_arena) ? _arena->base + _arena->used : 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return mark;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_arena_rewind()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sRewind the token arena to a previously taken mark\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    Every token allocated after the mark was taken is "
+              "reclaimed.  Blocks\n");
+  fprintf(of, "    emptied by the rewind are kept for reuse by "
+              "%s_token_new().\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sAny pointer to a token allocated after the mark was "
+              "taken\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "             is invalid after this call.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %smark %s_token_mark from %s_token_arena_mark()\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_arena_rewind()
+
+  fprintf(of, "void %s_token_arena_rewind(%s_token_mark mark)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_arena_block *b;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  while (_arena && (_arena != mark.block))\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    b = _arena;\n");
+  fprintf(of, "    _arena = b->previous;\n");
+  fprintf(of, "    b->previous = _arena_spare;\n");
+  fprintf(of, "    _arena_spare = b;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (_arena)\n");
+  fprintf(of, "    _arena->used = mark.used;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_arena_release()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sRelease all memory held by the token arena\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    This frees every token, and therefore every token tree, at "
+              "once.\n");
+  fprintf(of, "    The line start index used by %s_token_get_location() is "
+              "discarded\n",
+                parser_name);
+  fprintf(of, "    as well, by %s_token_line_index_release().\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sAny pointer to a token is invalid after this call.\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_arena_release()
+
+  fprintf(of, "void %s_token_arena_release(void)\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_arena_block *b;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  while (_arena)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    b = _arena;\n");
+  fprintf(of, "    _arena = b->previous;\n");
+  fprintf(of, "    free(b);\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  while (_arena_spare)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    b = _arena_spare;\n");
+  fprintf(of, "    _arena_spare = b->previous;\n");
+  fprintf(of, "    free(b);\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  %s_token_line_index_release();\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_line_index_release()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sDiscard the line start index\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    The index used by %s_token_get_location() is built "
+              "lazily from the\n",
+                parser_name);
+  fprintf(of, "    input source, so it must be discarded whenever a different "
+              "input is\n");
+  if (_use_context)
+    fprintf(of, "    parsed.  Tokens parsed with a parser context use the "
+                "index of their\n"
+                "    own input bytes instead.\n");
+  else
+    fprintf(of, "    parsed.  %s_input_initialize() does so.\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_line_index_release()
+
+  fprintf(of, "void %s_token_line_index_release(void)\n", parser_name);
+  fprintf(of, "{\n");
+  if (_use_context)
+    fprintf(of, "  %s_token_source_release(&_input_source);\n", parser_name);
+  else
+  {
+    fprintf(of, "  free(_line_start);\n");
+    fprintf(of, "  _line_start = NULL;\n");
+    fprintf(of, "  _line_count = 0;\n");
+    fprintf(of, "  _line_size = 0;\n");
+    fprintf(of, "  _line_scanned = 0;\n");
+  }
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+  if (_use_parallel)
+  {
+      // Emit comment block for <PROJECT>_token_arena_detach()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sDetach the token arena of the calling thread\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    The blocks holding every token allocated by the calling "
+                "thread are\n");
+    fprintf(of, "    handed over to the caller, to be given to "
+                "%s_token_arena_attach() in\n",
+                  parser_name);
+    fprintf(of, "    the same or another thread, and the thread is left with "
+                "an empty\n");
+    fprintf(of, "    arena.  Blocks kept for reuse are freed.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %s\"void *\" detached arena blocks, or NULL if there are "
+                "none\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for <PROJECT>_token_arena_detach()
+
+    fprintf(of, "void *%s_token_arena_detach(void)\n", parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  %s_token_arena_block *b;\n", parser_name);
+    fprintf(of, "  void *arena = _arena;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  while (_arena_spare)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    b = _arena_spare;\n");
+    fprintf(of, "    _arena_spare = b->previous;\n");
+    fprintf(of, "    free(b);\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  _arena = NULL;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return arena;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+
+      // Emit comment block for <PROJECT>_token_arena_attach()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sAttach detached arena blocks to the token arena of the "
+                "calling\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "    thread\n");
+    fprintf(of, "\n");
+    fprintf(of, "    The tokens held by the blocks become part of the arena, "
+                "and are freed\n");
+    fprintf(of, "    with it by %s_token_arena_release(), or by\n",
+                  parser_name);
+    fprintf(of, "    %s_token_arena_rewind() to a mark taken before the "
+                "attach.\n",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "    %sarena blocks from %s_token_arena_detach(), or NULL\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for <PROJECT>_token_arena_attach()
+
+    fprintf(of, "void %s_token_arena_attach(void *arena)\n", parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  %s_token_arena_block *b;\n", parser_name);
+    fprintf(of, "  long index;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!(b = arena))\n");
+    fprintf(of, "    return;\n");
+    fprintf(of, "\n");
+    fprintf(of, "    // The attached tokens are indexed after those already in "
+                "the arena\n");
+    fprintf(of, "\n");
+    fprintf(of, "  index = (_arena) ? _arena->base + _arena->used : 0;\n");
+    fprintf(of, "  for (; b; b = b->previous)\n");
+    fprintf(of, "    index += b->used;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  for (b = arena; ; b = b->previous)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    index -= b->used;\n");
+    fprintf(of, "    b->base = index;\n");
+    fprintf(of, "    if (!b->previous)\n");
+    fprintf(of, "      break;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "  b->previous = _arena;\n");
+    fprintf(of, "  _arena = arena;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
+
+  if (_use_context)
+  {
+      // Emit comment block for <PROJECT>_token_source_index()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sExtends the line start index of input bytes to cover an "
+                "offset\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    Every input byte before offset, not already scanned, is "
+                "read from the\n");
+    fprintf(of, "    source, and the offset of each line following a newline "
+                "is appended\n");
+    fprintf(of, "    to its index.  The input source is read when the source "
+                "holds no\n");
+    fprintf(of, "    bytes, and the input position is restored afterwards.  "
+                "Bytes must be\n");
+    fprintf(of, "    scanned before they are dropped from the source.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %ssource %s_token_source * of input bytes\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "    %soffset long input offset to cover\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "\n");
+    fprintf(of, "    %sTRUE  index covers offset\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "    %sFALSE out of memory, or bytes before offset were "
+                "dropped\n",
+                  (_use_doxygen) ? "@retval " : "         ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for <PROJECT>_token_source_index()
+
+    fprintf(of, "int %s_token_source_index(%s_token_source *source, long "
+                "offset)\n",
+                  parser_name, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  long *ls;\n");
+    fprintf(of, "  long pos = 0;\n");
+    fprintf(of, "  byte b;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!source->line_start)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    source->line_start = malloc(%s_TOKEN_LINE_INDEX_SIZE *\n",
+                  u_parser_name);
+    fprintf(of, "                                sizeof(long));\n");
+    fprintf(of, "    if (!source->line_start)\n");
+    fprintf(of, "      return FALSE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "    source->line_size = %s_TOKEN_LINE_INDEX_SIZE;\n",
+                  u_parser_name);
+    fprintf(of, "    source->line_start[0] = 0;\n");
+    fprintf(of, "    source->line_count = 1;\n");
+    fprintf(of, "    source->line_scanned = 0;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (offset <= source->line_scanned)\n");
+    fprintf(of, "    return TRUE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (source->buffer && (source->line_scanned < "
+                "source->base))\n");
+    fprintf(of, "    return FALSE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!source->buffer)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    pos = input_get_position();\n");
+    fprintf(of, "    input_set_position(source->line_scanned);\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  while ((source->line_scanned < offset) &&\n");
+    fprintf(of, "         ((source->buffer) ? (source->line_scanned < "
+                "source->length)\n");
+    fprintf(of, "                           : !input_eof()))\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    if (source->buffer)\n");
+    fprintf(of, "      b = source->buffer[source->line_scanned - "
+                "source->base];\n");
+    fprintf(of, "    else\n");
+    fprintf(of, "      b = input_byte();\n");
+    fprintf(of, "    ++source->line_scanned;\n");
+    fprintf(of, "\n");
+    fprintf(of, "    if (b != '\\n')\n");
+    fprintf(of, "      continue;\n");
+    fprintf(of, "\n");
+    fprintf(of, "    if (source->line_count >= source->line_size)\n");
+    fprintf(of, "    {\n");
+    fprintf(of, "      ls = realloc(source->line_start,\n");
+    fprintf(of, "                   2 * source->line_size * sizeof(long));\n");
+    fprintf(of, "      if (!ls)\n");
+    fprintf(of, "      {\n");
+    fprintf(of, "        --source->line_scanned;\n");
+    fprintf(of, "        if (!source->buffer)\n");
+    fprintf(of, "          input_set_position(pos);\n");
+    fprintf(of, "        return FALSE;\n");
+    fprintf(of, "      }\n");
+    fprintf(of, "\n");
+    fprintf(of, "      source->line_start = ls;\n");
+    fprintf(of, "      source->line_size *= 2;\n");
+    fprintf(of, "    }\n");
+    fprintf(of, "\n");
+    fprintf(of, "    source->line_start[source->line_count++] = "
+                "source->line_scanned;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!source->buffer)\n");
+    fprintf(of, "    input_set_position(pos);\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return TRUE;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+
+      // Emit comment block for <PROJECT>_token_source_drop()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sDrop the input bytes before an offset from a source\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    The line start index is first extended to the offset, and "
+                "then only\n");
+    fprintf(of, "    the start of the line holding the offset is kept in it, "
+                "so that the\n");
+    fprintf(of, "    locations of tokens following the offset are still found "
+                "while the\n");
+    fprintf(of, "    index does not grow with the input.  The caller moves the "
+                "bytes\n");
+    fprintf(of, "    themselves.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %ssource %s_token_source * of input bytes\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "    %soffset long input offset of first byte kept\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for <PROJECT>_token_source_drop()
+
+    fprintf(of, "void %s_token_source_drop(%s_token_source *source, long "
+                "offset)\n",
+                  parser_name, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  long last;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!source || (offset <= source->base))\n");
+    fprintf(of, "    return;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (%s_token_source_index(source, offset))\n", parser_name);
+    fprintf(of, "  {\n");
+    fprintf(of, "    last = source->line_count - 1;\n");
+    fprintf(of, "    source->line_start[0] = source->line_start[last];\n");
+    fprintf(of, "    source->line_dropped += last;\n");
+    fprintf(of, "    source->line_count = 1;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  source->base = offset;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+
+      // Emit comment block for <PROJECT>_token_source_release()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sDiscard the line start index of input bytes\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    The input bytes themselves are not freed.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %ssource %s_token_source * of input bytes\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for <PROJECT>_token_source_release()
+
+    fprintf(of, "void %s_token_source_release(%s_token_source *source)\n",
+                  parser_name, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  if (!source)\n");
+    fprintf(of, "    return;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  free(source->line_start);\n");
+    fprintf(of, "  source->line_start = NULL;\n");
+    fprintf(of, "  source->line_count = 0;\n");
+    fprintf(of, "  source->line_size = 0;\n");
+    fprintf(of, "  source->line_scanned = 0;\n");
+    fprintf(of, "  source->line_dropped = 0;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+
+      // Emit comment block for read_input()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sCopies input bytes read back by a token\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    The bytes are read from the source of the token, or from "
+                "the input\n");
+    fprintf(of, "    source when the token has none, in which case the input "
+                "position is\n");
+    fprintf(of, "    restored afterwards.  Bytes no longer held by the source "
+                "are copied\n");
+    fprintf(of, "    as NUL bytes.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %st      existing %s_token *\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "    %soffset long input offset of first byte\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "    %slength long count of bytes\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "    %sto     char * to receive the bytes\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for read_input()
+
+    fprintf(of, "static void read_input(%s_token *t, long offset, long length, "
+                "char *to)\n",
+                  parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  %s_token_source *s = t->source;\n", parser_name);
+    fprintf(of, "  long pos;\n");
+    fprintf(of, "  long i;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!s)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    pos = input_get_position();\n");
+    fprintf(of, "    input_set_position(offset);\n");
+    fprintf(of, "    for (i = 0; i < length; ++i)\n");
+    fprintf(of, "      to[i] = input_byte();\n");
+    fprintf(of, "    input_set_position(pos);\n");
+    fprintf(of, "    return;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  for (i = 0; i < length; ++i, ++offset)\n");
+    fprintf(of, "    to[i] = ((offset >= s->base) && (offset < s->length)) "
+                "?\n");
+    fprintf(of, "              s->buffer[offset - s->base] : 0;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
+  else
+  {
+      // Emit comment block for extend_line_index()
+
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sExtends the line start index to cover an input offset\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    Every input byte before offset, not already scanned, is "
+                "read from the\n");
+    fprintf(of, "    input source, and the offset of each line following a "
+                "newline is\n");
+    fprintf(of, "    appended to the index.  The input position is restored "
+                "afterwards.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %soffset long input offset to cover\n",
+                  (_use_doxygen) ? "@param " : "Param: ");
+    fprintf(of, "\n");
+    fprintf(of, "    %sTRUE  index covers offset\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "    %sFALSE out of memory\n",
+                  (_use_doxygen) ? "@retval " : "         ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for extend_line_index()
+
+    fprintf(of, "static int extend_line_index(long offset)\n");
+    fprintf(of, "{\n");
+    fprintf(of, "  long *ls;\n");
+    fprintf(of, "  long pos;\n");
+    fprintf(of, "  byte b;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!_line_start)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    _line_start = malloc(%s_TOKEN_LINE_INDEX_SIZE * "
+                "sizeof(long));\n",
+                  u_parser_name);
+    fprintf(of, "    if (!_line_start)\n");
+    fprintf(of, "      return FALSE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "    _line_size = %s_TOKEN_LINE_INDEX_SIZE;\n", u_parser_name);
+    fprintf(of, "    _line_start[0] = 0;\n");
+    fprintf(of, "    _line_count = 1;\n");
+    fprintf(of, "    _line_scanned = 0;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (offset <= _line_scanned)\n");
+    fprintf(of, "    return TRUE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  pos = input_get_position();\n");
+    fprintf(of, "  input_set_position(_line_scanned);\n");
+    fprintf(of, "\n");
+    fprintf(of, "  while ((_line_scanned < offset) && !input_eof())\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    b = input_byte();\n");
+    fprintf(of, "    ++_line_scanned;\n");
+    fprintf(of, "\n");
+    fprintf(of, "    if (b != '\\n')\n");
+    fprintf(of, "      continue;\n");
+    fprintf(of, "\n");
+    fprintf(of, "    if (_line_count >= _line_size)\n");
+    fprintf(of, "    {\n");
+    fprintf(of, "      ls = realloc(_line_start, 2 * _line_size * "
+                "sizeof(long));\n");
+    fprintf(of, "      if (!ls)\n");
+    fprintf(of, "      {\n");
+    fprintf(of, "        input_set_position(pos);\n");
+    fprintf(of, "        return FALSE;\n");
+    fprintf(of, "      }\n");
+    fprintf(of, "\n");
+    fprintf(of, "      _line_start = ls;\n");
+    fprintf(of, "      _line_size *= 2;\n");
+    fprintf(of, "    }\n");
+    fprintf(of, "\n");
+    fprintf(of, "    _line_start[_line_count++] = _line_scanned;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  input_set_position(pos);\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return TRUE;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
+
+    // Clean up
+
+  free(u_parser_name);
+
+  return;
+}
+
+  /*!
+
+     \brief Generates \<PROJECT\>-token-type.h source code file.
+    
+     This function generates the source code for \<PROJECT\>-token-type.h\n
+     \n
+     The token type header file contains an enum typedef for the
+     \<PROJECT\>_token_type values.  A token type is defined for each phrase
+     defined in the parsed EGG grammar.
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the root token from which
+                        the source code is generated
+
+  */
+
+void generate_token_type_header(FILE *of,
+                                char *parser_name,
+                                egg_token *t)
+{
+  egg_token *ge, *p, *pn;
+  char *hn;
+  int hnl;
+  char *pns;
+  char *fn;
+  char *last = NULL;     // Identifier of the last phrase token type
+  char *u_parser_name;   // Upper case version of parser name
+
+    // Sanity check parameters
+
+  if (!of)
+    of = stdout;
+
+  if (!parser_name)
+    return;
+
+  if (!t)
+    return;
+
+    // Create header guard macro name
+
+  hnl = strlen(parser_name) + strlen("_token_type_h") + 1;
+  hn = malloc(hnl);
+  memset(hn, 0, hnl);
+
+  sprintf(hn, "%s_token_type_h", parser_name);
+
+    // Force header guard macro to uppercase
+
+  hn = str_toupper(hn);
+
+    // Emit the file level comment block
+
+  fn = make_file_name(parser_name, "token-type.h");
+  generator_set_file_name(fn);
+  emit_source_comment_header(of);
+  free(fn);
+
+    // Emit file description comment block
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  if (_use_doxygen)
+  {
+    fprintf(of, "    @file %s-token-type.h\n", parser_name);
+    fprintf(of, "\n");
+  }
+  fprintf(of, "    This is the header file for the %s grammar token type "
+              "definitions\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    Each %s grammar phrase has an associated token type\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit header include guard
+
+  fprintf(of, "#ifndef %s\n", hn);
+  fprintf(of, "#define %s\n", hn);
+  fprintf(of, "\n");
+
+    // Emit <PROJECT>_token_type annotation
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "    %sDefinition of allowed token types for %s_token.\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit <PROJECT>_token_direction enum
+
+  fprintf(of, "typedef enum\n");
+  fprintf(of, "{\n");
+
+  if ((ge = egg_token_find_child(t, egg_token_type_grammar_element)))
+  {
+      // Emit special token type, none
+
+    fprintf(of, "    /*%s %sSpecial token type for unknown tokens */\n",
+                  (_use_doxygen) ? "!" : "",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "  %s_token_type_none%s\n",
+                  parser_name,
+                  ge->next ? "," : "");
+
+    while (ge)
+    {
+      if ((p = egg_token_find_child(ge, egg_token_type_phrase)))
+      {
+        if ((pn = egg_token_find_child(p, egg_token_type_phrase_name)))
+        {
+          pns = NULL;
+          pns = egg_token_to_string(pn->descendant, pns);
+
+          fprintf(of, "    /*%s %sToken type for %s phrase*/\n",
+                        (_use_doxygen) ? "!" : "",
+                        (_use_doxygen) ? "@brief " : "",
+                        pns);
+
+          pns = fix_identifier(pns);
+
+          fprintf(of, "  %s_token_type_%s%s\n",
+                        parser_name,
+                        pns,
+                        ge->next ? "," : ""
+                 );
+
+          free(last);
+          last = pns;
+        }
+      }
+      ge = ge->next;
+    }
+  }
+
+  fprintf(of, "} %s_token_type;\n", parser_name);
+  fprintf(of, "\n");
+
+    // Emit <PROJECT>_TOKEN_TYPE_COUNT constant
+
+  u_parser_name = str_toupper(strdup(parser_name));
+  fprintf(of, "  /*%s %sCount of token types, for range checks */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "#define %s_TOKEN_TYPE_COUNT (%s_token_type_%s + 1)\n",
+                u_parser_name, parser_name, (last) ? last : "none");
+  fprintf(of, "\n");
+  free(u_parser_name);
+  free(last);
+
+    // Emit close-out for header include guard
+
+  fprintf(of, "#endif // %s\n", hn);
+  fprintf(of, "\n");
+
+  free(hn);
+
+  return;
+}
+
+  /*!
+
+     \brief Generates \<PROJECT\>-token-util.c source code file.
+    
+     This function generates the source code for \<PROJECT\>-token-util.c\n
+     \n
+     The token utility source file contains the \<PROJECT\>_token_type_to_string
+     function definition.
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the root token from which
+                        the source code is generated
+
+  */
+
+void generate_token_util_source(FILE *of,
+                                char *parser_name,
+                                egg_token *t)
+{
+  egg_token *ge, *p, *pn;
+  char *pns;
+  char *val;
+  char *fn;
+
+    // Sanity check parameters
+
+  if (!of)
+    of = stdout;
+
+  if (!parser_name)
+    return;
+
+  if (!t)
+    return;
+
+    // Emit the file level comment block
+
+  fn = make_file_name(parser_name, "token-util.c");
+  generator_set_file_name(fn);
+  emit_source_comment_header(of);
+  free(fn);
+
+    // Emit file description comment block
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  if (_use_doxygen)
+  {
+    fprintf(of, "    @file %s-token-util.c\n", parser_name);
+    fprintf(of, "\n");
+  }
+  fprintf(of, "    This is the source code file for the %s grammar token "
+              "utility\n",
+                parser_name);
+  fprintf(of, "    functions module.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    The %s_token_type_to_string function is defined in\n",
+                parser_name);
+  fprintf(of, "    this module.\n");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for included header files
+
+  fprintf(of, "#include <stdlib.h>\n");
+  fprintf(of, "#include <string.h>\n");
+  fprintf(of, "\n");
+  fprintf(of, "#include \"%s-token.h\"\n", parser_name);
+  fprintf(of, "#include \"%s-token-util.h\"\n", parser_name);
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_type_to_string()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns a string representation of %s_token.\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sThis function returns a pointer to dynamically allocated "
+              "memory.\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "    %sIt is the caller's responsibility to free this memory "
+              "when\n",
+                (_use_doxygen) ? "      " : "         ");
+  fprintf(of, "    %sappropriate.\n",
+                (_use_doxygen) ? "      " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "    %st %s_token * to %s_token to string-ize\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_type_to_string()
+
+  fprintf(of, "char *%s_token_type_to_string(%s_token *t)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  char *s;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  switch (t->type)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    case %s_token_type_none:\n", parser_name);
+  fprintf(of, "      s = \"<none>\";\n");
+  fprintf(of, "      break;\n");
+
+  if ((ge = egg_token_find_child(t, egg_token_type_grammar_element)))
+  {
+
+    while (ge)
+    {
+      if ((p = egg_token_find_child(ge, egg_token_type_phrase)))
+      {
+        if ((pn = egg_token_find_child(p, egg_token_type_phrase_name)))
+        {
+          pns = NULL;
+          pns = egg_token_to_string(pn->descendant, pns);
+          pns = fix_identifier(pns);
+
+          fprintf(of, "    case %s_token_type_%s:\n",
+                        parser_name, pns);
+          fprintf(of, "      s = \"%s\";\n",
+                      val = literal_or_phrase_name(p));
+          fprintf(of, "      break;\n");
+
+          free(val);
+          free(pns);
+        }
+      }
+      ge = ge->next;
+    }
+  }
+
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return s;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+  return;
+}
+
+  /*!
+
+     \brief Generates \<PROJECT\>-token-util.h source code file.
+    
+     This function generates the source code for \<PROJECT\>-token-util.h\n
+     \n
+     The token utility header file contains the \<PROJECT\>_token_type_to_string
+     function declaration.
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+
+  */
+
+void generate_token_util_header(FILE *of,
+                                char *parser_name)
+{
+  char *hn;
+  int hnl;
+  char *fn;
+
+    // Sanity check parameters
+
+  if (!of)
+    of = stdout;
+
+  if (!parser_name)
+    return;
+
+    // Create header guard macro name
+
+  hnl = strlen(parser_name) + strlen("_token_util_h") + 1;
+  hn = malloc(hnl);
+  memset(hn, 0, hnl);
+
+  sprintf(hn, "%s_token_util_h", parser_name);
+
+    // Force header guard macro name to uppercase 
+
+  hn = str_toupper(hn);
+
+    // Emit the file level comment block
+
+  fn = make_file_name(parser_name, "token-util.h");
+  generator_set_file_name(fn);
+  emit_source_comment_header(of);
+  free(fn);
+
+    // Emit file description comment block
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  if (_use_doxygen)
+  {
+    fprintf(of, "    @file %s-token-util.h\n", parser_name);
+    fprintf(of, "\n");
+  }
+  fprintf(of, "    This is the header file for the %s grammar token utility\n",
+                parser_name);
+  fprintf(of, "    functions module.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    The %s_token_type_to_string function is defined in\n",
+                parser_name);
+  fprintf(of, "    this module.\n");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit header include guard
+
+  fprintf(of, "#ifndef %s\n", hn);
+  fprintf(of, "#define %s\n", hn);
+  fprintf(of, "\n");
+
+    // Emit function declarations
+
+  fprintf(of, "char *%s_token_type_to_string(%s_token *t);\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+
+    // Emit close-out for header include guard
+
+  fprintf(of, "#endif // %s\n", hn);
+
+    // Clean up
+
+  free(hn);
+
+  return;
+}
+
+  /*!
+
+     \brief Generates \<PROJECT\>-token-tree.h source code file.
+    
+     This function generates the source code for \<PROJECT\>-token-tree.h\n
+     \n
+     The token tree header file contains the \<PROJECT\>_token_tree typedef,
+     a compact, index based alternative to a linked \<PROJECT\>_token tree,
+     and the declarations for its management functions.
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+
+  */
+
+void generate_token_tree_header(FILE *of,
+                                char *parser_name)
+{
+  char *u_parser_name;   // Upper case version of parser name
+  char *fn;              // A generated file name for emitted documentation
+
+    // Sanity check parameters
+
+  if (!of)
+    of = stdout;
+
+  if (!parser_name)
+    return;
+
+    // Force parser name to upper case
+
+  u_parser_name = str_toupper(strdup(parser_name));
+
+    // Emit the file level comment block
+
+  fn = make_file_name(parser_name, "token-tree.h");
+  generator_set_file_name(fn);
+  emit_source_comment_header(of);
+  free(fn);
+
+    // Emit file description comment block
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  if (_use_doxygen)
+  {
+    fprintf(of, "    @file %s-token-tree.h\n", parser_name);
+    fprintf(of, "\n");
+  }
+  fprintf(of, "    This is the header file for the %s grammar compact token "
+              "tree\n",
+                parser_name);
+  fprintf(of, "    module.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    A compact token tree stores the same hierarchy as a "
+              "%s_token tree,\n",
+                parser_name);
+  fprintf(of, "    but as parallel arrays addressed by 32 bit indices instead "
+              "of linked\n");
+  fprintf(of, "    nodes addressed by pointers.  Nodes are stored in "
+              "pre-order, so the\n");
+  fprintf(of, "    root is always index 0 and every subtree occupies a "
+              "contiguous range\n");
+  fprintf(of, "    of indices.\n");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit header include guard
+
+  fprintf(of, "#ifndef %s_TOKEN_TREE_H\n", u_parser_name);
+  fprintf(of, "#define %s_TOKEN_TREE_H\n", u_parser_name);
+  fprintf(of, "\n");
+
+    // Emit system related includes
+
+  fprintf(of, "#include <stdint.h>\n");
+  fprintf(of, "\n");
+
+    // Emit module related includes
+
+  fprintf(of, "#include \"%s-token.h\"\n", parser_name);
+  fprintf(of, "\n");
+
+    // Emit <PROJECT>_token_index annotation
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "    %sDefinition of %s_token_index, the index of a node in a\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "    %s_token_tree\n", parser_name);
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit <PROJECT>_token_index typedef
+
+  fprintf(of, "typedef uint32_t %s_token_index;\n", parser_name);
+  fprintf(of, "\n");
+
+    // Emit <PROJECT>_TOKEN_INDEX_NONE annotation
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "    %sIndex value used for a missing ascendant, descendant or "
+              "next node\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit <PROJECT>_TOKEN_INDEX_NONE constant
+
+  fprintf(of, "#define %s_TOKEN_INDEX_NONE ((%s_token_index)0xFFFFFFFF)\n",
+                u_parser_name, parser_name);
+  fprintf(of, "\n");
+
+    // Emit <PROJECT>_TOKEN_TREE_SNAPSHOT_VERSION annotation
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "    %sVersion of the %s_token_tree snapshot file format\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit <PROJECT>_TOKEN_TREE_SNAPSHOT_VERSION constant
+
+  fprintf(of, "#define %s_TOKEN_TREE_SNAPSHOT_VERSION 2\n", u_parser_name);
+  fprintf(of, "\n");
+
+    // Emit <PROJECT>_token_tree annotation
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "    %sDefinition of %s_token_tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit <PROJECT>_token_tree typedef
+
+  fprintf(of, "typedef struct\n");
+  fprintf(of, "{\n");
+  fprintf(of, "    /*%s %sCount of nodes in tree */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_index count;\n", parser_name);
+  fprintf(of, "    /*%s %sType of each node */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_type *type;\n", parser_name);
+  fprintf(of, "    /*%s %sIndex of ascendant (parent) of each node */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_index *ascendant;\n", parser_name);
+  fprintf(of, "    /*%s %sIndex of first descendant (child) of each node */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_index *descendant;\n", parser_name);
+  fprintf(of, "    /*%s %sIndex of next (sibling) of each node */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_index *next;\n", parser_name);
+  fprintf(of, "    /*%s %sInput offset of first byte matched by each node */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  long *offset;\n");
+  fprintf(of, "    /*%s %sCount of input bytes matched by each node */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  long *length;\n");
+  fprintf(of, "    /*%s %sFirst-child-by-type hash, or NULL when not "
+              "indexed */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_index *child_index;\n", parser_name);
+  fprintf(of, "    /*%s %sCount of slots in child_index */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_index child_index_size;\n", parser_name);
+  fprintf(of, "    /*%s %sEmbedded input text, or NULL when read from the "
+              "input */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  char *source;\n");
+  fprintf(of, "    /*%s %sCount of bytes in source */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  long source_length;\n");
+  fprintf(of, "    /*%s %sOffset of the start of each line of source, or NULL "
+              "*/\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  long *line_start;\n");
+  fprintf(of, "    /*%s %sCount of entries in line_start */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  long line_count;\n");
+  fprintf(of, "    /*%s %sSnapshot mapping holding the arrays, or NULL */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  void *mapping;\n");
+  fprintf(of, "    /*%s %sCount of bytes in mapping */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  long mapping_size;\n");
+  fprintf(of, "} %s_token_tree;\n", parser_name);
+  fprintf(of, "\n");
+
+    // Emit <PROJECT>_token_tree_snapshot_header annotation
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "    %sDefinition of %s_token_tree_snapshot_header\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    A snapshot file starts with this header.  It is followed by "
+              "the type,\n");
+  fprintf(of, "    ascendant, descendant, next, offset and length arrays of "
+              "the tree, in\n");
+  fprintf(of, "    that order and each starting on an 8 byte boundary, and "
+              "then by the\n");
+  fprintf(of, "    input text when it is embedded.  The arrays keep the byte "
+              "order and\n");
+  fprintf(of, "    sizes of the writing host, which the header records, so a "
+              "snapshot\n");
+  fprintf(of, "    from an incompatible host is refused.  The length and "
+              "hash of the\n");
+  fprintf(of, "    input let a loaded tree be checked against the input "
+              "source.\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit <PROJECT>_token_tree_snapshot_header typedef
+
+  fprintf(of, "typedef struct\n");
+  fprintf(of, "{\n");
+  fprintf(of, "    /*%s %sFile signature, \"EMBTREE\" */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  char magic[8];\n");
+  fprintf(of, "    /*%s %sName of the parser that produced the tree */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  char parser[24];\n");
+  fprintf(of, "    /*%s %sSnapshot format version */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  uint32_t version;\n");
+  fprintf(of, "    /*%s %s0x01020304 in writing host byte order */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  uint32_t byte_order;\n");
+  fprintf(of, "    /*%s %sSize of %s_token_type on the writing host */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "  uint32_t type_size;\n");
+  fprintf(of, "    /*%s %sSize of long on the writing host */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  uint32_t long_size;\n");
+  fprintf(of, "    /*%s %sCount of nodes in tree */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  uint32_t count;\n");
+  fprintf(of, "    /*%s %sNon-zero when the input text is embedded */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  uint32_t has_source;\n");
+  fprintf(of, "    /*%s %sCount of bytes of embedded input text */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  uint64_t source_length;\n");
+  fprintf(of, "    /*%s %sCount of bytes of the input the tree was parsed from "
+              "*/\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  uint64_t input_length;\n");
+  fprintf(of, "    /*%s %sFNV-1a hash of the input the tree was parsed from "
+              "*/\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  uint64_t input_hash;\n");
+  fprintf(of, "} %s_token_tree_snapshot_header;\n", parser_name);
+  fprintf(of, "\n");
+
+    // Emit function declarations
+
+  fprintf(of, "%s_token_tree *%s_token_tree_new(%s_token *t);\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "void %s_token_tree_free(%s_token_tree *tree);\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "%s_token_index %s_token_tree_get_count(%s_token_tree *tree);\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "%s_token_type %s_token_tree_get_type(%s_token_tree *tree,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_index i);\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "%s_token_index %s_token_tree_get_ascendant(%s_token_tree "
+              "*tree,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_index i);\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "%s_token_index %s_token_tree_get_descendant(%s_token_tree "
+              "*tree,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_index i);\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "%s_token_index %s_token_tree_get_next(%s_token_tree *tree,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_index i);\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "long %s_token_tree_get_offset(%s_token_tree *tree, "
+              "%s_token_index i);\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "long %s_token_tree_get_length(%s_token_tree *tree, "
+              "%s_token_index i);\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "%s_token_index %s_token_tree_find(%s_token_tree *tree,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_index i,\n", parser_name);
+  fprintf(of, "  %s_token_type type);\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "int %s_token_tree_index_children(%s_token_tree *tree);\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "%s_token_index %s_token_tree_find_child(%s_token_tree *tree,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_index i,\n", parser_name);
+  fprintf(of, "  %s_token_type type);\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "%s_token_tree *%s_token_tree_load(char *file_name);\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "int %s_token_tree_save(%s_token_tree *tree,\n",
+                parser_name, parser_name);
+  fprintf(of, "  char *file_name,\n");
+  fprintf(of, "  int with_source);\n");
+  fprintf(of, "\n");
+  fprintf(of, "int %s_token_tree_match_input(%s_token_tree *tree);\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "char *%s_token_tree_get_source(%s_token_tree *tree, long "
+              "*length);\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "void %s_token_tree_get_location(%s_token_tree *tree,\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token_index i,\n", parser_name);
+  fprintf(of, "  input_location *location);\n");
+  fprintf(of, "\n");
+  fprintf(of, "char *%s_token_tree_span_to_string(%s_token_tree *tree,\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token_index i,\n", parser_name);
+  fprintf(of, "  char *s);\n");
+  fprintf(of, "\n");
+  fprintf(of, "char *%s_token_tree_to_string(%s_token_tree *tree,\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token_index i,\n", parser_name);
+  fprintf(of, "  char *s);\n");
+  fprintf(of, "long %s_token_tree_to_buffer(%s_token_tree *tree,\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token_index i,\n", parser_name);
+  fprintf(of, "  char *buffer,\n");
+  fprintf(of, "  long size);\n");
+  fprintf(of, "\n");
+
+    // Emit close-out for header include guard
+
+  fprintf(of, "#endif // %s_TOKEN_TREE_H\n", u_parser_name);
+  fprintf(of, "\n");
+
+    // Clean up
+
+  free(u_parser_name);
+
+  return;
+}
+
+  /*!
+
+     \brief Generates \<PROJECT\>-token-tree.c source code file.
+    
+     This function generates the source code for \<PROJECT\>-token-tree.c\n
+     \n
+     The token tree source file contains:
+       - the definitions for several \<PROJECT\>_token_tree management
+         functions
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+
+  */
+
+void generate_token_tree_source(FILE *of,
+                                char *parser_name)
+{
+  char *u_parser_name;   // Upper case version of parser name
+  char *fn;              // A generated file name for emitted documentation
+
+    // Sanity check parameters
+
+  if (!of)
+    of = stdout;
+
+  if (!parser_name)
+    return;
+
+    // Force parser name to upper case
+
+  u_parser_name = str_toupper(strdup(parser_name));
+
+    // Emit the file level comment block
+
+  fn = make_file_name(parser_name, "token-tree.c");
+  generator_set_file_name(fn);
+  emit_source_comment_header(of);
+  free(fn);
+
+    // Emit file description comment block
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  if (_use_doxygen)
+  {
+    fprintf(of, "    @file %s-token-tree.c\n", parser_name);
+    fprintf(of, "\n");
+  }
+  fprintf(of, "    This is the source code file for the %s grammar compact "
+              "token tree\n",
+                parser_name);
+  fprintf(of, "    module.\n");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for included header files
+
+  fprintf(of, "#include <stdio.h>\n");
+  fprintf(of, "#include <stdlib.h>\n");
+  fprintf(of, "#include <string.h>\n");
+  fprintf(of, "#include <fcntl.h>\n");
+  fprintf(of, "#include <unistd.h>\n");
+  fprintf(of, "#include <sys/mman.h>\n");
+  fprintf(of, "#include <sys/stat.h>\n");
+  fprintf(of, "\n");
+
+    // Emit code for project related header files
+
+  fprintf(of, "#include \"%s-token.h\"\n", parser_name);
+  fprintf(of, "#include \"%s-token-util.h\"\n", parser_name);
+  fprintf(of, "#include \"%s-token-tree.h\"\n", parser_name);
+  fprintf(of, "\n");
+
+    // Emit code for module constants
+
+  fprintf(of, "#define %s_TOKEN_TREE_HASH_BASIS 0xcbf29ce484222325ULL\n",
+                u_parser_name);
+  fprintf(of, "#define %s_TOKEN_TREE_HASH_PRIME 0x100000001b3ULL\n",
+                u_parser_name);
+  fprintf(of, "\n");
+
+    // Emit code for module function declarations
+
+  fprintf(of, "static %s_token_index subtree_end(%s_token_tree *tree, "
+              "%s_token_index i);\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "static %s_token_index child_slot(%s_token_tree *tree,\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token_index a,\n", parser_name);
+  fprintf(of, "  %s_token_type type);\n", parser_name);
+  fprintf(of, "static long snapshot_layout(%s_token_index count,\n",
+                parser_name);
+  fprintf(of, "  long source_length,\n");
+  fprintf(of, "  long *at);\n");
+  fprintf(of, "static int snapshot_write(FILE *f, void *data, long size, "
+              "long at);\n");
+  fprintf(of, "static int index_lines(%s_token_tree *tree);\n", parser_name);
+  fprintf(of, "static int check_nodes(%s_token_tree *tree,\n", parser_name);
+  fprintf(of, "  %s_token_tree_snapshot_header *header);\n", parser_name);
+  fprintf(of, "static void hash_input(long *length, uint64_t *hash);\n");
+  fprintf(of, "static uint64_t snapshot_hash(uint64_t hash,\n");
+  fprintf(of, "  unsigned char *bytes,\n");
+  fprintf(of, "  long count);\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_new()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sCreate a new %s_token_tree from a %s_token tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    The compact tree holds t, its descendants, and each "
+              "following sibling\n");
+  fprintf(of, "    of t along with its descendants.  They are copied in the "
+              "order of a\n");
+  fprintf(of, "    %s_token_iterator pre-order walk.  The %s_token tree "
+              "itself is not\n",
+                parser_name, parser_name);
+  fprintf(of, "    modified, and remains valid.\n");
+  if (_use_context)
+  {
+    fprintf(of, "\n");
+    fprintf(of, "    When t holds the input bytes of a whole parse, the tree "
+                "reads its text\n");
+    fprintf(of, "    and locations from them, so they must be kept while the "
+                "tree is used.\n");
+  }
+  fprintf(of, "\n");
+  fprintf(of, "    %sThis function returns a pointer to dynamically allocated "
+              "memory.\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "             It is the caller's responsibility to free this "
+              "memory with\n");
+  fprintf(of, "             %s_token_tree_free() when appropriate.\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %st %s_token * to root of %s_token tree\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token_tree *%s new %s_token_tree\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "",
+                parser_name);
+  fprintf(of, "    %sNULL failure\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_new()
+
+  fprintf(of, "%s_token_tree *%s_token_tree_new(%s_token *t)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_tree *tree;\n", parser_name);
+  fprintf(of, "  %s_token_iterator it;\n", parser_name);
+  fprintf(of, "  %s_token *p;\n", parser_name);
+  fprintf(of, "  %s_token_index count;\n", parser_name);
+  fprintf(of, "  %s_token_index i;\n", parser_name);
+  fprintf(of, "  %s_token_index a;\n", parser_name);
+  fprintf(of, "  %s_token_index previous;\n", parser_name);
+  fprintf(of, "  int depth;\n");
+  fprintf(of, "  int d;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  count = 0;\n");
+  fprintf(of, "  %s_token_iterator_init(&it, t, %s_token_pre_order);\n",
+                parser_name, parser_name);
+  fprintf(of, "  while (%s_token_iterator_next(&it))\n", parser_name);
+  fprintf(of, "    ++count;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  tree = malloc(sizeof(%s_token_tree));\n", parser_name);
+  fprintf(of, "  if (!tree)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  tree->count = count;\n");
+  fprintf(of, "  tree->child_index = NULL;\n");
+  fprintf(of, "  tree->child_index_size = 0;\n");
+  if (_use_context)
+  {
+    fprintf(of, "  if (t->source && t->source->buffer && !t->source->base)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    tree->source = (char *)t->source->buffer;\n");
+    fprintf(of, "    tree->source_length = t->source->length;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "  else\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    tree->source = NULL;\n");
+    fprintf(of, "    tree->source_length = 0;\n");
+    fprintf(of, "  }\n");
+  }
+  else
+  {
+    fprintf(of, "  tree->source = NULL;\n");
+    fprintf(of, "  tree->source_length = 0;\n");
+  }
+  fprintf(of, "  tree->line_start = NULL;\n");
+  fprintf(of, "  tree->line_count = 0;\n");
+  fprintf(of, "  tree->mapping = NULL;\n");
+  fprintf(of, "  tree->mapping_size = 0;\n");
+  fprintf(of, "  tree->type = malloc(count * sizeof(%s_token_type));\n",
+                parser_name);
+  fprintf(of, "  tree->ascendant = malloc(count * sizeof(%s_token_index));\n",
+                parser_name);
+  fprintf(of, "  tree->descendant = malloc(count * sizeof(%s_token_index));\n",
+                parser_name);
+  fprintf(of, "  tree->next = malloc(count * sizeof(%s_token_index));\n",
+                parser_name);
+  fprintf(of, "  tree->offset = malloc(count * sizeof(long));\n");
+  fprintf(of, "  tree->length = malloc(count * sizeof(long));\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree->type || !tree->ascendant || !tree->descendant ||\n");
+  fprintf(of, "      !tree->next || !tree->offset || !tree->length)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    %s_token_tree_free(tree);\n", parser_name);
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  i = 0;\n");
+  fprintf(of, "  depth = 0;\n");
+  fprintf(of, "  %s_token_iterator_init(&it, t, %s_token_pre_order);\n",
+                parser_name, parser_name);
+  fprintf(of, "  while ((p = %s_token_iterator_next(&it)))\n", parser_name);
+  fprintf(of, "  {\n");
+  fprintf(of, "    d = %s_token_iterator_get_depth(&it);\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "      // A deeper node is the first descendant of the node "
+              "before it,\n");
+  fprintf(of, "      // otherwise it follows the node at the same depth on the "
+              "path\n");
+  fprintf(of, "      // back up from the node before it\n");
+  fprintf(of, "\n");
+  fprintf(of, "    a = %s_TOKEN_INDEX_NONE;\n", u_parser_name);
+  fprintf(of, "    if (d > depth)\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      a = i - 1;\n");
+  fprintf(of, "      tree->descendant[a] = i;\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "    else if (i > 0)\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      for (previous = i - 1; depth > d; --depth)\n");
+  fprintf(of, "        previous = tree->ascendant[previous];\n");
+  fprintf(of, "      tree->next[previous] = i;\n");
+  fprintf(of, "      a = tree->ascendant[previous];\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "    depth = d;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    tree->type[i] = p->type;\n");
+  fprintf(of, "    tree->ascendant[i] = a;\n");
+  fprintf(of, "    tree->descendant[i] = %s_TOKEN_INDEX_NONE;\n",
+                u_parser_name);
+  fprintf(of, "    tree->next[i] = %s_TOKEN_INDEX_NONE;\n", u_parser_name);
+  fprintf(of, "    tree->offset[i] = p->offset;\n");
+  fprintf(of, "    tree->length[i] = p->length;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    ++i;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return tree;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_free()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sFree the memory associated with %s_token_tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_free()
+
+  fprintf(of, "void %s_token_tree_free(%s_token_tree *tree)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!tree)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    // A loaded tree's arrays live in the snapshot mapping\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (tree->mapping)\n");
+  fprintf(of, "    munmap(tree->mapping, tree->mapping_size);\n");
+  fprintf(of, "  else\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    free(tree->type);\n");
+  fprintf(of, "    free(tree->ascendant);\n");
+  fprintf(of, "    free(tree->descendant);\n");
+  fprintf(of, "    free(tree->next);\n");
+  fprintf(of, "    free(tree->offset);\n");
+  fprintf(of, "    free(tree->length);\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  free(tree->child_index);\n");
+  fprintf(of, "  free(tree->line_start);\n");
+  fprintf(of, "  free(tree);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_get_count()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns count of nodes in %s_token_tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token_index%s count\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_get_count()
+
+  fprintf(of, "%s_token_index %s_token_tree_get_count(%s_token_tree *tree)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!tree)\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return tree->count;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_get_type()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns type of node in %s_token_tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %si    %s_token_index of node\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token_type%s type\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "    %s%s_token_type_none failure\n",
+                (_use_doxygen) ? "@retval " : "         ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_get_type()
+
+  fprintf(of, "%s_token_type %s_token_tree_get_type(%s_token_tree *tree,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_index i)\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!tree || (i >= tree->count))\n");
+  fprintf(of, "    return %s_token_type_none;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  return tree->type[i];\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_get_ascendant()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns index of ascendant (parent) of node in "
+              "%s_token_tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %si    %s_token_index of node\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token_index%s ascendant\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "    %s%s_TOKEN_INDEX_NONE no ascendant, or failure\n",
+                (_use_doxygen) ? "@retval " : "         ",
+                u_parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_get_ascendant()
+
+  fprintf(of, "%s_token_index %s_token_tree_get_ascendant(%s_token_tree "
+              "*tree,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_index i)\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!tree || (i >= tree->count))\n");
+  fprintf(of, "    return %s_TOKEN_INDEX_NONE;\n", u_parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  return tree->ascendant[i];\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_get_descendant()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns index of first descendant (child) of node in\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "    %s_token_tree\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %si    %s_token_index of node\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token_index%s descendant\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "    %s%s_TOKEN_INDEX_NONE no descendant, or failure\n",
+                (_use_doxygen) ? "@retval " : "         ",
+                u_parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_get_descendant()
+
+  fprintf(of, "%s_token_index %s_token_tree_get_descendant(%s_token_tree "
+              "*tree,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_index i)\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!tree || (i >= tree->count))\n");
+  fprintf(of, "    return %s_TOKEN_INDEX_NONE;\n", u_parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  return tree->descendant[i];\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_get_next()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns index of next (sibling) of node in "
+              "%s_token_tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %si    %s_token_index of node\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token_index%s next\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "    %s%s_TOKEN_INDEX_NONE no next, or failure\n",
+                (_use_doxygen) ? "@retval " : "         ",
+                u_parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_get_next()
+
+  fprintf(of, "%s_token_index %s_token_tree_get_next(%s_token_tree *tree,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_index i)\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!tree || (i >= tree->count))\n");
+  fprintf(of, "    return %s_TOKEN_INDEX_NONE;\n", u_parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  return tree->next[i];\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_get_offset()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns input offset of first byte matched by node in\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "    %s_token_tree\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %si    %s_token_index of node\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %slong offset\n", (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_get_offset()
+
+  fprintf(of, "long %s_token_tree_get_offset(%s_token_tree *tree, "
+              "%s_token_index i)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!tree || (i >= tree->count))\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return tree->offset[i];\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_get_length()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns count of input bytes matched by node in "
+              "%s_token_tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %si    %s_token_index of node\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %slong length\n", (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_get_length()
+
+  fprintf(of, "long %s_token_tree_get_length(%s_token_tree *tree, "
+              "%s_token_index i)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!tree || (i >= tree->count))\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return tree->length[i];\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_find()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sFind node of specified %s_token_type in %s_token_tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name,
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    Like %s_token_find(), the search covers the node itself, "
+              "its\n",
+                parser_name);
+  fprintf(of, "    descendants, and its following siblings along with their "
+              "descendants.\n");
+  fprintf(of, "    Since nodes are stored in pre-order, this is a linear scan "
+              "of one\n");
+  fprintf(of, "    contiguous range of indices.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %si    %s_token_index of node where search begins\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "    %stype %s_token_type\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token_index%s found node\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "    %s%s_TOKEN_INDEX_NONE failure, including NOT FOUND\n",
+                (_use_doxygen) ? "@retval " : "         ",
+                u_parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_find()
+
+  fprintf(of, "%s_token_index %s_token_tree_find(%s_token_tree *tree,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_index i,\n", parser_name);
+  fprintf(of, "  %s_token_type type)\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_index end;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree || (i >= tree->count))\n");
+  fprintf(of, "    return %s_TOKEN_INDEX_NONE;\n", u_parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  end = subtree_end(tree, tree->ascendant[i]);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  for (; i < end; ++i)\n");
+  fprintf(of, "    if (tree->type[i] == type)\n");
+  fprintf(of, "      return i;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return %s_TOKEN_INDEX_NONE;\n", u_parser_name);
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_index_children()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sBuild first-child-by-type index for %s_token_tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    After indexing, %s_token_tree_find_child() answers in "
+              "constant\n",
+                parser_name);
+  fprintf(of, "    expected time instead of scanning the children of a node.  "
+              "The index\n");
+  fprintf(of, "    is an open-addressing hash keyed by (ascendant, type) "
+              "holding the\n");
+  fprintf(of, "    first child of each type, and is freed by "
+              "%s_token_tree_free().\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s1 success, including tree already indexed\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "    %s0 failure\n", (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_index_children()
+
+  fprintf(of, "int %s_token_tree_index_children(%s_token_tree *tree)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_index size;\n", parser_name);
+  fprintf(of, "  %s_token_index i;\n", parser_name);
+  fprintf(of, "  %s_token_index s;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree)\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (tree->child_index)\n");
+  fprintf(of, "    return 1;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  size = 1;\n");
+  fprintf(of, "  while (size < (2 * tree->count))\n");
+  fprintf(of, "    size <<= 1;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  tree->child_index = malloc(size * sizeof(%s_token_index));\n",
+                parser_name);
+  fprintf(of, "  if (!tree->child_index)\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  tree->child_index_size = size;\n");
+  fprintf(of, "  for (s = 0; s < size; ++s)\n");
+  fprintf(of, "    tree->child_index[s] = %s_TOKEN_INDEX_NONE;\n",
+                u_parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    // Nodes are in pre-order, so the first child of each type "
+              "is seen first\n");
+  fprintf(of, "  for (i = 0; i < tree->count; ++i)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    s = child_slot(tree, tree->ascendant[i], tree->type[i]);\n");
+  fprintf(of, "    if (tree->child_index[s] == %s_TOKEN_INDEX_NONE)\n",
+                u_parser_name);
+  fprintf(of, "      tree->child_index[s] = i;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return 1;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_find_child()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sFind first child node of specified %s_token_type\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    Only the direct descendants of node i are considered.  When "
+              "the tree\n");
+  fprintf(of, "    has been indexed by %s_token_tree_index_children() the "
+              "lookup is a\n",
+                parser_name);
+  fprintf(of, "    hash probe, otherwise it walks the child list of node i.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %si    %s_token_index of parent node\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "    %stype %s_token_type\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token_index%s found node\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "    %s%s_TOKEN_INDEX_NONE failure, including NOT FOUND\n",
+                (_use_doxygen) ? "@retval " : "         ",
+                u_parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_find_child()
+
+  fprintf(of, "%s_token_index %s_token_tree_find_child(%s_token_tree *tree,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "  %s_token_index i,\n", parser_name);
+  fprintf(of, "  %s_token_type type)\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_index c;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree || (i >= tree->count))\n");
+  fprintf(of, "    return %s_TOKEN_INDEX_NONE;\n", u_parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  if (tree->child_index)\n");
+  fprintf(of, "    return tree->child_index[child_slot(tree, i, type)];\n");
+  fprintf(of, "\n");
+  fprintf(of, "  for (c = tree->descendant[i]; c != %s_TOKEN_INDEX_NONE; c = "
+              "tree->next[c])\n",
+                u_parser_name);
+  fprintf(of, "    if (tree->type[c] == type)\n");
+  fprintf(of, "      return c;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return %s_TOKEN_INDEX_NONE;\n", u_parser_name);
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+    // Emit comment block for <PROJECT>_token_tree_to_string()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns string representation of node in %s_token_tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    Like %s_token_to_string(), the text of the node, its "
+              "descendants,\n",
+                parser_name);
+  fprintf(of, "    and its following siblings along with their descendants is "
+              "appended.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sThis function returns a pointer to dynamically allocated "
+              "memory.\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "             It is the caller's responsibility to free this "
+              "memory when\n");
+  fprintf(of, "             appropriate.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %si    %s_token_index of node\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "    %ss    char * of existing string, can be NULL\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "    %s%schar *%s string, can be NULL if s is NULL\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_to_string()
+
+  fprintf(of, "char *%s_token_tree_to_string(%s_token_tree *tree,\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token_index i,\n", parser_name);
+  fprintf(of, "  char *s)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  char *ns;\n");
+  fprintf(of, "  long used;\n");
+  fprintf(of, "  long length;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree || (i >= tree->count))\n");
+  fprintf(of, "    return s;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    // Size the string once, then fill it in place\n");
+  fprintf(of, "\n");
+  fprintf(of, "  length = %s_token_tree_to_buffer(tree, i, NULL, 0);\n",
+                parser_name);
+  fprintf(of, "  used = (s) ? strlen(s) : 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  ns = realloc(s, used + length + 1);\n");
+  fprintf(of, "  if (!ns)\n");
+  fprintf(of, "    return s;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  %s_token_tree_to_buffer(tree, i, ns + used, length + 1);\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  return ns;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_to_buffer()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sWrites string representation of node in %s_token_tree to "
+              "a\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "    buffer\n");
+  fprintf(of, "\n");
+  fprintf(of, "    The text is the same as from %s_token_tree_to_string(), and "
+              "it is\n",
+                parser_name);
+  fprintf(of, "    written with the same rules as %s_token_to_buffer().\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %stree   %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %si      %s_token_index of node\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "    %sbuffer char * to receive the text, can be NULL\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "    %ssize   long size of buffer in bytes\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "    %slong length of the complete text, not counting the NUL "
+              "byte\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_to_buffer()
+
+  fprintf(of, "long %s_token_tree_to_buffer(%s_token_tree *tree,\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token_index i,\n", parser_name);
+  fprintf(of, "  char *buffer,\n");
+  fprintf(of, "  long size)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token leaf;\n", parser_name);
+  fprintf(of, "  %s_token_index end;\n", parser_name);
+  fprintf(of, "  char *text;\n");
+  fprintf(of, "  long length;\n");
+  fprintf(of, "  long room;\n");
+  fprintf(of, "  long n;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  length = 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (buffer && (size > 0))\n");
+  fprintf(of, "    buffer[0] = 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree || (i >= tree->count))\n");
+  fprintf(of, "    return length;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  end = subtree_end(tree, tree->ascendant[i]);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  for (; i < end; ++i)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    if (tree->descendant[i] != %s_TOKEN_INDEX_NONE)\n",
+                u_parser_name);
+  fprintf(of, "      continue;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    memset(&leaf, 0, sizeof(%s_token));\n", parser_name);
+  fprintf(of, "    leaf.type = tree->type[i];\n");
+  fprintf(of, "    leaf.offset = tree->offset[i];\n");
+  fprintf(of, "    leaf.length = tree->length[i];\n");
+  fprintf(of, "\n");
+  fprintf(of, "    if (!tree->source)\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      length += %s_token_to_buffer(&leaf,\n", parser_name);
+  fprintf(of, "                  (buffer && (length < size)) ? buffer + length "
+              ": NULL,\n");
+  fprintf(of, "                  size - length);\n");
+  fprintf(of, "      continue;\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "\n");
+  fprintf(of, "      // Embedded input text is copied directly, without the "
+              "input source\n");
+  fprintf(of, "\n");
+  fprintf(of, "    text = NULL;\n");
+  fprintf(of, "    n = 0;\n");
+  fprintf(of, "    if (leaf.length <= 0)\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      text = %s_token_type_to_string(&leaf);\n", parser_name);
+  fprintf(of, "      n = strlen(text);\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "    else if (leaf.offset + leaf.length <= "
+              "tree->source_length)\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      text = tree->source + leaf.offset;\n");
+  fprintf(of, "      n = leaf.length;\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "\n");
+  fprintf(of, "    room = (buffer && (size - 1 > length)) ? size - 1 - length "
+              ": 0;\n");
+  fprintf(of, "    if (text && (room > 0))\n");
+  fprintf(of, "      memcpy(buffer + length, text, (n < room) ? n : room);\n");
+  fprintf(of, "\n");
+  fprintf(of, "    length += n;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    if (buffer && (size > 0))\n");
+  fprintf(of, "      buffer[(length < size) ? length : size - 1] = 0;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return length;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_save()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sWrite %s_token_tree to a snapshot file\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    The snapshot holds the node arrays of the tree in a form "
+              "that\n");
+  fprintf(of, "    %s_token_tree_load() can map straight into memory, so that "
+              "later\n",
+                parser_name);
+  fprintf(of, "    processes can use the tree without parsing the input again. "
+              " When\n");
+  fprintf(of, "    with_source is non-zero the input text is embedded as well, "
+              "and the\n");
+  fprintf(of, "    loaded tree no longer needs the input source for text or "
+              "locations.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %stree        %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %sfile_name   name of snapshot file to write\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "    %swith_source non-zero to embed the input text\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "    %s1 success\n", (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "    %s0 failure\n", (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_save()
+
+  fprintf(of, "int %s_token_tree_save(%s_token_tree *tree,\n",
+                parser_name, parser_name);
+  fprintf(of, "  char *file_name,\n");
+  fprintf(of, "  int with_source)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_tree_snapshot_header header;\n", parser_name);
+  fprintf(of, "  FILE *f;\n");
+  fprintf(of, "  long at[7];\n");
+  fprintf(of, "  long pos;\n");
+  fprintf(of, "  long length;\n");
+  fprintf(of, "  uint64_t hash;\n");
+  fprintf(of, "  int ok;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree || !file_name)\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (tree->source)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    length = tree->source_length;\n");
+  fprintf(of, "    hash = snapshot_hash(%s_TOKEN_TREE_HASH_BASIS,\n",
+                u_parser_name);
+  fprintf(of, "                         (unsigned char *)tree->source,\n");
+  fprintf(of, "                         length);\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "  else\n");
+  fprintf(of, "    hash_input(&length, &hash);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  f = fopen(file_name, \"wb\");\n");
+  fprintf(of, "  if (!f)\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  memset(&header, 0, sizeof(header));\n");
+  fprintf(of, "  memcpy(header.magic, \"EMBTREE\", 8);\n");
+  fprintf(of, "  strncpy(header.parser, \"%s\", sizeof(header.parser) - 1);\n",
+                parser_name);
+  fprintf(of, "  header.version = %s_TOKEN_TREE_SNAPSHOT_VERSION;\n",
+                u_parser_name);
+  fprintf(of, "  header.byte_order = 0x01020304;\n");
+  fprintf(of, "  header.type_size = sizeof(%s_token_type);\n", parser_name);
+  fprintf(of, "  header.long_size = sizeof(long);\n");
+  fprintf(of, "  header.count = tree->count;\n");
+  fprintf(of, "  header.has_source = (with_source) ? 1 : 0;\n");
+  fprintf(of, "  header.source_length = (with_source) ? length : 0;\n");
+  fprintf(of, "  header.input_length = length;\n");
+  fprintf(of, "  header.input_hash = hash;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  snapshot_layout(tree->count, 0, at);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  ok = snapshot_write(f, &header, sizeof(header), 0) &&\n");
+  fprintf(of, "       snapshot_write(f, tree->type,\n");
+  fprintf(of, "                      tree->count * sizeof(%s_token_type), "
+              "at[0]) &&\n",
+                parser_name);
+  fprintf(of, "       snapshot_write(f, tree->ascendant,\n");
+  fprintf(of, "                      tree->count * sizeof(%s_token_index), "
+              "at[1]) &&\n",
+                parser_name);
+  fprintf(of, "       snapshot_write(f, tree->descendant,\n");
+  fprintf(of, "                      tree->count * sizeof(%s_token_index), "
+              "at[2]) &&\n",
+                parser_name);
+  fprintf(of, "       snapshot_write(f, tree->next,\n");
+  fprintf(of, "                      tree->count * sizeof(%s_token_index), "
+              "at[3]) &&\n",
+                parser_name);
+  fprintf(of, "       snapshot_write(f, tree->offset, tree->count * "
+              "sizeof(long), at[4]) &&\n");
+  fprintf(of, "       snapshot_write(f, tree->length, tree->count * "
+              "sizeof(long), at[5]) &&\n");
+  fprintf(of, "       snapshot_write(f, NULL, 0, at[6]);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (ok && with_source)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    if (tree->source)\n");
+  fprintf(of, "      ok = snapshot_write(f, tree->source, tree->source_length, "
+              "at[6]);\n");
+  fprintf(of, "    else\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      pos = input_get_position();\n");
+  fprintf(of, "      input_set_position(0);\n");
+  fprintf(of, "      while (ok && !input_eof())\n");
+  fprintf(of, "        ok = (fputc(input_byte(), f) != EOF);\n");
+  fprintf(of, "      input_set_position(pos);\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (fclose(f))\n");
+  fprintf(of, "    ok = 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return ok;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_load()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sLoad %s_token_tree from a snapshot file\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    The file is mapped into memory, and the node arrays of the "
+              "returned\n");
+  fprintf(of, "    tree point into the mapping, so loading costs no per-node "
+              "allocation\n");
+  fprintf(of, "    or copying however large the tree is.  The mapping is "
+              "released by\n");
+  fprintf(of, "    %s_token_tree_free().\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    Every node index and span is checked, so a damaged or "
+              "altered snapshot\n");
+  fprintf(of, "    is refused.  A tree without embedded input text should "
+              "be checked\n");
+  fprintf(of, "    against the input source with "
+              "%s_token_tree_match_input().\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sfile_name name of snapshot file to read\n",
+                (_use_doxygen) ? "@param " : "Param: ");
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token_tree *%s success\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "    %sNULL failure, including a snapshot from another parser, "
+              "format\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "                version, incompatible host or "
+              "inconsistent nodes\n");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_load()
+
+  fprintf(of, "%s_token_tree *%s_token_tree_load(char *file_name)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_tree_snapshot_header *header;\n", parser_name);
+  fprintf(of, "  %s_token_tree *tree;\n", parser_name);
+  fprintf(of, "  struct stat st;\n");
+  fprintf(of, "  long at[7];\n");
+  fprintf(of, "  char *map;\n");
+  fprintf(of, "  int fd;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!file_name)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  fd = open(file_name, O_RDONLY);\n");
+  fprintf(of, "  if (fd < 0)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (fstat(fd, &st) ||\n");
+  fprintf(of, "      (st.st_size < (off_t)sizeof(*header)))\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    close(fd);\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, "
+              "fd, 0);\n");
+  fprintf(of, "  close(fd);\n");
+  fprintf(of, "  if (map == MAP_FAILED)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  header = (%s_token_tree_snapshot_header *)map;\n",
+                parser_name);
+  fprintf(of, "  if (memcmp(header->magic, \"EMBTREE\", 8) ||\n");
+  fprintf(of, "      strncmp(header->parser, \"%s\", sizeof(header->parser)) "
+              "||\n",
+                parser_name);
+  fprintf(of, "      (header->version != %s_TOKEN_TREE_SNAPSHOT_VERSION) ||\n",
+                u_parser_name);
+  fprintf(of, "      (header->byte_order != 0x01020304) ||\n");
+  fprintf(of, "      (header->type_size != sizeof(%s_token_type)) ||\n",
+                parser_name);
+  fprintf(of, "      (header->long_size != sizeof(long)) ||\n");
+  fprintf(of, "      (header->has_source &&\n");
+  fprintf(of, "       (header->source_length != header->input_length)) ||\n");
+  fprintf(of, "      (header->source_length > (uint64_t)st.st_size) ||\n");
+  fprintf(of, "      (snapshot_layout(header->count, header->source_length, "
+              "at) >\n");
+  fprintf(of, "       (long)st.st_size))\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    munmap(map, st.st_size);\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  tree = malloc(sizeof(%s_token_tree));\n", parser_name);
+  fprintf(of, "  if (!tree)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    munmap(map, st.st_size);\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  tree->count = header->count;\n");
+  fprintf(of, "  tree->type = (%s_token_type *)(map + at[0]);\n", parser_name);
+  fprintf(of, "  tree->ascendant = (%s_token_index *)(map + at[1]);\n",
+                parser_name);
+  fprintf(of, "  tree->descendant = (%s_token_index *)(map + at[2]);\n",
+                parser_name);
+  fprintf(of, "  tree->next = (%s_token_index *)(map + at[3]);\n", parser_name);
+  fprintf(of, "  tree->offset = (long *)(map + at[4]);\n");
+  fprintf(of, "  tree->length = (long *)(map + at[5]);\n");
+  fprintf(of, "  tree->child_index = NULL;\n");
+  fprintf(of, "  tree->child_index_size = 0;\n");
+  fprintf(of, "  tree->source = (header->has_source) ? map + at[6] : NULL;\n");
+  fprintf(of, "  tree->source_length = (header->has_source) ? "
+              "header->source_length : 0;\n");
+  fprintf(of, "  tree->line_start = NULL;\n");
+  fprintf(of, "  tree->line_count = 0;\n");
+  fprintf(of, "  tree->mapping = map;\n");
+  fprintf(of, "  tree->mapping_size = st.st_size;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!check_nodes(tree, header))\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    %s_token_tree_free(tree);\n", parser_name);
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return tree;\n");
+  fprintf(of, "}\n");
+
+    // Emit comment block for <PROJECT>_token_tree_match_input()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sCheck that the input source is the one a tree was parsed "
+              "from\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    A snapshot records the length and a hash of the input it "
+              "was parsed\n");
+  fprintf(of, "    from.  The offsets of a tree loaded without embedded input "
+              "text refer\n");
+  fprintf(of, "    to the input source, so it should be checked with this "
+              "function before\n");
+  fprintf(of, "    text or locations are read through it.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s1 input source matches, or tree was not loaded from a "
+              "snapshot\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "    %s0 input source differs\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_match_input()
+
+  fprintf(of, "int %s_token_tree_match_input(%s_token_tree *tree)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_tree_snapshot_header *header;\n", parser_name);
+  fprintf(of, "  long length;\n");
+  fprintf(of, "  uint64_t hash;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree)\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree->mapping)\n");
+  fprintf(of, "    return 1;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  header = (%s_token_tree_snapshot_header *)tree->mapping;\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  hash_input(&length, &hash);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return ((uint64_t)length == header->input_length) &&\n");
+  fprintf(of, "         (hash == header->input_hash);\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+    // Emit comment block for <PROJECT>_token_tree_get_source()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns input text embedded in %s_token_tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %stree   %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %slength long * to receive count of bytes, or NULL\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "    %s%schar *%s embedded input text, which is not NUL "
+              "terminated\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "    %sNULL no text is embedded, it is read from the input "
+              "source\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_get_source()
+
+  fprintf(of, "char *%s_token_tree_get_source(%s_token_tree *tree, long "
+              "*length)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (length)\n");
+  fprintf(of, "    *length = (tree) ? tree->source_length : 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree)\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return tree->source;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_get_location()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sGets line + offset location of node in %s_token_tree\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    When input text is embedded in the tree, an index of its "
+              "line starts\n");
+  fprintf(of, "    is built the first time a location is asked for.  Otherwise "
+              "the\n");
+  fprintf(of, "    location comes from %s_token_get_location(), which reads "
+              "the input\n",
+                parser_name);
+  fprintf(of, "    source.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %stree     %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %si        %s_token_index of node\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "    %slocation input_location * to receive the location\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_get_location()
+
+  fprintf(of, "void %s_token_tree_get_location(%s_token_tree *tree,\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token_index i,\n", parser_name);
+  fprintf(of, "  input_location *location)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token leaf;\n", parser_name);
+  fprintf(of, "  long lo;\n");
+  fprintf(of, "  long hi;\n");
+  fprintf(of, "  long mid;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!location)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  location->line_number = 0;\n");
+  fprintf(of, "  location->character_offset = 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree || (i >= tree->count))\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree->source)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    memset(&leaf, 0, sizeof(%s_token));\n", parser_name);
+  fprintf(of, "    leaf.offset = tree->offset[i];\n");
+  fprintf(of, "    %s_token_get_location(&leaf, location);\n", parser_name);
+  fprintf(of, "    return;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree->line_start && !index_lines(tree))\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  lo = 0;\n");
+  fprintf(of, "  hi = tree->line_count - 1;\n");
+  fprintf(of, "  while (lo < hi)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    mid = (lo + hi + 1) / 2;\n");
+  fprintf(of, "    if (tree->line_start[mid] <= tree->offset[i])\n");
+  fprintf(of, "      lo = mid;\n");
+  fprintf(of, "    else\n");
+  fprintf(of, "      hi = mid - 1;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  location->line_number = lo + 1;\n");
+  fprintf(of, "  location->character_offset = tree->offset[i] - "
+              "tree->line_start[lo];\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>_token_tree_span_to_string()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sAppend input text matched by one node to a string\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    Unlike %s_token_tree_to_string(), only the text of node i "
+              "itself is\n",
+                parser_name);
+  fprintf(of, "    appended, not the text of its following siblings.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %si    %s_token_index of node\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "    %ss    existing string to append to, or NULL\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "    %s%schar *%s s with the text of node i appended\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>_token_tree_span_to_string()
+
+  fprintf(of, "char *%s_token_tree_span_to_string(%s_token_tree *tree,\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token_index i,\n", parser_name);
+  fprintf(of, "  char *s)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token leaf;\n", parser_name);
+  fprintf(of, "  char *ns;\n");
+  fprintf(of, "  long used;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree || (i >= tree->count))\n");
+  fprintf(of, "    return s;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!tree->source)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    memset(&leaf, 0, sizeof(%s_token));\n", parser_name);
+  fprintf(of, "    leaf.type = tree->type[i];\n");
+  fprintf(of, "    leaf.offset = tree->offset[i];\n");
+  fprintf(of, "    leaf.length = tree->length[i];\n");
+  fprintf(of, "    return %s_token_span_to_string(&leaf, s);\n", parser_name);
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if ((tree->length[i] <= 0) ||\n");
+  fprintf(of, "      (tree->offset[i] + tree->length[i] > "
+              "tree->source_length))\n");
+  fprintf(of, "    return s;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  used = (s) ? strlen(s) : 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  ns = realloc(s, used + tree->length[i] + 1);\n");
+  fprintf(of, "  if (!ns)\n");
+  fprintf(of, "    return s;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  memcpy(ns + used, tree->source + tree->offset[i], "
+              "tree->length[i]);\n");
+  fprintf(of, "  ns[used + tree->length[i]] = 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return ns;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+    // Emit comment block for subtree_end()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sReturns the index just past the subtree of a node\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree *\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %si    %s_token_index of node, or %s_TOKEN_INDEX_NONE for\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name,
+                u_parser_name);
+  fprintf(of, "                the whole tree\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token_index%s end of subtree\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for subtree_end()
+
+  fprintf(of, "static %s_token_index subtree_end(%s_token_tree *tree, "
+              "%s_token_index i)\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  while ((i != %s_TOKEN_INDEX_NONE) &&\n", u_parser_name);
+  fprintf(of, "         (tree->next[i] == %s_TOKEN_INDEX_NONE))\n",
+                u_parser_name);
+  fprintf(of, "    i = tree->ascendant[i];\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (i == %s_TOKEN_INDEX_NONE)\n", u_parser_name);
+  fprintf(of, "    return tree->count;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return tree->next[i];\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for child_slot()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sLocate child index slot for (ascendant, type) key\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree * with child index\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %sa    %s_token_index of ascendant\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "    %stype %s_token_type\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token_index%s slot holding the key, or the empty "
+              "slot\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "                where it would be inserted\n");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for child_slot()
+
+  fprintf(of, "static %s_token_index child_slot(%s_token_tree *tree,\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token_index a,\n", parser_name);
+  fprintf(of, "  %s_token_type type)\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_index mask;\n", parser_name);
+  fprintf(of, "  %s_token_index s;\n", parser_name);
+  fprintf(of, "  %s_token_index c;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  mask = tree->child_index_size - 1;\n");
+  fprintf(of, "  s = ((a * 2654435761u) ^ (%s_token_index)type) & mask;\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  while ((c = tree->child_index[s]) != %s_TOKEN_INDEX_NONE)\n",
+                u_parser_name);
+  fprintf(of, "  {\n");
+  fprintf(of, "    if ((tree->ascendant[c] == a) && "
+              "(tree->type[c] == type))\n");
+  fprintf(of, "      break;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    s = (s + 1) & mask;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return s;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+    // Emit comment block for snapshot_layout()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sCompute where each part of a snapshot file starts\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %scount         count of nodes in tree\n",
+                (_use_doxygen) ? "@param " : "Param: ");
+  fprintf(of, "    %ssource_length count of bytes of embedded input text\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "    %sat            array of 7 longs to receive the starting "
+              "offsets\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "                         of the type, ascendant, descendant, "
+              "next, offset\n");
+  fprintf(of, "                         and length arrays, and of the input "
+              "text\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %slong total size of snapshot file\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for snapshot_layout()
+
+  fprintf(of, "static long snapshot_layout(%s_token_index count,\n",
+                parser_name);
+  fprintf(of, "  long source_length,\n");
+  fprintf(of, "  long *at)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  long size[6];\n");
+  fprintf(of, "  long end;\n");
+  fprintf(of, "  int k;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  size[0] = count * (long)sizeof(%s_token_type);\n",
+                parser_name);
+  fprintf(of, "  size[1] = count * (long)sizeof(%s_token_index);\n",
+                parser_name);
+  fprintf(of, "  size[2] = size[1];\n");
+  fprintf(of, "  size[3] = size[1];\n");
+  fprintf(of, "  size[4] = count * (long)sizeof(long);\n");
+  fprintf(of, "  size[5] = size[4];\n");
+  fprintf(of, "\n");
+  fprintf(of, "  end = sizeof(%s_token_tree_snapshot_header);\n", parser_name);
+  fprintf(of, "  for (k = 0; k < 6; ++k)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    at[k] = (end + 7) & ~7L;\n");
+  fprintf(of, "    end = at[k] + size[k];\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "  at[6] = (end + 7) & ~7L;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return at[6] + source_length;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for snapshot_write()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sWrite part of a snapshot file at a given offset\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    The file is padded with zero bytes up to the offset first, "
+              "so parts\n");
+  fprintf(of, "    must be written in order.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sf    FILE * of open snapshot file\n",
+                (_use_doxygen) ? "@param " : "Param: ");
+  fprintf(of, "    %sdata bytes to write, or NULL to only pad\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "    %ssize count of bytes to write\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "    %sat   offset in file at which data starts\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "    %s1 success\n", (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "    %s0 failure\n", (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for snapshot_write()
+
+  fprintf(of, "static int snapshot_write(FILE *f, void *data, long size, long "
+              "at)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  long pos;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  pos = ftell(f);\n");
+  fprintf(of, "  if (pos < 0)\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  for (; pos < at; ++pos)\n");
+  fprintf(of, "    if (fputc(0, f) == EOF)\n");
+  fprintf(of, "      return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!data || (size <= 0))\n");
+  fprintf(of, "    return 1;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return (fwrite(data, 1, size, f) == (size_t)size);\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for index_lines()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sBuild index of line starts of input text embedded in "
+              "tree\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %stree %s_token_tree * with embedded input text\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s1 success\n", (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "    %s0 failure\n", (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for index_lines()
+
+  fprintf(of, "static int index_lines(%s_token_tree *tree)\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  char *p;\n");
+  fprintf(of, "  char *end;\n");
+  fprintf(of, "  long n;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  end = tree->source + tree->source_length;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  n = 1;\n");
+  fprintf(of, "  for (p = tree->source; (p = memchr(p, '\\n', end - p)); "
+              "++p)\n");
+  fprintf(of, "    ++n;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  tree->line_start = malloc(n * sizeof(long));\n");
+  fprintf(of, "  if (!tree->line_start)\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  tree->line_start[0] = 0;\n");
+  fprintf(of, "  tree->line_count = 1;\n");
+  fprintf(of, "  for (p = tree->source; (p = memchr(p, '\\n', end - p)); "
+              "++p)\n");
+  fprintf(of, "    tree->line_start[tree->line_count++] = p + 1 - "
+              "tree->source;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return 1;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+    // Emit comment block for check_nodes()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sCheck the node arrays of a loaded snapshot\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    Nodes are stored in pre-order, so the ascendant of a node "
+              "comes before\n");
+  fprintf(of, "    it, its first descendant directly follows it, and its next "
+              "sibling\n");
+  fprintf(of, "    comes later and shares its ascendant.  Every type must be "
+              "known, every\n");
+  fprintf(of, "    span must lie within the input the tree was parsed from, "
+              "and embedded\n");
+  fprintf(of, "    input text must match the recorded hash.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %stree   %s_token_tree * just loaded\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %sheader %s_token_tree_snapshot_header * of its snapshot\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s1 nodes are consistent\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "    %s0 snapshot is damaged or altered\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for check_nodes()
+
+  fprintf(of, "static int check_nodes(%s_token_tree *tree,\n", parser_name);
+  fprintf(of, "  %s_token_tree_snapshot_header *header)\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_index i;\n", parser_name);
+  fprintf(of, "  %s_token_index n;\n", parser_name);
+  fprintf(of, "  long length;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  length = (long)header->input_length;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (tree->source &&\n");
+  fprintf(of, "      (snapshot_hash(%s_TOKEN_TREE_HASH_BASIS,\n",
+                u_parser_name);
+  fprintf(of, "                     (unsigned char *)tree->source,\n");
+  fprintf(of, "                     tree->source_length) != "
+              "header->input_hash))\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  for (i = 0; i < tree->count; ++i)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    if ((unsigned long)tree->type[i] >= "
+              "%s_TOKEN_TYPE_COUNT)\n",
+                u_parser_name);
+  fprintf(of, "      return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    n = tree->ascendant[i];\n");
+  fprintf(of, "    if ((n != %s_TOKEN_INDEX_NONE) && (n >= i))\n",
+                u_parser_name);
+  fprintf(of, "      return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    n = tree->descendant[i];\n");
+  fprintf(of, "    if ((n != %s_TOKEN_INDEX_NONE) &&\n", u_parser_name);
+  fprintf(of, "        ((n != i + 1) || (n >= tree->count) || "
+              "(tree->ascendant[n] != i)))\n");
+  fprintf(of, "      return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    n = tree->next[i];\n");
+  fprintf(of, "    if ((n != %s_TOKEN_INDEX_NONE) &&\n", u_parser_name);
+  fprintf(of, "        ((n <= i) || (n >= tree->count) ||\n");
+  fprintf(of, "         (tree->ascendant[n] != tree->ascendant[i])))\n");
+  fprintf(of, "      return 0;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    if ((tree->offset[i] < 0) || (tree->length[i] < 0) ||\n");
+  fprintf(of, "        (tree->offset[i] > length) ||\n");
+  fprintf(of, "        (tree->length[i] > length - tree->offset[i]))\n");
+  fprintf(of, "      return 0;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return 1;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for hash_input()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sMeasure and hash the whole input source\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    The input position is restored afterwards.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %slength long * to receive count of bytes of input\n",
+                (_use_doxygen) ? "@param " : "Param: ");
+  fprintf(of, "    %shash   uint64_t * to receive hash of input\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for hash_input()
+
+  fprintf(of, "static void hash_input(long *length, uint64_t *hash)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  unsigned char b;\n");
+  fprintf(of, "  long pos;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  *length = 0;\n");
+  fprintf(of, "  *hash = %s_TOKEN_TREE_HASH_BASIS;\n", u_parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  pos = input_get_position();\n");
+  fprintf(of, "  input_set_position(0);\n");
+  fprintf(of, "  while (!input_eof())\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    b = input_byte();\n");
+  fprintf(of, "    *hash = snapshot_hash(*hash, &b, 1);\n");
+  fprintf(of, "    ++*length;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "  input_set_position(pos);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for snapshot_hash()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sContinue an FNV-1a hash over a run of bytes\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %shash   uint64_t hash so far, %s_TOKEN_TREE_HASH_BASIS to "
+              "start\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                u_parser_name);
+  fprintf(of, "    %sbytes unsigned char * to bytes to hash\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "    %scount long count of bytes\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "    %suint64_t hash including the bytes\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for snapshot_hash()
+
+  fprintf(of, "static uint64_t snapshot_hash(uint64_t hash,\n");
+  fprintf(of, "  unsigned char *bytes,\n");
+  fprintf(of, "  long count)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  long i;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  for (i = 0; i < count; ++i)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    hash ^= bytes[i];\n");
+  fprintf(of, "    hash *= %s_TOKEN_TREE_HASH_PRIME;\n", u_parser_name);
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return hash;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+    // Clean up
+
+  free(u_parser_name);
+
+  return;
+}
+
+  /*!
+
+     \brief Generates \<PROJECT\>-walker.c source code file.
+    
+     This function generates the source code for \<PROJECT\>-walker.c\n
+     \n
+     The walker source file contains the code for a generic grammar walking
+     utility command.  The walker utility will walk any given file and apply
+     the \<PROJECT\> grammar rules to the file.  On success, the walker will
+     dump all the parsed phrases in the input file to \b stdout.  This
+     utility can optionally just check for correct grammar structure of the
+     input file.
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the root token from which
+                        the source code is generated
+
+  */
+
+void generate_walker_source(FILE *of,
+                            char *parser_name,
+                            egg_token *t)
+{
+  phrase_map_item *pml;
+  phrase_map_item *pmi;
+  char *phrase_name;
+  int opt_count = 0;
+  char *fn;
+  char *u_parser_name;   // Upper case version of parser name
+
+    // Sanity check parameters
+
+  if (!of)
+    of = stdout;
+
+  if (!parser_name)
+    return;
+
+  if (!t)
+    return;
+
+    // Create a top level phrase map of all grammar phrases
+
+  pml = phrase_map(t);
+  phrase_map_list_isolate_top_level_phrases(&pml);
+
+    // Force parser name to upper case
+
+  u_parser_name = str_toupper(strdup(parser_name));
+
+    // Emit the file level comment block
+
+  fn = make_file_name(parser_name, "walker.c");
+  generator_set_file_name(fn);
+  emit_source_comment_header(of);
+  free(fn);
+
+    // Emit code for included header files
+
+  fprintf(of, "#include <stdio.h>\n");
+  fprintf(of, "#include <stdlib.h>\n");
+  fprintf(of, "#include <string.h>\n");
+  fprintf(of, "#include <getopt.h>\n");
+  fprintf(of, "\n");
+
+    // Emit code for project related header files
+
+  fprintf(of, "#include \"gray/input.h\"\n");
+
+    // Emit code for project related header files
+  fprintf(of, "#include \"%s-token.h\"\n", parser_name);
+  fprintf(of, "#include \"%s-token-util.h\"\n", parser_name);
+  fprintf(of, "#include \"%s-token-tree.h\"\n", parser_name);
+  fprintf(of, "#include \"%s-parser.h\"\n", parser_name);
+  fprintf(of, "\n");
+
+    // Emit code for module constants
+
+  fprintf(of, "#define FALSE 0\n");
+  fprintf(of, "#define TRUE 1\n");
+  fprintf(of, "\n");
+
+    // Emit code for function declarations
+
+  fprintf(of, "static void usage(void);\n");
+  fprintf(of, "static void version(void);\n");
+  fprintf(of, "static void walk(%s_token *t, int level);\n", parser_name);
+  fprintf(of, "static void walk_tree(%s_token_tree *tree);\n", parser_name);
+  fprintf(of, "static void print_text(char *s);\n");
+  fprintf(of, "static int walk_snapshot(char *snapshot_file, "
+              "char *input_file);\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>-walker's main() function
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "     %smain function for %s %s-walker utility command.\n",
+                (_use_doxygen) ? "@brief " : "",
+                (_use_doxygen) ? "@b" : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "     This is the main function for the %s %s-walker "
+              "utility.%s\n",
+                (_use_doxygen) ? "@b" : "",
+                parser_name,
+                (_use_doxygen) ? "@n" : "");
+  fprintf(of, "       - Accepts and parses command line arguments\n");
+  fprintf(of, "       - Initializes the input source\n");
+  fprintf(of, "       - Parses the input using the specified phrase(s)\n");
+  fprintf(of, "       - Walks the %s_token tree and displays each %s_token\n",
+                parser_name,
+                parser_name);
+  fprintf(of, "       - Cleans up input source and other data\n");
+  fprintf(of, "\n");
+  fprintf(of, "     @param argc count of command line arguments\n");
+  fprintf(of, "     @param argv array of command line argument strings\n");
+  fprintf(of, "\n");
+  fprintf(of, "     @retval 0 success\n");
+  fprintf(of, "     @retval 1 any failure\n");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>-walker's main() function
+
+  fprintf(of, "int main(int argc, char **argv)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  int c;\n");
+  fprintf(of, "  extern char *optarg;\n");
+  fprintf(of, "  extern int optind;\n");
+  fprintf(of, "  int long_index;\n");
+  fprintf(of, "  struct option long_opts[] =\n");
+  fprintf(of, "  {\n");
+  pmi = pml;
+  while (pmi)
+  {
+    fprintf(of, "    { \"");
+    fprintf(of, "%s", pmi->name);
+    fprintf(of, "\", 0, 0, 0 },\n");
+    fprintf(of, "\n");
+    pmi = pmi->next;
+  }
+  fprintf(of, "    { 0, 0, 0, 0 }\n");
+  fprintf(of, "  };\n");
+  fprintf(of, "  unsigned char syntax_only = FALSE;\n");
+  fprintf(of, "  unsigned char compact = FALSE;\n");
+  fprintf(of, "  unsigned char embed_source = FALSE;\n");
+  fprintf(of, "  char *snapshot_in = NULL;\n");
+  fprintf(of, "  char *snapshot_out = NULL;\n");
+  pmi = pml;
+  while (pmi)
+  {
+    phrase_name = fix_identifier(strdup(pmi->name));
+    fprintf(of, "  unsigned char walk_%s = FALSE;\n", phrase_name);
+    free(phrase_name);
+    pmi = pmi->next;
+  }
+  fprintf(of, "  %s_token *t = NULL;\n", parser_name);
+  fprintf(of, "  %s_token_tree *tree;\n", parser_name);
+  if (_use_recognizer)
+    fprintf(of, "  unsigned char passed = FALSE;\n");
+  if (_use_context)
+    fprintf(of, "  %s_context *ctx;\n", parser_name);
+  fprintf(of, "  char *input_file;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  while ((c = getopt_long(argc, argv, \"cel:o:svh\", long_opts, "
+              "&long_index)) != -1)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    switch (c)\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      case 0:\n");
+  fprintf(of, "        switch (long_index)\n");
+  fprintf(of, "        {\n");
+  pmi = pml;
+  opt_count = 0;
+  while (pmi)
+  {
+    phrase_name = fix_identifier(strdup(pmi->name));
+    fprintf(of, "          case %d:\n", opt_count);
+    fprintf(of, "            walk_%s = TRUE;\n", phrase_name);
+    fprintf(of, "            break;\n");
+    free(phrase_name);
+    pmi = pmi->next;
+    ++opt_count;
+  }
+  fprintf(of, "          default:\n");
+  fprintf(of, "            break;\n");
+  fprintf(of, "        }\n");
+  fprintf(of, "        break;\n");
+  fprintf(of, "      case 'c':\n");
+  fprintf(of, "        compact = TRUE;\n");
+  fprintf(of, "        break;\n");
+  fprintf(of, "      case 'e':\n");
+  fprintf(of, "        embed_source = TRUE;\n");
+  fprintf(of, "        break;\n");
+  fprintf(of, "      case 'l':\n");
+  fprintf(of, "        snapshot_in = optarg;\n");
+  fprintf(of, "        break;\n");
+  fprintf(of, "      case 'o':\n");
+  fprintf(of, "        snapshot_out = optarg;\n");
+  fprintf(of, "        break;\n");
+  fprintf(of, "      case 's':\n");
+  fprintf(of, "        syntax_only = TRUE;\n");
+  fprintf(of, "        break;\n");
+  fprintf(of, "      case 'v':\n");
+  fprintf(of, "        version();\n");
+  fprintf(of, "        return 0;\n");
+  fprintf(of, "      case 'h':\n");
+  fprintf(of, "      default:\n");
+  fprintf(of, "        version();\n");
+  fprintf(of, "        usage();\n");
+  fprintf(of, "        return 1;\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  input_file = NULL;\n");
+  fprintf(of, "  if (optind < argc)\n");
+  fprintf(of, "    if (strcmp(argv[optind], \"-\"))\n");
+  fprintf(of, "      input_file = strdup(argv[optind]);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (snapshot_in)\n");
+  fprintf(of, "    return walk_snapshot(snapshot_in, input_file);\n");
+  fprintf(of, "\n");
+  if (_use_context)
+    fprintf(of, "  if (!input_initialize(input_file))\n");
+  else
+    fprintf(of, "  if (!%s_input_initialize(input_file))\n", parser_name);
+  fprintf(of, "    return 1;\n");
+  fprintf(of, "\n");
+  if (_use_context)
+  {
+    fprintf(of, "  if (!(ctx = %s_context_new_from_input()))\n", parser_name);
+    fprintf(of, "  {\n");
+    fprintf(of, "    input_cleanup();\n");
+    fprintf(of, "    return 1;\n");
+    fprintf(of, "  }\n");
+  }
+  else
+    fprintf(of, "  %s_input_buffer_load();\n", parser_name);
+  fprintf(of, "\n");
+  pmi = pml;
+  while (pmi)
+  {
+    phrase_name = fix_identifier(strdup(pmi->name));
+    if (_use_recognizer)
+    {
+        // Syntax checks use the phrase recognizer, which builds no tree
+
+      fprintf(of, "  if (walk_%s && syntax_only)\n", phrase_name);
+      fprintf(of, "  {\n");
+      fprintf(of, "    passed = (recognize_%s(%s) >= 0);\n",
+                    phrase_name, _in_arg);
+      fprintf(of, "    printf(\"%%s.\\n\", (passed) ? \"Passed\" : "
+                  "\"Failed\");\n");
+      fprintf(of, "  }\n");
+      fprintf(of, "  else if (walk_%s)\n", phrase_name);
+    }
+    else
+      fprintf(of, "  if (walk_%s)\n", phrase_name);
+    fprintf(of, "  {\n");
+    fprintf(of, "    t = %s(%s);\n", phrase_name, _in_arg);
+    free(phrase_name);
+    fprintf(of, "    if (t)\n");
+    fprintf(of, "    {\n");
+    if (!_use_recognizer)
+    {
+      fprintf(of, "      if (syntax_only)\n");
+      fprintf(of, "        printf(\"Passed.\\n\");\n");
+      fprintf(of, "      else ");
+    }
+    else
+      fprintf(of, "      ");
+    fprintf(of, "if (snapshot_out)\n");
+    fprintf(of, "      {\n");
+    fprintf(of, "        tree = %s_token_tree_new(t);\n", parser_name);
+    fprintf(of, "        if (!%s_token_tree_save(tree, snapshot_out, "
+                "embed_source))\n",
+                  parser_name);
+    fprintf(of, "        {\n");
+    fprintf(of, "          fprintf(stderr, \"Unable to write %%s\\n\", "
+                "snapshot_out);\n");
+    fprintf(of, "          t = NULL;\n");
+    fprintf(of, "        }\n");
+    fprintf(of, "        %s_token_tree_free(tree);\n", parser_name);
+    fprintf(of, "      }\n");
+    fprintf(of, "      else if (compact)\n");
+    fprintf(of, "      {\n");
+    fprintf(of, "        tree = %s_token_tree_new(t);\n", parser_name);
+    fprintf(of, "        walk_tree(tree);\n");
+    fprintf(of, "        %s_token_tree_free(tree);\n", parser_name);
+    fprintf(of, "      }\n");
+    fprintf(of, "      else\n");
+    fprintf(of, "        walk(t, 0);\n");
+    fprintf(of, "    }\n");
+    fprintf(of, "    else\n");
+    fprintf(of, "      printf(\"Failed.\\n\");\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    pmi = pmi->next;
+  }
+  if (_use_context)
+    fprintf(of, "  %s_context_delete(ctx);\n", parser_name);
+  else
+    fprintf(of, "  %s_input_buffer_release();\n", parser_name);
+  fprintf(of, "  input_cleanup();\n");
+  fprintf(of, "\n");
+  fprintf(of, "  %s_token_arena_release();\n", parser_name);
+  if ((_use_memo || _memo_phrases) && !_use_context)
+    fprintf(of, "  %s_memo_release();\n", parser_name);
+  fprintf(of, "\n");
+  if (_use_recognizer)
+    fprintf(of, "  if (!t && !passed)\n");
+  else
+    fprintf(of, "  if (!t)\n");
+  fprintf(of, "    return 1;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return 0;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>-walker's usage() function
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "     %s Displays usage/help message in conventional format.\n",
+                (_use_doxygen) ? "@brief" : "");
+  fprintf(of, "\n");
+  fprintf(of, "     This function displays a help and usage message for the "
+              "%s %s-walker\n",
+                (_use_doxygen) ? "@b" : "",
+                parser_name);
+  fprintf(of, "     utility in the mostly ubiquitous POSIX/GNU format.\n");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+  if (_use_external_usage)
+  {
+      // Emit include directive for <PROJECT>-walker's usage() function
+
+    fprintf(of, "#include \"%s-walker-usage.inc\"\n", parser_name);
+    fprintf(of, "\n");
+  }
+  else
+  {
+      // Emit code for <PROJECT>-walker's usage() function
+
+    fprintf(of, "static void usage(void)\n");
+    fprintf(of, "{\n");
+
+    fprintf(of, "  fprintf(stderr, \"\\nUSAGE:\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"    %s-walker [--grammar] [-c] [-s] [-o SNAPSHOT [-e]] "
+                "[EGG_FILE]\\n\");\n",
+      parser_name);
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"    %s-walker -l SNAPSHOT [EGG_FILE]\\n\");\n",
+      parser_name);
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr, \"    %s-walker -v, --version\\n\");\n",
+      parser_name);
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr, \"    %s-walker -h, --help\\n\");\n",
+      parser_name);
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr, \"\\nOPTIONS:\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr, \"    -h, --help\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"        Display a usage message on STDERR, \"\n");
+    fprintf(of, "    \"which includes the program version.\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr, \"    -v, --version\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of,
+      "    \"        Display the program version on STDERR.\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr, \"    [--grammar]\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"        Indicates the top-level phrase name from \"\n");
+    fprintf(of, "    \"which the phrase dump will begin.\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"        NOTE:  Although the --grammar option is \"\n");
+    fprintf(of, "    \"not strictly required by\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"               %s-walker, nothing meaningful will \"\n",
+      parser_name);
+    fprintf(of, "    \"be processed without\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"               this option.\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr, \"    [-c]\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"        Walk the compact (index based) token tree \"\n");
+    fprintf(of, "    \"instead of the linked\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"        token tree.  The output is the same as for \"\n");
+    fprintf(of, "    \"the linked tree.\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr, \"    [-e]\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"        Embed the input text in the snapshot \"\n");
+    fprintf(of, "    \"written by -o, so that it can\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"        be walked without the input file.\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr, \"    -l SNAPSHOT\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"        Walk the token tree snapshot in SNAPSHOT \"\n");
+    fprintf(of, "    \"instead of parsing input.\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"        The output is the same as for -c.  \"\n");
+    fprintf(of, "    \"Unless the input text is embedded,\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"        EGG_FILE must name the input the snapshot \"\n");
+    fprintf(of, "    \"was written from.\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr, \"    [-o SNAPSHOT]\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"        Write a binary snapshot of the compact \"\n");
+    fprintf(of, "    \"token tree to SNAPSHOT instead\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"        of dumping it.  The snapshot can be \"\n");
+    fprintf(of, "    \"loaded again by -l.\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr, \"    [-s]\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of,
+      "    \"        Flag to control the output reported.  When \"\n");
+    fprintf(of, "    \"this flag is present, the\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of, "    \"        output will be either 'Passed' or \"\n");
+    fprintf(of, "    \"'Failed'.\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "  fprintf(stderr, \"    [EGG_FILE]\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of,
+      "    \"        Specify the name of the EGG file.  A single '-' \"\n");
+    fprintf(of, "    \"character will read\\n\");\n");
+    fprintf(of, "  fprintf(stderr,\n");
+    fprintf(of,
+      "    \"        input from STDIN.  Defaults to STDIN.\\n\");\n");
+    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
+
+    // Emit comment block for <PROJECT>-walker's version() function
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "     %s Display command version.\n",
+                (_use_doxygen) ? "@brief" : "");
+  fprintf(of, "\n");
+  fprintf(of, "     This function displays the current version of this "
+              "command.\n");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>-walker's version() function
+
+  fprintf(of, "static void version(void)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  fprintf(stderr, \"\\n\"\n");
+  fprintf(of, "       \"%s-walker - %s grammar walker.\\n\"\n",
+                parser_name, parser_name);
+  fprintf(of, "       \"%*.*s          Version %s\\n\"\n",
+                (int)strlen(parser_name), (int)strlen(parser_name), " ",
+                _version);
+  fprintf(of, "       \"\\n\");\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>-walker's walk() function
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "     %s Walks a %s_token tree.\n",
+                (_use_doxygen) ? "@brief" : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "     This function walks %s_token tree, and displays each "
+              "%s_token.\n",
+                parser_name,
+                parser_name);
+  fprintf(of, "     Leaf tokens are followed by the input text of their "
+              "span, as\n");
+  fprintf(of, "     displayed by print_text().\n");
+  fprintf(of, "\n");
+  fprintf(of, "     %st %s_token * to root of %s_token tree\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name,
+                parser_name);
+  fprintf(of, "     %slevel int indentation level of t\n",
+                (_use_doxygen) ? "@param " : "Param: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>-walker's walk() function
+
+  fprintf(of, "static void walk(%s_token *t, int level)\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_iterator it;\n", parser_name);
+  fprintf(of, "  input_location location;\n");
+  fprintf(of, "  int depth;\n");
+  fprintf(of, "  char *s;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  %s_token_iterator_init(&it, t, %s_token_pre_order);\n",
+                parser_name, parser_name);
+  fprintf(of, "  while ((t = %s_token_iterator_next(&it)))\n", parser_name);
+  fprintf(of, "  {\n");
+  fprintf(of, "    depth = level + %s_token_iterator_get_depth(&it);\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s_token_get_location(t, &location);\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    s = NULL;\n");
+  fprintf(of, "    if (!t->descendant)\n");
+  fprintf(of, "      s = %s_token_span_to_string(t, s);\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    printf(\"%%*.*s%%s@%%d.%%d\",\n"
+              "           depth, depth, \" \",\n"
+              "           %s_token_type_to_string(t),\n"
+              "           location.line_number,\n"
+              "           location.character_offset);\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    if (s)\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      putchar(' ');\n");
+  fprintf(of, "      print_text(s);\n");
+  fprintf(of, "      free(s);\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "    putchar('\\n');\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>-walker's walk_tree() function
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "     %sWalks a %s_token_tree.\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "     This function walks a %s_token_tree in index order, which "
+              "is the\n",
+                parser_name);
+  fprintf(of, "     same pre-order as walk(), and displays each token with its "
+              "location.\n");
+  fprintf(of, "     Leaf tokens are followed by the input text of their "
+              "span, as\n");
+  fprintf(of, "     displayed by print_text().\n");
+  fprintf(of, "\n");
+  fprintf(of, "     %stree  %s_token_tree * to walk\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>-walker's walk_tree() function
+
+  fprintf(of, "static void walk_tree(%s_token_tree *tree)\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token leaf;\n", parser_name);
+  fprintf(of, "  input_location location;\n");
+  fprintf(of, "  %s_token_index i;\n", parser_name);
+  fprintf(of, "  %s_token_index a;\n", parser_name);
+  fprintf(of, "  int level;\n");
+  fprintf(of, "  char *s;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  for (i = 0; i < %s_token_tree_get_count(tree); ++i)\n",
+                parser_name);
+  fprintf(of, "  {\n");
+  fprintf(of, "    level = 0;\n");
+  fprintf(of, "    for (a = %s_token_tree_get_ascendant(tree, i);\n",
+                parser_name);
+  fprintf(of, "         a != %s_TOKEN_INDEX_NONE;\n", u_parser_name);
+  fprintf(of, "         a = %s_token_tree_get_ascendant(tree, a))\n",
+                parser_name);
+  fprintf(of, "      ++level;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    memset(&leaf, 0, sizeof(%s_token));\n", parser_name);
+  fprintf(of, "    leaf.type = %s_token_tree_get_type(tree, i);\n",
+                parser_name);
+  fprintf(of, "    %s_token_tree_get_location(tree, i, &location);\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    s = NULL;\n");
+  fprintf(of, "    if (%s_token_tree_get_descendant(tree, i) == "
+              "%s_TOKEN_INDEX_NONE)\n",
+                parser_name, u_parser_name);
+  fprintf(of, "      s = %s_token_tree_span_to_string(tree, i, s);\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    printf(\"%%*.*s%%s@%%d.%%d\",\n");
+  fprintf(of, "           level, level, \" \",\n");
+  fprintf(of, "           %s_token_type_to_string(&leaf),\n", parser_name);
+  fprintf(of, "           location.line_number,\n");
+  fprintf(of, "           location.character_offset);\n");
+  fprintf(of, "\n");
+  fprintf(of, "    if (s)\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      putchar(' ');\n");
+  fprintf(of, "      print_text(s);\n");
+  fprintf(of, "      free(s);\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "    putchar('\\n');\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>-walker's print_text() function
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "     %sDisplays the input text of a token span.\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "     This function displays text on one line.  Newline, tab, "
+              "carriage\n");
+  fprintf(of, "     return and backslash bytes are displayed as C escape "
+              "sequences, and\n");
+  fprintf(of, "     any other control byte as a hexadecimal escape sequence, "
+              "so each\n");
+  fprintf(of, "     token keeps to one line of output.\n");
+  fprintf(of, "\n");
+  fprintf(of, "     %ss string of text\n",
+                (_use_doxygen) ? "@param " : "Param: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>-walker's print_text() function
+
+  fprintf(of, "static void print_text(char *s)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  unsigned char c;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  for (; *s; ++s)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    c = (unsigned char)*s;\n");
+  fprintf(of, "    if (c == '\\n')\n");
+  fprintf(of, "      printf(\"\\\\n\");\n");
+  fprintf(of, "    else if (c == '\\t')\n");
+  fprintf(of, "      printf(\"\\\\t\");\n");
+  fprintf(of, "    else if (c == '\\r')\n");
+  fprintf(of, "      printf(\"\\\\r\");\n");
+  fprintf(of, "    else if (c == '\\\\')\n");
+  fprintf(of, "      printf(\"\\\\\\\\\");\n");
+  fprintf(of, "    else if ((c < 0x20) || (c == 0x7f))\n");
+  fprintf(of, "      printf(\"\\\\x%%02x\", c);\n");
+  fprintf(of, "    else\n");
+  fprintf(of, "      putchar(c);\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for <PROJECT>-walker's walk_snapshot() function
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "     %sWalks a %s_token_tree snapshot.\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "     This function loads a snapshot written with the -o option, "
+              "and walks\n");
+  fprintf(of, "     it like walk_tree().  The input source is only opened when "
+              "the\n");
+  fprintf(of, "     snapshot does not embed the input text.\n");
+  fprintf(of, "\n");
+  fprintf(of, "     %ssnapshot_file name of snapshot file\n",
+                (_use_doxygen) ? "@param " : "Param: ");
+  fprintf(of, "     %sinput_file    name of input file, or NULL for STDIN\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "\n");
+  fprintf(of, "     %s0 success\n", (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "     %s1 any failure\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for <PROJECT>-walker's walk_snapshot() function
+
+  fprintf(of, "static int walk_snapshot(char *snapshot_file, char "
+              "*input_file)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_tree *tree;\n", parser_name);
+  fprintf(of, "  unsigned char use_input;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  tree = %s_token_tree_load(snapshot_file);\n", parser_name);
+  fprintf(of, "  if (!tree)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    fprintf(stderr, \"Unable to load %%s\\n\", "
+              "snapshot_file);\n");
+  fprintf(of, "    return 1;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  use_input = !%s_token_tree_get_source(tree, NULL);\n",
+                parser_name);
+  if (_use_context)
+    fprintf(of, "  if (use_input && !input_initialize(input_file))\n");
+  else
+    fprintf(of, "  if (use_input && !%s_input_initialize(input_file))\n",
+                  parser_name);
+  fprintf(of, "  {\n");
+  fprintf(of, "    %s_token_tree_free(tree);\n", parser_name);
+  fprintf(of, "    return 1;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (use_input && !%s_token_tree_match_input(tree))\n",
+                parser_name);
+  fprintf(of, "  {\n");
+  fprintf(of, "    fprintf(stderr, \"%%s was not parsed from this input\\n\", "
+              "snapshot_file);\n");
+  fprintf(of, "    %s_token_tree_free(tree);\n", parser_name);
+  fprintf(of, "    input_cleanup();\n");
+  fprintf(of, "    return 1;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  walk_tree(tree);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  %s_token_tree_free(tree);\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  if (use_input)\n");
+  fprintf(of, "    input_cleanup();\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return 0;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+  free(u_parser_name);
+
+  return;
+}
+
+  /*!
+
+     \brief Generates Makefile for \<PROJECT\> parser project.
+    
+     This function generates the Makefile for \<PROJECT\>\n
+     \n
+     The \<PROJECT\> Makefile contains all the make rules necessary to compile
+     and link all the generated source code from embryo and associated
+     utility actions, such as building a linkable library for the \<PROJECT\>
+     parsing modules, installation scripts for the library, header files,
+     and associated documention.
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+
+  */
+
+void generate_makefile(FILE *of,
+                       char *parser_name)
+{
+  if (!of)
+    of = stdout;
+
+  if (!parser_name)
+    return;
+
+  fprintf(of, "CC = gcc\n");
+
+  fprintf(of, "CFLAGS = -g -Wall -Wno-unused-but-set-variable -O0 \\\n"
+              "\t\t-I include \\\n"
+              "\t\t-I /usr/local/include/egg \\\n"
+              "\t\t-I /usr/include/egg \\\n"
+              "\t\t-L /usr/local/lib/egg \\\n"
+              "\t\t-L ./lib\n");
+  fprintf(of, "\n");
+
+  fprintf(of, "CFLAGS_ALL = $(CFLAGS)\n");
+  fprintf(of, "\n");
+
+  fprintf(of, "ifdef EGG_LIBRARY_PATH\n");
+  fprintf(of, "\tCFLAGS_ALL += -L $(EGG_LIBRARY_PATH)\n");
+  fprintf(of, "endif\n");
+  fprintf(of, "\n");
+
+  fprintf(of, "ifdef EGG_INCLUDE_PATH\n");
+  fprintf(of, "\tCFLAGS_ALL += -I $(EGG_INCLUDE_PATH)\n");
+  fprintf(of, "endif\n");
+  fprintf(of, "\n");
+
+    // Parallel parsing runs on POSIX threads
+
+  if (_use_parallel)
+  {
+    fprintf(of, "CFLAGS_ALL += -pthread\n");
+    fprintf(of, "\n");
+  }
+
+  fprintf(of, "all: %s-walker\n", parser_name);
+  fprintf(of, "\n");
+
+  fprintf(of, "%s-walker: bin/%s-walker\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+
+  fprintf(of, "bin/%s-walker: obj/%s-walker.o \\\n",
+                parser_name, parser_name);
+  fprintf(of, "\t\tlib/lib%s-parser.so.1.0\n", parser_name);
+  fprintf(of, "\t$(CC) $(CFLAGS_ALL) \\\n");
+  fprintf(of, "\t\t-o bin/%s-walker \\\n", parser_name);
+  fprintf(of, "\t\tobj/%s-walker.o \\\n", parser_name);
+  fprintf(of, "\t\t-legg-common \\\n");
+  fprintf(of, "\t\t-legg-parser\n");
+  fprintf(of, "\n");
+
+  fprintf(of, "lib%s-parser: lib/lib%s-parser.a lib/lib%s-parser.so.1.0\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "lib/lib%s-parser.so.1.0: obj/%s-parser.o \\\n",
+                parser_name, parser_name);
+  fprintf(of, "    obj/%s-token.o \\\n", parser_name);
+  fprintf(of, "    obj/%s-token-util.o \\\n", parser_name);
+  fprintf(of, "    obj/%s-token-tree.o\n", parser_name);
+  fprintf(of, "  $(CC) $(COPTS) --shared -Wl,-soname,lib%s-parser.so.1 \\\n",
+                parser_name);
+  fprintf(of, "    -o lib/lib%s-parser.so.1.0 \\\n", parser_name);
+  fprintf(of, "    obj/%s-parser.o \\\n", parser_name);
+  fprintf(of, "    obj/%s-token.o \\\n", parser_name);
+  fprintf(of, "    obj/%s-token-util.o \\\n", parser_name);
+  fprintf(of, "    obj/%s-token-tree.o\n", parser_name);
+  fprintf(of, "  @(cd lib; ln -sf lib%s-parser.so.1.0 lib%s-parser.so.1)\n",
+                parser_name, parser_name);
+  fprintf(of, "  @(cd lib; ln -sf lib%s-parser.so.1 lib%s-parser.so)\n",
+                parser_name, parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "lib/lib%s-parser.a: obj/%s-parser.o \\\n",
+                parser_name, parser_name);
+  fprintf(of, "    obj/%s-token.o \\\n", parser_name);
+  fprintf(of, "    obj/%s-token-util.o \\\n", parser_name);
+  fprintf(of, "    obj/%s-token-tree.o\n", parser_name);
+  fprintf(of, "  ar crD lib/lib%s-parser.a \\\n", parser_name);
+  fprintf(of, "    obj/%s-parser.o \\\n", parser_name);
+  fprintf(of, "    obj/%s-token.o \\\n", parser_name);
+  fprintf(of, "    obj/%s-token-util.o \\\n", parser_name);
+  fprintf(of, "    obj/%s-token-tree.o\n", parser_name);
+  fprintf(of, "\n");
+
+  fprintf(of, "obj/%s-walker.o: src/%s-walker.c \\\n",
+                parser_name, parser_name);
+  fprintf(of, "\t\tinclude/%s-token.h \\\n", parser_name);
+  fprintf(of, "\t\tinclude/%s-token-type.h \\\n", parser_name);
+  fprintf(of, "\t\tinclude/%s-token-util.h \\\n", parser_name);
+  fprintf(of, "\t\tinclude/%s-token-tree.h \\\n", parser_name);
+  fprintf(of, "\t\tinclude/%s-parser.h\n", parser_name);
+  fprintf(of, "\t$(CC) $(CFLAGS_ALL) \\\n");
+  fprintf(of, "\t\t-o obj/%s-walker.o \\\n", parser_name);
+  fprintf(of, "\t\t-c src/%s-walker.c\n", parser_name);
+  fprintf(of, "\n");
+
+  fprintf(of, "obj/%s-parser.o: "
+              "src/%s-parser.c \\\n",
+                parser_name, parser_name);
+  fprintf(of, "\t\tinclude/%s-parser.h \\\n", parser_name);
+  fprintf(of, "\t\tinclude/%s-token.h \\\n", parser_name);
+  fprintf(of, "\t\tinclude/%s-token-type.h\n", parser_name);
+  fprintf(of, "\t$(CC) $(CFLAGS_ALL) -fPIC\\\n");
+  fprintf(of, "\t\t-o obj/%s-parser.o \\\n", parser_name);
+  fprintf(of, "\t\t-c src/%s-parser.c\n", parser_name);
+  fprintf(of, "\n");
+
+  fprintf(of, "obj/%s-token.o: "
+              "src/%s-token.c \\\n",
+                parser_name, parser_name);
+  fprintf(of, "\t\tinclude/%s-token.h \\\n", parser_name);
+  fprintf(of, "\t\tinclude/%s-token-type.h \\\n", parser_name);
+  fprintf(of, "\t\tinclude/%s-token-util.h\n", parser_name);
+  fprintf(of, "\t$(CC) $(CFLAGS_ALL) -fPIC\\\n");
+  fprintf(of, "\t\t-o obj/%s-token.o \\\n", parser_name);
+  fprintf(of, "\t\t-c src/%s-token.c\n", parser_name);
+  fprintf(of, "\n");
+
+  fprintf(of, "obj/%s-token-util.o: "
+              "src/%s-token-util.c \\\n",
+                parser_name, parser_name);
+  fprintf(of, "\t\tinclude/%s-token.h \\\n", parser_name);
+  fprintf(of, "\t\tinclude/%s-token-type.h \\\n", parser_name);
+  fprintf(of, "\t\tinclude/%s-token-util.h\n", parser_name);
+  fprintf(of, "\t$(CC) $(CFLAGS_ALL) -fPIC\\\n");
+  fprintf(of, "\t\t-o obj/%s-token-util.o \\\n", parser_name);
+  fprintf(of, "\t\t-c src/%s-token-util.c\n", parser_name);
+  fprintf(of, "\n");
+
+  fprintf(of, "obj/%s-token-tree.o: "
+              "src/%s-token-tree.c \\\n",
+                parser_name, parser_name);
+  fprintf(of, "\t\tinclude/%s-token.h \\\n", parser_name);
+  fprintf(of, "\t\tinclude/%s-token-type.h \\\n", parser_name);
+  fprintf(of, "\t\tinclude/%s-token-tree.h\n", parser_name);
+  fprintf(of, "\t$(CC) $(CFLAGS_ALL) -fPIC\\\n");
+  fprintf(of, "\t\t-o obj/%s-token-tree.o \\\n", parser_name);
+  fprintf(of, "\t\t-c src/%s-token-tree.c\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "clean:\n");
+  fprintf(of, "\t@rm -f obj/*.o\n");
+  fprintf(of, "\t@rm -f lib/*\n");
+  fprintf(of, "\t@rm -f bin/%s-walker\n", parser_name);
+  fprintf(of, "\n");
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+    
+     This function is the highest level helper function for generating the
+     parser for \<PROJECT\>.\n
+     \n
+     This function basically scans each individual phrase in the token tree
+     of the parsed EGG file for \<PROJECT\>'s grammar and kicks off the
+     subsequent calls to lower level generator functions.
+
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the root token from which
+                        the source code is generated
+     \param level       the current indentation level for generated code
+
+  */
+
+static void generate_grammar(FILE *of,
+                             char *parser_name,
+                             egg_token *t,
+                             int level)
+{
+  egg_token_iterator it;
+
+  if (!t) return;
+
+  if (!parser_name)
+    return;
+
+  if (!of)
+    of = stdout;
+
+  egg_token_iterator_init(&it, t, egg_token_pre_order);
+  while ((t = egg_token_iterator_next(&it)))
+  {
+    switch (t->type)
+    {
+      case egg_token_type_phrase:
+        generate_phrase(of, parser_name, t);
+        break;
+      default:
+        break;
+    }
+  }
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+    
+     This function parses a phrase token and generates the appropriate
+     code for the phrase parsing function.\n
+     \n
+     A phrase consists of a phrase-name and a definition.  This function
+     directly generates the source for the phrase parsing function pre-amble
+     code, calls the subsequent definition code generating function, and then
+     closes out the code for the phrase parsing function.
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the phrase token from which
+                        the source code is generated
+
+  */
+
+static void generate_phrase(FILE *of,
+                            char *parser_name,
+                            egg_token *t)
+{
+  egg_token *pn;
+  egg_token *def;
+  alternative *alts;
+  first_set fs;
+  unsigned char guarded;
+  int n, i, k;
+  int length;
+
+  if (!t)
+    return;
+
+  if (t->type != egg_token_type_phrase)
+    return;
+
+  if (!parser_name)
+    return;
+
+  if (!of)
+    of = stdout;
+
+  _pns = _pns_f = NULL;
+  _memo_phrase = FALSE;
+  _inline_phrase = FALSE;
+
+  emit_phrase_comment_block(of, parser_name, t);
+
+  pn = egg_token_find_child(t, egg_token_type_phrase_name);
+  if (pn)
+  {
+    _pns = egg_token_to_string(pn->descendant, _pns);
+    if (_pns)
+    {
+      _pns_f = fix_identifier(strdup(_pns));
+
+      def = egg_token_find_child(t, egg_token_type_definition);
+
+        // Trivia phrases are parsed by their recognizers
+
+      if (!_recognize && is_trivia_phrase(_pns))
+      {
+        generate_trivia_phrase(of, parser_name);
+        free(_pns);
+        free(_pns_f);
+        return;
+      }
+
+        // Inlined phrases are parsed by a static inline function, which
+        // the phrase parsing function calls
+
+      if (!_recognize && phrase_map_list_find_item_by_name(_inl, _pns))
+        _inline_phrase = TRUE;
+
+        // Single byte phrases built from other phrases collapse into a span
+
+      _collapse_phrase = FALSE;
+      if (def && phrase_map_list_find_item_by_name(_sbl, _pns))
+        if (egg_token_find(def->descendant, egg_token_type_phrase_name))
+          _collapse_phrase = TRUE;
+
+        // Memoized phrases record their outcome at each input position,
+        // except in recognizers, which hold no tokens to record
+
+      if (!_recognize)
+        _memo_phrase = is_memo_phrase(_pns);
+
+        // Single byte phrases over a known set of bytes become one lookup
+
+      if (def && _first && phrase_map_list_find_item_by_name(_sbl, _pns))
+      {
+        fs = _first[phrase_map_list_get_item_index(_pml, _pns)];
+        if (emit_first_guard(NULL, &fs))
+        {
+          generate_class_phrase(of, parser_name, &fs);
+          if (_inline_phrase)
+            emit_inline_wrapper(of, parser_name);
+          free(_pns);
+          free(_pns_f);
+          return;
+        }
+      }
+
+        // Alternatives are guarded by their first byte where possible
+
+      guarded = FALSE;
+      if (def && _first)
+      {
+        n = get_alternatives(def, &alts);
+        for (i = 0; i < n; i += k)
+        {
+          k = get_alternative_group(alts + i, n - i, 0, &length);
+          if (is_guarded_group(alts + i, k, &fs))
+            guarded = TRUE;
+        }
+        free_alternatives(alts, n);
+      }
+
+      emit_phrase_head(of, parser_name);
+      fprintf(of, "{\n");
+      fprintf(of, "  long pos = %s_get_position(%s);\n", _in, _in_arg);
+      if (!_recognize)
+      {
+        fprintf(of, "  %s_token_mark mark = %s_token_arena_mark();\n",
+                      parser_name, parser_name);
+        fprintf(of, "  %s_token head, *nt, *t1, *t2;\n", parser_name);
+      }
+      fprintf(of, "  int count;\n");
+      if (!_recognize)
+        fprintf(of, "  %s_token_direction dir;\n", parser_name);
+      if (_recognize && _use_events)
+      {
+        fprintf(of, "  long ev = event_mark(%s);\n", _in_arg);
+        fprintf(of, "  int hold = %sevents_hold;\n", _sp);
+      }
+      if (guarded)
+        fprintf(of, "  unsigned char first;\n");
+      fprintf(of, "\n");
+      if (_use_context)
+        fprintf(of, "  ++ctx->calls;\n");
+      if (emit_callback(of, parser_name, 1, "entry") || _use_context)
+        fprintf(of, "\n");
+      fprintf(of, "  if (%s_eof(%s))\n", _in, _in_arg);
+      fprintf(of, "    return %s;\n", (_recognize) ? "-1" : "NULL");
+      fprintf(of, "\n");
+
+        // The events within a collapsed phrase are held back, to be
+        // dropped in favour of the event of the phrase
+
+      if (_recognize && _use_events && _collapse_phrase)
+      {
+        fprintf(of, "  ++%sevents_hold;\n", _sp);
+        fprintf(of, "\n");
+      }
+      if (_memo_phrase)
+      {
+        fprintf(of, "  if (memo_lookup(%s%d, pos, &nt))\n",
+                      _in_args, phrase_map_list_get_item_index(_pml, _pns));
+        fprintf(of, "  {\n");
+        if (_use_callbacks)
+        {
+          fprintf(of, "    if (!nt)\n");
+          fprintf(of, "    {\n");
+          emit_callback(of, parser_name, 3, "fail");
+          fprintf(of, "\n");
+          fprintf(of, "      return NULL;\n");
+          fprintf(of, "    }\n");
+          fprintf(of, "\n");
+          emit_callback(of, parser_name, 2, "success");
+          fprintf(of, "\n");
+        }
+        fprintf(of, "    return nt;\n");
+        fprintf(of, "  }\n");
+        fprintf(of, "\n");
+      }
+      if (guarded)
+      {
+        fprintf(of, "  first = %s_byte(%s);\n", _in, _in_arg);
+        fprintf(of, "  %s_set_position(%spos);\n", _in, _in_args);
+        fprintf(of, "\n");
+      }
+      fprintf(of, "  count = 0;\n");
+      fprintf(of, "\n");
+      if (!_recognize)
+      {
+        fprintf(of, "  nt = t1 = t2 = NULL;\n");
+        fprintf(of, "\n");
+        fprintf(of, "    // Descendants are chained below head until the "
+                    "phrase matches\n");
+        fprintf(of, "\n");
+        fprintf(of, "  head.descendant = NULL;\n");
+        fprintf(of, "  t1 = &head;\n");
+        fprintf(of, "\n");
+      }
+
+      generate_definition(of, parser_name, def);
+    }
+  }
+
+  if (_memo_phrase)
+  {
+    fprintf(of, "  memo_store(%s%d, pos, NULL);\n",
+                  _in_args, phrase_map_list_get_item_index(_pml, _pns));
+    fprintf(of, "\n");
+  }
+
+  if (emit_callback(of, parser_name, 1, "fail"))
+    fprintf(of, "\n");
+
+  if (_recognize && _use_events && _collapse_phrase)
+  {
+    fprintf(of, "  %sevents_hold = hold;\n", _sp);
+    fprintf(of, "\n");
+  }
+
+  fprintf(of, "  return %s;\n", (_recognize) ? "-1" : "NULL");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+  if (_inline_phrase)
+    emit_inline_wrapper(of, parser_name);
+
+  if (_pns)
+    free(_pns);
+  if (_pns_f)
+    free(_pns_f);
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_phrase function.
+
+     This function generates the complete phrase parsing function for a
+     phrase which always matches exactly one byte from a known set.  The
+     byte is tested against the set at once, instead of trying each
+     alternative in turn.  The phrase token is the same as from the
+     alternatives, a single byte span without descendants.
+
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param fs          \e first_set * of bytes matched by the phrase
+
+  */
+
+static void generate_class_phrase(FILE *of,
+                                  char *parser_name,
+                                  first_set *fs)
+{
+  emit_phrase_head(of, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  long pos = %s_get_position(%s);\n", _in, _in_arg);
+  if (!_recognize)
+    fprintf(of, "  %s_token *nt;\n", parser_name);
+  fprintf(of, "  unsigned char first;\n");
+  fprintf(of, "\n");
+  if (_use_context)
+    fprintf(of, "  ++ctx->calls;\n");
+  if (emit_callback(of, parser_name, 1, "entry") || _use_context)
+    fprintf(of, "\n");
+  fprintf(of, "  if (%s_eof(%s))\n", _in, _in_arg);
+  fprintf(of, "    return %s;\n", (_recognize) ? "-1" : "NULL");
+  fprintf(of, "\n");
+  fprintf(of, "  first = %s_byte(%s);\n", _in, _in_arg);
+
+  _current_level = 1;
+  emit_first_guard(of, fs);
+  _current_level = 0;
+
+  if (_recognize)
+  {
+    if (_use_events)
+      fprintf(of, "    event_add(%s%s_token_type_%s, pos, pos + 1);\n",
+                    _in_args, parser_name, _pns_f);
+    fprintf(of, "    return 1;\n");
+  }
+  else
+  {
+    fprintf(of, "    nt = %s%s_token_type_%s);\n",
+                  _new, parser_name, _pns_f);
+    fprintf(of, "    if (nt)\n");
+    fprintf(of, "    {\n");
+    fprintf(of, "      %s_token_set_offset(nt, pos);\n", parser_name);
+    fprintf(of, "      %s_token_set_length(nt, 1);\n", parser_name);
+    fprintf(of, "\n");
+    if (emit_callback(of, parser_name, 3, "success"))
+      fprintf(of, "\n");
+    fprintf(of, "      return nt;\n");
+    fprintf(of, "    }\n");
+  }
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  %s_set_position(%spos);\n", _in, _in_args);
+  fprintf(of, "\n");
+  if (emit_callback(of, parser_name, 1, "fail"))
+    fprintf(of, "\n");
+  fprintf(of, "  return %s;\n", (_recognize) ? "-1" : "NULL");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_phrase function.
+
+     This function generates the complete phrase parsing function for a
+     trivia phrase.  The input is matched by the recognizer of the phrase,
+     and the phrase token is one span of the input matched, without
+     descendants.
+
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+
+  */
+
+static void generate_trivia_phrase(FILE *of, char *parser_name)
+{
+  emit_phrase_head(of, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  long pos = %s_get_position(%s);\n", _in, _in_arg);
+  fprintf(of, "  long length;\n");
+  fprintf(of, "  %s_token *nt;\n", parser_name);
+  fprintf(of, "\n");
+  if (_use_context)
+    fprintf(of, "  ++ctx->calls;\n");
+  if (emit_callback(of, parser_name, 1, "entry") || _use_context)
+    fprintf(of, "\n");
+  fprintf(of, "  if ((length = recognize_%s(%s)) >= 0)\n", _pns_f, _in_arg);
+  fprintf(of, "  {\n");
+  fprintf(of, "    nt = %s%s_token_type_%s);\n",
+                _new, parser_name, _pns_f);
+  fprintf(of, "    if (nt)\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      %s_token_set_offset(nt, pos);\n", parser_name);
+  fprintf(of, "      %s_token_set_length(nt, length);\n", parser_name);
+  fprintf(of, "\n");
+  if (emit_callback(of, parser_name, 3, "success"))
+    fprintf(of, "\n");
+  fprintf(of, "      return nt;\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  %s_set_position(%spos);\n", _in, _in_args);
+  fprintf(of, "\n");
+  if (emit_callback(of, parser_name, 1, "fail"))
+    fprintf(of, "\n");
+  fprintf(of, "  return NULL;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_phrase and
+            \e generate_class_phrase functions.
+
+     This function emits the head of the function parsing the current
+     phrase, which for an inlined phrase is a static inline function, and
+     for a recognizer returns the length of input matched.
+
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+
+  */
+
+static void emit_phrase_head(FILE *of, char *parser_name)
+{
+  if (_recognize)
+    fprintf(of, "long recognize_%s(%s)\n", _pns_f, _ctx_void);
+  else if (_inline_phrase)
+    fprintf(of, "static inline %s_token *inline_%s(%s)\n",
+                  parser_name, _pns_f, _ctx_void);
+  else
+    fprintf(of, "%s_token *%s(%s)\n", parser_name, _pns_f, _ctx_void);
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_phrase function.
+
+     This function emits the public phrase parsing function of an inlined
+     phrase, which calls the static inline function.
+
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+
+  */
+
+static void emit_inline_wrapper(FILE *of, char *parser_name)
+{
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sParse phrase %s by calling inline_%s()\n",
+                (_use_doxygen) ? "@brief " : "", _pns, _pns_f);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+  fprintf(of, "%s_token *%s(%s)\n", parser_name, _pns_f, _ctx_void);
+  fprintf(of, "{\n");
+  fprintf(of, "  return inline_%s(%s);\n", _pns_f, _in_arg);
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+    
+     This function parses a definition token and generates the appropriate
+     code for all contents of the phrase definition.\n
+     \n
+     A definition consists of a sequence of definition elements.  This function
+     directly generates the source for the definition pre-amble code, calls the
+     subsequent sequence code generating function, and then closes out the code
+     for the definition.
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the definition token from
+                        which the source code is generated
+
+  */
+
+static void generate_definition(FILE *of,
+                                char *parser_name,
+                                egg_token *t)
+{
+  alternative *alts;
+  int n;
+
+  if (!t)
+    return;
+
+  if (!parser_name)
+    return;
+
+  if (!of)
+    of = stdout;
+
+  if (egg_token_find_child(t, egg_token_type_sequence))
+  {
+    n = get_alternatives(t, &alts);
+    generate_alternatives(of, parser_name, alts, n, 0);
+    free_alternatives(alts, n);
+
+    if (!_recognize)
+      fprintf(of, "  %smark);\n", _rewind);
+    else if (_use_events)
+      fprintf(of, "  event_rewind(%sev);\n", _in_args);
+    fprintf(of, "  %s_set_position(%spos);\n", _in, _in_args);
+    fprintf(of, "\n");
+  }
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_definition function.
+
+     This function generates the code for a list of alternatives, from the
+     item at a given depth on.  Consecutive alternatives beginning with the
+     same items are generated as one group, whose shared items are matched
+     once.  The state after the shared items is kept, and each alternative
+     of the group is matched from that state on.\n
+     \n
+     Since matching an item depends only on the input position, the shared
+     items match the same input, and build the same tokens, as they would
+     for each alternative on its own.  The token tree is thus unchanged.
+
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param alts        \e alternative * array of alternatives
+     \param n           count of alternatives
+     \param depth       index of first item of each alternative to generate
+
+  */
+
+static void generate_alternatives(FILE *of,
+                                  char *parser_name,
+                                  alternative *alts,
+                                  int n,
+                                  int depth)
+{
+  first_set fs;
+  int level_in = _current_level;
+  int i, j, k;
+  int length;
+
+  for (i = 0; i < n; i = j)
+  {
+    j = i + get_alternative_group(alts + i, n - i, depth, &length);
+
+    if (depth == 0)
+    {
+      if ((i > 0) && _recognize)
+      {
+        if (_use_events)
+        {
+          fprintf(of, "  event_rewind(%sev);\n", _in_args);
+          fprintf(of, "  event_unhold(%s);\n", _in_arg);
+        }
+        fprintf(of, "  %s_set_position(%spos);\n", _in, _in_args);
+        fprintf(of, "\n");
+      }
+      else if (i > 0)
+      {
+        fprintf(of, "  %smark);\n", _rewind);
+        fprintf(of, "  head.descendant = NULL;\n");
+        fprintf(of, "  %s_set_position(%spos);\n", _in, _in_args);
+        fprintf(of, "  t1 = &head;\n");
+        fprintf(of, "\n");
+      }
+      if (!_recognize)
+      {
+        emit_indent(of);
+        fprintf(of, "  dir = %s_token_below;\n", parser_name);
+      }
+
+        // The events of an alternative are held back while a later one
+        // may still be tried
+
+      if (_recognize && _use_events && (j < n))
+      {
+        fprintf(of, "  ++%sevents_hold;\n", _sp);
+        fprintf(of, "\n");
+      }
+
+      if (j - i == 1)
+      {
+        generate_sequence(of, parser_name, alts[i].seq);
+        fprintf(of, "\n");
+        continue;
+      }
+
+        // Skip the group when the first byte of input cannot begin it
+
+      if (is_guarded_group(alts + i, j - i, &fs))
+      {
+        ++_current_level;
+        emit_first_guard(of, &fs);
+      }
+    }
+    else if ((i > 0) && _recognize)
+    {
+      if (_use_events)
+      {
+        emit_indent(of);
+        fprintf(of, "  event_rewind(%sfev);\n", _in_args);
+        emit_indent(of);
+        fprintf(of, "  event_unhold(%s);\n", _in_arg);
+      }
+      emit_indent(of);
+      fprintf(of, "  %s_set_position(%sfpos);\n", _in, _in_args);
+      fprintf(of, "\n");
+    }
+    else if (i > 0)
+    {
+      emit_indent(of);
+      fprintf(of, "  %sfmark);\n", _rewind);
+      emit_indent(of);
+      fprintf(of, "  if (fdir == %s_token_below)\n", parser_name);
+      emit_indent(of);
+      fprintf(of, "    %s_token_set_descendant(ft1, NULL);\n", parser_name);
+      emit_indent(of);
+      fprintf(of, "  else\n");
+      emit_indent(of);
+      fprintf(of, "    %s_token_set_next(ft1, NULL);\n", parser_name);
+      emit_indent(of);
+      fprintf(of, "  %s_set_position(%sfpos);\n", _in, _in_args);
+      emit_indent(of);
+      fprintf(of, "  t1 = ft1;\n");
+      emit_indent(of);
+      fprintf(of, "  dir = fdir;\n");
+      fprintf(of, "\n");
+    }
+
+    if ((depth > 0) && _recognize && _use_events && (j < n))
+    {
+      emit_indent(of);
+      fprintf(of, "  ++%sevents_hold;\n", _sp);
+      fprintf(of, "\n");
+    }
+
+    if (j - i == 1)
+    {
+      for (k = depth; k < alts[i].count; k++)
+      {
+        ++_current_level;
+        generate_item(of, parser_name, alts[i].items[k]);
+      }
+      emit_sequence_commit(of, parser_name);
+    }
+    else
+    {
+        // Match the shared items once, and keep the state after them
+
+      for (k = depth; k < depth + length; k++)
+      {
+        ++_current_level;
+        generate_item(of, parser_name, alts[i].items[k]);
+      }
+      ++_current_level;
+      emit_indent(of);
+      fprintf(of, "{\n");
+      emit_indent(of);
+      fprintf(of, "  long fpos = %s_get_position(%s);\n", _in, _in_arg);
+      if (_recognize && _use_events)
+      {
+        emit_indent(of);
+        fprintf(of, "  long fev = event_mark(%s);\n", _in_arg);
+      }
+      if (!_recognize)
+      {
+        emit_indent(of);
+        fprintf(of, "  %s_token_mark fmark = %s_token_arena_mark();\n",
+                      parser_name, parser_name);
+        emit_indent(of);
+        fprintf(of, "  %s_token *ft1 = t1;\n", parser_name);
+        emit_indent(of);
+        fprintf(of, "  %s_token_direction fdir = dir;\n", parser_name);
+      }
+      fprintf(of, "\n");
+
+      generate_alternatives(of, parser_name, alts + i, j - i, depth + length);
+    }
+
+    while (_current_level > level_in)
+    {
+      emit_indent(of);
+      fprintf(of, "}\n");
+      --_current_level;
+    }
+
+    if (depth == 0)
+      fprintf(of, "\n");
+  }
+
+  _current_level = level_in;
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_definition function.
+
+     This function makes the list of alternatives of a definition, with
+     the items of each alternative and the text of each item.  The text
+     finds the items shared by alternatives.
+
+     \warning This function returns a pointer to dynamically allocated memory.
+              It is the caller's responsibility to free this memory with
+              \e free_alternatives when appropriate.
+
+     \param t           \e egg_token * containing the definition token
+     \param alts        \e alternative ** to receive the array of
+                        alternatives
+
+     \retval int count of alternatives
+
+  */
+
+static int get_alternatives(egg_token *t, alternative **alts)
+{
+  egg_token *seq;
+  egg_token *cont;
+  egg_token *sc;
+  egg_token *itm;
+  alternative *a;
+  egg_token **items;
+  char **texts;
+  int n = 0;
+
+  *alts = NULL;
+
+  for (cont = egg_token_find_child(t, egg_token_type_sequence); cont;
+       cont = cont->next)
+  {
+    if (cont->type == egg_token_type_sequence)
+      seq = cont;
+    else if (cont->type == egg_token_type_definition_continuation)
+      seq = egg_token_find_child(cont, egg_token_type_sequence);
+    else
+      continue;
+    if (!seq)
+      continue;
+
+    a = realloc(*alts, (n + 1) * sizeof(alternative));
+    if (!a)
+      break;
+    *alts = a;
+    a += n++;
+    memset(a, 0, sizeof(alternative));
+    a->seq = seq;
+
+    for (sc = egg_token_find_child(seq, egg_token_type_item); sc;
+         sc = sc->next)
+    {
+      if (sc->type == egg_token_type_item)
+        itm = sc;
+      else if (sc->type == egg_token_type_sequence_continuation)
+        itm = egg_token_find_child(sc, egg_token_type_item);
+      else
+        itm = NULL;
+      if (!itm)
+        continue;
+
+      items = realloc(a->items, (a->count + 1) * sizeof(egg_token *));
+      if (items)
+        a->items = items;
+      texts = realloc(a->texts, (a->count + 1) * sizeof(char *));
+      if (texts)
+        a->texts = texts;
+      if (!items || !texts)
+        break;
+
+      a->items[a->count] = itm;
+      a->texts[a->count] = egg_token_to_string(itm->descendant, NULL);
+      ++a->count;
+    }
+  }
+
+  return n;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_definition function.
+
+     This function frees a list of alternatives made by
+     \e get_alternatives function.
+
+     \param alts        \e alternative * array of alternatives
+     \param n           count of alternatives
+
+  */
+
+static void free_alternatives(alternative *alts, int n)
+{
+  int i, k;
+
+  for (i = 0; i < n; i++)
+  {
+    for (k = 0; k < alts[i].count; k++)
+      free(alts[i].texts[k]);
+    free(alts[i].texts);
+    free(alts[i].items);
+  }
+  free(alts);
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_alternatives function.
+
+     This function finds the group of consecutive alternatives which begin
+     with the same item at a given depth, and the count of items shared by
+     all alternatives of the group.
+
+     \param alts        \e alternative * array of alternatives, beginning
+                        with the first alternative of the group
+     \param n           count of alternatives in array
+     \param depth       index of first item compared
+     \param length      int * to receive the count of shared items
+
+     \retval int count of alternatives in group, which is 1 when the first
+                 alternative shares no item
+
+  */
+
+static int get_alternative_group(alternative *alts,
+                                 int n,
+                                 int depth,
+                                 int *length)
+{
+  int i, j, k;
+
+  *length = 0;
+
+  for (j = 1; j < n; j++)
+    if (!is_same_item(alts, alts + j, depth))
+      break;
+
+  if (j == 1)
+    return 1;
+
+  for (k = depth + 1; k < alts[0].count; k++)
+  {
+    for (i = 1; i < j; i++)
+      if (!is_same_item(alts, alts + i, k))
+        break;
+    if (i < j)
+      break;
+  }
+
+  *length = k - depth;
+
+  return j;
+}
+
+  /*!
+
+     \brief Helper function for \e get_alternative_group function.
+
+     This function tests whether two alternatives have the same item at a
+     given depth.
+
+     \param a           \e alternative * of first alternative
+     \param b           \e alternative * of second alternative
+     \param depth       index of item compared
+
+     \retval TRUE  if the items are the same
+     \retval FALSE otherwise
+
+  */
+
+static unsigned char is_same_item(alternative *a, alternative *b, int depth)
+{
+  if ((depth >= a->count) || (depth >= b->count))
+    return FALSE;
+
+  if (!a->texts[depth] || !b->texts[depth])
+    return FALSE;
+
+  return !strcmp(a->texts[depth], b->texts[depth]);
+}
+
+  /*!
+
+     \brief Helper function for \e generate_alternatives function.
+
+     This function tests whether a group of alternatives is guarded by a
+     test of the first byte of input.  A group of one alternative is
+     guarded as the alternative is, and a larger group only when all of its
+     alternatives are, by the union of their sets.
+
+     \param alts        \e alternative * array of alternatives of group
+     \param n           count of alternatives in group
+     \param fs          \e first_set * to receive the set of the group
+
+     \retval TRUE  if the group is guarded
+     \retval FALSE otherwise
+
+  */
+
+static unsigned char is_guarded_group(alternative *alts, int n, first_set *fs)
+{
+  first_set afs;
+  int i, b;
+
+  if (!is_guarded_sequence(alts[0].seq, fs))
+    return FALSE;
+
+  for (i = 1; i < n; i++)
+  {
+    if (!is_guarded_sequence(alts[i].seq, &afs))
+      return FALSE;
+    for (b = 0; b < 32; b++)
+      fs->bytes[b] |= afs.bytes[b];
+  }
+
+  return emit_first_guard(NULL, fs);
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+    
+     This function parses a sequence token and generates the appropriate
+     code for all contents of the sequence.\n
+     \n
+     A sequence consists of a list of grammar items.  This function calls
+     the item generation function, and directly generates the source for the
+     definition close-out code.
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the sequence token from which
+                        the source code is generated
+
+  */
+
+static void generate_sequence(FILE *of,
+                              char *parser_name,
+                              egg_token *t)
+{
+  egg_token *itm;
+  egg_token *cont;
+  first_set fs;
+  int level_in = _current_level;
+
+  if (!t)
+    return;
+
+  if (!parser_name)
+    return;
+
+  if (!of)
+    of = stdout;
+
+  itm = egg_token_find_child(t, egg_token_type_item);
+  if (itm)
+  {
+      // Skip the alternative when the first byte of input cannot begin it
+
+    if (is_guarded_sequence(t, &fs))
+    {
+      ++_current_level;
+      emit_first_guard(of, &fs);
+    }
+
+    ++_current_level;
+
+    generate_item(of, parser_name, itm);
+
+    cont = itm->next;
+    while (cont)
+    {
+      if (cont->type == egg_token_type_sequence_continuation)
+      {
+        itm = egg_token_find_child(cont, egg_token_type_item);
+        if (itm)
+        {
+           ++_current_level;
+           generate_item(of, parser_name, itm);
+        }
+      }
+      cont = cont->next;
+    }
+
+    emit_sequence_commit(of, parser_name);
+
+    while (_current_level > level_in)
+    {
+      emit_indent(of);
+      fprintf(of, "}\n");
+      --_current_level;
+    }
+  }
+
+  _current_level = 0;
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_sequence and
+            \e generate_alternatives functions.
+
+     This function generates the close-out code of an alternative whose
+     items all matched.  The phrase token is only allocated here, and the
+     descendants chained below the local head token are linked below it.
+     A recognizer returns the length of input matched instead.
+
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+
+  */
+
+static void emit_sequence_commit(FILE *of, char *parser_name)
+{
+  if (_recognize)
+  {
+    if (_use_events)
+    {
+      if (_collapse_phrase)
+      {
+        emit_indent(of);
+        fprintf(of, "  event_rewind(%sev);\n", _in_args);
+      }
+      emit_indent(of);
+      fprintf(of, "  %sevents_hold = hold;\n", _sp);
+      emit_indent(of);
+      fprintf(of, "  event_add(%s%s_token_type_%s, pos, %s_get_position(%s));"
+                  "\n",
+                    _in_args, parser_name, _pns_f, _in, _in_arg);
+    }
+    emit_indent(of);
+    fprintf(of, "  return %s_get_position(%s) - pos;\n", _in, _in_arg);
+    return;
+  }
+
+  if (_collapse_phrase)
+  {
+    emit_indent(of);
+    fprintf(of, "  %smark);\n", _rewind);
+  }
+  emit_indent(of);
+  fprintf(of, "  nt = %s%s_token_type_%s);\n",
+                _new, parser_name, _pns_f);
+  emit_indent(of);
+  fprintf(of, "  if (!nt)\n");
+  emit_indent(of);
+  fprintf(of, "  {\n");
+  emit_indent(of);
+  fprintf(of, "    %smark);\n", _rewind);
+  emit_indent(of);
+  fprintf(of, "    %s_set_position(%spos);\n", _in, _in_args);
+  if (emit_callback(of, parser_name, _current_level + 2, "fail"))
+    fprintf(of, "\n");
+  emit_indent(of);
+  fprintf(of, "    return NULL;\n");
+  emit_indent(of);
+  fprintf(of, "  }\n");
+  emit_indent(of);
+  fprintf(of, "  %s_token_set_offset(nt, pos);\n", parser_name);
+  emit_indent(of);
+  fprintf(of, "  %s_token_set_length(nt, %s_get_position(%s) - pos);\n",
+                parser_name, _in, _in_arg);
+  if (!_collapse_phrase)
+  {
+    emit_indent(of);
+    fprintf(of, "  %s_token_add(nt, %s_token_below, head.descendant);\n",
+                  parser_name, parser_name);
+  }
+  if (_memo_phrase)
+  {
+    emit_indent(of);
+    fprintf(of, "  memo_store(%s%d, pos, nt);\n",
+                  _in_args, phrase_map_list_get_item_index(_pml, _pns));
+  }
+  fprintf(of, "\n");
+  if (emit_callback(of, parser_name, _current_level + 1, "success"))
+    fprintf(of, "\n");
+  emit_indent(of);
+  fprintf(of, "  return nt;\n");
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+    
+     This function parses an item token and generates the appropriate
+     code for all contents of the item.\n
+     \n
+     An item consists of an atom which is possibly quantified.  This function
+     directly generates the item and quantifier pre-amble code, calls the atom
+     generation function, and directly generates the source for the
+     item close-out code.
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the item token from which
+                        the source code is generated
+
+  */
+
+static void generate_item(FILE *of,
+                          char *parser_name,
+                          egg_token *t)
+{
+  egg_token *atm;
+  egg_token *qty;
+  egg_token *lit = NULL;
+  egg_token *pn;
+  first_set fs;
+  char *pns = NULL;
+  char *s = NULL;
+  int min = 1;
+  int max = 1;
+  int lo[4], hi[4];
+  int i;
+
+  if (!t)
+    return;
+
+  if (!parser_name)
+    return;
+
+  if (!of)
+    of = stdout;
+
+  atm = egg_token_find_child(t, egg_token_type_atom);
+  if (atm)
+  {
+    qty = egg_token_find_child(t, egg_token_type_quantifier);
+
+      // A quantified single byte atom may be matched as one run
+
+    if (qty && _use_run_tokens && get_run_set(atm, &fs, &pns))
+    {
+      if (pns && !_recognize && _use_trivia_drop)
+      {
+        pn = egg_token_find_child(atm, egg_token_type_phrase_name);
+        s = egg_token_to_string(pn->descendant, s);
+        if (is_trivia_phrase(s))
+        {
+          free(pns);
+          pns = NULL;
+        }
+        free(s);
+      }
+      generate_run(of, parser_name, qty, &fs, pns);
+      if (pns)
+        free(pns);
+      return;
+    }
+
+      // A recognizer, or a dropped trivia phrase, repeated without limit
+      // skips runs of the bytes the phrase matches alone
+
+    if (qty && _skip && (get_maximum(qty) < 0) &&
+        (pn = egg_token_find_child(atm, egg_token_type_phrase_name)))
+    {
+      s = egg_token_to_string(pn->descendant, s);
+      i = phrase_map_list_get_item_index(_pml, s);
+      if ((i >= 0) && (get_byte_ranges(&_skip[i], lo, hi) > 0) &&
+          (_recognize || (_use_trivia_drop && is_trivia_phrase(s))))
+      {
+        generate_skip(of, parser_name, qty, s);
+        free(s);
+        return;
+      }
+      if (s)
+        free(s);
+      s = NULL;
+    }
+
+    if (qty)
+    {
+      lit = egg_token_find_child(atm, egg_token_type_literal);
+      min = get_minimum(qty);
+      max = get_maximum(qty);
+      emit_indent(of);
+      fprintf(of, "count=0;\n");
+      if (max >= 0)
+      {
+        emit_indent(of);
+        fprintf(of, "while(count < %d)\n", max);
+      }
+      else
+      {
+        emit_indent(of);
+        fprintf(of, "while(TRUE)\n");
+      }
+      emit_indent(of);
+      fprintf(of, "{\n");
+      ++_current_level;
+
+        // A failed literal may have consumed input, so the position of
+        // each repetition is kept to be restored
+
+      if (lit)
+      {
+        emit_indent(of);
+        fprintf(of, "long qpos = %s_get_position(%s);\n", _in, _in_arg);
+        fprintf(of, "\n");
+      }
+
+        // The events of a repetition of a phrase are held back until the
+        // repetition is known to match
+
+      if (!lit && _recognize && _use_events)
+      {
+        emit_indent(of);
+        fprintf(of, "++%sevents_hold;\n", _sp);
+      }
+    }
+    generate_atom(of, parser_name, atm);
+    if (qty)
+    {
+      --_current_level;
+      if (!lit && _recognize && _use_events)
+      {
+        emit_indent(of);
+        fprintf(of, "    event_unhold(%s);\n", _in_arg);
+      }
+      emit_indent(of);
+      fprintf(of, "    ++count;\n");
+      emit_indent(of);
+      fprintf(of, "  }\n");
+      emit_indent(of);
+      fprintf(of, "  else\n");
+      if (!lit && _recognize && _use_events)
+      {
+        emit_indent(of);
+        fprintf(of, "  {\n");
+        emit_indent(of);
+        fprintf(of, "    event_unhold(%s);\n", _in_arg);
+        emit_indent(of);
+        fprintf(of, "    break;\n");
+        emit_indent(of);
+        fprintf(of, "  }\n");
+      }
+      else if (lit)
+      {
+        emit_indent(of);
+        fprintf(of, "  {\n");
+        emit_indent(of);
+        fprintf(of, "    %s_set_position(%sqpos);\n", _in, _in_args);
+        emit_indent(of);
+        fprintf(of, "    break;\n");
+        emit_indent(of);
+        fprintf(of, "  }\n");
+      }
+      else
+      {
+        emit_indent(of);
+        fprintf(of, "    break;\n");
+      }
+      emit_indent(of);
+      fprintf(of, "}\n");
+      if (max >= 0)
+      {
+        emit_indent(of);
+        fprintf(of, "if ((count >= %d) && (count <= %d))\n", min, max);
+      }
+      else
+      {
+        emit_indent(of);
+        fprintf(of, "if ((count >= %d))\n", min);
+      }
+      emit_indent(of);
+      fprintf(of, "{\n");
+    }
+  }
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_item function.
+
+     This function finds whether an atom always matches exactly one byte
+     from a known byte set, so that a quantified item of the atom can be
+     matched as one run.  This is the case for a single byte literal, and
+     for a phrase which is generated as a byte set lookup.
+
+     \param t           \e egg_token * containing the atom token
+     \param fs          \e first_set * to receive the byte set of the atom
+     \param pns         char ** to receive the phrase identifier for a
+                        phrase atom, or NULL for a literal atom
+
+     \retval TRUE  if the atom can be matched as a run
+     \retval FALSE otherwise
+
+  */
+
+static unsigned char get_run_set(egg_token *t, first_set *fs, char **pns)
+{
+  egg_token *lit;
+  egg_token *pn;
+  char *s = NULL;
+  long c = -1;
+
+  *pns = NULL;
+  memset(fs, 0, sizeof(first_set));
+
+  if ((lit = egg_token_find_child(t, egg_token_type_literal)))
+  {
+    s = egg_token_to_string(lit->descendant, s);
+    if (!s)
+      return FALSE;
+    if (egg_token_find_child(lit, egg_token_type_absolute_literal))
+    {
+      s[strlen(s) - 1] = 0;
+      c = strtol(s + 1, NULL, 0);
+    }
+    else if ((strlen(s) == 3) && (s[1] != '\\'))
+      c = (unsigned char)s[1];
+    free(s);
+
+    if ((c < 0) || (c > 255))
+      return FALSE;
+
+    fs->bytes[c >> 3] |= 1 << (c & 7);
+
+    return TRUE;
+  }
+
+  if (!_first)
+    return FALSE;
+
+  if ((pn = egg_token_find_child(t, egg_token_type_phrase_name)))
+  {
+    s = egg_token_to_string(pn->descendant, s);
+    if (s && phrase_map_list_find_item_by_name(_sbl, s))
+    {
+      *fs = _first[phrase_map_list_get_item_index(_pml, s)];
+      if (emit_first_guard(NULL, fs))
+      {
+        *pns = fix_identifier(s);
+        return TRUE;
+      }
+    }
+    if (s)
+      free(s);
+  }
+
+  return FALSE;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_item function.
+
+     This function generates the code matching a quantified single byte atom
+     as one run of bytes.  For a phrase atom, one token of the phrase type
+     spanning the whole run is added in place of one token per byte.
+
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the quantifier token
+     \param fs          \e first_set * of bytes matched by the atom
+     \param pns         string containing phrase identifier of a phrase
+                        atom, or NULL for a literal atom
+
+  */
+
+static void generate_run(FILE *of,
+                         char *parser_name,
+                         egg_token *t,
+                         first_set *fs,
+                         char *pns)
+{
+  int min, max;
+
+  min = get_minimum(t);
+  max = get_maximum(t);
+
+  emit_scan_run(of, "count = ", fs, max);
+
+  if (pns && _recognize && _use_events)
+  {
+    emit_indent(of);
+    fprintf(of, "if (count > 0)\n");
+    emit_indent(of);
+    fprintf(of, "  event_add(%s%s_token_type_%s,\n",
+                  _in_args, parser_name, pns);
+    emit_indent(of);
+    fprintf(of, "            %s_get_position(%s) - count,\n", _in, _in_arg);
+    emit_indent(of);
+    fprintf(of, "            %s_get_position(%s));\n", _in, _in_arg);
+  }
+  else if (pns && !_recognize)
+  {
+    emit_indent(of);
+    fprintf(of, "if (count > 0)\n");
+    emit_indent(of);
+    fprintf(of, "{\n");
+    emit_indent(of);
+    fprintf(of, "  if (%s_token_add(t1, dir, t2 = %s%s_token_type_%s)))\n",
+                  parser_name, _new, parser_name, pns);
+    emit_indent(of);
+    fprintf(of, "  {\n");
+    emit_indent(of);
+    fprintf(of, "    %s_token_set_offset(t2, %s_get_position(%s) - count);\n",
+                  parser_name, _in, _in_arg);
+    emit_indent(of);
+    fprintf(of, "    %s_token_set_length(t2, count);\n", parser_name);
+    emit_indent(of);
+    fprintf(of, "    dir = %s_token_after;\n", parser_name);
+    emit_indent(of);
+    fprintf(of, "    t1 = t2;\n");
+    emit_indent(of);
+    fprintf(of, "  }\n");
+    emit_indent(of);
+    fprintf(of, "}\n");
+  }
+
+  emit_indent(of);
+  if (max >= 0)
+    fprintf(of, "if ((count >= %d) && (count <= %d))\n", min, max);
+  else
+    fprintf(of, "if ((count >= %d))\n", min);
+  emit_indent(of);
+  fprintf(of, "{\n");
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_item function.
+
+     This function generates the code matching a phrase atom repeated
+     without limit by a recognizer.  Runs of the bytes the phrase matches
+     alone are skipped by \e scan_run, and the phrase recognizer is called
+     only where a run ends.  A run counts as one repetition for each byte,
+     up to the minimum count.
+
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the quantifier token
+     \param pn          string containing phrase name of the atom
+
+  */
+
+static void generate_skip(FILE *of,
+                          char *parser_name,
+                          egg_token *t,
+                          char *pn)
+{
+  char *pns;
+  int min;
+  int i;
+
+  i = phrase_map_list_get_item_index(_pml, pn);
+  if (i < 0)
+    return;
+
+  min = get_minimum(t);
+
+    // A phrase matching exactly one byte whenever it can begin is matched
+    // as one run
+
+  if (!_first[i].nullable && !memcmp(_first[i].bytes, _skip[i].bytes, 32))
+  {
+    generate_run(of, parser_name, t, &_skip[i], NULL);
+    return;
+  }
+
+  pns = fix_identifier(strdup(pn));
+  if (!pns)
+    return;
+
+  emit_indent(of);
+  fprintf(of, "count=0;\n");
+  emit_indent(of);
+  fprintf(of, "while(TRUE)\n");
+  emit_indent(of);
+  fprintf(of, "{\n");
+  ++_current_level;
+  emit_scan_run(of, "long skip = ", &_skip[i], -1);
+  fprintf(of, "\n");
+  emit_indent(of);
+  fprintf(of, "if (skip > 0)\n");
+  emit_indent(of);
+  if (min > 1)
+    fprintf(of, "  count += (skip < %d) ? (int)skip : %d;\n", min, min);
+  else
+    fprintf(of, "  ++count;\n");
+  emit_indent(of);
+  fprintf(of, "else if (recognize_%s(%s) >= 0)\n", pns, _in_arg);
+  emit_indent(of);
+  fprintf(of, "  ++count;\n");
+  emit_indent(of);
+  fprintf(of, "else\n");
+  emit_indent(of);
+  fprintf(of, "  break;\n");
+  --_current_level;
+  emit_indent(of);
+  fprintf(of, "}\n");
+  emit_indent(of);
+  fprintf(of, "if ((count >= %d))\n", min);
+  emit_indent(of);
+  fprintf(of, "{\n");
+
+  free(pns);
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+    
+     This function parses an atom token and generates the appropriate
+     code for all contents of the atom.\n
+     \n
+     An atom contains either a literal or a phrase-name.  This function calls
+     the appropriate code generation function for a literal or a phrase name.
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the atom token from which
+                        the source code is generated
+
+  */
+
+static void generate_atom(FILE *of,
+                          char *parser_name,
+                          egg_token *t)
+{
+  egg_token *lit;
+  egg_token *pn;
+
+  if (!t)
+    return;
+
+  if (!parser_name)
+    return;
+
+  if (!of)
+    of = stdout;
+
+  lit = egg_token_find_child(t, egg_token_type_literal);
+  if (lit)
+  {
+    generate_literal(of, parser_name, lit);
+  }
+  else
+  {
+    pn = egg_token_find_child(t, egg_token_type_phrase_name);
+    if (pn)
+    {
+      generate_phrase_name(of, parser_name, pn);
+    }
+  }
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+    
+     This function parses a literal token and generates the appropriate
+     code for all contents of the literal.\n
+     \n
+     An literal contains either a string or integer.  This function directly
+     generates the code for all types of literals.  String literals are
+     matched with the emitted match_literal() function, which compares the
+     whole string at once when the input buffer is loaded.
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the literal token from which
+                        the source code is generated
+
+  */
+
+static void generate_literal(FILE *of,
+                             char *parser_name,
+                             egg_token *t)
+{
+  egg_token *lit;
+  char *s;
+  char *s2;
+
+  if (!t)
+    return;
+
+  if (!parser_name)
+    return;
+
+  if (!of)
+    of = stdout;
+
+  lit = egg_token_find_child(t, egg_token_type_absolute_literal);
+  if (lit)
+  {
+    s = egg_token_to_string(lit->descendant, s = NULL);
+    ++s;
+    s[strlen(s)-1] = 0;
+    emit_indent(of);
+    fprintf(of, "if ((%s_byte(%s)) == %s)\n", _in, _in_arg, s);
+    emit_indent(of);
+    fprintf(of, "{\n");
+    free(s-1);
+    return;
+  }
+
+  lit = egg_token_find_child(t, egg_token_type_quoted_literal);
+  if (lit)
+  {
+    s = egg_token_to_string(lit->descendant, s = NULL);
+    ++s;
+    s[strlen(s)-1] = 0;
+    emit_indent(of);
+    fprintf(of, "if (MATCH_LITERAL(\"%s\"))\n", s);
+    emit_indent(of);
+    fprintf(of, "{\n");
+    free(s-1);
+    return;
+  }
+
+  lit = egg_token_find_child(t, egg_token_type_single_quoted_literal);
+  if (lit)
+  {
+    s = egg_token_to_string(lit->descendant, s = NULL);
+    ++s;
+    s[strlen(s)-1] = 0;
+    s2 = fix_quotes(s);
+    emit_indent(of);
+    fprintf(of, "if (MATCH_LITERAL(\"%s\"))\n", s2);
+    emit_indent(of);
+    fprintf(of, "{\n");
+    free(s-1);
+    free(s2);
+    return;
+  }
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+    
+     This function parses a phrase-name token and generates the appropriate
+     code for all contents of the phrase-name.\n
+     \n
+     A phrase-name contains is a literal EGG grammer name of a phrase.  This
+     function directly generates the code for a phrase-name.
+    
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the phrase-name token from
+                        which the source code is generated
+
+  */
+
+static void generate_phrase_name(FILE *of, char *parser_name, egg_token *t)
+{
+  char *pns = NULL;
+  unsigned char inlined;
+  unsigned char dropped;
+
+  if (!t)
+    return;
+
+  if (!parser_name)
+    return;
+
+  if (!of)
+    of = stdout;
+
+  t = t->descendant;
+
+  pns = egg_token_to_string(t, pns);
+  inlined = (pns && phrase_map_list_find_item_by_name(_inl, pns));
+  dropped = (_use_trivia_drop && is_trivia_phrase(pns));
+  pns = fix_identifier(pns);
+
+  if (pns && (_recognize || dropped))
+  {
+    emit_indent(of);
+    fprintf(of, "if (recognize_%s(%s) >= 0)\n", pns, _in_arg);
+    emit_indent(of);
+    fprintf(of, "{\n");
+
+    free(pns);
+  }
+  else if (pns)
+  {
+    emit_indent(of);
+    fprintf(of, "if (%s_token_add(t1, dir, t2 = %s%s(%s)))\n",
+                  parser_name, (inlined) ? "inline_" : "", pns, _in_arg);
+    emit_indent(of);
+    fprintf(of, "{\n");
+    emit_indent(of);
+    fprintf(of, "  dir = %s_token_after;\n", parser_name);
+    emit_indent(of);
+    fprintf(of, "  t1 = t2;\n");
+
+    free(pns);
+  }
+
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+    
+     This function finds the minimum range value in a quantifier.
+    
+     \param t           \e egg_token * containing the quantifier token
+
+     \retval int value of quantifier range minimum
+             1   on any error
+
+  */
+
+static int get_minimum(egg_token *t)
+{
+  egg_token *in;
+  char *ins = NULL;
+  int i;
+
+  if (!t)
+    return 1;
+
+  if (t->type != egg_token_type_quantifier)
+    return 1;
+
+  in = egg_token_find_child(t, egg_token_type_integer);
+  if (in)
+  {
+    ins = egg_token_to_string(in->descendant, ins);
+    if (ins)
+    {
+      i = atoi(ins);
+      free(ins);
+      return i;
+    }
+  }
+
+  return 1;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+    
+     This function finds the maximum range value in a quantifier.
+    
+     \param t           \e egg_token * containing the quantifier token
+
+     \retval int value of quantifier range maximum
+             -1  when range maximum is unlimited (ie. asterisk)
+              1  on any error
+
+  */
+
+static int get_maximum(egg_token *t)
+{
+  egg_token *opt;
+  egg_token *in;
+  egg_token *as;
+  char *ins = NULL;
+  int min = 1;
+  int i;
+
+  if (!t)
+    return 1;
+
+  if (t->type != egg_token_type_quantifier)
+    return 1;
+
+  min = get_minimum(t);
+
+  opt = egg_token_find_child(t, egg_token_type_quantifier_option);
+  if (opt)
+  {
+    in = egg_token_find_within(opt, egg_token_type_integer, 2);
+    if (in)
+    {
+      ins = egg_token_to_string(in->descendant, ins);
+      if (ins)
+      {
+        i = atoi(ins);
+        free(ins);
+        return i;
+      }
+    }
+    else
+    {
+      as = egg_token_find_within(opt, egg_token_type_asterisk, 2);
+      if (as)
+        return -1;
+    }
+  }
+  else
+    return min;
+
+  return 1;
+}
+
+  /*!
+
+     \brief Generic helper function for code generation functions.
+    
+     This function converts all EGG grammar identifiers (ie. phrase-name) to
+     C language identifiers.  Specifically all '-' (minus) characters are
+     converted to '_' (underscore) characters.
+    
+     \param pn string containing EGG phrase-name
+    
+     \retval "char *" string containing C language equivalent identifier
+
+  */
+
+static char *fix_identifier(char *pn)
+{
+  char *t;
+
+  if (!pn)
+    return NULL;
+
+  t = pn;
+
+  while (*t)
+  {
+    if (*t == '-')
+      *t = '_';
+    ++t;
+  }
+
+  return pn;
+}
+
+  /*!
+
+     \brief Generic helper function for code generation functions.
+    
+     This function converts all EGG grammar quoted literals to C language
+     compatible strings.  All single-quoted-literals are converted to double
+     quoted strings, including preceding any double-quotes contained within
+     the single-quoted-literal with a C string '\' (backslash) character.
+    
+     \warning This function returns a pointer to dynamically allocated memory.
+              It is the caller's responsibility to free this memory when
+              appropriate.
+
+     \param s string containing single quoted literal
+    
+     \retval "char *" string containing C language compatible double quoted
+                      string
+
+  */
+
+static char *fix_quotes(char *s)
+{
+  char *t;
+  char *n;
+  int nq = 0;
+
+  if (!s)
+    return NULL;
+
+  for (t = s; *t; t++)
+    if (*t == '"')
+      ++nq;
+
+  n = malloc(strlen(s) + nq + 1);
+
+  for (t = n; *s; ++s, ++t)
+  {
+    if (*s == '"')
+    {
+      *t = '\\';
+      ++t;
+    }
+    *t = *s;
+  }
+
+  *t = 0;
+
+  return n;
+}
+
+  /*!
+
+     \brief Generic helper function for code generation functions.
+    
+     This function builds a C language compatible literal value.
+    
+     \warning This function returns a pointer to dynamically allocated memory.
+              It is the caller's responsibility to free this memory when
+              appropriate.
+
+     \param t           \e egg_token * containing the literal token
+
+     \retval "char *" string containing the C language literal code.
+             NULL     on any error
+
+  */
+
+static char *build_literal(egg_token *t)
+{
+  char *s = NULL;
+  char *sp1, *sp2;
+  egg_token *tm;
+  long l;
+
+  if (!t)
+    return NULL;
+
+  if (t->type != egg_token_type_literal)
+    return NULL;
+
+  tm = egg_token_find_child(t, egg_token_type_absolute_literal);
+  if (tm)
+  {
+    tm = egg_token_find_child(tm, egg_token_type_integer);
+    if (tm)
+    {
+      s = egg_token_to_string(tm->descendant, s);
+
+      switch (tm->descendant->type)
+      {
+        case egg_token_type_binary_integer:
+          l = strtol(s+2, NULL, 2);
+          break;
+        case egg_token_type_octal_integer:
+          l = strtol(s+2, NULL, 8);
+          break;
+        case egg_token_type_hexadecimal_integer:
+          l = strtol(s+2, NULL, 16);
+          break;
+        case egg_token_type_decimal_integer:
+        default:
+          l = strtol(s, NULL, 10);
+          break;
+      }
+
+      free(s);
+
+      s = long_to_bytes(l);
+
+      return s;
+    }
+
+    return NULL;
+  }
+
+  tm = egg_token_find_child(t, egg_token_type_quoted_literal);
+  if (tm)
+  {
+    s = egg_token_to_string(tm->descendant, s);
+    for (sp1 = s+1, sp2 = s; *sp1; ++sp2, ++sp1)
+      *sp2 = *sp1; 
+    *(strchr(s, '"')) = 0;
+    return s;
+  }
+
+  tm = egg_token_find_child(t, egg_token_type_single_quoted_literal);
+  if (tm)
+  {
+    s = egg_token_to_string(tm->descendant, s);
+    for (sp1 = s+1, sp2 = s; *sp1; ++sp2, ++sp1)
+      *sp2 = *sp1; 
+    *(strchr(s, '\'')) = 0;
+    sp1 = fix_quotes(s);
+    free(s);
+    return sp1;
+  }
+
+  return NULL;
+}
+
+  /*!
+
+     \brief Generic helper function for code generation functions.
+    
+     This function converts all alpha characters in a string to upper case.
+    
+     \warning This function modifies the passed string, therefore a copy must be
+              made by the caller if the original string contents are to be
+              preserved.
+
+     \param s string
+
+     \retval "char *" string with all upper case alpha characters
+             NULL     on any error
+
+  */
+
+static char *str_toupper(char *s)
+{
+  char *t = s;
+
+  if (!s)
+    return NULL;
+
+  while (*t)
+  {
+    *t = toupper(*t);
+    ++t;
+  }
+
+  return s;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_token_util_source function.
+    
+     This function determines if a given phrase contains only literals.  If so,
+     then a C language compatible literal is returned, else a C language
+     compatible string containing a phrase's phrase-name is returned.
+    
+     \param t           \e egg_token * containing the phrase token
+
+     \retval "char *" string containing either literal or phrase name in C
+                      language compatible form
+     \retval NULL     on any error
+
+  */
+
+static char *literal_or_phrase_name(egg_token *t)
+{
+  egg_token *pn;
+  egg_token *def;
+  egg_token *tm;
+  char *pns;
+
+  if (!t)
+    return NULL;
+
+  if (t->type != egg_token_type_phrase)
+    return NULL;
+
+  pn = egg_token_find_child(t, egg_token_type_phrase_name);
+  if (!pn)
+    return NULL;
+
+  def = egg_token_find_child(t, egg_token_type_definition);
+  if (!def)
+    return NULL;
+
+  if (!(tm = egg_token_find_child(def,
+                                   egg_token_type_definition_continuation)))
+  {
+    tm = egg_token_find_child(def, egg_token_type_sequence);
+    if (tm)
+    {
+      if (!egg_token_find_child(tm, egg_token_type_sequence_continuation))
+      {
+        tm = egg_token_find_child(tm, egg_token_type_item);
+        if (tm)
+        {
+          if (!egg_token_find_child(tm, egg_token_type_quantifier))
+          {
+            tm = egg_token_find_within(tm, egg_token_type_literal, 2);
+            if (tm)
+              return build_literal(tm);
+          }
+        }
+      }
+    }
+  }
+
+  pns = NULL;
+  return egg_token_to_string(pn->descendant, pns);
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+    
+     This function builds a list of the names of all phrases which always
+     match exactly one input byte.  A phrase is single byte when every
+     alternative of its definition is exactly one unquantified item, and
+     that item is either a single byte literal or another single byte phrase.\n
+     \n
+     On success, the token of a single byte phrase is collapsed into one span
+     token, discarding the chain of character level tokens below it.
+    
+     \param t           \e egg_token * containing the root token of the grammar
+
+     \retval phrase_map_item * head of list of single byte phrase names
+     \retval NULL             when no phrase is single byte
+
+  */
+
+static phrase_map_item *find_single_byte_phrases(egg_token *t)
+{
+  phrase_map_item *list = NULL;
+  egg_token *ge;
+  egg_token *p;
+  egg_token *pn;
+  egg_token *def;
+  char *pns;
+  unsigned char changed;
+
+  if (!t)
+    return NULL;
+
+    // Repeat until no new phrase is found, since phrases may be used before
+    // they are defined
+
+  do
+  {
+    changed = FALSE;
+
+    ge = egg_token_find_child(t, egg_token_type_grammar_element);
+    while (ge)
+    {
+      if ((p = egg_token_find_child(ge, egg_token_type_phrase)))
+      {
+        pn = egg_token_find_child(p, egg_token_type_phrase_name);
+        def = egg_token_find_child(p, egg_token_type_definition);
+        if (pn && def)
+        {
+          pns = NULL;
+          pns = egg_token_to_string(pn->descendant, pns);
+          if (pns && !phrase_map_list_find_item_by_name(list, pns))
+          {
+            if (is_single_byte_definition(def, list))
+            {
+              phrase_map_list_append_item_by_name(&list, pns, FALSE);
+              changed = TRUE;
+            }
+          }
+          if (pns)
+            free(pns);
+        }
+      }
+      ge = ge->next;
+    }
+  } while (changed);
+
+  return list;
+}
+
+  /*!
+
+     \brief Helper function for \e find_single_byte_phrases function.
+    
+     This function tests whether every alternative of a definition is a
+     single byte sequence.
+    
+     \param t           \e egg_token * containing the definition token
+     \param list        \e phrase_map_item * list of phrase names already
+                        known to be single byte
+
+     \retval TRUE  definition always matches exactly one byte
+     \retval FALSE otherwise
+
+  */
+
+static unsigned char is_single_byte_definition(egg_token *t,
+                                               phrase_map_item *list)
+{
+  egg_token *seq;
+  egg_token *cont;
+
+  if (!t)
+    return FALSE;
+
+  if (t->type != egg_token_type_definition)
+    return FALSE;
+
+  seq = egg_token_find_child(t, egg_token_type_sequence);
+  if (!is_single_byte_sequence(seq, list))
+    return FALSE;
+
+  for (cont = seq->next; cont; cont = cont->next)
+  {
+    if (cont->type == egg_token_type_definition_continuation)
+    {
+      seq = egg_token_find_child(cont, egg_token_type_sequence);
+      if (!is_single_byte_sequence(seq, list))
+        return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+  /*!
+
+     \brief Helper function for \e find_single_byte_phrases function.
+    
+     This function tests whether a sequence consists of exactly one
+     unquantified item, which is either a single byte literal or a phrase
+     already known to be single byte.
+    
+     \param t           \e egg_token * containing the sequence token
+     \param list        \e phrase_map_item * list of phrase names already
+                        known to be single byte
+
+     \retval TRUE  sequence always matches exactly one byte
+     \retval FALSE otherwise
+
+  */
+
+static unsigned char is_single_byte_sequence(egg_token *t,
+                                             phrase_map_item *list)
+{
+  egg_token *itm;
+  egg_token *atm;
+  egg_token *lit;
+  egg_token *pn;
+  char *s = NULL;
+  unsigned char is_single = FALSE;
+
+  if (!t)
+    return FALSE;
+
+  itm = egg_token_find_child(t, egg_token_type_item);
+  if (!itm || itm->next)
+    return FALSE;
+
+  atm = egg_token_find_child(itm, egg_token_type_atom);
+  if (!atm || atm->next)
+    return FALSE;
+
+  if ((lit = egg_token_find_child(atm, egg_token_type_literal)))
+  {
+    if (egg_token_find_child(lit, egg_token_type_absolute_literal))
+      return TRUE;
+
+    s = egg_token_to_string(lit->descendant, s);
+    if (s)
+    {
+        // Quoted literal of one character, plus opening and closing quotes
+
+      is_single = (strlen(s) == 3);
+      free(s);
+    }
+  }
+  else if ((pn = egg_token_find_child(atm, egg_token_type_phrase_name)))
+  {
+    s = egg_token_to_string(pn->descendant, s);
+    if (s)
+    {
+      is_single = (phrase_map_list_find_item_by_name(list, s) != NULL);
+      free(s);
+    }
+  }
+
+  return is_single;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+
+     This function finds all phrases which are inlined at their uses by the
+     other phrase parsing functions.
+
+     \warning This function returns a pointer to dynamically allocated memory.
+              It is the caller's responsibility to free this memory when
+              appropriate.
+
+     \param t           \e egg_token * containing the root token of the
+                        grammar
+
+     \retval "phrase_map_item *" list of inlined phrase names
+     \retval NULL when no phrase is inlined
+
+  */
+
+static phrase_map_item *find_inline_phrases(egg_token *t)
+{
+  phrase_map_item *list = NULL;
+  egg_token *ge;
+  egg_token *p;
+  egg_token *pn;
+  egg_token *def;
+  char *pns;
+
+  if (!t)
+    return NULL;
+
+  ge = egg_token_find_child(t, egg_token_type_grammar_element);
+  while (ge)
+  {
+    if ((p = egg_token_find_child(ge, egg_token_type_phrase)))
+    {
+      pn = egg_token_find_child(p, egg_token_type_phrase_name);
+      def = egg_token_find_child(p, egg_token_type_definition);
+      if (pn && def)
+      {
+        pns = NULL;
+        pns = egg_token_to_string(pn->descendant, pns);
+        if (pns && !phrase_map_list_find_item_by_name(list, pns))
+          if (is_inline_definition(def, pns))
+            phrase_map_list_append_item_by_name(&list, pns, FALSE);
+        if (pns)
+          free(pns);
+      }
+    }
+    ge = ge->next;
+  }
+
+  return list;
+}
+
+  /*!
+
+     \brief Helper function for \e find_inline_phrases function.
+
+     This function tests whether a phrase is trivial enough to inline.  A
+     phrase matching a single byte from a known set is inlined, as is a
+     phrase of one alternative holding one literal or one other phrase
+     without a quantifier.
+
+     \param t           \e egg_token * containing the definition token
+     \param pn          string containing the phrase name
+
+     \retval TRUE  phrase is inlined
+     \retval FALSE otherwise
+
+  */
+
+static unsigned char is_inline_definition(egg_token *t, char *pn)
+{
+  alternative *alts;
+  first_set fs;
+  unsigned char is_inline;
+  int n;
+
+  if (!t || !pn)
+    return FALSE;
+
+  if (is_trivia_phrase(pn))
+    return FALSE;
+
+  if (_first && phrase_map_list_find_item_by_name(_sbl, pn))
+  {
+    fs = _first[phrase_map_list_get_item_index(_pml, pn)];
+    if (emit_first_guard(NULL, &fs))
+      return TRUE;
+  }
+
+  n = get_alternatives(t, &alts);
+  is_inline = ((n == 1) && (alts[0].count == 1) &&
+               !egg_token_find_child(alts[0].items[0],
+                                     egg_token_type_quantifier));
+  free_alternatives(alts, n);
+
+  return is_inline;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+
+     This function computes, for every phrase, the set of bytes that can
+     begin a match of the phrase, and whether the phrase can match without
+     consuming any input.
+
+     \warning This function returns a pointer to dynamically allocated memory.
+              It is the caller's responsibility to free this memory when
+              appropriate.
+
+     \param t           \e egg_token * containing the root token of the
+                        grammar
+
+     \retval "first_set *" array of sets, indexed like the phrase map list
+     \retval NULL on any error
+
+  */
+
+static first_set *find_first_sets(egg_token *t)
+{
+  first_set *sets;
+  first_set fs;
+  egg_token *ge;
+  egg_token *p;
+  egg_token *pn;
+  egg_token *def;
+  char *pns;
+  int i, b;
+  unsigned char changed;
+
+  if (!t)
+    return NULL;
+
+  sets = calloc(phrase_map_list_count_items(_pml) + 1, sizeof(first_set));
+  if (!sets)
+    return NULL;
+
+    // Repeat until no set grows, since phrases may be used before they
+    // are defined
+
+  do
+  {
+    changed = FALSE;
+
+    ge = egg_token_find_child(t, egg_token_type_grammar_element);
+    while (ge)
+    {
+      if ((p = egg_token_find_child(ge, egg_token_type_phrase)))
+      {
+        pn = egg_token_find_child(p, egg_token_type_phrase_name);
+        def = egg_token_find_child(p, egg_token_type_definition);
+        if (pn && def)
+        {
+          pns = NULL;
+          pns = egg_token_to_string(pn->descendant, pns);
+          i = phrase_map_list_get_item_index(_pml, pns);
+          if (i >= 0)
+          {
+            get_first_set_of_definition(def, sets, &fs);
+            for (b = 0; b < 32; b++)
+            {
+              if (fs.bytes[b] & ~sets[i].bytes[b])
+              {
+                sets[i].bytes[b] |= fs.bytes[b];
+                changed = TRUE;
+              }
+            }
+            if (fs.nullable && !sets[i].nullable)
+            {
+              sets[i].nullable = TRUE;
+              changed = TRUE;
+            }
+          }
+          if (pns)
+            free(pns);
+        }
+      }
+      ge = ge->next;
+    }
+  } while (changed);
+
+  return sets;
+}
+
+  /*!
+
+     \brief Helper function for \e find_first_sets function.
+
+     This function computes the first byte set of a definition, which is
+     the union of the first byte sets of all of its alternatives.
+
+     \param t           \e egg_token * containing the definition token
+     \param sets        \e first_set * array of phrase sets found so far
+     \param fs          \e first_set * to receive the set
+
+  */
+
+static void get_first_set_of_definition(egg_token *t,
+                                        first_set *sets,
+                                        first_set *fs)
+{
+  egg_token *seq;
+  egg_token *cont;
+  first_set sfs;
+  int b;
+
+  memset(fs, 0, sizeof(first_set));
+
+  if (!t)
+    return;
+
+  seq = egg_token_find_child(t, egg_token_type_sequence);
+  get_first_set_of_sequence(seq, sets, fs);
+
+  for (cont = (seq) ? seq->next : NULL; cont; cont = cont->next)
+  {
+    if (cont->type == egg_token_type_definition_continuation)
+    {
+      seq = egg_token_find_child(cont, egg_token_type_sequence);
+      get_first_set_of_sequence(seq, sets, &sfs);
+      for (b = 0; b < 32; b++)
+        fs->bytes[b] |= sfs.bytes[b];
+      if (sfs.nullable)
+        fs->nullable = TRUE;
+    }
+  }
+
+  return;
+}
+
+  /*!
 
-  fprintf(of, "void %s_token_unlink(%s_token *t)\n",
-                parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  if (t->ascendant)\n");
-  fprintf(of, "    if (t->ascendant->descendant == t)\n");
-  fprintf(of, "      t->ascendant->descendant = t->next;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  if (t->previous)\n");
-  fprintf(of, "    t->previous->next = t->next;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  if (t->next)\n");
-  fprintf(of, "    t->next->previous = t->previous;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  return;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+     \brief Helper function for \e find_first_sets function.
 
-    // Emit comment block for <PROJECT>_token_get_type()
+     This function computes the first byte set of a sequence.  Items are
+     added to the set until an item which cannot match empty input is
+     found.  A literal whose first byte is an escape sequence, and a phrase
+     not defined in the grammar, are taken to begin with any byte.
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sReturns %s_token_type of %s_token\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name,
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %st %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %s%s_token_type\n",
-                (_use_doxygen) ? "@retval " : "Returns: ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+     \param t           \e egg_token * containing the sequence token
+     \param sets        \e first_set * array of phrase sets found so far
+     \param fs          \e first_set * to receive the set
 
-    // Emit code for <PROJECT>_token_get_type()
+  */
 
-  fprintf(of, "%s_token_type %s_token_get_type(%s_token *t)\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return %s_token_type_none;\n",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "  return t->type;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+static void get_first_set_of_sequence(egg_token *t,
+                                      first_set *sets,
+                                      first_set *fs)
+{
+  egg_token *itm;
+  egg_token *cont;
+  egg_token *atm;
+  egg_token *lit;
+  egg_token *pn;
+  egg_token *qty;
+  char *s;
+  int i, b;
+  long c;
 
-    // Emit comment block for <PROJECT>_token_set_type()
+  memset(fs, 0, sizeof(first_set));
+  fs->nullable = TRUE;
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sSets %s_token_type of %s_token\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name,
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %st    %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "    %stype %s_token_type\n",
-                (_use_doxygen) ? "@param " : "       ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+  if (!t)
+    return;
 
-    // Emit code for <PROJECT>_token_set_type()
+  cont = itm = egg_token_find_child(t, egg_token_type_item);
+  while (itm && fs->nullable)
+  {
+    fs->nullable = FALSE;
+    atm = egg_token_find_child(itm, egg_token_type_atom);
+    lit = pn = NULL;
+    if (atm)
+      if (!(lit = egg_token_find_child(atm, egg_token_type_literal)))
+        pn = egg_token_find_child(atm, egg_token_type_phrase_name);
+
+    if (lit)
+    {
+      c = -1;
+      s = NULL;
+      s = egg_token_to_string(lit->descendant, s);
+      if (s)
+      {
+        if (egg_token_find_child(lit, egg_token_type_absolute_literal))
+        {
+          s[strlen(s) - 1] = 0;
+          c = strtol(s + 1, NULL, 0);
+        }
+        else if (strlen(s) == 2)
+          fs->nullable = TRUE;
+        else if (s[1] != '\\')
+          c = (unsigned char)s[1];
+        free(s);
+      }
+      if (c >= 0)
+      {
+        if (c < 256)
+          fs->bytes[c >> 3] |= 1 << (c & 7);
+      }
+      else if (!fs->nullable)
+        memset(fs->bytes, 0xff, 32);
+    }
+    else if (pn)
+    {
+      s = NULL;
+      s = egg_token_to_string(pn->descendant, s);
+      i = phrase_map_list_get_item_index(_pml, s);
+      if (i >= 0)
+      {
+        for (b = 0; b < 32; b++)
+          fs->bytes[b] |= sets[i].bytes[b];
+        fs->nullable = sets[i].nullable;
+      }
+      else
+      {
+        memset(fs->bytes, 0xff, 32);
+        fs->nullable = TRUE;
+      }
+      if (s)
+        free(s);
+    }
 
-  fprintf(of, "void %s_token_set_type(%s_token *t, %s_token_type type)\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  t->type = type;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+    qty = egg_token_find_child(itm, egg_token_type_quantifier);
+    if (qty && (get_minimum(qty) == 0))
+      fs->nullable = TRUE;
 
-    // Emit comment block for <PROJECT>_token_get_ascendant()
+      // Move on to the item of the next sequence continuation
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sReturns pointer to ascendant of %s_token\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name,
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %st %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %s%s%s_token *%s\n",
-                (_use_doxygen) ? "@retval " : "Returns: ",
-                (_use_doxygen) ? "\"" : "",
-                parser_name,
-                (_use_doxygen) ? "\"" : "");
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+    itm = NULL;
+    for (cont = cont->next; cont; cont = cont->next)
+    {
+      if (cont->type == egg_token_type_sequence_continuation)
+      {
+        itm = egg_token_find_child(cont, egg_token_type_item);
+        break;
+      }
+    }
+  }
 
-    // Emit code for <PROJECT>_token_get_ascendant()
+  return;
+}
 
-  fprintf(of, "%s_token *%s_token_get_ascendant(%s_token *t)\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return NULL;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  return t->ascendant;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+  /*!
 
-    // Emit comment block for <PROJECT>_token_set_ascendant()
+     \brief Helper function for \e generate_parser_source function.
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sSets pointer to ascendant of %s_token\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name,
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %st existing %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "    %sa ascendant of %s_token *\n",
-                (_use_doxygen) ? "@param " : "       ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+     This function computes, for every phrase, the set of bytes on which
+     one match of the phrase is known to be that byte alone.  A recognizer
+     repeating the phrase can then skip a run of these bytes at once,
+     instead of calling the phrase recognizer for each byte.
 
-    // Emit code for <PROJECT>_token_set_ascendant()
+     \warning This function returns a pointer to dynamically allocated memory.
+              It is the caller's responsibility to free this memory when
+              appropriate.
 
-  fprintf(of, "void %s_token_set_ascendant(%s_token *t, %s_token *a)\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  t->ascendant = a;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+     \param t           \e egg_token * containing the root token of the
+                        grammar
 
-    // Emit comment block for <PROJECT>_token_get_descendant()
+     \retval "first_set *" array of sets, indexed like the phrase map list
+     \retval NULL on any error
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sReturns pointer to descendant of %s_token\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name,
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %st %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %s%s%s_token *%s\n",
-                (_use_doxygen) ? "@retval " : "Returns: ",
-                (_use_doxygen) ? "\"" : "",
-                parser_name,
-                (_use_doxygen) ? "\"" : "");
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+  */
 
-    // Emit code for <PROJECT>_token_get_descendant()
+static first_set *find_skip_sets(egg_token *t)
+{
+  first_set *sets;
+  first_set fs;
+  egg_token *ge;
+  egg_token *p;
+  egg_token *pn;
+  egg_token *def;
+  char *pns;
+  int i, b;
+  unsigned char changed;
 
-  fprintf(of, "%s_token *%s_token_get_descendant(%s_token *t)\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return NULL;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  return t->descendant;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+  if (!t || !_first)
+    return NULL;
 
-    // Emit comment block for <PROJECT>_token_set_descendant()
+  sets = calloc(phrase_map_list_count_items(_pml) + 1, sizeof(first_set));
+  if (!sets)
+    return NULL;
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sSets pointer to descendant of %s_token\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name,
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %st existing %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "    %sd descendant of %s_token *\n",
-                (_use_doxygen) ? "@param " : "       ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+    // Repeat until no set grows, since phrases may be used before they
+    // are defined
 
-    // Emit code for <PROJECT>_token_set_descendant()
+  do
+  {
+    changed = FALSE;
 
-  fprintf(of, "void %s_token_set_descendant(%s_token *t, %s_token *d)\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  t->descendant = d;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+    ge = egg_token_find_child(t, egg_token_type_grammar_element);
+    while (ge)
+    {
+      if ((p = egg_token_find_child(ge, egg_token_type_phrase)))
+      {
+        pn = egg_token_find_child(p, egg_token_type_phrase_name);
+        def = egg_token_find_child(p, egg_token_type_definition);
+        if (pn && def)
+        {
+          pns = NULL;
+          pns = egg_token_to_string(pn->descendant, pns);
+          i = phrase_map_list_get_item_index(_pml, pns);
+          if (i >= 0)
+          {
+            get_skip_set_of_definition(def, sets, &fs);
+            for (b = 0; b < 32; b++)
+            {
+              if (fs.bytes[b] & ~sets[i].bytes[b])
+              {
+                sets[i].bytes[b] |= fs.bytes[b];
+                changed = TRUE;
+              }
+            }
+          }
+          if (pns)
+            free(pns);
+        }
+      }
+      ge = ge->next;
+    }
+  } while (changed);
+
+  return sets;
+}
+
+  /*!
 
-    // Emit comment block for <PROJECT>_token_get_previous()
+     \brief Helper function for \e find_skip_sets function.
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sReturns pointer to previous %s_token\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name,
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %st %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %s%s%s_token *%s\n",
-                (_use_doxygen) ? "@retval " : "Returns: ",
-                (_use_doxygen) ? "\"" : "",
-                parser_name,
-                (_use_doxygen) ? "\"" : "");
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+     This function computes the skip set of a definition.  An alternative
+     of one unquantified single byte literal or phrase adds the bytes it
+     matches alone, except for the bytes which an earlier alternative may
+     begin with, since that alternative is tried first.
 
-    // Emit code for <PROJECT>_token_get_previous()
+     \param t           \e egg_token * containing the definition token
+     \param sets        \e first_set * array of phrase skip sets found so far
+     \param fs          \e first_set * to receive the set
 
-  fprintf(of, "%s_token *%s_token_get_previous(%s_token *t)\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return NULL;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  return t->previous;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+  */
 
-    // Emit comment block for <PROJECT>_token_set_previous()
+static void get_skip_set_of_definition(egg_token *t,
+                                       first_set *sets,
+                                       first_set *fs)
+{
+  alternative *alts;
+  first_set blocked;
+  first_set afs;
+  egg_token *atm;
+  egg_token *pn;
+  char *s;
+  int n, i, k, b;
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sSets pointer to previous %s_token\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name,
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %st existing %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "    %sp previous %s_token *\n",
-                (_use_doxygen) ? "@param " : "       ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+  memset(fs, 0, sizeof(first_set));
+  memset(&blocked, 0, sizeof(first_set));
 
-    // Emit code for <PROJECT>_token_set_previous()
+  if (!t)
+    return;
 
-  fprintf(of, "void %s_token_set_previous(%s_token *t, %s_token *p)\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  t->previous = p;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+  n = get_alternatives(t, &alts);
+  for (i = 0; i < n; i++)
+  {
+    atm = NULL;
+    if ((alts[i].count == 1) &&
+        !egg_token_find_child(alts[i].items[0], egg_token_type_quantifier))
+      atm = egg_token_find_child(alts[i].items[0], egg_token_type_atom);
 
-    // Emit comment block for <PROJECT>_token_get_next()
+      // Bytes matched alone by the alternative, and bytes it may begin with
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sReturns pointer to next %s_token\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name,
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %st %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %s%s%s_token *%s\n",
-                (_use_doxygen) ? "@retval " : "Returns: ",
-                (_use_doxygen) ? "\"" : "",
-                parser_name,
-                (_use_doxygen) ? "\"" : "");
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+    memset(&afs, 0, sizeof(first_set));
+    k = -1;
+    if (atm && egg_token_find_child(atm, egg_token_type_literal))
+    {
+      s = NULL;
+      if (get_run_set(atm, &afs, &s))
+        k = -2;
+    }
+    else if (atm && (pn = egg_token_find_child(atm,
+                                               egg_token_type_phrase_name)))
+    {
+      s = NULL;
+      s = egg_token_to_string(pn->descendant, s);
+      k = phrase_map_list_get_item_index(_pml, s);
+      if (s)
+        free(s);
+    }
 
-    // Emit code for <PROJECT>_token_get_next()
+    if (k >= 0)
+    {
+      for (b = 0; b < 32; b++)
+      {
+        fs->bytes[b] |= sets[k].bytes[b] & ~blocked.bytes[b];
+        blocked.bytes[b] |= _first[k].bytes[b];
+      }
+      if (_first[k].nullable)
+        break;
+    }
+    else if (k == -2)
+    {
+      for (b = 0; b < 32; b++)
+      {
+        fs->bytes[b] |= afs.bytes[b] & ~blocked.bytes[b];
+        blocked.bytes[b] |= afs.bytes[b];
+      }
+    }
+    else
+    {
+      get_first_set_of_sequence(alts[i].seq, _first, &afs);
+      for (b = 0; b < 32; b++)
+        blocked.bytes[b] |= afs.bytes[b];
+      if (afs.nullable)
+        break;
+    }
+  }
+  free_alternatives(alts, n);
 
-  fprintf(of, "%s_token *%s_token_get_next(%s_token *t)\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return NULL;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  return t->next;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+  return;
+}
 
-    // Emit comment block for <PROJECT>_token_set_next()
+  /*!
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sSets pointer to next %s_token\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name,
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %st existing %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "    %sn next %s_token *\n",
-                (_use_doxygen) ? "@param " : "       ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+     \brief Helper function for code generation functions.
 
-    // Emit code for <PROJECT>_token_set_next()
+     This function finds the ranges of consecutive bytes in a byte set.
 
-  fprintf(of, "void %s_token_set_next(%s_token *t, %s_token *n)\n",
-                parser_name, parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  t->next = n;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+     \param fs          \e first_set * of bytes
+     \param lo          array of 4 ints to receive the first byte of the
+                        first 4 ranges
+     \param hi          array of 4 ints to receive the last byte of the
+                        first 4 ranges
 
-    // Emit comment block for <PROJECT>_token_find_next()
+     \retval int count of ranges, which may be more than 4
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sFind next %s_token of specified %s_token_type\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name,
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %st    existing %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "    %stype %s_token_type\n",
-                (_use_doxygen) ? "@param " : "       ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %s%s%s_token *%s found %s_token\n",
-                (_use_doxygen) ? "@retval " : "Returns: ",
-                (_use_doxygen) ? "\"" : "",
-                parser_name,
-                (_use_doxygen) ? "\"" : "",
-                parser_name);
-  fprintf(of, "    %sNULL failure, including NOT FOUND\n",
-                (_use_doxygen) ? "@retval " : "         ");
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+  */
 
-    // Emit code for <PROJECT>_token_find_next()
+static int get_byte_ranges(first_set *fs, int *lo, int *hi)
+{
+  int ranges = 0;
+  int last = -2;
+  int c;
 
-  fprintf(of, "%s_token *%s_token_find(%s_token *t, %s_token_type type)\n",
-                parser_name, parser_name, parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  %s_token *f;\n", parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return NULL;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  if (t->type == type)\n");
-  fprintf(of, "    return t;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  f = %s_token_find(t->descendant, type);\n", parser_name);
-  fprintf(of, "  if (f)\n");
-  fprintf(of, "    return f;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  f = %s_token_find(t->next, type);\n", parser_name);
-  fprintf(of, "  if (f)\n");
-  fprintf(of, "    return f;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  return NULL;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+  for (c = 0; c < 256; c++)
+  {
+    if (!(fs->bytes[c >> 3] & (1 << (c & 7))))
+      continue;
+    if (c != last + 1)
+    {
+      if (ranges < 4)
+        lo[ranges] = c;
+      ++ranges;
+    }
+    if (ranges <= 4)
+      hi[ranges - 1] = c;
+    last = c;
+  }
 
-    // Emit comment block for <PROJECT>_token_to_string()
+  return ranges;
+}
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  fprintf(of, "    %sReturns string representation of %s_token\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name,
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %sThis is a recursive function, therefore parameter s can "
-              "NOT point to static\n",
-                (_use_doxygen) ? "@warning " : "Warning: ");
-  fprintf(of, "              memory.\n");
-  fprintf(of, "\n");
-  fprintf(of, "    %sThis function returns a pointer to dynamically "
-              "allocated memory.\n",
-                (_use_doxygen) ? "@warning " : "Warning: ");
-  fprintf(of, "             It is the caller's responsibility to free this "
-              "memory when\n");
-  fprintf(of, "             appropriate.\n");
-  fprintf(of, "\n");
-  fprintf(of, "    %st existing %s_token *\n",
-                (_use_doxygen) ? "@param " : "Param: ",
-                parser_name);
-  fprintf(of, "    %ss char * of existing string, can be NULL\n",
-                (_use_doxygen) ? "@param " : "       ",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    %s%schar *%s string, can be NULL if s is NULL\n",
-                (_use_doxygen) ? "@retval " : "Returns: ",
-                (_use_doxygen) ? "\"" : "",
-                (_use_doxygen) ? "\"" : "");
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+  /*!
 
-    // Emit code for <PROJECT>_token_to_string()
+     \brief Helper function for \e generate_run and \e generate_skip
+            functions.
 
-  fprintf(of, "char *%s_token_to_string(%s_token *t, char *s)\n",
-               parser_name, parser_name);
-  fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return s;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  if (!t->descendant)\n");
-  fprintf(of, "    s = strapp(s , %s_token_type_to_string(t));\n", parser_name);
-  fprintf(of, "  else\n");
-  fprintf(of, "    s = %s_token_to_string(t->descendant, s);\n", parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "  s = %s_token_to_string(t->next, s);\n", parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "  return s;\n");
-  fprintf(of, "}\n");
-  fprintf(of, "\n");
+     This function emits a call of \e scan_run matching a run of the bytes
+     of a byte set, passing the set as a bitmap, and as up to 4 byte ranges
+     for the vectorized scan.
+
+     \param of          FILE * of open output file to write source code
+     \param lead        string emitted in front of the call
+     \param fs          \e first_set * of bytes
+     \param max         maximum length of run, or -1 for no limit
+
+  */
+
+static void emit_scan_run(FILE *of, char *lead, first_set *fs, int max)
+{
+  int lo[4], hi[4];
+  int ranges;
+  int b, r;
+
+  ranges = get_byte_ranges(fs, lo, hi);
+  if (ranges > 4)
+    ranges = 0;
+
+  emit_indent(of);
+  fprintf(of, "%sscan_run(%s\"", lead, _in_args);
+  for (b = 0; b < 32; b++)
+  {
+    fprintf(of, "\\x%02x", fs->bytes[b]);
+    if (b == 15)
+    {
+      fprintf(of, "\"\n");
+      emit_indent(of);
+      fprintf(of, "%*s\"", (int)strlen(lead) + 9, "");
+    }
+  }
+  fprintf(of, "\",\n");
+  emit_indent(of);
+  fprintf(of, "%*s%d, \"", (int)strlen(lead) + 9, "", ranges);
+  for (r = 0; r < ranges; r++)
+    fprintf(of, "\\x%02x\\x%02x", lo[r], hi[r]);
+  fprintf(of, "\", %d);\n", max);
 
   return;
 }
 
   /*!
 
-     \brief Generates \<PROJECT\>-token-type.h source code file.
-    
-     This function generates the source code for \<PROJECT\>-token-type.h\n
-     \n
-     The token type header file contains an enum typedef for the
-     \<PROJECT\>_token_type values.  A token type is defined for each phrase
-     defined in the parsed EGG grammar.
-    
+     \brief Helper function for code generation functions.
+
+     This function emits a C expression testing whether a byte variable
+     holds a byte of a byte set.  Sets of up to 4 byte ranges are tested by
+     comparison, and larger sets by a bitmap.  Continuation lines are
+     indented to follow an opening "if (".
+
      \param of          FILE * of open output file to write source code
-     \param parser_name string containing name of parser (ie. \<PROJECT\>)
-     \param t           \e egg_token * containing the root token from which
-                        the source code is generated
+     \param fs          \e first_set * of bytes
+     \param var         string containing name of byte variable
 
   */
 
-void generate_token_type_header(FILE *of,
-                                char *parser_name,
-                                egg_token *t)
+static void emit_byte_test(FILE *of, first_set *fs, char *var)
 {
-  egg_token *ge, *p, *pn;
-  char *hn;
-  int hnl;
-  char *pns;
-  char *fn;
+  int lo[4], hi[4];
+  int ranges;
+  int c, b;
 
-    // Sanity check parameters
+  ranges = get_byte_ranges(fs, lo, hi);
 
-  if (!of)
-    of = stdout;
+  if (ranges > 4)
+  {
+    fprintf(of, "\"");
+    for (b = 0; b < 32; b++)
+    {
+      fprintf(of, "\\x%02x", fs->bytes[b]);
+      if (b == 15)
+      {
+        fprintf(of, "\"\n");
+        emit_indent(of);
+        fprintf(of, "    \"");
+      }
+    }
+    fprintf(of, "\"\n");
+    emit_indent(of);
+    fprintf(of, "      [%s >> 3] & (1 << (%s & 7))", var, var);
+  }
+  else if (ranges == 0)
+    fprintf(of, "FALSE");
+  else
+  {
+    for (c = 0; c < ranges; c++)
+    {
+      if (c)
+      {
+        fprintf(of, " ||\n");
+        emit_indent(of);
+        fprintf(of, "    ");
+      }
 
-  if (!parser_name)
-    return;
+        // Leave out a bound that every byte meets, which compilers warn
+        // is always true
+
+      if (lo[c] == hi[c])
+        fprintf(of, (ranges > 1) ? "(%s == 0x%02X)" : "%s == 0x%02X",
+                      var, lo[c]);
+      else if (lo[c] == 0x00)
+        fprintf(of, (ranges > 1) ? "(%s <= 0x%02X)" : "%s <= 0x%02X",
+                      var, hi[c]);
+      else if (hi[c] == 0xFF)
+        fprintf(of, (ranges > 1) ? "(%s >= 0x%02X)" : "%s >= 0x%02X",
+                      var, lo[c]);
+      else
+        fprintf(of, (ranges > 1) ? "((%s >= 0x%02X) && (%s <= 0x%02X))"
+                                 : "(%s >= 0x%02X) && (%s <= 0x%02X)",
+                      var, lo[c], var, hi[c]);
+    }
+  }
 
-  if (!t)
-    return;
+  return;
+}
 
-    // Create header guard macro name
+  /*!
 
-  hnl = strlen(parser_name) + strlen("_token_type_h") + 1;
-  hn = malloc(hnl);
-  memset(hn, 0, hnl);
+     \brief Helper function for \e generate_sequence function.
 
-  sprintf(hn, "%s_token_type_h", parser_name);
+     This function emits a test of the first byte of input in front of an
+     alternative, so that an alternative which cannot match is never
+     entered.  No test is emitted for an alternative which can match empty
+     input, or which can begin with any byte.
 
-    // Force header guard macro to uppercase
+     \param of          FILE * of open output file to write source code, or
+                        NULL to only find whether a test is needed
+     \param fs          \e first_set * of alternative
 
-  hn = str_toupper(hn);
+     \retval TRUE  if a test is needed, opening a new block
+     \retval FALSE otherwise
 
-    // Emit the file level comment block
+  */
 
-  fn = make_file_name(parser_name, "token-type.h");
-  generator_set_file_name(fn);
-  emit_source_comment_header(of);
-  free(fn);
+static unsigned char emit_first_guard(FILE *of, first_set *fs)
+{
+  int lo[4], hi[4];
+  int ranges;
 
-    // Emit file description comment block
+  if (!fs || fs->nullable)
+    return FALSE;
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "\n");
-  if (_use_doxygen)
-  {
-    fprintf(of, "    @file %s-token-type.h\n", parser_name);
-    fprintf(of, "\n");
-  }
-  fprintf(of, "    This is the header file for the %s grammar token type "
-              "definitions\n",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "    Each %s grammar phrase has an associated token type\n",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+  ranges = get_byte_ranges(fs, lo, hi);
+  if ((ranges == 1) && (lo[0] == 0) && (hi[0] == 255))
+    return FALSE;
 
-    // Emit header include guard
+  if (!of)
+    return TRUE;
 
-  fprintf(of, "#ifndef %s\n", hn);
-  fprintf(of, "#define %s\n", hn);
-  fprintf(of, "\n");
+  emit_indent(of);
+  fprintf(of, "if (");
+  emit_byte_test(of, fs, "first");
+  fprintf(of, ")\n");
+  emit_indent(of);
+  fprintf(of, "{\n");
 
-    // Emit <PROJECT>_token_type annotation
+  return TRUE;
+}
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
-  fprintf(of, "    %sDefinition of allowed token types for %s_token.\n",
-                (_use_doxygen) ? "@brief " : "",
-                parser_name);
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
+  /*!
 
-    // Emit <PROJECT>_token_direction enum
+     \brief Helper function for \e generate_sequence function.
 
-  fprintf(of, "typedef enum\n");
-  fprintf(of, "{\n");
+     This function tests whether an alternative is guarded by a test of the
+     first byte of input.  Only alternatives beginning with a phrase are
+     guarded, since an alternative beginning with a literal already fails
+     on its first byte without any call or allocation.
 
-  if ((ge = egg_token_find(t->descendant, egg_token_type_grammar_element)))
-  {
-      // Emit special token type, none
+     \param t           \e egg_token * containing the sequence token
+     \param fs          \e first_set * to receive the set of the sequence
 
-    fprintf(of, "    /*%s %sSpecial token type for unknown tokens */\n",
-                  (_use_doxygen) ? "!" : "",
-                  (_use_doxygen) ? "@brief " : "");
-    fprintf(of, "  %s_token_type_none%s\n",
-                  parser_name,
-                  ge->next ? "," : "");
+     \retval TRUE  if the alternative is guarded
+     \retval FALSE otherwise
 
-    while (ge)
-    {
-      if ((p = egg_token_find(ge->descendant, egg_token_type_phrase)))
-      {
-        if ((pn = egg_token_find(p->descendant, egg_token_type_phrase_name)))
-        {
-          pns = NULL;
-          pns = egg_token_to_string(pn->descendant, pns);
+  */
 
-          fprintf(of, "    /*%s %sToken type for %s phrase*/\n",
-                        (_use_doxygen) ? "!" : "",
-                        (_use_doxygen) ? "@brief " : "",
-                        pns);
+static unsigned char is_guarded_sequence(egg_token *t, first_set *fs)
+{
+  egg_token *itm;
+  egg_token *atm;
 
-          pns = fix_identifier(pns);
+  if (!t || !_first)
+    return FALSE;
 
-          fprintf(of, "  %s_token_type_%s%s\n",
-                        parser_name,
-                        pns,
-                        ge->next ? "," : ""
-                 );
+  itm = egg_token_find_child(t, egg_token_type_item);
+  if (!itm)
+    return FALSE;
 
-          free(pns);
-        }
-      }
-      ge = ge->next;
-    }
-  }
+  atm = egg_token_find_child(itm, egg_token_type_atom);
+  if (!atm || !egg_token_find_child(atm, egg_token_type_phrase_name))
+    return FALSE;
 
-  fprintf(of, "} %s_token_type;\n", parser_name);
-  fprintf(of, "\n");
+  get_first_set_of_sequence(t, _first, fs);
 
-    // Emit close-out for header include guard
+  return emit_first_guard(NULL, fs);
+}
 
-  fprintf(of, "#endif // %s\n", hn);
-  fprintf(of, "\n");
+  /*!
 
-  free(hn);
+     \brief Helper function for \e generate_phrase function.
 
-  return;
+     This function emits a callback of a phrase parsing function.  The
+     callback function pointer is tested inline, so that nothing but the
+     test is executed when no function is registered for the callback.
+     Nothing is emitted when callbacks are turned off.
+
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param level       indent level of emitted code
+     \param type        string containing callback type, which is also the
+                        name of the callback function field of the entry
+
+     \retval TRUE  if the callback is emitted
+     \retval FALSE otherwise
+
+  */
+
+static unsigned char emit_callback(FILE *of,
+                                   char *parser_name,
+                                   int level,
+                                   char *type)
+{
+  int level_in = _current_level;
+  int index;
+
+  if (!_use_callbacks || _recognize)
+    return FALSE;
+
+  index = phrase_map_list_get_item_index(_pml, _pns);
+
+  _current_level = level;
+  emit_indent(of);
+  fprintf(of, "if (%scallbacks[%d].%s)\n", _sp, index, type);
+  emit_indent(of);
+  fprintf(of, "  callback_by_index(&%scbt,\n", _sp);
+  emit_indent(of);
+  fprintf(of, "                    %d,\n", index);
+  emit_indent(of);
+  fprintf(of, "                    %s,\n", type);
+  emit_indent(of);
+  fprintf(of, "                    (void *)%s_token_type_%s);\n",
+                parser_name, _pns_f);
+  _current_level = level_in;
+
+  return TRUE;
 }
 
   /*!
 
-     \brief Generates \<PROJECT\>-token-util.c source code file.
-    
-     This function generates the source code for \<PROJECT\>-token-util.c\n
-     \n
-     The token utility source file contains the \<PROJECT\>_token_type_to_string
-     function definition.
-    
+     \brief Helper function for \e generate_parser_source function.
+
+     This function emits the static input functions used by phrase parsing
+     functions in place of the input functions of libgray, when phrase
+     parsing functions are given a parser context.  Each function reads or
+     moves the input position held by the context, or creates a token
+     which reads its text back from the context.
+
      \param of          FILE * of open output file to write source code
      \param parser_name string containing name of parser (ie. \<PROJECT\>)
-     \param t           \e egg_token * containing the root token from which
-                        the source code is generated
 
   */
 
-void generate_token_util_source(FILE *of,
-                                char *parser_name,
-                                egg_token *t)
+static void emit_context_input_functions(FILE *of, char *parser_name)
 {
-  egg_token *ge, *p, *pn;
-  char *pns;
-  char *val;
-  char *fn;
+  if (_use_stream)
+  {
+      // Emit comment block for context_fill()
 
-    // Sanity check parameters
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sRead more input source bytes into the window of a "
+                "stream context\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    Bytes are read until the window holds the byte at the "
+                "input position,\n");
+    fprintf(of, "    growing the window when it is full.\n");
+    if (_use_push)
+    {
+      fprintf(of, "\n");
+      fprintf(of, "    For a push context, bytes are fed by the caller "
+                  "instead.  An element\n");
+      fprintf(of, "    parsed by push_next() is suspended until they are, "
+                  "and otherwise the\n");
+      fprintf(of, "    context is marked as waiting for more bytes.\n");
+    }
+    fprintf(of, "\n");
+    fprintf(of, "    %sctx %s_context * of parse\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "    %sTRUE  if the byte at the position is in the window\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "    %sFALSE at end of input, or on failure\n",
+                  (_use_doxygen) ? "@retval " : "         ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-  if (!of)
-    of = stdout;
+      // Emit code for context_fill()
 
-  if (!parser_name)
-    return;
+    fprintf(of, "static unsigned char context_fill(%s_context *ctx)\n",
+                  parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  unsigned char *b;\n");
+    fprintf(of, "  long used, size;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!ctx->input_stream)\n");
+    fprintf(of, "    return FALSE;\n");
+    fprintf(of, "\n");
+    if (_use_push)
+    {
+      fprintf(of, "  if (ctx->input_push)\n");
+      fprintf(of, "  {\n");
+      fprintf(of, "    while ((ctx->input_position >= ctx->input_length) &&\n");
+      fprintf(of, "           !ctx->input_finished)\n");
+      fprintf(of, "    {\n");
+      fprintf(of, "      ctx->input_starved = TRUE;\n");
+      fprintf(of, "      if (!ctx->push->running)\n");
+      fprintf(of, "        return FALSE;\n");
+      fprintf(of, "\n");
+      fprintf(of, "        // Wait for more bytes, resuming in "
+                  "push_next()\n");
+      fprintf(of, "\n");
+      fprintf(of, "      ctx->push->suspended = TRUE;\n");
+      fprintf(of, "      swapcontext(&ctx->push->parser, "
+                  "&ctx->push->caller);\n");
+      fprintf(of, "      ctx->push->suspended = FALSE;\n");
+      fprintf(of, "    }\n");
+      fprintf(of, "    return (ctx->input_position < ctx->input_length);\n");
+      fprintf(of, "  }\n");
+      fprintf(of, "\n");
+    }
+    fprintf(of, "  while (ctx->input_position >= ctx->input_length)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    if (input_eof())\n");
+    fprintf(of, "      return FALSE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "    used = ctx->input_length - ctx->input_base;\n");
+    fprintf(of, "    if (used == ctx->input_size)\n");
+    fprintf(of, "    {\n");
+    fprintf(of, "      size = (used) ? used * 2 : 4096;\n");
+    fprintf(of, "      if (!(b = realloc((void *)ctx->input_buffer, size)))\n");
+    fprintf(of, "        return FALSE;\n");
+    fprintf(of, "      ctx->input_buffer = ctx->source.buffer = b;\n");
+    fprintf(of, "      ctx->input_size = size;\n");
+    fprintf(of, "    }\n");
+    fprintf(of, "\n");
+    fprintf(of, "    b = (unsigned char *)ctx->input_buffer;\n");
+    fprintf(of, "    while ((used < ctx->input_size) && !input_eof())\n");
+    fprintf(of, "      b[used++] = input_byte();\n");
+    fprintf(of, "    ctx->input_length = ctx->input_base + used;\n");
+    fprintf(of, "    ctx->source.length = ctx->input_length;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return TRUE;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
 
-  if (!t)
-    return;
+    // Emit comment block for context_eof()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sTest for the end of input of a parser context\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sctx %s_context * of parse\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sTRUE at end of input\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "    %sFALSE otherwise\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for context_eof()
+
+  fprintf(of, "static unsigned char context_eof(%s_context *ctx)\n",
+                parser_name);
+  fprintf(of, "{\n");
+  if (_use_stream)
+    fprintf(of, "  return ((ctx->input_position >= ctx->input_length) &&\n"
+                "          !context_fill(ctx));\n");
+  else
+    fprintf(of, "  return (ctx->input_position >= ctx->input_length);\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for context_byte()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sRead the byte at the input position of a parser context\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    The input position is moved past the byte.  At the end of "
+              "input the\n");
+  fprintf(of, "    position is still moved, and 0 is returned.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sctx %s_context * of parse\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s\"unsigned char\" byte read\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for context_byte()
+
+  fprintf(of, "static unsigned char context_byte(%s_context *ctx)\n",
+                parser_name);
+  fprintf(of, "{\n");
+  if (_use_stream)
+    fprintf(of, "  if ((ctx->input_position >= ctx->input_length) &&\n"
+                "      !context_fill(ctx))\n");
+  else
+    fprintf(of, "  if (ctx->input_position >= ctx->input_length)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    ++ctx->input_position;\n");
+  fprintf(of, "    return 0;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  if (_use_stream)
+    fprintf(of, "  return ctx->input_buffer[ctx->input_position++ - "
+                "ctx->input_base];\n");
+  else
+    fprintf(of, "  return ctx->input_buffer[ctx->input_position++];\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for context_get_position()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sGet the input position of a parser context\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sctx %s_context * of parse\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %slong input position\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
 
-    // Emit the file level comment block
+    // Emit code for context_get_position()
 
-  fn = make_file_name(parser_name, "token-util.c");
-  generator_set_file_name(fn);
-  emit_source_comment_header(of);
-  free(fn);
+  fprintf(of, "static long context_get_position(%s_context *ctx)\n",
+                parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  return ctx->input_position;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
 
-    // Emit file description comment block
+    // Emit comment block for context_set_position()
 
   fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
   fprintf(of, "\n");
-  if (_use_doxygen)
-  {
-    fprintf(of, "    @file %s-token-util.c\n", parser_name);
-    fprintf(of, "\n");
-  }
-  fprintf(of, "    This is the source code file for the %s grammar token "
-              "utility\n",
-                parser_name);
-  fprintf(of, "    functions module.\n");
+  fprintf(of, "    %sSet the input position of a parser context\n",
+                (_use_doxygen) ? "@brief " : "");
   fprintf(of, "\n");
-  fprintf(of, "    The %s_token_type_to_string function is defined in\n",
+  fprintf(of, "    %sctx      %s_context * of parse\n",
+                (_use_doxygen) ? "@param " : "Param: ",
                 parser_name);
-  fprintf(of, "    this module.\n");
+  fprintf(of, "    %sposition new input position\n",
+                (_use_doxygen) ? "@param " : "       ");
   fprintf(of, "\n");
   fprintf(of, "  */\n");
   fprintf(of, "\n");
 
-    // Emit code for included header files
+    // Emit code for context_set_position()
 
-  fprintf(of, "#include <stdlib.h>\n");
-  fprintf(of, "#include <string.h>\n");
+  fprintf(of, "static void context_set_position(%s_context *ctx, long "
+              "position)\n",
+                parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  ctx->input_position = position;\n");
   fprintf(of, "\n");
-  fprintf(of, "#include \"%s-token.h\"\n", parser_name);
-  fprintf(of, "#include \"%s-token-util.h\"\n", parser_name);
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
   fprintf(of, "\n");
 
-    // Emit comment block for <PROJECT>_token_type_to_string()
+    // Emit comment block for token_new()
 
   fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
   fprintf(of, "\n");
-  fprintf(of, "    %sReturns a string representation of %s_token.\n",
+  fprintf(of, "    %sCreate a new %s_token at the input position of a parser "
+              "context\n",
                 (_use_doxygen) ? "@brief " : "",
                 parser_name);
   fprintf(of, "\n");
-  fprintf(of, "    %sThis function returns a pointer to dynamically allocated "
-              "memory.\n",
-                (_use_doxygen) ? "@warning " : "Warning: ");
-  fprintf(of, "    %sIt is the caller's responsibility to free this memory "
-              "when\n",
-                (_use_doxygen) ? "      " : "         ");
-  fprintf(of, "    %sappropriate.\n",
-                (_use_doxygen) ? "      " : "         ");
+  fprintf(of, "    The token reads its text and location back from the input "
+              "bytes of\n");
+  fprintf(of, "    the context.\n");
   fprintf(of, "\n");
-  fprintf(of, "    %st %s_token * to %s_token to string-ize\n",
+  fprintf(of, "    %sctx  %s_context * of parse\n",
                 (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %stype %s_token_type\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s%s%s_token *%s new %s_token\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
                 parser_name,
+                (_use_doxygen) ? "\"" : "",
                 parser_name);
+  fprintf(of, "    %sNULL failure\n",
+                (_use_doxygen) ? "@retval " : "         ");
   fprintf(of, "\n");
   fprintf(of, "  */\n");
   fprintf(of, "\n");
 
-    // Emit code for <PROJECT>_token_type_to_string()
+    // Emit code for token_new()
 
-  fprintf(of, "char *%s_token_type_to_string(%s_token *t)\n",
-                parser_name, parser_name);
+  fprintf(of, "static %s_token *token_new(%s_context *ctx, %s_token_type "
+              "type)\n",
+                parser_name, parser_name, parser_name);
   fprintf(of, "{\n");
-  fprintf(of, "  char *s;\n");
-  fprintf(of, "\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return NULL;\n");
+  fprintf(of, "  %s_token *t;\n", parser_name);
   fprintf(of, "\n");
-  fprintf(of, "  switch (t->type)\n");
+  fprintf(of, "  if ((t = %s_token_new(type)))\n", parser_name);
   fprintf(of, "  {\n");
-  fprintf(of, "    case %s_token_type_none:\n", parser_name);
-  fprintf(of, "      s = \"<none>\";\n");
-  fprintf(of, "      break;\n");
-
-  if ((ge = egg_token_find(t->descendant, egg_token_type_grammar_element)))
-  {
-
-    while (ge)
-    {
-      if ((p = egg_token_find(ge->descendant, egg_token_type_phrase)))
-      {
-        if ((pn = egg_token_find(p->descendant, egg_token_type_phrase_name)))
-        {
-          pns = NULL;
-          pns = egg_token_to_string(pn->descendant, pns);
-          pns = fix_identifier(pns);
-
-          fprintf(of, "    case %s_token_type_%s:\n",
-                        parser_name, pns);
-          fprintf(of, "      s = \"%s\";\n",
-                      val = literal_or_phrase_name(p));
-          fprintf(of, "      break;\n");
-
-          free(val);
-          free(pns);
-        }
-      }
-      ge = ge->next;
-    }
-  }
-
+  fprintf(of, "    %s_token_set_source(t, ctx->token_source);\n", parser_name);
+  fprintf(of, "    %s_token_set_offset(t, ctx->input_position);\n",
+                parser_name);
   fprintf(of, "  }\n");
   fprintf(of, "\n");
-  fprintf(of, "  return s;\n");
+  fprintf(of, "  return t;\n");
   fprintf(of, "}\n");
   fprintf(of, "\n");
 
@@ -1752,646 +12014,878 @@ void generate_token_util_source(FILE *of,
 
   /*!
 
-     \brief Generates \<PROJECT\>-token-util.h source code file.
-    
-     This function generates the source code for \<PROJECT\>-token-util.h\n
-     \n
-     The token utility header file contains the \<PROJECT\>_token_type_to_string
-     function declaration.
-    
+     \brief Helper function for \e generate_parser_source function.
+
+     This function emits the public functions to create and delete a parser
+     context, and to get the callback table of a context.
+
      \param of          FILE * of open output file to write source code
      \param parser_name string containing name of parser (ie. \<PROJECT\>)
 
   */
 
-void generate_token_util_header(FILE *of,
-                                char *parser_name)
+static void generate_context_functions(FILE *of, char *parser_name)
 {
-  char *hn;
-  int hnl;
-  char *fn;
-
-    // Sanity check parameters
-
-  if (!of)
-    of = stdout;
-
-  if (!parser_name)
-    return;
-
-    // Create header guard macro name
-
-  hnl = strlen(parser_name) + strlen("_token_util_h") + 1;
-  hn = malloc(hnl);
-  memset(hn, 0, hnl);
-
-  sprintf(hn, "%s_token_util_h", parser_name);
-
-    // Force header guard macro name to uppercase 
-
-  hn = str_toupper(hn);
-
-    // Emit the file level comment block
-
-  fn = make_file_name(parser_name, "token-util.h");
-  generator_set_file_name(fn);
-  emit_source_comment_header(of);
-  free(fn);
-
-    // Emit file description comment block
+    // Emit comment block for <PROJECT>_context_new()
 
   fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
   fprintf(of, "\n");
-  if (_use_doxygen)
-  {
-    fprintf(of, "    @file %s-token-util.h\n", parser_name);
-    fprintf(of, "\n");
-  }
-  fprintf(of, "    This is the header file for the %s grammar token utility\n",
-                parser_name);
-  fprintf(of, "    functions module.\n");
+  fprintf(of, "    %sCreate a parser context for an input buffer\n",
+                (_use_doxygen) ? "@brief " : "");
   fprintf(of, "\n");
-  fprintf(of, "    The %s_token_type_to_string function is defined in\n",
+  fprintf(of, "    Each context holds its own input position, callback table, "
+              "memo and\n");
+  fprintf(of, "    statistics, so phrase functions given separate contexts can "
+              "parse in\n");
+  fprintf(of, "    separate threads at the same time.  Tokens are allocated "
+              "from the\n");
+  fprintf(of, "    token arena of the calling thread, and their offsets are "
+              "offsets into\n");
+  fprintf(of, "    the buffer.  Their text and locations are read back from "
+              "the buffer,\n");
+  fprintf(of, "    with a line index held by the context.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sThe buffer is not copied, and must be left unchanged "
+              "until\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "             the context is deleted with %s_context_delete().\n",
                 parser_name);
-  fprintf(of, "    this module.\n");
-  fprintf(of, "\n");
-  fprintf(of, "  */\n");
-  fprintf(of, "\n");
-
-    // Emit header include guard
-
-  fprintf(of, "#ifndef %s\n", hn);
-  fprintf(of, "#define %s\n", hn);
-  fprintf(of, "\n");
-
-    // Emit function declarations
-
-  fprintf(of, "char *%s_token_type_to_string(%s_token *t);\n",
-                parser_name, parser_name);
-  fprintf(of, "\n");
-
-    // Emit close-out for header include guard
-
-  fprintf(of, "#endif // %s\n", hn);
-
-    // Clean up
-
-  free(hn);
-
-  return;
-}
-
-  /*!
-
-     \brief Generates \<PROJECT\>-walker.c source code file.
-    
-     This function generates the source code for \<PROJECT\>-walker.c\n
-     \n
-     The walker source file contains the code for a generic grammar walking
-     utility command.  The walker utility will walk any given file and apply
-     the \<PROJECT\> grammar rules to the file.  On success, the walker will
-     dump all the parsed phrases in the input file to \b stdout.  This
-     utility can optionally just check for correct grammar structure of the
-     input file.
-    
-     \param of          FILE * of open output file to write source code
-     \param parser_name string containing name of parser (ie. \<PROJECT\>)
-     \param t           \e egg_token * containing the root token from which
-                        the source code is generated
-
-  */
-
-void generate_walker_source(FILE *of,
-                            char *parser_name,
-                            egg_token *t)
-{
-  phrase_map_item *pml;
-  phrase_map_item *pmi;
-  char *phrase_name;
-  int opt_count = 0;
-  char *fn;
-
-    // Sanity check parameters
-
-  if (!of)
-    of = stdout;
-
-  if (!parser_name)
-    return;
-
-  if (!t)
-    return;
-
-    // Create a top level phrase map of all grammar phrases
-
-  pml = phrase_map(t);
-  phrase_map_list_isolate_top_level_phrases(&pml);
-
-    // Emit the file level comment block
-
-  fn = make_file_name(parser_name, "walker.c");
-  generator_set_file_name(fn);
-  emit_source_comment_header(of);
-  free(fn);
-
-    // Emit code for included header files
-
-  fprintf(of, "#include <stdio.h>\n");
-  fprintf(of, "#include <stdlib.h>\n");
-  fprintf(of, "#include <string.h>\n");
-  fprintf(of, "#include <getopt.h>\n");
   fprintf(of, "\n");
-
-    // Emit code for project related header files
-
-  fprintf(of, "#include \"gray/input.h\"\n");
-
-    // Emit code for project related header files
-  fprintf(of, "#include \"%s-token.h\"\n", parser_name);
-  fprintf(of, "#include \"%s-token-util.h\"\n", parser_name);
-  fprintf(of, "#include \"%s-parser.h\"\n", parser_name);
+  fprintf(of, "    %sbuffer string of input bytes\n",
+                (_use_doxygen) ? "@param " : "Param: ");
+  fprintf(of, "    %slength count of bytes in buffer\n",
+                (_use_doxygen) ? "@param " : "       ");
   fprintf(of, "\n");
-
-    // Emit code for module constants
-
-  fprintf(of, "#define FALSE 0\n");
-  fprintf(of, "#define TRUE 1\n");
+  fprintf(of, "    %s%s%s_context *%s new context on success\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "    %sNULL on failure\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
   fprintf(of, "\n");
 
-    // Emit code for function declarations
+    // Emit code for <PROJECT>_context_new()
 
-  fprintf(of, "static void usage(void);\n");
-  fprintf(of, "static void version(void);\n");
-  fprintf(of, "static void walk(%s_token *t, int level);\n", parser_name);
+  fprintf(of, "%s_context *%s_context_new(const unsigned char *buffer, long "
+              "length)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_context *ctx;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  if (!(ctx = calloc(1, sizeof(%s_context))))\n", parser_name);
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  ctx->input_buffer = ctx->source.buffer = buffer;\n");
+  fprintf(of, "  ctx->input_length = ctx->source.length = length;\n");
+  fprintf(of, "  ctx->token_source = &ctx->source;\n");
+  if (_use_callbacks)
+  {
+    fprintf(of, "\n");
+    fprintf(of, "  if (!(ctx->callbacks = malloc(sizeof(_callbacks))))\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    free(ctx);\n");
+    fprintf(of, "    return NULL;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "  memcpy(ctx->callbacks, _callbacks, sizeof(_callbacks));\n");
+    fprintf(of, "  ctx->cbt.count = %d;\n",
+                  phrase_map_list_count_items(_pml));
+    fprintf(of, "  ctx->cbt.entries = ctx->callbacks;\n");
+  }
+  fprintf(of, "\n");
+  fprintf(of, "  return ctx;\n");
+  fprintf(of, "}\n");
   fprintf(of, "\n");
 
-    // Emit comment block for <PROJECT>-walker's main() function
+    // Emit comment block for <PROJECT>_context_new_from_input()
 
   fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
   fprintf(of, "\n");
-  fprintf(of, "     %smain function for %s %s-walker utility command.\n",
-                (_use_doxygen) ? "@brief " : "",
-                (_use_doxygen) ? "@b" : "",
-                parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "     This is the main function for the %s %s-walker "
-              "utility.%s\n",
-                (_use_doxygen) ? "@b" : "",
-                parser_name,
-                (_use_doxygen) ? "@n" : "");
-  fprintf(of, "       - Accepts and parses command line arguments\n");
-  fprintf(of, "       - Initializes the input source\n");
-  fprintf(of, "       - Parses the input using the specified phrase(s)\n");
-  fprintf(of, "       - Walks the %s_token tree and displays each %s_token\n",
-                parser_name,
-                parser_name);
-  fprintf(of, "       - Cleans up input source and other data\n");
+  fprintf(of, "    %sCreate a parser context for the whole input source\n",
+                (_use_doxygen) ? "@brief " : "");
   fprintf(of, "\n");
-  fprintf(of, "     @param argc count of command line arguments\n");
-  fprintf(of, "     @param argv array of command line argument strings\n");
+  fprintf(of, "    The input source is copied into a buffer owned by the "
+              "context, and the\n");
+  fprintf(of, "    input position is not changed.\n");
   fprintf(of, "\n");
-  fprintf(of, "     @retval 0 success\n");
-  fprintf(of, "     @retval 1 any failure\n");
+  fprintf(of, "    %s%s%s_context *%s new context on success\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "    %sNULL on failure\n",
+                (_use_doxygen) ? "@retval " : "         ");
   fprintf(of, "\n");
   fprintf(of, "  */\n");
   fprintf(of, "\n");
 
-    // Emit code for <PROJECT>-walker's main() function
+    // Emit code for <PROJECT>_context_new_from_input()
 
-  fprintf(of, "int main(int argc, char **argv)\n");
+  fprintf(of, "%s_context *%s_context_new_from_input(void)\n",
+                parser_name, parser_name);
   fprintf(of, "{\n");
-  fprintf(of, "  int c;\n");
-  fprintf(of, "  extern char *optarg;\n");
-  fprintf(of, "  extern int optind;\n");
-  fprintf(of, "  int long_index;\n");
-  fprintf(of, "  struct option long_opts[] =\n");
-  fprintf(of, "  {\n");
-  pmi = pml;
-  while (pmi)
-  {
-    fprintf(of, "    { \"");
-    fprintf(of, "%s", pmi->name);
-    fprintf(of, "\", 0, 0, 0 },\n");
-    fprintf(of, "\n");
-    pmi = pmi->next;
-  }
-  fprintf(of, "    { 0, 0, 0, 0 }\n");
-  fprintf(of, "  };\n");
-  fprintf(of, "  unsigned char syntax_only = FALSE;\n");
-  pmi = pml;
-  while (pmi)
-  {
-    phrase_name = fix_identifier(strdup(pmi->name));
-    fprintf(of, "  unsigned char walk_%s = FALSE;\n", phrase_name);
-    free(phrase_name);
-    pmi = pmi->next;
-  }
-  fprintf(of, "  %s_token *t;\n", parser_name);
-  fprintf(of, "  char *input_file;\n");
+  fprintf(of, "  %s_context *ctx;\n", parser_name);
+  fprintf(of, "  long pos = input_get_position();\n");
+  fprintf(of, "  unsigned char *buffer, *b;\n");
+  fprintf(of, "  long length = 0;\n");
+  fprintf(of, "  long size = 4096;\n");
   fprintf(of, "\n");
-  fprintf(of, "  while ((c = getopt_long(argc, argv, \"svh\", long_opts, "
-              "&long_index)) != -1)\n");
+  fprintf(of, "  if (!(buffer = malloc(size)))\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  input_set_position(0);\n");
+  fprintf(of, "  while (!input_eof())\n");
   fprintf(of, "  {\n");
-  fprintf(of, "    switch (c)\n");
+  fprintf(of, "    if (length == size)\n");
   fprintf(of, "    {\n");
-  fprintf(of, "      case 0:\n");
-  fprintf(of, "        switch (long_index)\n");
-  fprintf(of, "        {\n");
-  pmi = pml;
-  opt_count = 0;
-  while (pmi)
-  {
-    phrase_name = fix_identifier(strdup(pmi->name));
-    fprintf(of, "          case %d:\n", opt_count);
-    fprintf(of, "            walk_%s = TRUE;\n", phrase_name);
-    fprintf(of, "            break;\n");
-    free(phrase_name);
-    pmi = pmi->next;
-    ++opt_count;
-  }
-  fprintf(of, "          default:\n");
-  fprintf(of, "            break;\n");
-  fprintf(of, "        }\n");
-  fprintf(of, "        break;\n");
-  fprintf(of, "      case 's':\n");
-  fprintf(of, "        syntax_only = TRUE;\n");
-  fprintf(of, "        break;\n");
-  fprintf(of, "      case 'v':\n");
-  fprintf(of, "        version();\n");
-  fprintf(of, "        return 0;\n");
-  fprintf(of, "      case 'h':\n");
-  fprintf(of, "      default:\n");
-  fprintf(of, "        version();\n");
-  fprintf(of, "        usage();\n");
-  fprintf(of, "        return 1;\n");
+  fprintf(of, "      if (!(b = realloc(buffer, size * 2)))\n");
+  fprintf(of, "      {\n");
+  fprintf(of, "        free(buffer);\n");
+  fprintf(of, "        input_set_position(pos);\n");
+  fprintf(of, "        return NULL;\n");
+  fprintf(of, "      }\n");
+  fprintf(of, "      buffer = b;\n");
+  fprintf(of, "      size *= 2;\n");
   fprintf(of, "    }\n");
+  fprintf(of, "    buffer[length++] = input_byte();\n");
   fprintf(of, "  }\n");
+  fprintf(of, "  input_set_position(pos);\n");
   fprintf(of, "\n");
-  fprintf(of, "  input_file = NULL;\n");
-  fprintf(of, "  if (optind < argc)\n");
-  fprintf(of, "    if (strcmp(argv[optind], \"-\"))\n");
-  fprintf(of, "      input_file = strdup(argv[optind]);\n");
-  fprintf(of, "\n");
-  fprintf(of, "  if (!input_initialize(input_file))\n");
-  fprintf(of, "    return 1;\n");
-  fprintf(of, "\n");
-  pmi = pml;
-  while (pmi)
-  {
-    phrase_name = fix_identifier(strdup(pmi->name));
-    fprintf(of, "  if (walk_%s)\n", phrase_name);
-    fprintf(of, "  {\n");
-    fprintf(of, "    t = %s();\n", phrase_name);
-    free(phrase_name);
-    fprintf(of, "    if (t)\n");
-    fprintf(of, "    {\n");
-    fprintf(of, "      if (syntax_only)\n");
-    fprintf(of, "        printf(\"Passed.\\n\");\n");
-    fprintf(of, "      else\n");
-    fprintf(of, "        walk(t, 0);\n");
-    fprintf(of, "    }\n");
-    fprintf(of, "    else\n");
-    fprintf(of, "      printf(\"Failed.\\n\");\n");
-    fprintf(of, "  }\n");
-    fprintf(of, "\n");
-    pmi = pmi->next;
-  }
-  fprintf(of, "  input_cleanup();\n");
-  fprintf(of, "\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return 1;\n");
+  fprintf(of, "  if (!(ctx = %s_context_new(buffer, length)))\n", parser_name);
+  fprintf(of, "  {\n");
+  fprintf(of, "    free(buffer);\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "  ctx->owns_input_buffer = TRUE;\n");
   fprintf(of, "\n");
-  fprintf(of, "  return 0;\n");
+  fprintf(of, "  return ctx;\n");
   fprintf(of, "}\n");
   fprintf(of, "\n");
 
-    // Emit comment block for <PROJECT>-walker's usage() function
+    // Emit comment block for <PROJECT>_context_delete()
 
   fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
   fprintf(of, "\n");
-  fprintf(of, "     %s Displays usage/help message in conventional format.\n",
-                (_use_doxygen) ? "@brief" : "");
+  fprintf(of, "    %sDelete a parser context\n",
+                (_use_doxygen) ? "@brief " : "");
   fprintf(of, "\n");
-  fprintf(of, "     This function displays a help and usage message for the "
-              "%s %s-walker\n",
-                (_use_doxygen) ? "@b" : "",
+  fprintf(of, "    Tokens parsed with the context are not freed, but their "
+              "text and\n");
+  fprintf(of, "    locations can no longer be read.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sctx %s_context * of context to delete\n",
+                (_use_doxygen) ? "@param " : "Param: ",
                 parser_name);
-  fprintf(of, "     utility in the mostly ubiquitous POSIX/GNU format.\n");
   fprintf(of, "\n");
   fprintf(of, "  */\n");
   fprintf(of, "\n");
 
-  if (_use_external_usage)
-  {
-      // Emit include directive for <PROJECT>-walker's usage() function
+    // Emit code for <PROJECT>_context_delete()
 
-    fprintf(of, "#include \"%s-walker-usage.inc\"\n", parser_name);
-    fprintf(of, "\n");
-  }
-  else
+  fprintf(of, "void %s_context_delete(%s_context *ctx)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  if (!ctx)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  if (_use_memo || _memo_phrases)
+    fprintf(of, "  memo_release(ctx);\n");
+  if (_use_callbacks)
+    fprintf(of, "  free(ctx->callbacks);\n");
+  if (_use_events)
+    fprintf(of, "  free(ctx->events);\n");
+  if (_use_push)
   {
-      // Emit code for <PROJECT>-walker's usage() function
-
-    fprintf(of, "static void usage(void)\n");
-    fprintf(of, "{\n");
-
-    fprintf(of, "  fprintf(stderr, \"\\nUSAGE:\\n\");\n");
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
-
-    fprintf(of, "  fprintf(stderr,\n");
-    fprintf(of, "    \"    %s-walker [--grammar] [-s] [EGG_FILE]\\n\");\n",
-      parser_name);
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
-
-    fprintf(of, "  fprintf(stderr, \"    %s-walker -v, --version\\n\");\n",
-      parser_name);
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
-
-    fprintf(of, "  fprintf(stderr, \"    %s-walker -h, --help\\n\");\n",
-      parser_name);
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "  if (ctx->push)\n");
+    fprintf(of, "    free(ctx->push->stack);\n");
+    fprintf(of, "  free(ctx->push);\n");
+  }
+  fprintf(of, "  %s_token_source_release(&ctx->source);\n", parser_name);
+  fprintf(of, "  if (ctx->owns_input_buffer)\n");
+  fprintf(of, "    free((void *)ctx->input_buffer);\n");
+  fprintf(of, "  free(ctx);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
 
-    fprintf(of, "  fprintf(stderr, \"\\nOPTIONS:\\n\");\n");
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+  if (_use_callbacks)
+  {
+      // Emit comment block for <PROJECT>_context_get_callback_table()
 
-    fprintf(of, "  fprintf(stderr, \"    -h, --help\\n\");\n");
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
-    fprintf(of, "  fprintf(stderr,\n");
-    fprintf(of, "    \"        Display a usage message on STDERR, \"\n");
-    fprintf(of, "    \"which includes the program version.\\n\");\n");
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sReturns pointer to callback table of a parser context\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    The caller can use this to register its own callback "
+                "functions for\n");
+    fprintf(of, "    additional parsing actions in the context.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %sctx %s_context * of parse\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "    %s\"callback_table *\" pointer to head of context "
+                "callback table\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-    fprintf(of, "  fprintf(stderr, \"    -v, --version\\n\");\n");
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
-    fprintf(of, "  fprintf(stderr,\n");
-    fprintf(of,
-      "    \"        Display the program version on STDERR.\\n\");\n");
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+      // Emit code for <PROJECT>_context_get_callback_table()
 
-    fprintf(of, "  fprintf(stderr, \"    [--grammar]\\n\");\n");
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
-    fprintf(of, "  fprintf(stderr,\n");
-    fprintf(of, "    \"        Indicates the top-level phrase name from \"\n");
-    fprintf(of, "    \"which the phrase dump will begin.\\n\");\n");
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
-    fprintf(of, "  fprintf(stderr,\n");
-    fprintf(of, "    \"        NOTE:  Although the --grammar option is \"\n");
-    fprintf(of, "    \"not strictly required by\\n\");\n");
-    fprintf(of, "  fprintf(stderr,\n");
-    fprintf(of, "    \"               %s-walker, nothing meaningful will \"\n",
-      parser_name);
-    fprintf(of, "    \"be processed without\\n\");\n");
-    fprintf(of, "  fprintf(stderr,\n");
-    fprintf(of, "    \"               this option.\\n\");\n");
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "callback_table *%s_context_get_callback_table(%s_context "
+                "*ctx)\n",
+                  parser_name, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  return &ctx->cbt;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
 
-    fprintf(of, "  fprintf(stderr, \"    [-s]\\n\");\n");
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
-    fprintf(of, "  fprintf(stderr,\n");
-    fprintf(of,
-      "    \"        Flag to control the output reported.  When \"\n");
-    fprintf(of, "    \"this flag is present, the\\n\");\n");
-    fprintf(of, "  fprintf(stderr,\n");
-    fprintf(of, "    \"        output will be either 'Passed' or \"\n");
-    fprintf(of, "    \"'Failed'.\\n\");\n");
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+  if (_use_events)
+  {
+      // Emit comment block for <PROJECT>_context_set_event_handler()
 
-    fprintf(of, "  fprintf(stderr, \"    [EGG_FILE]\\n\");\n");
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
-    fprintf(of, "  fprintf(stderr,\n");
-    fprintf(of,
-      "    \"        Specify the name of the EGG file.  A single '-' \"\n");
-    fprintf(of, "    \"character will read\\n\");\n");
-    fprintf(of, "  fprintf(stderr,\n");
-    fprintf(of,
-      "    \"        input from STDIN.  Defaults to STDIN.\\n\");\n");
-    fprintf(of, "  fprintf(stderr, \"\\n\");\n");
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sSet the function called for each phrase matched by "
+                "the recognizers\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "    in a parser context\n");
+    fprintf(of, "\n");
+    fprintf(of, "    Matches are reported in the order they end, each phrase "
+                "after the\n");
+    fprintf(of, "    phrases within it.  Matches in alternatives which are "
+                "given up are\n");
+    fprintf(of, "    never reported.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %sctx     %s_context * of parse\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "    %shandler %s_event_handler to call, or NULL for none\n",
+                  (_use_doxygen) ? "@param " : "       ",
+                  parser_name);
+    fprintf(of, "    %sdata    user data given to each call of handler\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+
+      // Emit code for <PROJECT>_context_set_event_handler()
 
+    fprintf(of, "void %s_context_set_event_handler(%s_context *ctx,\n",
+                  parser_name, parser_name);
+    fprintf(of, "  %s_event_handler handler,\n", parser_name);
+    fprintf(of, "  void *data)\n");
+    fprintf(of, "{\n");
+    fprintf(of, "  ctx->event_handler = handler;\n");
+    fprintf(of, "  ctx->event_data = data;\n");
     fprintf(of, "\n");
     fprintf(of, "  return;\n");
     fprintf(of, "}\n");
     fprintf(of, "\n");
   }
 
-    // Emit comment block for <PROJECT>-walker's version() function
+  return;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_parser_source function.
+
+     This function emits the public function to parse a repetition of top
+     level elements on several threads, and the static types and helper
+     functions it uses.
+
+     \param of            FILE * of open output file to write source code
+     \param parser_name   string containing name of parser (ie. \<PROJECT\>)
+     \param u_parser_name string containing name of parser in upper case
+
+  */
+
+static void generate_parallel_functions(FILE *of,
+                                        char *parser_name,
+                                        char *u_parser_name)
+{
+    // Emit code for parallel parse constants
+
+  fprintf(of, "#define %s_PARALLEL_CHUNKS_PER_THREAD 4\n", u_parser_name);
+  fprintf(of, "\n");
+
+    // Emit comment block for parallel parse types
 
   fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "    %sDefinition of %s_parallel_chunk, one slice of the input "
+              "parsed\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "    by %s_parse_parallel()\n", parser_name);
+  fprintf(of, "  */\n");
   fprintf(of, "\n");
-  fprintf(of, "     %s Display command version.\n",
-                (_use_doxygen) ? "@brief" : "");
+
+    // Emit parallel parse types
+
+  fprintf(of, "typedef struct\n");
+  fprintf(of, "{\n");
+  fprintf(of, "    /*%s %sInput offset of first byte of chunk */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  long start;\n");
+  fprintf(of, "    /*%s %sInput offset following last byte of chunk */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  long end;\n");
+  fprintf(of, "    /*%s %sInput offset where parsing of chunk stopped */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  long parsed;\n");
+  fprintf(of, "    /*%s %sTRUE when an element failed before end of chunk */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  unsigned char stopped;\n");
+  fprintf(of, "    /*%s %sFirst element token parsed in chunk */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token *first;\n", parser_name);
+  fprintf(of, "    /*%s %sLast element token parsed in chunk */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token *last;\n", parser_name);
+  fprintf(of, "} %s_parallel_chunk;\n", parser_name);
   fprintf(of, "\n");
-  fprintf(of, "     This function displays the current version of this "
-              "command.\n");
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "    %sDefinition of %s_parallel_job, the chunks of a call to\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "    %s_parse_parallel() shared by its threads\n", parser_name);
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+  fprintf(of, "typedef struct\n");
+  fprintf(of, "{\n");
+  fprintf(of, "    /*%s %sInput bytes being parsed */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  const unsigned char *buffer;\n");
+  fprintf(of, "    /*%s %sCount of input bytes */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  long length;\n");
+  fprintf(of, "    /*%s %sSource of token text and locations */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_token_source *source;\n", parser_name);
+  fprintf(of, "    /*%s %sPhrase function of one top level element */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_phrase_function element;\n", parser_name);
+  fprintf(of, "    /*%s %sChunks of input */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_parallel_chunk *chunks;\n", parser_name);
+  fprintf(of, "    /*%s %sCount of chunks */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  int count;\n");
+  fprintf(of, "    /*%s %sIndex of next chunk to be parsed */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  int next;\n");
+  fprintf(of, "    /*%s %sLock of next chunk index */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  pthread_mutex_t lock;\n");
+  fprintf(of, "} %s_parallel_job;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "    %sDefinition of %s_parallel_worker, the state of one thread "
+              "of\n",
+                (_use_doxygen) ? "@brief " : "",
+                parser_name);
+  fprintf(of, "    %s_parse_parallel()\n", parser_name);
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+  fprintf(of, "typedef struct\n");
+  fprintf(of, "{\n");
+  fprintf(of, "    /*%s %sJob shared by all threads */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  %s_parallel_job *job;\n", parser_name);
+  fprintf(of, "    /*%s %sToken arena blocks left by thread */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  void *arena;\n");
+  fprintf(of, "    /*%s %sThread running worker */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  pthread_t thread;\n");
+  fprintf(of, "    /*%s %sTRUE when thread was started */\n",
+                (_use_doxygen) ? "!" : "",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "  unsigned char started;\n");
+  fprintf(of, "} %s_parallel_worker;\n", parser_name);
+  fprintf(of, "\n");
+
+    // Emit comment block for parallel_split()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sFind the first split point at or after an input offset\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    A split point follows a match of the terminator phrase, or "
+              "follows a\n");
+  fprintf(of, "    newline when no terminator phrase is given.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sbuffer     string of input bytes\n",
+                (_use_doxygen) ? "@param " : "Param: ");
+  fprintf(of, "    %slength     count of bytes in buffer\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "    %sfrom       input offset to start search from, greater "
+              "than 0\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "    %sterminator %s_phrase_function of terminator phrase, or "
+              "NULL\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s\"long\" input offset of split point, or length if none "
+              "is found\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
   fprintf(of, "\n");
   fprintf(of, "  */\n");
   fprintf(of, "\n");
 
-    // Emit code for <PROJECT>-walker's version() function
+    // Emit code for parallel_split()
 
-  fprintf(of, "static void version(void)\n");
+  fprintf(of, "static long parallel_split(const unsigned char *buffer,\n");
+  fprintf(of, "                           long length,\n");
+  fprintf(of, "                           long from,\n");
+  fprintf(of, "                           %s_phrase_function terminator)\n",
+                parser_name);
   fprintf(of, "{\n");
-  fprintf(of, "  fprintf(stderr, \"\\n\"\n");
-  fprintf(of, "       \"%s-walker - %s grammar walker.\\n\"\n",
-                parser_name, parser_name);
-  fprintf(of, "       \"%*.*s          Version %s\\n\"\n",
-                (int)strlen(parser_name), (int)strlen(parser_name), " ",
-                _version);
-  fprintf(of, "       \"\\n\");\n");
+  fprintf(of, "  %s_context *ctx;\n", parser_name);
+  fprintf(of, "  %s_token_mark mark;\n", parser_name);
+  fprintf(of, "  long pos;\n");
   fprintf(of, "\n");
-  fprintf(of, "  return;\n");
+  fprintf(of, "  if (!terminator)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    while ((from < length) && (buffer[from - 1] != '\\n'))\n");
+  fprintf(of, "      ++from;\n");
+  fprintf(of, "    return from;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!(ctx = %s_context_new(buffer, length)))\n", parser_name);
+  fprintf(of, "    return length;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  for (pos = from; pos < length; pos++)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    mark = %s_token_arena_mark();\n", parser_name);
+  fprintf(of, "    ctx->input_position = pos;\n");
+  fprintf(of, "    if (terminator(ctx))\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      %s_token_arena_rewind(mark);\n", parser_name);
+  fprintf(of, "      pos = ctx->input_position;\n");
+  fprintf(of, "      break;\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  %s_context_delete(ctx);\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  return pos;\n");
   fprintf(of, "}\n");
   fprintf(of, "\n");
 
-    // Emit comment block for <PROJECT>-walker's walk() function
+    // Emit comment block for parallel_parse_chunk()
 
   fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
   fprintf(of, "\n");
-  fprintf(of, "     %s Walks a %s_token tree.\n",
-                (_use_doxygen) ? "@brief" : "",
-                parser_name);
+  fprintf(of, "    %sParse the top level elements of one chunk of input\n",
+                (_use_doxygen) ? "@brief " : "");
   fprintf(of, "\n");
-  fprintf(of, "     This function walks %s_token tree, and displays each "
-              "%s_token.\n",
-                parser_name,
-                parser_name);
+  fprintf(of, "    Elements are parsed from the start of the chunk across the "
+              "whole\n");
+  fprintf(of, "    input, until one ends at or past the end of the chunk, or "
+              "one fails.\n");
+  fprintf(of, "    Each element therefore matches as it would in a sequential "
+              "parse\n");
+  fprintf(of, "    reaching the start of the chunk.\n");
   fprintf(of, "\n");
-  fprintf(of, "     %st %s_token * to root of %s_token tree\n",
+  fprintf(of, "    %sjob   %s_parallel_job * of parse\n",
                 (_use_doxygen) ? "@param " : "Param: ",
-                parser_name,
                 parser_name);
-  fprintf(of, "     %slevel int depth level of recursion during walk\n",
-                (_use_doxygen) ? "@param " : "Param: ");
+  fprintf(of, "    %sc     %s_parallel_chunk * of chunk to parse\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
   fprintf(of, "\n");
   fprintf(of, "  */\n");
   fprintf(of, "\n");
 
-    // Emit code for <PROJECT>-walker's walk() function
+    // Emit code for parallel_parse_chunk()
 
-  fprintf(of, "static void walk(%s_token *t, int level)\n", parser_name);
+  fprintf(of, "static void parallel_parse_chunk(%s_parallel_job *job,\n",
+                parser_name);
+  fprintf(of, "                                 %s_parallel_chunk *c)\n",
+                parser_name);
   fprintf(of, "{\n");
-  fprintf(of, "  if (!t)\n");
-  fprintf(of, "    return;\n");
+  fprintf(of, "  %s_context *ctx;\n", parser_name);
+  fprintf(of, "  %s_token *t;\n", parser_name);
+  fprintf(of, "  long pos;\n");
   fprintf(of, "\n");
-  fprintf(of, "  printf(\"%%*.*s%%s@%%d.%%d\\n\",\n"
-              "           level, level, \" \",\n"
-              "           %s_token_type_to_string(t),\n"
-              "           t->location.line_number,\n"
-              "           t->location.character_offset);\n",
+  fprintf(of, "  c->parsed = c->start;\n");
+  fprintf(of, "  c->stopped = TRUE;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!(ctx = %s_context_new(job->buffer, job->length)))\n",
                 parser_name);
+  fprintf(of, "    return;\n");
   fprintf(of, "\n");
-  fprintf(of, "  walk(t->descendant, level+1);\n");
+  fprintf(of, "  ctx->token_source = job->source;\n");
+  fprintf(of, "  ctx->input_position = c->start;\n");
+  fprintf(of, "  while (ctx->input_position < c->end)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    pos = ctx->input_position;\n");
+  fprintf(of, "    if (!(t = job->element(ctx)) || (ctx->input_position == "
+              "pos))\n");
+  fprintf(of, "      break;\n");
+  fprintf(of, "    if (c->last)\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      %s_token_set_next(c->last, t);\n", parser_name);
+  fprintf(of, "      %s_token_set_previous(t, c->last);\n", parser_name);
+  fprintf(of, "    }\n");
+  fprintf(of, "    else\n");
+  fprintf(of, "      c->first = t;\n");
+  fprintf(of, "    c->last = t;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "  c->parsed = ctx->input_position;\n");
+  fprintf(of, "  c->stopped = (c->parsed < c->end);\n");
   fprintf(of, "\n");
-  fprintf(of, "  walk(t->next, level);\n");
+  fprintf(of, "  %s_context_delete(ctx);\n", parser_name);
   fprintf(of, "\n");
   fprintf(of, "  return;\n");
   fprintf(of, "}\n");
   fprintf(of, "\n");
 
-  return;
-}
+    // Emit comment block for parallel_worker()
 
-  /*!
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sParse chunks of a job until none are left\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    The token arena blocks of the thread are handed back in the "
+              "worker,\n");
+  fprintf(of, "    so the calling thread of %s_parse_parallel() can take them "
+              "over.\n",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sarg %s_parallel_worker * of thread\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sNULL always\n", (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
 
-     \brief Generates Makefile for \<PROJECT\> parser project.
-    
-     This function generates the Makefile for \<PROJECT\>\n
-     \n
-     The \<PROJECT\> Makefile contains all the make rules necessary to compile
-     and link all the generated source code from embryo and associated
-     utility actions, such as building a linkable library for the \<PROJECT\>
-     parsing modules, installation scripts for the library, header files,
-     and associated documention.
-    
-     \param of          FILE * of open output file to write source code
-     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+    // Emit code for parallel_worker()
 
-  */
+  fprintf(of, "static void *parallel_worker(void *arg)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_parallel_worker *w = arg;\n", parser_name);
+  fprintf(of, "  %s_parallel_job *job = w->job;\n", parser_name);
+  fprintf(of, "  int i;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  while (TRUE)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    pthread_mutex_lock(&job->lock);\n");
+  fprintf(of, "    i = job->next++;\n");
+  fprintf(of, "    pthread_mutex_unlock(&job->lock);\n");
+  fprintf(of, "\n");
+  fprintf(of, "    if (i >= job->count)\n");
+  fprintf(of, "      break;\n");
+  fprintf(of, "\n");
+  fprintf(of, "    parallel_parse_chunk(job, &job->chunks[i]);\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  w->arena = %s_token_arena_detach();\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  return NULL;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
 
-void generate_makefile(FILE *of,
-                       char *parser_name)
-{
-  if (!of)
-    of = stdout;
+    // Emit comment block for <PROJECT>_parse_parallel()
 
-  if (!parser_name)
-    return;
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sParse a repetition of top level elements on several "
+              "threads\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    The input is parsed as if by a phrase of the form\n");
+  fprintf(of, "    \"root = element{1,*} ;\", returning a token of the given "
+              "type holding\n");
+  fprintf(of, "    one token per element matched.  The input is first split "
+              "into chunks,\n");
+  fprintf(of, "    each chunk ending after a match of the terminator phrase, "
+              "or after a\n");
+  fprintf(of, "    newline when no terminator phrase is given.  The chunks are "
+              "then\n");
+  fprintf(of, "    parsed by a pool of threads, and their tokens are joined "
+              "under the\n");
+  fprintf(of, "    returned token, which is allocated with all of the parsed "
+              "tokens in\n");
+  fprintf(of, "    the token arena of the calling thread.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    Each chunk is parsed from its start across the whole input, "
+              "and its\n");
+  fprintf(of, "    tokens are joined only when the elements before it end "
+              "exactly where\n");
+  fprintf(of, "    the chunk starts, so the result is that of a sequential "
+              "parse.  Where\n");
+  fprintf(of, "    an element runs across a split point, the calling thread "
+              "parses on\n");
+  fprintf(of, "    from where it ends until it reaches the start of a later "
+              "chunk, and\n");
+  fprintf(of, "    the work done on the chunks passed over is lost.  Split "
+              "points should\n");
+  fprintf(of, "    therefore be element boundaries for the parse to gain from "
+              "threads.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sCallbacks are not called by this function, and memo\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "             tables are kept per chunk.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sctx        %s_context * of input, made by "
+              "%s_context_new()\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name, parser_name);
+  fprintf(of, "    %stype       %s_token_type of returned token\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "    %selement    %s_phrase_function of one top level element\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "    %sterminator %s_phrase_function of element terminator "
+              "phrase,\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "                      or NULL to split at newlines\n");
+  fprintf(of, "    %sthreads    count of threads to use, or 0 to use one "
+              "thread\n",
+                (_use_doxygen) ? "@param " : "       ");
+  fprintf(of, "                      per online processor\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %s\"%s_token *\" of root token on success\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                parser_name);
+  fprintf(of, "    %sNULL when no element is matched, or on failure\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
 
-  fprintf(of, "CC = gcc\n");
+    // Emit code for <PROJECT>_parse_parallel()
 
-  fprintf(of, "CFLAGS = -g -Wall -Wno-unused-but-set-variable -O0 \\\n"
-              "\t\t-I include \\\n"
-              "\t\t-I /usr/local/include/egg \\\n"
-              "\t\t-I /usr/include/egg \\\n"
-              "\t\t-L /usr/local/lib/egg \\\n"
-              "\t\t-L ./lib\n");
+  fprintf(of, "%s_token *%s_parse_parallel(%s_context *ctx,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "                              %s_token_type type,\n",
+                parser_name);
+  fprintf(of, "                              %s_phrase_function element,\n",
+                parser_name);
+  fprintf(of, "                              %s_phrase_function terminator,\n",
+                parser_name);
+  fprintf(of, "                              int threads)\n");
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token_mark mark = %s_token_arena_mark();\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_parallel_job job;\n", parser_name);
+  fprintf(of, "  %s_parallel_worker *workers;\n", parser_name);
+  fprintf(of, "  %s_parallel_chunk *c;\n", parser_name);
+  fprintf(of, "  %s_context *rest;\n", parser_name);
+  fprintf(of, "  %s_token *root, *last, *t;\n", parser_name);
+  fprintf(of, "  const unsigned char *buffer;\n");
+  fprintf(of, "  long length, start, end, next, pos;\n");
+  fprintf(of, "  int count, i;\n");
+  fprintf(of, "  unsigned char stop;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  if (!ctx || !ctx->input_buffer || !element)\n");
+  fprintf(of, "    return NULL;\n");
   fprintf(of, "\n");
-
-  fprintf(of, "CFLAGS_ALL = $(CFLAGS)\n");
+  fprintf(of, "  buffer = ctx->input_buffer;\n");
+  fprintf(of, "  length = ctx->input_length;\n");
   fprintf(of, "\n");
-
-  fprintf(of, "ifdef EGG_LIBRARY_PATH\n");
-  fprintf(of, "\tCFLAGS_ALL += -L $(EGG_LIBRARY_PATH)\n");
-  fprintf(of, "endif\n");
+  fprintf(of, "  if (threads < 1)\n");
+  fprintf(of, "    threads = (int)sysconf(_SC_NPROCESSORS_ONLN);\n");
+  fprintf(of, "  if (threads < 1)\n");
+  fprintf(of, "    threads = 1;\n");
   fprintf(of, "\n");
-
-  fprintf(of, "ifdef EGG_INCLUDE_PATH\n");
-  fprintf(of, "\tCFLAGS_ALL += -I $(EGG_INCLUDE_PATH)\n");
-  fprintf(of, "endif\n");
+  fprintf(of, "    // Split input into chunks of about equal size\n");
   fprintf(of, "\n");
-
-  fprintf(of, "all: %s-walker\n", parser_name);
+  fprintf(of, "  count = threads * %s_PARALLEL_CHUNKS_PER_THREAD;\n",
+                u_parser_name);
+  fprintf(of, "  if (!(job.chunks = calloc(count, "
+              "sizeof(%s_parallel_chunk))))\n",
+                parser_name);
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "  if (!(workers = calloc(threads, "
+              "sizeof(%s_parallel_worker))))\n",
+                parser_name);
+  fprintf(of, "  {\n");
+  fprintf(of, "    free(job.chunks);\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  job.buffer = buffer;\n");
+  fprintf(of, "  job.length = length;\n");
+  fprintf(of, "  job.source = ctx->token_source;\n");
+  fprintf(of, "  job.element = element;\n");
+  fprintf(of, "  job.count = 0;\n");
+  fprintf(of, "  job.next = 0;\n");
+  fprintf(of, "  pthread_mutex_init(&job.lock, NULL);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  start = 0;\n");
+  fprintf(of, "  for (i = 1; (i <= count) && (start < length); i++)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    if (i == count)\n");
+  fprintf(of, "      end = length;\n");
+  fprintf(of, "    else\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      end = (length / count) * i;\n");
+  fprintf(of, "      if (end <= start)\n");
+  fprintf(of, "        end = start + 1;\n");
+  fprintf(of, "      end = parallel_split(buffer, length, end, terminator);\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "    job.chunks[job.count].start = start;\n");
+  fprintf(of, "    job.chunks[job.count].end = end;\n");
+  fprintf(of, "    ++job.count;\n");
+  fprintf(of, "    start = end;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "    // Parse chunks on the calling thread and a pool of other "
+              "threads\n");
+  fprintf(of, "\n");
+  fprintf(of, "  for (i = 1; i < threads; i++)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    workers[i].job = &job;\n");
+  fprintf(of, "    workers[i].started = !pthread_create(&workers[i].thread,\n");
+  fprintf(of, "                                         NULL,\n");
+  fprintf(of, "                                         parallel_worker,\n");
+  fprintf(of, "                                         &workers[i]);\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "  workers[0].job = &job;\n");
+  fprintf(of, "  parallel_worker(&workers[0]);\n");
+  fprintf(of, "\n");
+  fprintf(of, "  for (i = 0; i < threads; i++)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    if ((i > 0) && workers[i].started)\n");
+  fprintf(of, "      pthread_join(workers[i].thread, NULL);\n");
+  fprintf(of, "    %s_token_arena_attach(workers[i].arena);\n", parser_name);
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  pthread_mutex_destroy(&job.lock);\n");
+  fprintf(of, "  free(workers);\n");
   fprintf(of, "\n");
-
-  fprintf(of, "%s-walker: bin/%s-walker\n",
-                parser_name, parser_name);
+  fprintf(of, "    // Join element tokens under a root token, taking the "
+              "tokens of a chunk\n");
+  fprintf(of, "    // only when the elements before it end where the chunk "
+              "starts\n");
   fprintf(of, "\n");
-
-  fprintf(of, "bin/%s-walker: obj/%s-walker.o \\\n",
-                parser_name, parser_name);
-  fprintf(of, "\t\tlib/lib%s-parser.so.1.0\n", parser_name);
-  fprintf(of, "\t$(CC) $(CFLAGS_ALL) \\\n");
-  fprintf(of, "\t\t-o bin/%s-walker \\\n", parser_name);
-  fprintf(of, "\t\tobj/%s-walker.o \\\n", parser_name);
-  fprintf(of, "\t\t-legg-common \\\n");
-  fprintf(of, "\t\t-legg-parser\n");
+  fprintf(of, "  root = last = NULL;\n");
+  fprintf(of, "  rest = NULL;\n");
+  fprintf(of, "  pos = 0;\n");
+  fprintf(of, "  stop = FALSE;\n");
+  fprintf(of, "  i = 0;\n");
   fprintf(of, "\n");
-
-  fprintf(of, "lib%s-parser: lib/lib%s-parser.a lib/lib%s-parser.so.1.0\n",
-                parser_name, parser_name, parser_name);
+  fprintf(of, "  if ((root = token_new(ctx, type)))\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    while (!stop && (pos < length))\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      while ((i < job.count) && (job.chunks[i].start < pos))\n");
+  fprintf(of, "        ++i;\n");
   fprintf(of, "\n");
-  fprintf(of, "lib/lib%s-parser.so.1.0: obj/%s-parser.o \\\n",
-                parser_name, parser_name);
-  fprintf(of, "    obj/%s-token.o \\\n", parser_name);
-  fprintf(of, "    obj/%s-token-util.o\n", parser_name);
-  fprintf(of, "  $(CC) $(COPTS) --shared -Wl,-soname,lib%s-parser.so.1 \\\n",
+  fprintf(of, "      if ((i < job.count) && (job.chunks[i].start == pos))\n");
+  fprintf(of, "      {\n");
+  fprintf(of, "        c = &job.chunks[i++];\n");
+  fprintf(of, "        if (c->first)\n");
+  fprintf(of, "        {\n");
+  fprintf(of, "          if (last)\n");
+  fprintf(of, "          {\n");
+  fprintf(of, "            %s_token_set_next(last, c->first);\n", parser_name);
+  fprintf(of, "            %s_token_set_previous(c->first, last);\n",
                 parser_name);
-  fprintf(of, "    -o lib/lib%s-parser.so.1.0 \\\n", parser_name);
-  fprintf(of, "    obj/%s-parser.o \\\n", parser_name);
-  fprintf(of, "    obj/%s-token.o \\\n", parser_name);
-  fprintf(of, "    obj/%s-token-util.o\n", parser_name);
-  fprintf(of, "  @(cd lib; ln -sf lib%s-parser.so.1.0 lib%s-parser.so.1)\n",
-                parser_name, parser_name);
-  fprintf(of, "  @(cd lib; ln -sf lib%s-parser.so.1 lib%s-parser.so)\n",
-                parser_name, parser_name);
-  fprintf(of, "\n");
-  fprintf(of, "lib/lib%s-parser.a: obj/%s-parser.o \\\n",
-                parser_name, parser_name);
-  fprintf(of, "    obj/%s-token.o \\\n", parser_name);
-  fprintf(of, "    obj/%s-token-util.o\n", parser_name);
-  fprintf(of, "  ar crD lib/lib%s-parser.a \\\n", parser_name);
-  fprintf(of, "    obj/%s-parser.o \\\n", parser_name);
-  fprintf(of, "    obj/%s-token.o \\\n", parser_name);
-  fprintf(of, "    obj/%s-token-util.o\n", parser_name);
+  fprintf(of, "          }\n");
+  fprintf(of, "          else\n");
+  fprintf(of, "            %s_token_set_descendant(root, c->first);\n",
+                parser_name);
+  fprintf(of, "          last = c->last;\n");
+  fprintf(of, "        }\n");
+  fprintf(of, "        pos = c->parsed;\n");
+  fprintf(of, "        stop = c->stopped;\n");
+  fprintf(of, "        continue;\n");
+  fprintf(of, "      }\n");
+  fprintf(of, "\n");
+  fprintf(of, "        // Parse on from where an element ran across a split "
+              "point, up to\n");
+  fprintf(of, "        // the start of the next chunk\n");
+  fprintf(of, "\n");
+  fprintf(of, "      if (!rest)\n");
+  fprintf(of, "      {\n");
+  fprintf(of, "        if (!(rest = %s_context_new(buffer, length)))\n",
+                parser_name);
+  fprintf(of, "        {\n");
+  fprintf(of, "          last = NULL;\n");
+  fprintf(of, "          break;\n");
+  fprintf(of, "        }\n");
+  fprintf(of, "        rest->token_source = ctx->token_source;\n");
+  fprintf(of, "      }\n");
+  fprintf(of, "\n");
+  fprintf(of, "      next = (i < job.count) ? job.chunks[i].start : length;\n");
+  fprintf(of, "      rest->input_position = pos;\n");
+  fprintf(of, "      while (pos < next)\n");
+  fprintf(of, "      {\n");
+  fprintf(of, "        if (!(t = element(rest)) || (rest->input_position == "
+              "pos))\n");
+  fprintf(of, "        {\n");
+  fprintf(of, "          stop = TRUE;\n");
+  fprintf(of, "          break;\n");
+  fprintf(of, "        }\n");
+  fprintf(of, "        if (last)\n");
+  fprintf(of, "        {\n");
+  fprintf(of, "          %s_token_set_next(last, t);\n", parser_name);
+  fprintf(of, "          %s_token_set_previous(t, last);\n", parser_name);
+  fprintf(of, "        }\n");
+  fprintf(of, "        else\n");
+  fprintf(of, "          %s_token_set_descendant(root, t);\n", parser_name);
+  fprintf(of, "        last = t;\n");
+  fprintf(of, "        pos = rest->input_position;\n");
+  fprintf(of, "      }\n");
+  fprintf(of, "    }\n");
   fprintf(of, "\n");
-
-  fprintf(of, "obj/%s-walker.o: src/%s-walker.c \\\n",
-                parser_name, parser_name);
-  fprintf(of, "\t\tinclude/%s-token.h \\\n", parser_name);
-  fprintf(of, "\t\tinclude/%s-token-type.h \\\n", parser_name);
-  fprintf(of, "\t\tinclude/%s-token-util.h \\\n", parser_name);
-  fprintf(of, "\t\tinclude/%s-parser.h\n", parser_name);
-  fprintf(of, "\t$(CC) $(CFLAGS_ALL) \\\n");
-  fprintf(of, "\t\t-o obj/%s-walker.o \\\n", parser_name);
-  fprintf(of, "\t\t-c src/%s-walker.c\n", parser_name);
+  fprintf(of, "    if (rest)\n");
+  fprintf(of, "      %s_context_delete(rest);\n", parser_name);
   fprintf(of, "\n");
-
-  fprintf(of, "obj/%s-parser.o: "
-              "src/%s-parser.c \\\n",
+  fprintf(of, "    for (t = %s_token_get_descendant(root); t; t = "
+              "%s_token_get_next(t))\n",
                 parser_name, parser_name);
-  fprintf(of, "\t\tinclude/%s-parser.h \\\n", parser_name);
-  fprintf(of, "\t\tinclude/%s-token.h \\\n", parser_name);
-  fprintf(of, "\t\tinclude/%s-token-type.h\n", parser_name);
-  fprintf(of, "\t$(CC) $(CFLAGS_ALL) -fPIC\\\n");
-  fprintf(of, "\t\t-o obj/%s-parser.o \\\n", parser_name);
-  fprintf(of, "\t\t-c src/%s-parser.c\n", parser_name);
+  fprintf(of, "      %s_token_set_ascendant(t, root);\n", parser_name);
+  fprintf(of, "  }\n");
   fprintf(of, "\n");
-
-  fprintf(of, "obj/%s-token.o: "
-              "src/%s-token.c \\\n",
-                parser_name, parser_name);
-  fprintf(of, "\t\tinclude/%s-token.h \\\n", parser_name);
-  fprintf(of, "\t\tinclude/%s-token-type.h \\\n", parser_name);
-  fprintf(of, "\t\tinclude/%s-token-util.h\n", parser_name);
-  fprintf(of, "\t$(CC) $(CFLAGS_ALL) -fPIC\\\n");
-  fprintf(of, "\t\t-o obj/%s-token.o \\\n", parser_name);
-  fprintf(of, "\t\t-c src/%s-token.c\n", parser_name);
+  fprintf(of, "  free(job.chunks);\n");
   fprintf(of, "\n");
-
-  fprintf(of, "obj/%s-token-util.o: "
-              "src/%s-token-util.c \\\n",
-                parser_name, parser_name);
-  fprintf(of, "\t\tinclude/%s-token.h \\\n", parser_name);
-  fprintf(of, "\t\tinclude/%s-token-type.h \\\n", parser_name);
-  fprintf(of, "\t\tinclude/%s-token-util.h\n", parser_name);
-  fprintf(of, "\t$(CC) $(CFLAGS_ALL) -fPIC\\\n");
-  fprintf(of, "\t\t-o obj/%s-token-util.o \\\n", parser_name);
-  fprintf(of, "\t\t-c src/%s-token-util.c\n", parser_name);
+  fprintf(of, "  if (!last)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    %s_token_arena_rewind(mark);\n", parser_name);
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "  }\n");
   fprintf(of, "\n");
-  fprintf(of, "clean:\n");
-  fprintf(of, "\t@rm -f obj/*.o\n");
-  fprintf(of, "\t@rm -f lib/*\n");
-  fprintf(of, "\t@rm -f bin/%s-walker\n", parser_name);
+  fprintf(of, "  %s_token_set_offset(root, 0);\n", parser_name);
+  fprintf(of, "  %s_token_set_length(root, pos);\n", parser_name);
   fprintf(of, "\n");
+  fprintf(of, "  return root;\n");
+  fprintf(of, "}\n");
 
   return;
 }
@@ -2399,262 +12893,560 @@ void generate_makefile(FILE *of,
   /*!
 
      \brief Helper function for \e generate_parser_source function.
-    
-     This function is the highest level helper function for generating the
-     parser for \<PROJECT\>.\n
-     \n
-     This function basically scans each individual phrase in the token tree
-     of the parsed EGG file for \<PROJECT\>'s grammar and kicks off the
-     subsequent calls to lower level generator functions.
-    
-     \warning This function is recursive.
+
+     This function emits the public functions to parse the input of a
+     parser context one element at a time, releasing each element and the
+     input before it once the caller is done with it.
 
      \param of          FILE * of open output file to write source code
      \param parser_name string containing name of parser (ie. \<PROJECT\>)
-     \param t           \e egg_token * containing the root token from which
-                        the source code is generated
-     \param level       the current indentation level for generated code
 
   */
 
-static void generate_grammar(FILE *of,
-                             char *parser_name,
-                             egg_token *t,
-                             int level)
+static void generate_stream_functions(FILE *of,
+                                      char *parser_name,
+                                      char *u_parser_name)
 {
-  if (!t) return;
+    // Emit comment block for <PROJECT>_context_new_stream()
 
-  if (!parser_name)
-    return;
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sCreate a parser context streaming the input source\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    Input source bytes are read, from the current input "
+              "position, into a\n");
+  fprintf(of, "    window held by the context as they are needed.  Elements of "
+              "the input\n");
+  fprintf(of, "    are parsed one at a time with %s_stream_next(), and the "
+              "input before\n",
+                parser_name);
+  fprintf(of, "    the end of an element is dropped from the window by\n");
+  fprintf(of, "    %s_stream_release(), so the memory used does not grow with "
+              "the size\n",
+                parser_name);
+  fprintf(of, "    of the input.  Token offsets are counted from the start of "
+              "the\n");
+  fprintf(of, "    stream.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %s\"%s_context *\" new context on success\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                parser_name);
+  fprintf(of, "    %sNULL on failure\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
 
-  if (!of)
-    of = stdout;
+    // Emit code for <PROJECT>_context_new_stream()
 
-  switch (t->type)
+  fprintf(of, "%s_context *%s_context_new_stream(void)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_context *ctx;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  if (!(ctx = %s_context_new(NULL, 0)))\n", parser_name);
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  ctx->owns_input_buffer = TRUE;\n");
+  fprintf(of, "  ctx->input_stream = TRUE;\n");
+  fprintf(of, "  ctx->stream_mark = %s_token_arena_mark();\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  return ctx;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+  if (_use_push)
   {
-    case egg_token_type_phrase:
-      generate_phrase(of, parser_name, t);
-      break;
-    default:
-      break;
-  }
+      // Emit comment block for push_run()
 
-  generate_grammar(of, parser_name, t->descendant, level+1);
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sParse an element of a push context on the stack of its "
+                "parse\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-  generate_grammar(of, parser_name, t->next, level);
+      // Emit code for push_run()
 
-  return;
-}
+    fprintf(of, "static void push_run(void)\n");
+    fprintf(of, "{\n");
+    fprintf(of, "  %s_context *ctx = _push_context;\n", parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  ctx->push->t = ctx->push->element(ctx);\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
 
-  /*!
+      // Emit comment block for push_next()
 
-     \brief Helper function for \e generate_parser_source function.
-    
-     This function parses a phrase token and generates the appropriate
-     code for the phrase parsing function.\n
-     \n
-     A phrase consists of a phrase-name and a definition.  This function
-     directly generates the source for the phrase parsing function pre-amble
-     code, calls the subsequent definition code generating function, and then
-     closes out the code for the phrase parsing function.
-    
-     \param of          FILE * of open output file to write source code
-     \param parser_name string containing name of parser (ie. \<PROJECT\>)
-     \param t           \e egg_token * containing the phrase token from which
-                        the source code is generated
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sParse or resume the next element of a push context\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    The element is parsed on a stack of its own.  When it "
+                "needs bytes\n");
+    fprintf(of, "    not yet fed, context_fill() suspends it, and the next "
+                "call resumes\n");
+    fprintf(of, "    it where it stopped instead of parsing it again from its "
+                "start.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %sctx     %s_context * of parse\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "    %selement %s_phrase_function of element, unused when "
+                "resuming\n",
+                  (_use_doxygen) ? "@param " : "       ",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "    %s\"%s_token *\" of element on success\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ",
+                  parser_name);
+    fprintf(of, "    %sNULL at end of input, while more bytes are needed, or "
+                "when\n",
+                  (_use_doxygen) ? "@retval " : "         ");
+    fprintf(of, "             no element is matched\n");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-  */
+      // Emit code for push_next()
 
-static void generate_phrase(FILE *of,
-                            char *parser_name,
-                            egg_token *t)
-{
-  egg_token *pn;
-  egg_token *def;
-  char *ds = NULL;
+    fprintf(of, "static %s_token *push_next(%s_context *ctx, "
+                "%s_phrase_function element)\n",
+                  parser_name, parser_name, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  %s_push_state *p = ctx->push;\n", parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  if (!p->suspended)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    if (context_eof(ctx))\n");
+    fprintf(of, "      return NULL;\n");
+    fprintf(of, "\n");
+    fprintf(of, "    p->element = element;\n");
+    fprintf(of, "    p->position = ctx->input_position;\n");
+    fprintf(of, "    p->t = NULL;\n");
+    fprintf(of, "    ctx->stream_mark = %s_token_arena_mark();\n", parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "    if (getcontext(&p->parser) == -1)\n");
+    fprintf(of, "      return NULL;\n");
+    fprintf(of, "    p->parser.uc_stack.ss_sp = p->stack;\n");
+    fprintf(of, "    p->parser.uc_stack.ss_size = %s_PUSH_STACK_SIZE;\n",
+                  u_parser_name);
+    fprintf(of, "    p->parser.uc_link = &p->caller;\n");
+    fprintf(of, "    makecontext(&p->parser, push_run, 0);\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  _push_context = ctx;\n");
+    fprintf(of, "  p->running = TRUE;\n");
+    fprintf(of, "  swapcontext(&p->caller, &p->parser);\n");
+    fprintf(of, "  p->running = FALSE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (p->suspended)\n");
+    fprintf(of, "    return NULL;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!p->t || (ctx->input_position == p->position))\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    %s_token_arena_rewind(ctx->stream_mark);\n", parser_name);
+    fprintf(of, "    ctx->input_position = p->position;\n");
+    if (_use_memo || _memo_phrases)
+      fprintf(of, "    memo_release(ctx);\n");
+    fprintf(of, "    return NULL;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return p->t;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
+  }
 
-  if (!t)
-    return;
+    // Emit comment block for <PROJECT>_stream_next()
 
-  if (t->type != egg_token_type_phrase)
-    return;
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sParse the next element of the input of a parser context\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    The element is parsed at the input position, which is moved "
+              "past it.\n");
+  fprintf(of, "    The tokens of the element are kept until "
+              "%s_stream_release() is\n",
+                parser_name);
+  fprintf(of, "    called.\n");
+  fprintf(of, "\n");
+  if (_use_push)
+  {
+    fprintf(of, "    For a push context, an element which needs bytes not yet "
+                "fed is\n");
+    fprintf(of, "    suspended, and NULL is returned until more bytes are "
+                "fed.  The next\n");
+    fprintf(of, "    call then resumes the element where it stopped.\n");
+    fprintf(of, "\n");
+  }
+  fprintf(of, "    %sctx     %s_context * of parse\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "    %selement %s_phrase_function of element\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %s\"%s_token *\" of element on success\n",
+                (_use_doxygen) ? "@retval " : "Returns: ",
+                parser_name);
+  fprintf(of, "    %sNULL at end of input, or when no element is matched\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
 
-  if (!parser_name)
-    return;
+    // Emit code for <PROJECT>_stream_next()
 
-  if (!of)
-    of = stdout;
+  fprintf(of, "%s_token *%s_stream_next(%s_context *ctx,\n",
+                parser_name, parser_name, parser_name);
+  fprintf(of, "                            %s_phrase_function element)\n",
+                parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token *t;\n", parser_name);
+  fprintf(of, "  long pos;\n");
+  fprintf(of, "\n");
+  if (_use_push)
+  {
+    fprintf(of, "  if (!ctx || !element)\n");
+    fprintf(of, "    return NULL;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  ctx->input_starved = FALSE;\n");
+    fprintf(of, "  if (ctx->input_push)\n");
+    fprintf(of, "    return push_next(ctx, element);\n");
+    fprintf(of, "  if (context_eof(ctx))\n");
+    fprintf(of, "    return NULL;\n");
+  }
+  else
+  {
+    fprintf(of, "  if (!ctx || !element || context_eof(ctx))\n");
+    fprintf(of, "    return NULL;\n");
+  }
+  fprintf(of, "\n");
+  fprintf(of, "  pos = ctx->input_position;\n");
+  fprintf(of, "  ctx->stream_mark = %s_token_arena_mark();\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  if (!(t = element(ctx)) || (ctx->input_position == pos))\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    %s_token_arena_rewind(ctx->stream_mark);\n", parser_name);
+  fprintf(of, "    ctx->input_position = pos;\n");
+  if (_use_memo || _memo_phrases)
+    fprintf(of, "    memo_release(ctx);\n");
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return t;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
 
-  _pns = _pns_f = NULL;
+    // Emit comment block for <PROJECT>_stream_release()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sRelease the element most recently parsed from a parser "
+              "context\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    The tokens of the element returned by the last call of\n");
+  fprintf(of, "    %s_stream_next(), and any token allocated after them, are "
+              "freed.\n",
+                parser_name);
+  fprintf(of, "    For a stream context, the input before the input position "
+              "is dropped\n");
+  fprintf(of, "    from the window of the context as well.\n");
+  if (_use_push)
+    fprintf(of, "    Nothing is released while an element of a push context "
+                "is suspended.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sAny pointer to a released token is invalid after this\n",
+                (_use_doxygen) ? "@warning " : "Warning: ");
+  fprintf(of, "             call.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sctx %s_context * of parse\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
 
-  t = t->descendant;
+    // Emit code for <PROJECT>_stream_release()
 
-  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "void %s_stream_release(%s_context *ctx)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  long drop;\n");
   fprintf(of, "\n");
-  fprintf(of, "    %s%sEGG Phrase Definition%s\n",
-                (_use_doxygen) ? "@par " : "",
-                (_use_doxygen) ? "\"" : "",
-                (_use_doxygen) ? "\"" : ":");
-  if (_use_doxygen)
-    fprintf(of, "    @verbatim\n");
-  ds = egg_token_to_string(t, ds);
-  if (ds)
+  if (_use_push)
+    fprintf(of, "  if (!ctx || (ctx->push && ctx->push->suspended))\n");
+  else
+    fprintf(of, "  if (!ctx)\n");
+  fprintf(of, "    return;\n");
+  fprintf(of, "\n");
+  fprintf(of, "  %s_token_arena_rewind(ctx->stream_mark);\n", parser_name);
+  fprintf(of, "  ctx->stream_mark = %s_token_arena_mark();\n", parser_name);
+  fprintf(of, "\n");
+  if (_use_memo || _memo_phrases)
   {
-    emit_phrase_comment_lines(of, ds);
-    free(ds);
+    fprintf(of, "  memo_release(ctx);\n");
+    fprintf(of, "\n");
   }
-  if (_use_doxygen)
-    fprintf(of, "    @endverbatim\n");
+  fprintf(of, "  if (!ctx->input_stream)\n");
+  fprintf(of, "    return;\n");
   fprintf(of, "\n");
-  fprintf(of, "    %s %s%s_token *%s on synctactical match of phrase\n",
-                (_use_doxygen) ? "@retval" : "Returns:",
-                (_use_doxygen) ? "\"" : "",
-                parser_name,
-                (_use_doxygen) ? "\"" : "");
-  fprintf(of, "    %s NULL on error including NO MATCH\n",
-                (_use_doxygen) ? "@retval" : "        ");
+  fprintf(of, "  drop = ctx->input_position - ctx->input_base;\n");
+  fprintf(of, "  if (drop > 0)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    %s_token_source_drop(&ctx->source, ctx->input_position);\n",
+                parser_name);
+  fprintf(of, "    memmove((void *)ctx->input_buffer,\n");
+  fprintf(of, "            ctx->input_buffer + drop,\n");
+  fprintf(of, "            ctx->input_length - ctx->input_position);\n");
+  fprintf(of, "    ctx->input_base = ctx->input_position;\n");
+  fprintf(of, "  }\n");
   fprintf(of, "\n");
-  fprintf(of, " */\n");
+  fprintf(of, "  return;\n");
+  fprintf(of, "}\n");
   fprintf(of, "\n");
 
-  pn = egg_token_find(t, egg_token_type_phrase_name);
-  if (pn)
-  {
-    _pns = egg_token_to_string(pn->descendant, _pns);
-    if (_pns)
-    {
-      _pns_f = fix_identifier(strdup(_pns));
-
-      fprintf(of, "%s_token *", parser_name);
-      fprintf(of, "%s", _pns_f);
-      fprintf(of, "(void)\n");
-      fprintf(of, "{\n");
-      fprintf(of, "  long pos = input_get_position();\n");
-      fprintf(of, "  %s_token *nt, *t1, *t2;\n", parser_name);
-      fprintf(of, "  int count;\n");
-      fprintf(of, "  %s_token_direction dir;\n", parser_name);
-      fprintf(of, "\n");
-      fprintf(of, "  callback_by_index(&_cbt,\n"
-                  "                    %d,\n"
-                  "                    entry,\n"
-                  "                    (void *)%s_token_type_%s);\n",
-                    phrase_map_list_get_item_index(_pml, _pns),
-                    parser_name, _pns_f);
-      fprintf(of, "\n");
-      fprintf(of, "  if (input_eof())\n");
-      fprintf(of, "    return NULL;\n");
-      fprintf(of, "\n");
-      fprintf(of, "  count = 0;\n");
-      fprintf(of, "\n");
-      fprintf(of, "  nt = t1 = t2 = NULL;\n");
-      fprintf(of, "\n");
-      fprintf(of, "  nt = %s_token_new(%s_token_type_%s);\n",
-                    parser_name, parser_name, _pns_f);
-      fprintf(of, "  if (!nt)\n");
-      fprintf(of, "  {\n");
-      fprintf(of, "    callback_by_index(&_cbt,\n"
-                  "                      %d,\n"
-                  "                      fail,\n"
-                  "                      (void *)%s_token_type_%s);\n",
-                    phrase_map_list_get_item_index(_pml, _pns),
-                    parser_name, _pns_f);
-      fprintf(of, "    return NULL;\n");
-      fprintf(of, "  }\n");
-      fprintf(of, "\n");
-      fprintf(of, "  t1 = nt;\n");
-      fprintf(of, "\n");
-
-      def = egg_token_find(t, egg_token_type_definition);
-      generate_definition(of, parser_name, def);
-    }
-  }
+    // Emit comment block for <PROJECT>_stream_eof()
 
-  fprintf(of, "  callback_by_index(&_cbt,\n"
-              "                    %d,\n"
-              "                    fail,\n"
-              "                    (void *)%s_token_type_%s);\n",
-                phrase_map_list_get_item_index(_pml, _pns),
-                parser_name, _pns_f);
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sTest for the end of input of a parser context\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sctx %s_context * of parse\n",
+                (_use_doxygen) ? "@param " : "Param: ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sTRUE  at end of input\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "    %sFALSE otherwise\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
   fprintf(of, "\n");
 
-  fprintf(of, "  return NULL;\n");
+    // Emit code for <PROJECT>_stream_eof()
+
+  fprintf(of, "unsigned char %s_stream_eof(%s_context *ctx)\n",
+                parser_name, parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  return (!ctx || context_eof(ctx));\n");
   fprintf(of, "}\n");
   fprintf(of, "\n");
 
-  if (_pns)
-    free(_pns);
-  if (_pns_f)
-    free(_pns_f);
+  if (_use_push)
+  {
+      // Emit comment block for <PROJECT>_context_new_push()
 
-  return;
-}
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sCreate a parser context for input pushed in chunks\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    Input bytes are given to the context with "
+                "%s_parser_feed() as they\n",
+                  parser_name);
+    fprintf(of, "    arrive, and the end of input is given with "
+                "%s_parser_finish().\n",
+                  parser_name);
+    fprintf(of, "    Elements are parsed with %s_stream_next() and released "
+                "with\n",
+                  parser_name);
+    fprintf(of, "    %s_stream_release(), as for a stream context.  An element "
+                "which\n",
+                  parser_name);
+    fprintf(of, "    needs bytes not yet fed is suspended on a stack of its "
+                "own, and is\n");
+    fprintf(of, "    resumed where it stopped once more bytes are fed, so each "
+                "byte fed is\n");
+    fprintf(of, "    scanned as it would be by a single parse.  Only the input "
+                "from the\n");
+    fprintf(of, "    start of the current element is kept.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %sThe stack of a push context holds %s_PUSH_STACK_SIZE "
+                "bytes,\n",
+                  (_use_doxygen) ? "@warning " : "Warning: ",
+                  u_parser_name);
+    fprintf(of, "             which bounds how deeply the phrases of an "
+                "element nest.\n");
+    fprintf(of, "             Define %s_PUSH_STACK_SIZE when compiling the "
+                "parser to\n",
+                  u_parser_name);
+    fprintf(of, "             change it.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %s\"%s_context *\" new context on success\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ",
+                  parser_name);
+    fprintf(of, "    %sNULL on failure\n",
+                  (_use_doxygen) ? "@retval " : "         ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-  /*!
+      // Emit code for <PROJECT>_context_new_push()
 
-     \brief Helper function for \e generate_parser_source function.
-    
-     This function parses a definition token and generates the appropriate
-     code for all contents of the phrase definition.\n
-     \n
-     A definition consists of a sequence of definition elements.  This function
-     directly generates the source for the definition pre-amble code, calls the
-     subsequent sequence code generating function, and then closes out the code
-     for the definition.
-    
-     \param of          FILE * of open output file to write source code
-     \param parser_name string containing name of parser (ie. \<PROJECT\>)
-     \param t           \e egg_token * containing the definition token from
-                        which the source code is generated
+    fprintf(of, "%s_context *%s_context_new_push(void)\n",
+                  parser_name, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  %s_context *ctx;\n", parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  if (!(ctx = %s_context_new_stream()))\n", parser_name);
+    fprintf(of, "    return NULL;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  ctx->input_push = TRUE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!(ctx->push = calloc(1, sizeof(%s_push_state))) ||\n",
+                  parser_name);
+    fprintf(of, "      !(ctx->push->stack = malloc(%s_PUSH_STACK_SIZE)))\n",
+                  u_parser_name);
+    fprintf(of, "  {\n");
+    fprintf(of, "    %s_context_delete(ctx);\n", parser_name);
+    fprintf(of, "    return NULL;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return ctx;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
 
-  */
+      // Emit comment block for <PROJECT>_parser_feed()
 
-static void generate_definition(FILE *of,
-                                char *parser_name,
-                                egg_token *t)
-{
-  egg_token *seq;
-  egg_token *cont;
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sGive more input bytes to a push parser context\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    The bytes are copied, following those given before.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %sctx    %s_context * of parse\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "    %sbuffer string of input bytes\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "    %slength count of bytes in buffer\n",
+                  (_use_doxygen) ? "@param " : "       ");
+    fprintf(of, "\n");
+    fprintf(of, "    %sTRUE  on success\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "    %sFALSE on failure, or after %s_parser_finish()\n",
+                  (_use_doxygen) ? "@retval " : "         ",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-  if (!t)
-    return;
+      // Emit code for <PROJECT>_parser_feed()
 
-  if (!parser_name)
-    return;
+    fprintf(of, "unsigned char %s_parser_feed(%s_context *ctx,\n",
+                  parser_name, parser_name);
+    fprintf(of, "                              const unsigned char *buffer,\n");
+    fprintf(of, "                              long length)\n");
+    fprintf(of, "{\n");
+    fprintf(of, "  unsigned char *b;\n");
+    fprintf(of, "  long used, size;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!ctx || !ctx->input_push || ctx->input_finished || "
+                "(length < 0))\n");
+    fprintf(of, "    return FALSE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  if (!length)\n");
+    fprintf(of, "    return TRUE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  used = ctx->input_length - ctx->input_base;\n");
+    fprintf(of, "  if (used + length > ctx->input_size)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    size = (ctx->input_size) ? ctx->input_size : 4096;\n");
+    fprintf(of, "    while (size < used + length)\n");
+    fprintf(of, "      size *= 2;\n");
+    fprintf(of, "    if (!(b = realloc((void *)ctx->input_buffer, size)))\n");
+    fprintf(of, "      return FALSE;\n");
+    fprintf(of, "    ctx->input_buffer = ctx->source.buffer = b;\n");
+    fprintf(of, "    ctx->input_size = size;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+    fprintf(of, "  memcpy((unsigned char *)ctx->input_buffer + used, buffer, "
+                "length);\n");
+    fprintf(of, "  ctx->input_length += length;\n");
+    fprintf(of, "  ctx->source.length = ctx->input_length;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return TRUE;\n");
+    fprintf(of, "}\n");
+    fprintf(of, "\n");
 
-  if (!of)
-    of = stdout;
+      // Emit comment block for <PROJECT>_parser_finish()
 
-  t = t->descendant;
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sMark the end of input of a push parser context\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    No more bytes may be fed afterwards.  Elements still held "
+                "back\n");
+    fprintf(of, "    waiting for more bytes are returned by later calls of\n");
+    fprintf(of, "    %s_stream_next().\n", parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "    %sctx %s_context * of parse\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-  seq = egg_token_find(t, egg_token_type_sequence);
-  if (seq)
-  {
-    emit_indent(of);
-    fprintf(of, "  dir = %s_token_below;\n", parser_name);
-    generate_sequence(of, parser_name, seq);
+      // Emit code for <PROJECT>_parser_finish()
+
+    fprintf(of, "void %s_parser_finish(%s_context *ctx)\n",
+                  parser_name, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  if (ctx)\n");
+    fprintf(of, "    ctx->input_finished = TRUE;\n");
+    fprintf(of, "\n");
+    fprintf(of, "  return;\n");
+    fprintf(of, "}\n");
     fprintf(of, "\n");
 
-    cont = seq->next;
+      // Emit comment block for <PROJECT>_parser_needs_input()
 
-    while (cont)
-    {
-      if (cont->type == egg_token_type_definition_continuation)
-      {
-        t = cont->descendant;
-        seq = egg_token_find(t, egg_token_type_sequence);
-        if (seq)
-        {
-          emit_indent(of);
-          fprintf(of, "  dir = %s_token_below;\n", parser_name);
-          generate_sequence(of, parser_name, seq);
-          fprintf(of, "\n");
-        }
-      }
-      cont = cont->next;
-    }
+    fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+    fprintf(of, "\n");
+    fprintf(of, "    %sTest whether a push parser context is waiting for more "
+                "input\n",
+                  (_use_doxygen) ? "@brief " : "");
+    fprintf(of, "\n");
+    fprintf(of, "    This tells apart the NULL returned by %s_stream_next() "
+                "when the next\n",
+                  parser_name);
+    fprintf(of, "    element needs bytes not yet fed, from the NULL returned "
+                "when no\n");
+    fprintf(of, "    element is matched.\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %sctx %s_context * of parse\n",
+                  (_use_doxygen) ? "@param " : "Param: ",
+                  parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "    %sTRUE  if more bytes must be fed to parse the next "
+                "element\n",
+                  (_use_doxygen) ? "@retval " : "Returns: ");
+    fprintf(of, "    %sFALSE otherwise\n",
+                  (_use_doxygen) ? "@retval " : "         ");
+    fprintf(of, "\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
 
-    fprintf(of, "  %s_token_delete(nt);\n", parser_name);
-    fprintf(of, "  input_set_position(pos);\n");
+      // Emit code for <PROJECT>_parser_needs_input()
+
+    fprintf(of, "unsigned char %s_parser_needs_input(%s_context *ctx)\n",
+                  parser_name, parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "  return (ctx && ctx->input_starved && "
+                "!ctx->input_finished);\n");
+    fprintf(of, "}\n");
     fprintf(of, "\n");
   }
 
@@ -2664,28 +13456,35 @@ static void generate_definition(FILE *of,
   /*!
 
      \brief Helper function for \e generate_parser_source function.
-    
-     This function parses a sequence token and generates the appropriate
-     code for all contents of the sequence.\n
+
+     This function generates the phrase parsing functions as one table
+     driven interpreter.  Each phrase is compiled into a program of
+     instructions, and the programs are emitted as constant tables together
+     with one copy of the interpreter.  Each phrase parsing function then
+     only runs the program of its phrase.\n
      \n
-     A sequence consists of a list of grammar items.  This function calls
-     the item generation function, and directly generates the source for the
-     definition close-out code.
-    
+     The programs make the same input moves, tokens and callbacks as the
+     phrase parsing functions emitted by \e generate_grammar, so the two
+     backends build identical token trees.
+
      \param of          FILE * of open output file to write source code
      \param parser_name string containing name of parser (ie. \<PROJECT\>)
-     \param t           \e egg_token * containing the sequence token from which
+     \param t           \e egg_token * containing the root token from which
                         the source code is generated
 
   */
 
-static void generate_sequence(FILE *of,
-                              char *parser_name,
-                              egg_token *t)
+static void generate_vm(FILE *of, char *parser_name, egg_token *t)
 {
-  egg_token *itm;
-  egg_token *cont;
-  int level_in = _current_level;
+  egg_token_iterator it;
+  egg_token *p;
+  egg_token *pn;
+  phrase_map_item *pmi;
+  int *flags;
+  int *starts;
+  char *pns;
+  int count;
+  int a, i, j;
 
   if (!t)
     return;
@@ -2696,709 +13495,1263 @@ static void generate_sequence(FILE *of,
   if (!of)
     of = stdout;
 
-  t = t->descendant;
+  count = phrase_map_list_count_items(_pml);
+  flags = calloc(count + 1, sizeof(int));
+  starts = calloc(count + 1, sizeof(int));
+  if (!flags || !starts)
+  {
+    free(flags);
+    free(starts);
+    return;
+  }
+
+    // Compile the program of each phrase, after a shared failure at
+    // address 0 for phrases without a definition
+
+  vm_append(VM_FAIL);
+
+  egg_token_iterator_init(&it, t, egg_token_pre_order);
+  while ((p = egg_token_iterator_next(&it)))
+    if (p->type == egg_token_type_phrase)
+      vm_compile_phrase(p, flags, starts);
+
+    // Emit code for interpreter types and constants
+
+  fprintf(of, "  /*\n");
+  fprintf(of, "    Instructions of phrase programs, each followed by its "
+              "operands\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+  fprintf(of, "#define VM_CHOICE 0    /* address of next alternative */\n");
+  fprintf(of, "#define VM_GUARD 1     /* byte set of first byte */\n");
+  fprintf(of, "#define VM_BYTE 2      /* byte */\n");
+  fprintf(of, "#define VM_LITERAL 3   /* literal index */\n");
+  fprintf(of, "#define VM_CALL 4      /* phrase index */\n");
+  fprintf(of, "#define VM_REPEAT 5    /* minimum, maximum, then one atom */\n");
+  fprintf(of, "#define VM_RUN 6       /* byte set, minimum, maximum, phrase "
+              "index */\n");
+  fprintf(of, "#define VM_COMMIT 7\n");
+  fprintf(of, "#define VM_FAIL 8\n");
+  fprintf(of, "#define VM_SAVE 9      /* address of next alternative */\n");
+  fprintf(of, "#define VM_BRANCH 10   /* address of next alternative */\n");
+  fprintf(of, "#define VM_DROP 11\n");
+  fprintf(of, "\n");
+  fprintf(of, "  /*\n");
+  fprintf(of, "    Phrase flags\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+  fprintf(of, "#define VM_CLASS 1     /* phrase is one byte set lookup */\n");
+  fprintf(of, "#define VM_GUARDED 2   /* alternatives test the first byte "
+              "*/\n");
+  fprintf(of, "#define VM_COLLAPSE 4  /* phrase token is a single byte span "
+              "*/\n");
+  fprintf(of, "#define VM_MEMO 8      /* phrase outcome is memoized */\n");
+  fprintf(of, "\n");
+  if (_vm_set_count)
+  {
+    fprintf(of, "#define VM_IN_SET(s, c) ((s)->bits[(c) >> 3] & "
+                "(1 << ((c) & 7)))\n");
+    fprintf(of, "\n");
+  }
+  fprintf(of, "  /*\n");
+  fprintf(of, "    Definition of %s_vm_phrase_entry, how one phrase is "
+              "parsed\n",
+                parser_name);
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+  fprintf(of, "typedef struct %s_vm_phrase_entry\n", parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "    /* Token type of phrase */\n");
+  fprintf(of, "  %s_token_type type;\n", parser_name);
+  fprintf(of, "    /* Phrase flags */\n");
+  fprintf(of, "  int flags;\n");
+  fprintf(of, "    /* Address of phrase program, or byte set of class "
+              "phrase */\n");
+  fprintf(of, "  int start;\n");
+  fprintf(of, "} %s_vm_phrase_entry;\n", parser_name);
+  fprintf(of, "\n");
+  if (_vm_set_count)
+  {
+    fprintf(of, "  /*\n");
+    fprintf(of, "    Definition of %s_vm_byte_set, a set of bytes tested by "
+                "a program\n",
+                  parser_name);
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+    fprintf(of, "typedef struct %s_vm_byte_set\n", parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "    /* Bitmap of 32 bytes */\n");
+    fprintf(of, "  const char *bits;\n");
+    fprintf(of, "    /* Count of byte ranges, or 0 if there are more than 4 "
+                "*/\n");
+    fprintf(of, "  int ranges;\n");
+    fprintf(of, "    /* First and last byte of each range */\n");
+    fprintf(of, "  const char *lohi;\n");
+    fprintf(of, "} %s_vm_byte_set;\n", parser_name);
+    fprintf(of, "\n");
+  }
+  if (_vm_saves)
+  {
+    fprintf(of, "  /*\n");
+    fprintf(of, "    Definition of %s_vm_save, the state kept after the "
+                "items shared by a\n",
+                  parser_name);
+    fprintf(of, "    group of alternatives\n");
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+    fprintf(of, "typedef struct %s_vm_save\n", parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "    /* Input position after shared items */\n");
+    fprintf(of, "  long position;\n");
+    fprintf(of, "    /* Token arena mark after shared items */\n");
+    fprintf(of, "  %s_token_mark mark;\n", parser_name);
+    fprintf(of, "    /* Last token added by shared items */\n");
+    fprintf(of, "  %s_token *t1;\n", parser_name);
+    fprintf(of, "    /* Direction of next token added */\n");
+    fprintf(of, "  %s_token_direction dir;\n", parser_name);
+    fprintf(of, "    /* Address of alternative after group */\n");
+    fprintf(of, "  const int *alt;\n");
+    fprintf(of, "} %s_vm_save;\n", parser_name);
+    fprintf(of, "\n");
+    fprintf(of, "#define VM_SAVES %d     /* most groups nested in a phrase "
+                "*/\n",
+                  _vm_saves);
+    fprintf(of, "\n");
+  }
+  if (_vm_literal_count)
+  {
+    fprintf(of, "  /*\n");
+    fprintf(of, "    Definition of %s_vm_literal, a literal string matched "
+                "by a program\n",
+                  parser_name);
+    fprintf(of, "  */\n");
+    fprintf(of, "\n");
+    fprintf(of, "typedef struct %s_vm_literal\n", parser_name);
+    fprintf(of, "{\n");
+    fprintf(of, "    /* String containing literal */\n");
+    fprintf(of, "  const char *s;\n");
+    fprintf(of, "    /* Count of bytes in literal */\n");
+    fprintf(of, "  long length;\n");
+    fprintf(of, "} %s_vm_literal;\n", parser_name);
+    fprintf(of, "\n");
+  }
+
+    // Emit code for table of phrases
+
+  fprintf(of, "static const %s_vm_phrase_entry _vm_phrases[] =\n",
+                parser_name);
+  fprintf(of, "{\n");
+  for (pmi = _pml, i = 0; pmi; pmi = pmi->next, i++)
+  {
+    pns = fix_identifier(strdup(pmi->name));
+    fprintf(of, "  { %s_token_type_%s, ", parser_name, pns);
+    free(pns);
+    if (!flags[i])
+      fprintf(of, "0");
+    for (j = 0; j < 4; j++)
+      if (flags[i] & (1 << j))
+        fprintf(of, "%s%s",
+                      (flags[i] & ((1 << j) - 1)) ? " | " : "",
+                      _vm_flag_names[j]);
+    fprintf(of, ", %d }%s\n", starts[i], (pmi->next) ? "," : "");
+  }
+  fprintf(of, "};\n");
+  fprintf(of, "\n");
+
+    // Emit code for tables of byte sets and literals
+
+  if (_vm_set_count)
+  {
+    fprintf(of, "static const %s_vm_byte_set _vm_sets[] =\n", parser_name);
+    fprintf(of, "{\n");
+    for (i = 0; i < _vm_set_count; i++)
+      emit_vm_byte_set(of, &(_vm_sets[i]), i < _vm_set_count - 1);
+    fprintf(of, "};\n");
+    fprintf(of, "\n");
+  }
+
+  if (_vm_literal_count)
+  {
+    fprintf(of, "static const %s_vm_literal _vm_literals[] =\n",
+                  parser_name);
+    fprintf(of, "{\n");
+    for (i = 0; i < _vm_literal_count; i++)
+      fprintf(of, "  { \"%s\", sizeof(\"%s\") - 1 }%s\n",
+                    _vm_literals[i], _vm_literals[i],
+                    (i < _vm_literal_count - 1) ? "," : "");
+    fprintf(of, "};\n");
+    fprintf(of, "\n");
+  }
+
+    // Emit code for the phrase programs, one instruction per line
 
-  itm = egg_token_find(t, egg_token_type_item);
-  if (itm)
+  fprintf(of, "static const int _vm_code[] =\n");
+  fprintf(of, "{\n");
+  for (a = 0; a < _vm_count; a += _vm_op_sizes[_vm_code[a]])
   {
-    ++_current_level;
+    if (!a)
+      fprintf(of, "    /* Phrases without a definition */\n");
+    for (pmi = _pml, i = 0; pmi; pmi = pmi->next, i++)
+      if (a && (starts[i] == a) && !(flags[i] & VM_CLASS))
+        fprintf(of, "    /* %s */\n", pmi->name);
+    fprintf(of, "  %s", _vm_op_names[_vm_code[a]]);
+    for (j = 1; j < _vm_op_sizes[_vm_code[a]]; j++)
+      fprintf(of, ", %d", _vm_code[a + j]);
+    fprintf(of, "%s\n", (a + j < _vm_count) ? "," : "");
+  }
+  fprintf(of, "};\n");
+  fprintf(of, "\n");
 
-    generate_item(of, parser_name, itm);
+    // Emit code for the interpreter
 
-    cont = itm->next;
-    while (cont)
-    {
-      if (cont->type == egg_token_type_sequence_continuation)
-      {
-        t = cont->descendant;
-        itm = egg_token_find(t, egg_token_type_item);
-        if (itm)
-        {
-           ++_current_level;
-           generate_item(of, parser_name, itm);
-        }
-      }
-      cont = cont->next;
-    }
+  emit_vm_interpreter(of, parser_name, flags, count);
 
-    emit_indent(of);
-    fprintf(of, "  callback_by_index(&_cbt,\n");
-    emit_indent(of);
-    fprintf(of, "                    %d,\n",
-                  phrase_map_list_get_item_index(_pml, _pns));
-    emit_indent(of);
-    fprintf(of, "                    success,\n");
-    emit_indent(of);
-    fprintf(of, "                    (void *)%s_token_type_%s);\n",
-                  parser_name, _pns_f);
-    fprintf(of, "\n");
-    emit_indent(of);
-    fprintf(of, "  return nt;\n");
+    // Emit code for each phrase parsing function, which runs the program
+    // of its phrase
 
-    while (_current_level > level_in)
+  egg_token_iterator_init(&it, t, egg_token_pre_order);
+  while ((p = egg_token_iterator_next(&it)))
+  {
+    if (p->type != egg_token_type_phrase)
+      continue;
+    pn = egg_token_find_child(p, egg_token_type_phrase_name);
+    if (!pn)
+      continue;
+
+    pns = NULL;
+    pns = egg_token_to_string(pn->descendant, pns);
+    if (pns)
     {
-      emit_indent(of);
+      i = phrase_map_list_get_item_index(_pml, pns);
+      emit_phrase_comment_block(of, parser_name, p);
+      fprintf(of, "%s_token *%s(%s)\n",
+                    parser_name, fix_identifier(pns), _ctx_void);
+      fprintf(of, "{\n");
+      fprintf(of, "  return vm_phrase(%s%d);\n", _in_args, i);
       fprintf(of, "}\n");
-      --_current_level;
+      fprintf(of, "\n");
+      free(pns);
     }
   }
 
-  _current_level = 0;
+    // Clean up and return
+
+  vm_release();
+  free(flags);
+  free(starts);
 
   return;
 }
 
   /*!
 
-     \brief Helper function for \e generate_parser_source function.
-    
-     This function parses an item token and generates the appropriate
-     code for all contents of the item.\n
-     \n
-     An item consists of an atom which is possibly quantified.  This function
-     directly generates the item and quantifier pre-amble code, calls the atom
-     generation function, and directly generates the source for the
-     item close-out code.
-    
+     \brief Helper function for \e generate_vm function.
+
+     This function emits the interpreter running the phrase programs.
+     Cases for instructions which no program uses are left out, so that
+     the interpreter only refers to the helper functions emitted for the
+     grammar.
+
      \param of          FILE * of open output file to write source code
      \param parser_name string containing name of parser (ie. \<PROJECT\>)
-     \param t           \e egg_token * containing the item token from which
-                        the source code is generated
+     \param flags       int * array of phrase flags, indexed like the phrase
+                        map list
+     \param count       count of phrases
 
   */
 
-static void generate_item(FILE *of,
-                          char *parser_name,
-                          egg_token *t)
+static void emit_vm_interpreter(FILE *of,
+                                char *parser_name,
+                                int *flags,
+                                int count)
 {
-  egg_token *atm;
-  egg_token *qty;
-  int min = 1;
-  int max = 1;
+  unsigned char memo = FALSE;
+  int i;
 
-  if (!t)
-    return;
+  for (i = 0; i < count; i++)
+    if (flags[i] & VM_MEMO)
+      memo = TRUE;
 
-  if (!parser_name)
-    return;
+  fprintf(of, "static %s_token *vm_phrase(%sint phrase);\n",
+                parser_name, _ctx_lead);
+  fprintf(of, "\n");
 
-  if (!of)
-    of = stdout;
+    // Emit comment block for vm_atom()
 
-  t = t->descendant;
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sMatch one atom of a phrase program\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    A phrase atom adds the token of the phrase after the last "
+              "token\n");
+  fprintf(of, "    added by the program.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sip  address of atom instruction\n",
+                (_use_doxygen) ? "@param " : "Param: ");
+  fprintf(of, "    %st1  %s_token ** of last token added\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "    %sdir %s_token_direction * of next token added\n",
+                (_use_doxygen) ? "@param " : "       ",
+                parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "    %sTRUE on match\n",
+                (_use_doxygen) ? "@retval " : "Returns: ");
+  fprintf(of, "    %sFALSE otherwise\n",
+                (_use_doxygen) ? "@retval " : "         ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
 
-  atm = egg_token_find(t, egg_token_type_atom);
-  if (atm)
+    // Emit code for vm_atom()
+
+  fprintf(of, "static unsigned char vm_atom(%sconst int *ip,\n", _ctx_lead);
+  fprintf(of, "                             %s_token **t1,\n", parser_name);
+  fprintf(of, "                             %s_token_direction *dir)\n",
+                parser_name);
+  fprintf(of, "{\n");
+  fprintf(of, "  %s_token *t2;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  switch (ip[0])\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    case VM_BYTE:\n");
+  fprintf(of, "      return ((%s_byte(%s)) == ip[1]);\n", _in, _in_arg);
+  if (_vm_literal_count)
   {
-    qty = egg_token_find(atm->next, egg_token_type_quantifier);
-    if (qty)
-    {
-      min = get_minimum(qty);
-      max = get_maximum(qty);
-      emit_indent(of);
-      fprintf(of, "count=0;\n");
-      if (max >= 0)
-      {
-        emit_indent(of);
-        fprintf(of, "while(count < %d)\n", max);
-      }
-      else
-      {
-        emit_indent(of);
-        fprintf(of, "while(TRUE)\n");
-      }
-      emit_indent(of);
-      fprintf(of, "{\n");
-      ++_current_level;
-    }
-    generate_atom(of, parser_name, atm);
-    if (qty)
+    fprintf(of, "    case VM_LITERAL:\n");
+    fprintf(of, "      return match_literal(%s_vm_literals[ip[1]].s,\n",
+                  _in_args);
+    fprintf(of, "                           _vm_literals[ip[1]].length);\n");
+  }
+  fprintf(of, "    case VM_CALL:\n");
+  fprintf(of, "      t2 = (ip[1] >= 0) ? vm_phrase(%sip[1]) : NULL;\n",
+                _in_args);
+  fprintf(of, "      if (!%s_token_add(*t1, *dir, t2))\n", parser_name);
+  fprintf(of, "        return FALSE;\n");
+  fprintf(of, "      *dir = %s_token_after;\n", parser_name);
+  fprintf(of, "      *t1 = t2;\n");
+  fprintf(of, "      return TRUE;\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "\n");
+  fprintf(of, "  return FALSE;\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
+
+    // Emit comment block for vm_phrase()
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %sParse one phrase by running its phrase program\n",
+                (_use_doxygen) ? "@brief " : "");
+  fprintf(of, "\n");
+  fprintf(of, "    Each alternative of the phrase is a VM_CHOICE instruction "
+              "holding the\n");
+  fprintf(of, "    address of the next alternative, the items of the "
+              "alternative, and a\n");
+  fprintf(of, "    VM_COMMIT instruction.  An item which does not match "
+              "continues with the\n");
+  fprintf(of, "    next alternative, and VM_FAIL ends the program.  "
+              "Alternatives beginning\n");
+  fprintf(of, "    with the same items match them once.  VM_SAVE keeps the "
+              "state after\n");
+  fprintf(of, "    the shared items, VM_BRANCH restores it for each further "
+              "alternative,\n");
+  fprintf(of, "    and VM_DROP leaves the group.  The phrase token is "
+              "only allocated by\n");
+  fprintf(of, "    VM_COMMIT, and descendants are chained below a local "
+              "head until then.\n");
+  fprintf(of, "\n");
+  fprintf(of, "    %sphrase index of phrase in phrase table\n",
+                (_use_doxygen) ? "@param " : "Param: ");
+  fprintf(of, "\n");
+  fprintf(of, "    %s %s%s_token *%s on synctactical match of phrase\n",
+                (_use_doxygen) ? "@retval" : "Returns:",
+                (_use_doxygen) ? "\"" : "",
+                parser_name,
+                (_use_doxygen) ? "\"" : "");
+  fprintf(of, "    %s NULL on error including NO MATCH\n",
+                (_use_doxygen) ? "@retval" : "        ");
+  fprintf(of, "\n");
+  fprintf(of, "  */\n");
+  fprintf(of, "\n");
+
+    // Emit code for vm_phrase()
+
+  fprintf(of, "static %s_token *vm_phrase(%sint phrase)\n",
+                parser_name, _ctx_lead);
+  fprintf(of, "{\n");
+  fprintf(of, "  const %s_vm_phrase_entry *p = &_vm_phrases[phrase];\n",
+                parser_name);
+  if (_vm_runs)
+    fprintf(of, "  const %s_vm_byte_set *bs;\n", parser_name);
+  fprintf(of, "  const int *ip;\n");
+  fprintf(of, "  const int *alt = NULL;\n");
+  fprintf(of, "  long pos = %s_get_position(%s);\n", _in, _in_arg);
+  fprintf(of, "  %s_token_mark mark = %s_token_arena_mark();\n",
+                parser_name, parser_name);
+  fprintf(of, "  %s_token head, *nt, *t1;\n", parser_name);
+  if (_vm_runs)
+    fprintf(of, "  %s_token *t2;\n", parser_name);
+  fprintf(of, "  %s_token_direction dir;\n", parser_name);
+  fprintf(of, "  long count;\n");
+  fprintf(of, "  long qpos;\n");
+  if (_vm_saves)
+  {
+    fprintf(of, "  %s_vm_save saves[VM_SAVES];\n", parser_name);
+    fprintf(of, "  %s_vm_save *sv;\n", parser_name);
+    fprintf(of, "  int depth = 0;\n");
+  }
+  if (_vm_set_count)
+    fprintf(of, "  unsigned char first = 0;\n");
+  fprintf(of, "\n");
+  if (_use_context)
+    fprintf(of, "  ++ctx->calls;\n");
+  if (emit_vm_callback(of, 1, "entry") || _use_context)
+    fprintf(of, "\n");
+  fprintf(of, "  if (%s_eof(%s))\n", _in, _in_arg);
+  fprintf(of, "    return NULL;\n");
+  fprintf(of, "\n");
+  if (_vm_set_count)
+  {
+    fprintf(of, "  if (p->flags & VM_CLASS)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    first = %s_byte(%s);\n", _in, _in_arg);
+    fprintf(of, "    if (VM_IN_SET(&_vm_sets[p->start], first))\n");
+    fprintf(of, "    {\n");
+    fprintf(of, "      nt = %sp->type);\n", _new);
+    fprintf(of, "      if (nt)\n");
+    fprintf(of, "      {\n");
+    fprintf(of, "        %s_token_set_offset(nt, pos);\n", parser_name);
+    fprintf(of, "        %s_token_set_length(nt, 1);\n", parser_name);
+    fprintf(of, "\n");
+    if (emit_vm_callback(of, 4, "success"))
+      fprintf(of, "\n");
+    fprintf(of, "        return nt;\n");
+    fprintf(of, "      }\n");
+    fprintf(of, "    }\n");
+    fprintf(of, "\n");
+    fprintf(of, "    %s_set_position(%spos);\n", _in, _in_args);
+    fprintf(of, "\n");
+    if (emit_vm_callback(of, 2, "fail"))
+      fprintf(of, "\n");
+    fprintf(of, "    return NULL;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+  }
+  if (memo)
+  {
+    fprintf(of, "  if ((p->flags & VM_MEMO) && memo_lookup(%sphrase, pos, "
+                "&nt))\n",
+                  _in_args);
+    fprintf(of, "  {\n");
+    if (_use_callbacks)
     {
-      --_current_level;
-      emit_indent(of);
-      fprintf(of, "    ++count;\n");
-      emit_indent(of);
-      fprintf(of, "  }\n");
-      emit_indent(of);
-      fprintf(of, "  else\n");
-      emit_indent(of);
-      fprintf(of, "    break;\n");
-      emit_indent(of);
-      fprintf(of, "}\n");
-      if (max >= 0)
-      {
-        emit_indent(of);
-        fprintf(of, "if ((count >= %d) && (count <= %d))\n", min, max);
-      }
-      else
-      {
-        emit_indent(of);
-        fprintf(of, "if ((count >= %d))\n", min);
-      }
-      emit_indent(of);
-      fprintf(of, "{\n");
+      fprintf(of, "    if (!nt)\n");
+      fprintf(of, "    {\n");
+      emit_vm_callback(of, 3, "fail");
+      fprintf(of, "\n");
+      fprintf(of, "      return NULL;\n");
+      fprintf(of, "    }\n");
+      fprintf(of, "\n");
+      emit_vm_callback(of, 2, "success");
+      fprintf(of, "\n");
     }
+    fprintf(of, "    return nt;\n");
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+  }
+  if (_vm_set_count)
+  {
+    fprintf(of, "  if (p->flags & VM_GUARDED)\n");
+    fprintf(of, "  {\n");
+    fprintf(of, "    first = %s_byte(%s);\n", _in, _in_arg);
+    fprintf(of, "    %s_set_position(%spos);\n", _in, _in_args);
+    fprintf(of, "  }\n");
+    fprintf(of, "\n");
+  }
+  fprintf(of, "    // Descendants are chained below head until the phrase "
+              "matches\n");
+  fprintf(of, "\n");
+  fprintf(of, "  head.descendant = NULL;\n");
+  fprintf(of, "  t1 = &head;\n");
+  fprintf(of, "  dir = %s_token_below;\n", parser_name);
+  fprintf(of, "\n");
+  fprintf(of, "  ip = _vm_code + p->start;\n");
+  fprintf(of, "  while (TRUE)\n");
+  fprintf(of, "  {\n");
+  fprintf(of, "    switch (ip[0])\n");
+  fprintf(of, "    {\n");
+  fprintf(of, "      case VM_CHOICE:\n");
+  fprintf(of, "        if (alt)\n");
+  fprintf(of, "        {\n");
+  fprintf(of, "          %smark);\n", _rewind);
+  fprintf(of, "          head.descendant = NULL;\n");
+  fprintf(of, "          %s_set_position(%spos);\n", _in, _in_args);
+  fprintf(of, "          t1 = &head;\n");
+  fprintf(of, "        }\n");
+  fprintf(of, "        dir = %s_token_below;\n", parser_name);
+  fprintf(of, "        alt = _vm_code + ip[1];\n");
+  fprintf(of, "        ip += 2;\n");
+  fprintf(of, "        break;\n");
+  if (_vm_set_count)
+  {
+    fprintf(of, "      case VM_GUARD:\n");
+    fprintf(of, "        ip = (VM_IN_SET(&_vm_sets[ip[1]], first)) ? ip + 2 "
+                ": alt;\n");
+    fprintf(of, "        break;\n");
+  }
+  fprintf(of, "      case VM_REPEAT:\n");
+  fprintf(of, "        for (count = 0; (ip[2] < 0) || (count < ip[2]); "
+              "++count)\n");
+  fprintf(of, "        {\n");
+  fprintf(of, "          qpos = %s_get_position(%s);\n", _in, _in_arg);
+  fprintf(of, "          if (!vm_atom(%sip + 3, &t1, &dir))\n", _in_args);
+  fprintf(of, "          {\n");
+  fprintf(of, "            if (ip[3] != VM_CALL)\n");
+  fprintf(of, "              %s_set_position(%sqpos);\n", _in, _in_args);
+  fprintf(of, "            break;\n");
+  fprintf(of, "          }\n");
+  fprintf(of, "        }\n");
+  fprintf(of, "        ip = (count >= ip[1]) ? ip + 5 : alt;\n");
+  fprintf(of, "        break;\n");
+  if (_vm_runs)
+  {
+    fprintf(of, "      case VM_RUN:\n");
+    fprintf(of, "        bs = &_vm_sets[ip[1]];\n");
+    fprintf(of, "        count = scan_run(%sbs->bits, bs->ranges, bs->lohi, "
+                "ip[3]);\n",
+                  _in_args);
+    fprintf(of, "        if ((ip[4] >= 0) && (count > 0))\n");
+    fprintf(of, "        {\n");
+    fprintf(of, "          t2 = %s_vm_phrases[ip[4]].type);\n", _new);
+    fprintf(of, "          if (%s_token_add(t1, dir, t2))\n", parser_name);
+    fprintf(of, "          {\n");
+    fprintf(of, "            %s_token_set_offset(t2, %s_get_position(%s) - "
+                "count);\n",
+                  parser_name, _in, _in_arg);
+    fprintf(of, "            %s_token_set_length(t2, count);\n", parser_name);
+    fprintf(of, "            dir = %s_token_after;\n", parser_name);
+    fprintf(of, "            t1 = t2;\n");
+    fprintf(of, "          }\n");
+    fprintf(of, "        }\n");
+    fprintf(of, "        ip = (count >= ip[2]) ? ip + 5 : alt;\n");
+    fprintf(of, "        break;\n");
+  }
+  if (_vm_saves)
+  {
+    fprintf(of, "      case VM_SAVE:\n");
+    fprintf(of, "        sv = &saves[depth++];\n");
+    fprintf(of, "        sv->position = %s_get_position(%s);\n",
+                  _in, _in_arg);
+    fprintf(of, "        sv->mark = %s_token_arena_mark();\n", parser_name);
+    fprintf(of, "        sv->t1 = t1;\n");
+    fprintf(of, "        sv->dir = dir;\n");
+    fprintf(of, "        sv->alt = alt;\n");
+    fprintf(of, "        alt = _vm_code + ip[1];\n");
+    fprintf(of, "        ip += 2;\n");
+    fprintf(of, "        break;\n");
+    fprintf(of, "      case VM_BRANCH:\n");
+    fprintf(of, "        sv = &saves[depth - 1];\n");
+    fprintf(of, "        %ssv->mark);\n", _rewind);
+    fprintf(of, "        if (sv->dir == %s_token_below)\n", parser_name);
+    fprintf(of, "          %s_token_set_descendant(sv->t1, NULL);\n",
+                  parser_name);
+    fprintf(of, "        else\n");
+    fprintf(of, "          %s_token_set_next(sv->t1, NULL);\n", parser_name);
+    fprintf(of, "        %s_set_position(%ssv->position);\n", _in, _in_args);
+    fprintf(of, "        t1 = sv->t1;\n");
+    fprintf(of, "        dir = sv->dir;\n");
+    fprintf(of, "        alt = _vm_code + ip[1];\n");
+    fprintf(of, "        ip += 2;\n");
+    fprintf(of, "        break;\n");
+    fprintf(of, "      case VM_DROP:\n");
+    fprintf(of, "        ip = alt = saves[--depth].alt;\n");
+    fprintf(of, "        break;\n");
   }
+  fprintf(of, "      case VM_COMMIT:\n");
+  fprintf(of, "        if (p->flags & VM_COLLAPSE)\n");
+  fprintf(of, "          %smark);\n", _rewind);
+  fprintf(of, "        nt = %sp->type);\n", _new);
+  fprintf(of, "        if (nt)\n");
+  fprintf(of, "        {\n");
+  fprintf(of, "          %s_token_set_offset(nt, pos);\n", parser_name);
+  fprintf(of, "          %s_token_set_length(nt, %s_get_position(%s) - "
+              "pos);\n",
+                parser_name, _in, _in_arg);
+  fprintf(of, "          if (!(p->flags & VM_COLLAPSE))\n");
+  fprintf(of, "            %s_token_add(nt, %s_token_below, "
+              "head.descendant);\n",
+                parser_name, parser_name);
+  if (memo)
+  {
+    fprintf(of, "          if (p->flags & VM_MEMO)\n");
+    fprintf(of, "            memo_store(%sphrase, pos, nt);\n", _in_args);
+  }
+  fprintf(of, "\n");
+  if (emit_vm_callback(of, 5, "success"))
+    fprintf(of, "\n");
+  fprintf(of, "          return nt;\n");
+  fprintf(of, "        }\n");
+  fprintf(of, "\n");
+  fprintf(of, "          // Fail when the phrase token cannot be allocated\n");
+  fprintf(of, "\n");
+  fprintf(of, "        /* fall through */\n");
+  fprintf(of, "      case VM_FAIL:\n");
+  fprintf(of, "        %smark);\n", _rewind);
+  fprintf(of, "        %s_set_position(%spos);\n", _in, _in_args);
+  if (memo)
+  {
+    fprintf(of, "        if (p->flags & VM_MEMO)\n");
+    fprintf(of, "          memo_store(%sphrase, pos, NULL);\n", _in_args);
+  }
+  fprintf(of, "\n");
+  if (emit_vm_callback(of, 4, "fail"))
+    fprintf(of, "\n");
+  fprintf(of, "        return NULL;\n");
+  fprintf(of, "      default:\n");
+  fprintf(of, "        ip = (vm_atom(%sip, &t1, &dir)) ? ip + 2 : alt;\n",
+                _in_args);
+  fprintf(of, "        break;\n");
+  fprintf(of, "    }\n");
+  fprintf(of, "  }\n");
+  fprintf(of, "}\n");
+  fprintf(of, "\n");
 
   return;
 }
 
   /*!
 
-     \brief Helper function for \e generate_parser_source function.
-    
-     This function parses an atom token and generates the appropriate
-     code for all contents of the atom.\n
-     \n
-     An atom contains either a literal or a phrase-name.  This function calls
-     the appropriate code generation function for a literal or a phrase name.
-    
+     \brief Helper function for \e emit_vm_interpreter function.
+
+     This function emits a callback of the interpreter, made with the index
+     and token type of the phrase being parsed.  Nothing is emitted when
+     callbacks are turned off.
+
      \param of          FILE * of open output file to write source code
-     \param parser_name string containing name of parser (ie. \<PROJECT\>)
-     \param t           \e egg_token * containing the atom token from which
-                        the source code is generated
+     \param level       indent level of emitted code
+     \param type        string containing callback type
+
+     \retval TRUE  if the callback is emitted
+     \retval FALSE otherwise
+
+  */
+
+static unsigned char emit_vm_callback(FILE *of, int level, char *type)
+{
+  int level_in = _current_level;
+
+  if (!_use_callbacks)
+    return FALSE;
+
+  _current_level = level;
+  emit_indent(of);
+  fprintf(of, "if (%scallbacks[phrase].%s)\n", _sp, type);
+  emit_indent(of);
+  fprintf(of, "  callback_by_index(&%scbt, phrase, %s, (void *)p->type);\n",
+                _sp, type);
+  _current_level = level_in;
+
+  return TRUE;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_vm function.
+
+     This function emits one entry of the table of byte sets.
+
+     \param of          FILE * of open output file to write source code
+     \param fs          \e first_set * holding the byte set
+     \param more        TRUE if more entries follow
 
   */
 
-static void generate_atom(FILE *of,
-                          char *parser_name,
-                          egg_token *t)
+static void emit_vm_byte_set(FILE *of, first_set *fs, unsigned char more)
 {
-  egg_token *lit;
-  egg_token *pn;
-
-  if (!t)
-    return;
+  int lo[4], hi[4];
+  int ranges;
+  int b, r;
 
-  if (!parser_name)
-    return;
-
-  if (!of)
-    of = stdout;
-
-  t = t->descendant;
+  ranges = get_byte_ranges(fs, lo, hi);
+  if (ranges > 4)
+    ranges = 0;
 
-  lit = egg_token_find(t, egg_token_type_literal);
-  if (lit)
-  {
-    generate_literal(of, parser_name, lit);
-  }
-  else
+  fprintf(of, "  {\n");
+  fprintf(of, "    \"");
+  for (b = 0; b < 32; b++)
   {
-    pn = egg_token_find(t, egg_token_type_phrase_name);
-    if (pn)
-    {
-      generate_phrase_name(of, parser_name, pn);
-    }
+    fprintf(of, "\\x%02x", fs->bytes[b]);
+    if (b == 15)
+      fprintf(of, "\"\n    \"");
   }
+  fprintf(of, "\",\n");
+  fprintf(of, "    %d, \"", ranges);
+  for (r = 0; r < ranges; r++)
+    fprintf(of, "\\x%02x\\x%02x", lo[r], hi[r]);
+  fprintf(of, "\"\n");
+  fprintf(of, "  }%s\n", (more) ? "," : "");
 
   return;
 }
 
   /*!
 
-     \brief Helper function for \e generate_parser_source function.
-    
-     This function parses a literal token and generates the appropriate
-     code for all contents of the literal.\n
-     \n
-     An literal contains either a string or integer.  This function directly
-     generates the code for all types of literals.
-    
-     \param of          FILE * of open output file to write source code
-     \param parser_name string containing name of parser (ie. \<PROJECT\>)
-     \param t           \e egg_token * containing the literal token from which
-                        the source code is generated
+     \brief Helper function for \e generate_vm function.
+
+     This function compiles the program of one phrase.  A phrase which is
+     generated as a byte set lookup has no program, and its flags and
+     start hold the lookup instead.  The flags are found exactly as
+     \e generate_phrase finds them.
+
+     \param t           \e egg_token * containing the phrase token
+     \param flags       int * array of phrase flags to receive the flags
+     \param starts      int * array of phrase starts to receive the address
+                        of the program
 
   */
 
-static void generate_literal(FILE *of,
-                             char *parser_name,
-                             egg_token *t)
+static void vm_compile_phrase(egg_token *t, int *flags, int *starts)
 {
-  egg_token *lit;
-  char *s;
-  char *s2;
+  egg_token *pn;
+  egg_token *def;
+  alternative *alts;
+  char *pns = NULL;
+  int i, n;
 
-  if (!t)
+  pn = egg_token_find_child(t, egg_token_type_phrase_name);
+  if (!pn)
     return;
 
-  if (!parser_name)
+  pns = egg_token_to_string(pn->descendant, pns);
+  if (!pns)
     return;
 
-  if (!of)
-    of = stdout;
-
-  t = t->descendant;
-
-  lit = egg_token_find(t, egg_token_type_absolute_literal);
-  if (lit)
+  i = phrase_map_list_get_item_index(_pml, pns);
+  def = egg_token_find_child(t, egg_token_type_definition);
+  if (i < 0)
   {
-    s = egg_token_to_string(lit->descendant, s = NULL);
-    ++s;
-    s[strlen(s)-1] = 0;
-    emit_indent(of);
-    fprintf(of, "if ((input_byte()) == %s)\n", s);
-    emit_indent(of);
-    fprintf(of, "{\n");
-    free(s-1);
+    free(pns);
     return;
   }
 
-  lit = egg_token_find(t, egg_token_type_quoted_literal);
-  if (lit)
+    // Single byte phrases over a known set of bytes become one lookup
+
+  if (def && _first && phrase_map_list_find_item_by_name(_sbl, pns) &&
+      emit_first_guard(NULL, &(_first[i])))
   {
-    s = egg_token_to_string(lit->descendant, s = NULL);
-    ++s;
-    s[strlen(s)-1] = 0;
-    emit_indent(of);
-    fprintf(of, "for (s = \"%s\"; *s && ((input_byte()) == *s); ++s) ;\n", s);
-    emit_indent(of);
-    fprintf(of, "if (!*s)\n");
-    emit_indent(of);
-    fprintf(of, "{\n");
-    free(s-1);
+    flags[i] = VM_CLASS;
+    starts[i] = vm_add_set(&(_first[i]));
+    free(pns);
     return;
   }
 
-  lit = egg_token_find(t, egg_token_type_single_quoted_literal);
-  if (lit)
-  {
-    s = egg_token_to_string(lit->descendant, s = NULL);
-    ++s;
-    s[strlen(s)-1] = 0;
-    s2 = fix_quotes(s);
-    emit_indent(of);
-    fprintf(of, "for (s = \"%s\"; *s && ((input_byte()) == *s); ++s) ;\n", s2);
-    emit_indent(of);
-    fprintf(of, "if (!*s)\n");
-    emit_indent(of);
-    fprintf(of, "{\n");
-    free(s-1);
-    free(s2);
+  if (def && phrase_map_list_find_item_by_name(_sbl, pns))
+    if (egg_token_find(def->descendant, egg_token_type_phrase_name))
+      flags[i] |= VM_COLLAPSE;
+
+  if (is_memo_phrase(pns))
+    flags[i] |= VM_MEMO;
+
+  free(pns);
+
+  if (!def || !egg_token_find_child(def, egg_token_type_sequence))
     return;
-  }
+
+  starts[i] = _vm_count;
+
+  n = get_alternatives(def, &alts);
+  if (vm_compile_alternatives(alts, n, 0, 0))
+    flags[i] |= VM_GUARDED;
+  free_alternatives(alts, n);
+
+  vm_append(VM_FAIL);
 
   return;
 }
 
   /*!
 
-     \brief Helper function for \e generate_parser_source function.
-    
-     This function parses a phrase-name token and generates the appropriate
-     code for all contents of the phrase-name.\n
-     \n
-     A phrase-name contains is a literal EGG grammer name of a phrase.  This
-     function directly generates the code for a phrase-name.
-    
-     \param of          FILE * of open output file to write source code
-     \param parser_name string containing name of parser (ie. \<PROJECT\>)
-     \param t           \e egg_token * containing the phrase-name token from
-                        which the source code is generated
-
-  */
+     \brief Helper function for \e vm_compile_phrase function.
 
-static void generate_phrase_name(FILE *of, char *parser_name, egg_token *t)
-{
-  char *pns = NULL;
+     This function compiles a list of alternatives, from the item at a given
+     depth on, grouping alternatives which begin with the same items as
+     \e generate_alternatives groups them.  A group of alternatives at the
+     top is one VM_CHOICE alternative, whose shared items are followed by
+     a VM_SAVE instruction, one VM_BRANCH instruction for each further
+     alternative of the group, and a VM_DROP instruction.  An alternative
+     without items is left out, as \e generate_sequence leaves it out.
 
-  if (!t)
-    return;
+     \param alts        \e alternative * array of alternatives
+     \param n           count of alternatives
+     \param depth       index of first item of each alternative to compile
+     \param nest        count of groups enclosing the alternatives
 
-  if (!parser_name)
-    return;
+     \retval TRUE  if an alternative is guarded by its first byte
+     \retval FALSE otherwise
 
-  if (!of)
-    of = stdout;
+  */
 
-  t = t->descendant;
+static unsigned char vm_compile_alternatives(alternative *alts,
+                                             int n,
+                                             int depth,
+                                             int nest)
+{
+  first_set fs;
+  unsigned char guarded = FALSE;
+  int i, j, k;
+  int length;
+  int choice;
 
-  pns = egg_token_to_string(t, pns);
-  pns = fix_identifier(pns);
+  if (nest > _vm_saves)
+    _vm_saves = nest;
 
-  if (pns)
+  for (i = 0; i < n; i = j)
   {
-    emit_indent(of);
-    fprintf(of, "if (%s_token_add(t1, dir, t2 = %s()))\n",
-                  parser_name, pns);
-    emit_indent(of);
-    fprintf(of, "{\n");
-    emit_indent(of);
-    fprintf(of, "  dir = %s_token_after;\n", parser_name);
-    emit_indent(of);
-    fprintf(of, "  t1 = t2;\n");
+    j = i + get_alternative_group(alts + i, n - i, depth, &length);
 
-    free(pns);
+    if (depth == 0)
+    {
+      if (!alts[i].count)
+        continue;
+      choice = vm_append(VM_CHOICE);
+      vm_append(0);
+      if (is_guarded_group(alts + i, j - i, &fs))
+      {
+        vm_append(VM_GUARD);
+        vm_append(vm_add_set(&fs));
+        guarded = TRUE;
+      }
+    }
+    else
+    {
+      choice = vm_append((i) ? VM_BRANCH : VM_SAVE);
+      vm_append(0);
+    }
+
+    if (j - i == 1)
+    {
+      for (k = depth; k < alts[i].count; k++)
+        vm_compile_item(alts[i].items[k]);
+      vm_append(VM_COMMIT);
+    }
+    else
+    {
+      for (k = depth; k < depth + length; k++)
+        vm_compile_item(alts[i].items[k]);
+      vm_compile_alternatives(alts + i, j - i, depth + length, nest + 1);
+    }
+
+    if (choice >= 0)
+      _vm_code[choice + 1] = _vm_count;
   }
 
-  return;
+  if (depth > 0)
+    vm_append(VM_DROP);
+
+  return guarded;
 }
 
   /*!
 
-     \brief Helper function for \e generate_parser_source function.
-    
-     This function finds the minimum range value in a quantifier.
-    
-     \param t           \e egg_token * containing the quantifier token
+     \brief Helper function for \e vm_compile_alternatives function.
 
-     \retval int value of quantifier range minimum
-             1   on any error
+     This function compiles one item of an alternative.  A quantified
+     item is a VM_REPEAT instruction followed by its atom, or one VM_RUN
+     instruction where \e generate_item matches the item as a run.
+
+     \param t           \e egg_token * containing the item token
 
   */
 
-static int get_minimum(egg_token *t)
+static void vm_compile_item(egg_token *t)
 {
-  egg_token *in;
-  char *ins = NULL;
-  int i;
+  egg_token *atm;
+  egg_token *qty;
+  first_set fs;
+  char *pns = NULL;
+  int at;
 
-  if (!t)
-    return 1;
+  atm = egg_token_find_child(t, egg_token_type_atom);
+  if (!atm)
+    return;
 
-  if (t->type != egg_token_type_quantifier)
-    return 1;
+  qty = egg_token_find_child(t, egg_token_type_quantifier);
 
-  in = egg_token_find(t->descendant, egg_token_type_integer);
-  if (in)
+    // A quantified single byte atom may be matched as one run
+
+  if (qty && _use_run_tokens && get_run_set(atm, &fs, &pns))
   {
-    ins = egg_token_to_string(in->descendant, ins);
-    if (ins)
-    {
-      i = atoi(ins);
-      free(ins);
-      return i;
-    }
+    vm_append(VM_RUN);
+    vm_append(vm_add_set(&fs));
+    vm_append(get_minimum(qty));
+    vm_append(get_maximum(qty));
+    vm_append((pns) ? vm_phrase_index(atm) : -1);
+    _vm_runs = TRUE;
+    if (pns)
+      free(pns);
+    return;
   }
 
-  return 1;
+  at = _vm_count;
+  if (qty)
+  {
+    vm_append(VM_REPEAT);
+    vm_append(get_minimum(qty));
+    vm_append(get_maximum(qty));
+  }
+
+    // An atom which compiles to nothing leaves out its quantifier too
+
+  if (!vm_compile_atom(atm))
+    _vm_count = at;
+
+  return;
 }
 
   /*!
 
-     \brief Helper function for \e generate_parser_source function.
-    
-     This function finds the maximum range value in a quantifier.
-    
-     \param t           \e egg_token * containing the quantifier token
+     \brief Helper function for \e vm_compile_item function.
 
-     \retval int value of quantifier range maximum
-             -1  when range maximum is unlimited (ie. asterisk)
-              1  on any error
+     This function compiles one atom, which is a VM_BYTE instruction for an
+     absolute literal, a VM_LITERAL instruction for a quoted literal, or a
+     VM_CALL instruction for a phrase name.
 
-  */
+     \param t           \e egg_token * containing the atom token
 
-static int get_maximum(egg_token *t)
-{
-  egg_token *opt;
-  egg_token *in;
-  egg_token *as;
-  char *ins = NULL;
-  int min = 1;
-  int i;
+     \retval TRUE  if an instruction is compiled
+     \retval FALSE otherwise
 
-  if (!t)
-    return 1;
+  */
 
-  if (t->type != egg_token_type_quantifier)
-    return 1;
+static unsigned char vm_compile_atom(egg_token *t)
+{
+  egg_token *lit;
+  egg_token *tm;
+  char *s = NULL;
+  long l;
 
-  min = get_minimum(t);
+  if (!(lit = egg_token_find_child(t, egg_token_type_literal)))
+  {
+    if (!egg_token_find_child(t, egg_token_type_phrase_name))
+      return FALSE;
+    vm_append(VM_CALL);
+    vm_append(vm_phrase_index(t));
+    return TRUE;
+  }
 
-  opt = egg_token_find(t->descendant, egg_token_type_quantifier_option);
-  if (opt)
+  tm = egg_token_find_child(lit, egg_token_type_absolute_literal);
+  if (tm && (tm = egg_token_find_child(tm, egg_token_type_integer)))
   {
-    in = egg_token_find(opt->descendant, egg_token_type_integer);
-    if (in)
-    {
-      ins = egg_token_to_string(in->descendant, ins);
-      if (ins)
-      {
-        i = atoi(ins);
-        free(ins);
-        return i;
-      }
-    }
-    else
+    s = egg_token_to_string(tm->descendant, s);
+    if (!s)
+      return FALSE;
+
+    switch (tm->descendant->type)
     {
-      as = egg_token_find(opt->descendant, egg_token_type_asterisk);
-      if (as)
-        return -1;
+      case egg_token_type_binary_integer:
+        l = strtol(s+2, NULL, 2);
+        break;
+      case egg_token_type_octal_integer:
+        l = strtol(s+2, NULL, 8);
+        break;
+      case egg_token_type_hexadecimal_integer:
+        l = strtol(s+2, NULL, 16);
+        break;
+      case egg_token_type_decimal_integer:
+      default:
+        l = strtol(s, NULL, 10);
+        break;
     }
+    free(s);
+
+    vm_append(VM_BYTE);
+    vm_append((int)l);
+    return TRUE;
   }
-  else
-    return min;
 
-  return 1;
+  if ((tm = egg_token_find_child(lit, egg_token_type_quoted_literal)))
+  {
+    s = egg_token_to_string(tm->descendant, s);
+    if (!s)
+      return FALSE;
+    s[strlen(s)-1] = 0;
+    vm_append(VM_LITERAL);
+    vm_append(vm_add_literal(strdup(s + 1)));
+    free(s);
+    return TRUE;
+  }
+
+  if ((tm = egg_token_find_child(lit, egg_token_type_single_quoted_literal)))
+  {
+    s = egg_token_to_string(tm->descendant, s);
+    if (!s)
+      return FALSE;
+    s[strlen(s)-1] = 0;
+    vm_append(VM_LITERAL);
+    vm_append(vm_add_literal(fix_quotes(s + 1)));
+    free(s);
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+  /*!
+
+     \brief Helper function for \e vm_compile_item function.
+
+     This function finds the phrase map index of the phrase named by an
+     atom.
+
+     \param t           \e egg_token * containing the atom token
+
+     \retval int index of phrase
+     \retval -1  if the phrase is not defined in the grammar
+
+  */
+
+static int vm_phrase_index(egg_token *t)
+{
+  egg_token *pn;
+  char *s = NULL;
+  int i;
+
+  pn = egg_token_find_child(t, egg_token_type_phrase_name);
+  if (!pn)
+    return -1;
+
+  s = egg_token_to_string(pn->descendant, s);
+  i = phrase_map_list_get_item_index(_pml, s);
+  if (s)
+    free(s);
+
+  return i;
 }
 
   /*!
 
-     \brief Generic helper function for code generation functions.
-    
-     This function converts all EGG grammar identifiers (ie. phrase-name) to
-     C language identifiers.  Specifically all '-' (minus) characters are
-     converted to '_' (underscore) characters.
-    
-     \param pn string containing EGG phrase-name
-    
-     \retval "char *" string containing C language equivalent identifier
+     \brief Helper function for VM program compiling functions.
 
-  */
+     This function appends one value to the VM program being compiled.
 
-static char *fix_identifier(char *pn)
-{
-  char *t;
+     \param v           value of instruction or operand
 
-  if (!pn)
-    return NULL;
+     \retval int address of value
+     \retval -1  on any error
 
-  t = pn;
+  */
 
-  while (*t)
+static int vm_append(int v)
+{
+  int *code;
+
+  if (_vm_count == _vm_size)
   {
-    if (*t == '-')
-      *t = '_';
-    ++t;
+    code = realloc(_vm_code, (_vm_size * 2 + 256) * sizeof(int));
+    if (!code)
+      return -1;
+    _vm_code = code;
+    _vm_size = _vm_size * 2 + 256;
   }
 
-  return pn;
+  _vm_code[_vm_count] = v;
+
+  return _vm_count++;
 }
 
   /*!
 
-     \brief Generic helper function for code generation functions.
-    
-     This function converts all EGG grammar quoted literals to C language
-     compatible strings.  All single-quoted-literals are converted to double
-     quoted strings, including preceding any double-quotes contained within
-     the single-quoted-literal with a C string '\' (backslash) character.
-    
-     \warning This function returns a pointer to dynamically allocated memory.
-              It is the caller's responsibility to free this memory when
-              appropriate.
+     \brief Helper function for VM program compiling functions.
 
-     \param s string containing single quoted literal
-    
-     \retval "char *" string containing C language compatible double quoted
-                      string
+     This function finds a literal in the table of literals, adding it when
+     not found, so that each literal is emitted once.
+
+     \param s           string containing literal, which is taken over by
+                        this function
+
+     \retval int index of literal
+     \retval -1  on any error
 
   */
 
-static char *fix_quotes(char *s)
+static int vm_add_literal(char *s)
 {
-  char *t;
-  char *n;
-  int nq = 0;
+  char **literals;
+  int i;
 
   if (!s)
-    return NULL;
-
-  for (t = s; *t; t++)
-    if (*t == '"')
-      ++nq;
-
-  n = malloc(strlen(s) + nq + 1);
+    return -1;
 
-  for (t = n; *s; ++s, ++t)
+  for (i = 0; i < _vm_literal_count; i++)
   {
-    if (*s == '"')
+    if (!strcmp(_vm_literals[i], s))
     {
-      *t = '\\';
-      ++t;
+      free(s);
+      return i;
     }
-    *t = *s;
   }
 
-  *t = 0;
+  literals = realloc(_vm_literals, (_vm_literal_count + 1) * sizeof(char *));
+  if (!literals)
+  {
+    free(s);
+    return -1;
+  }
+  _vm_literals = literals;
+  _vm_literals[_vm_literal_count] = s;
 
-  return n;
+  return _vm_literal_count++;
 }
 
   /*!
 
-     \brief Generic helper function for code generation functions.
-    
-     This function builds a C language compatible literal value.
-    
-     \warning This function returns a pointer to dynamically allocated memory.
-              It is the caller's responsibility to free this memory when
-              appropriate.
+     \brief Helper function for VM program compiling functions.
 
-     \param t           \e egg_token * containing the literal token
+     This function finds a byte set in the table of byte sets, adding it
+     when not found, so that each byte set is emitted once.
 
-     \retval "char *" string containing the C language literal code.
-             NULL     on any error
+     \param fs          \e first_set * holding the byte set
+
+     \retval int index of byte set
+     \retval -1  on any error
 
   */
 
-static char *build_literal(egg_token *t)
+static int vm_add_set(first_set *fs)
 {
-  char *s = NULL;
-  char *sp1, *sp2;
-  egg_token *tm;
-  long l;
+  first_set *sets;
+  int i;
 
-  if (!t)
-    return NULL;
+  for (i = 0; i < _vm_set_count; i++)
+    if (!memcmp(_vm_sets[i].bytes, fs->bytes, 32))
+      return i;
 
-  if (t->type != egg_token_type_literal)
-    return NULL;
+  sets = realloc(_vm_sets, (_vm_set_count + 1) * sizeof(first_set));
+  if (!sets)
+    return -1;
+  _vm_sets = sets;
+  _vm_sets[_vm_set_count] = *fs;
 
-  tm = egg_token_find(t->descendant, egg_token_type_absolute_literal);
-  if (tm)
-  {
-    tm = egg_token_find(tm->descendant, egg_token_type_integer);
-    if (tm)
-    {
-      s = egg_token_to_string(tm->descendant, s);
+  return _vm_set_count++;
+}
 
-      switch (tm->descendant->type)
-      {
-        case egg_token_type_binary_integer:
-          l = strtol(s+2, NULL, 2);
-          break;
-        case egg_token_type_octal_integer:
-          l = strtol(s+2, NULL, 8);
-          break;
-        case egg_token_type_hexadecimal_integer:
-          l = strtol(s+2, NULL, 16);
-          break;
-        case egg_token_type_decimal_integer:
-        default:
-          l = strtol(s, NULL, 10);
-          break;
-      }
+  /*!
 
-      free(s);
+     \brief Helper function for \e generate_vm function.
 
-      s = long_to_bytes(l);
+     This function frees the VM program and its tables once emitted.
 
-      return s;
-    }
+  */
 
-    return NULL;
-  }
+static void vm_release(void)
+{
+  int i;
 
-  tm = egg_token_find(t->descendant, egg_token_type_quoted_literal);
-  if (tm)
-  {
-    s = egg_token_to_string(tm->descendant, s);
-    for (sp1 = s+1, sp2 = s; *sp1; ++sp2, ++sp1)
-      *sp2 = *sp1; 
-    *(strchr(s, '"')) = 0;
-    return s;
-  }
+  for (i = 0; i < _vm_literal_count; i++)
+    free(_vm_literals[i]);
+  free(_vm_literals);
+  _vm_literals = NULL;
+  _vm_literal_count = 0;
 
-  tm = egg_token_find(t->descendant, egg_token_type_single_quoted_literal);
-  if (tm)
-  {
-    s = egg_token_to_string(tm->descendant, s);
-    for (sp1 = s+1, sp2 = s; *sp1; ++sp2, ++sp1)
-      *sp2 = *sp1; 
-    *(strchr(s, '\'')) = 0;
-    sp1 = fix_quotes(s);
-    free(s);
-    return sp1;
-  }
+  free(_vm_sets);
+  _vm_sets = NULL;
+  _vm_set_count = 0;
 
-  return NULL;
+  free(_vm_code);
+  _vm_code = NULL;
+  _vm_count = _vm_size = 0;
+  _vm_runs = FALSE;
+  _vm_saves = 0;
+
+  return;
 }
 
   /*!
 
-     \brief Generic helper function for code generation functions.
-    
-     This function converts all alpha characters in a string to upper case.
-    
-     \warning This function modifies the passed string, therefore a copy must be
-              made by the caller if the original string contents are to be
-              preserved.
+     \brief Helper function for \e generate_parser_source and
+            \e generate_parser_header functions.
 
-     \param s string
+     This function makes the parameter list of emitted phrase parsing
+     functions, and the leading parameters of emitted helper functions,
+     which take a parser context when contexts are in use, along with the
+     calls that create parsed tokens and rewind the token arena within
+     phrase functions.
 
-     \retval "char *" string with all upper case alpha characters
-             NULL     on any error
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
 
   */
 
-static char *str_toupper(char *s)
+static void make_context_parameters(char *parser_name)
 {
-  char *t = s;
+  free_context_parameters();
 
-  if (!s)
-    return NULL;
+  if (_use_context)
+  {
+    _ctx_void = malloc(strlen(parser_name) + strlen("_context *ctx") + 1);
+    if (_ctx_void)
+      sprintf(_ctx_void, "%s_context *ctx", parser_name);
+    _ctx_lead = malloc(strlen(parser_name) + strlen("_context *ctx, ") + 1);
+    if (_ctx_lead)
+      sprintf(_ctx_lead, "%s_context *ctx, ", parser_name);
+  }
+  else
+  {
+    _ctx_void = strdup("void");
+    _ctx_lead = strdup("");
+  }
 
-  while (*t)
+    // Parsed tokens read their text back from the context when contexts
+    // are in use
+
+  if (_use_context)
+    _new = strdup("token_new(ctx, ");
+  else
   {
-    *t = toupper(*t);
-    ++t;
+    _new = malloc(strlen(parser_name) + strlen("_token_new(") + 1);
+    if (_new)
+      sprintf(_new, "%s_token_new(", parser_name);
   }
 
-  return s;
+    // Phrase functions rewind through the memo when it is in use, so
+    // that entries whose tokens are released are dropped with them
+
+  if (_use_memo || _memo_phrases)
+    _rewind = strdup((_use_context) ? "memo_rewind(ctx, " : "memo_rewind(");
+  else
+  {
+    _rewind = malloc(strlen(parser_name) +
+                     strlen("_token_arena_rewind(") + 1);
+    if (_rewind)
+      sprintf(_rewind, "%s_token_arena_rewind(", parser_name);
+  }
+
+  return;
 }
 
   /*!
 
-     \brief Helper function for \e generate_token_util_source function.
-    
-     This function determines if a given phrase contains only literals.  If so,
-     then a C language compatible literal is returned, else a C language
-     compatible string containing a phrase's phrase-name is returned.
-    
-     \param t           \e egg_token * containing the phrase token
+     \brief Helper function for \e generate_parser_source and
+            \e generate_parser_header functions.
 
-     \retval "char *" string containing either literal or phrase name in C
-                      language compatible form
-     \retval NULL     on any error
+     This function frees the parameter lists made by
+     \e make_context_parameters function.
 
   */
 
-static char *literal_or_phrase_name(egg_token *t)
+static void free_context_parameters(void)
 {
-  egg_token *pn;
-  egg_token *def;
-  egg_token *tm;
-  char *pns;
-
-  if (!t)
-    return NULL;
-
-  if (t->type != egg_token_type_phrase)
-    return NULL;
-
-  pn = egg_token_find(t->descendant, egg_token_type_phrase_name);
-  if (!pn)
-    return NULL;
-
-  def = egg_token_find(t->descendant, egg_token_type_definition);
-  if (!def)
-    return NULL;
-
-  if (!(tm = egg_token_find(def->descendant, egg_token_type_definition_continuation)))
-  {
-    tm = egg_token_find(def->descendant, egg_token_type_sequence);
-    if (tm)
-    {
-      if (!egg_token_find(tm->descendant, egg_token_type_sequence_continuation))
-      {
-        tm = egg_token_find(tm->descendant, egg_token_type_item);
-        if (tm)
-        {
-          if (!egg_token_find(tm->next, egg_token_type_quantifier))
-          {
-            tm = egg_token_find(tm->descendant, egg_token_type_literal);
-            if (tm)
-              return build_literal(tm);
-          }
-        }
-      }
-    }
-  }
+  free(_ctx_void);
+  _ctx_void = NULL;
+  free(_ctx_lead);
+  _ctx_lead = NULL;
+  free(_rewind);
+  _rewind = NULL;
+  free(_new);
+  _new = NULL;
 
-  pns = NULL;
-  return egg_token_to_string(pn->descendant, pns);
+  return;
 }
 
   /*!
@@ -3480,6 +14833,68 @@ static void emit_indent(FILE *of)
   for (i = 0; i < _current_level; i++)
     fprintf(of, "  ");
 
+  return;
+}
+
+  /*!
+
+     \brief Generic helper function for code generation functions.
+
+     This function emits the comment block in front of a phrase parsing
+     or phrase recognizer function, which holds the EGG definition of the
+     phrase.
+
+     \param of          FILE * of open output file to write source code
+     \param parser_name string containing name of parser (ie. \<PROJECT\>)
+     \param t           \e egg_token * containing the phrase token
+
+  */
+
+static void emit_phrase_comment_block(FILE *of,
+                                      char *parser_name,
+                                      egg_token *t)
+{
+  char *ds = NULL;
+
+  fprintf(of, "  /*%s\n", (_use_doxygen) ? "!" : "");
+  fprintf(of, "\n");
+  fprintf(of, "    %s%sEGG Phrase Definition%s\n",
+                (_use_doxygen) ? "@par " : "",
+                (_use_doxygen) ? "\"" : "",
+                (_use_doxygen) ? "\"" : ":");
+  if (_use_doxygen)
+    fprintf(of, "    @verbatim\n");
+  ds = egg_token_to_string(t->descendant, ds);
+  if (ds)
+  {
+    emit_phrase_comment_lines(of, ds);
+    free(ds);
+  }
+  if (_use_doxygen)
+    fprintf(of, "    @endverbatim\n");
+  fprintf(of, "\n");
+  if (_recognize)
+  {
+    fprintf(of, "    %s long length of input on synctactical match of "
+                "phrase\n",
+                  (_use_doxygen) ? "@retval" : "Returns:");
+    fprintf(of, "    %s -1 on error including NO MATCH\n",
+                  (_use_doxygen) ? "@retval" : "        ");
+  }
+  else
+  {
+    fprintf(of, "    %s %s%s_token *%s on synctactical match of phrase\n",
+                  (_use_doxygen) ? "@retval" : "Returns:",
+                  (_use_doxygen) ? "\"" : "",
+                  parser_name,
+                  (_use_doxygen) ? "\"" : "");
+    fprintf(of, "    %s NULL on error including NO MATCH\n",
+                  (_use_doxygen) ? "@retval" : "        ");
+  }
+  fprintf(of, "\n");
+  fprintf(of, " */\n");
+  fprintf(of, "\n");
+
   return;
 }
 
@@ -3713,6 +15128,363 @@ void generator_set_external_usage_flag(unsigned char flag)
   _use_external_usage = flag;
 }
 
+  /*!
+     \brief Get packrat memo use flag from code generator.
+     \retval unsigned char packrat memo use flag
+  */
+
+unsigned char generator_get_memo_flag(void)
+{
+  return _use_memo;
+}
+
+  /*!
+     \brief Set packrat memo use flag for code generator.
+     \note When set, every phrase not matching a single byte is memoized,
+           unless a list of phrases is set with generator_set_memo_phrases().
+     \param flag TRUE or FALSE
+  */
+
+void generator_set_memo_flag(unsigned char flag)
+{
+  _use_memo = flag;
+}
+
+  /*!
+     \brief Get list of memoized phrases from code generator.
+     \retval "char *" string containing comma separated phrase names, or NULL
+  */
+
+char * generator_get_memo_phrases(void)
+{
+  return _memo_phrases;
+}
+
+  /*!
+     \brief Set list of memoized phrases for code generator.
+     \note Setting a list implies use of the packrat memo.
+     \param phrases string containing comma separated phrase names
+  */
+
+void generator_set_memo_phrases(char *phrases)
+{
+  _memo_phrases = phrases;
+}
+
+  /*!
+     \brief Get run tokens use flag from code generator.
+     \retval unsigned char run tokens use flag
+  */
+
+unsigned char generator_get_run_tokens_flag(void)
+{
+  return _use_run_tokens;
+}
+
+  /*!
+     \brief Set run tokens use flag for code generator.
+     \note When set, a quantified single byte phrase or literal is matched
+           as one run, and a phrase run yields one token spanning the run.
+     \param flag TRUE or FALSE
+  */
+
+void generator_set_run_tokens_flag(unsigned char flag)
+{
+  _use_run_tokens = flag;
+}
+
+  /*!
+     \brief Get callbacks use flag from code generator.
+     \retval unsigned char callbacks use flag
+  */
+
+unsigned char generator_get_callbacks_flag(void)
+{
+  return _use_callbacks;
+}
+
+  /*!
+     \brief Set callbacks use flag for code generator.
+     \note When cleared, the parser is generated without a callback table
+           and without any callback code.
+     \param flag TRUE or FALSE
+  */
+
+void generator_set_callbacks_flag(unsigned char flag)
+{
+  _use_callbacks = flag;
+}
+
+  /*!
+     \brief Get context use flag from code generator.
+     \retval unsigned char context use flag
+  */
+
+unsigned char generator_get_context_flag(void)
+{
+  return _use_context;
+}
+
+  /*!
+     \brief Set context use flag for code generator.
+     \note When set, each phrase function takes a parser context holding
+           the input, callback table, memo and statistics of one parse.
+     \param flag TRUE or FALSE
+  */
+
+void generator_set_context_flag(unsigned char flag)
+{
+  _use_context = flag;
+
+  _in = (flag) ? "context" : "input";
+  _in_arg = (flag) ? "ctx" : "";
+  _in_args = (flag) ? "ctx, " : "";
+  _sp = (flag) ? "ctx->" : "_";
+}
+
+  /*!
+     \brief Get parallel parse use flag from code generator.
+     \retval unsigned char parallel parse use flag
+  */
+
+unsigned char generator_get_parallel_flag(void)
+{
+  return _use_parallel;
+}
+
+  /*!
+     \brief Set parallel parse use flag for code generator.
+     \note When set, the parser is generated with a function to parse a
+           repetition of top level elements on several threads.  Setting
+           this flag also sets the context use flag.
+     \param flag TRUE or FALSE
+  */
+
+void generator_set_parallel_flag(unsigned char flag)
+{
+  _use_parallel = flag;
+
+  if (flag)
+    generator_set_context_flag(TRUE);
+}
+
+  /*!
+     \brief Get streaming parse use flag from code generator.
+     \retval unsigned char streaming parse use flag
+  */
+
+unsigned char generator_get_stream_flag(void)
+{
+  return _use_stream;
+}
+
+  /*!
+     \brief Set streaming parse use flag for code generator.
+     \note When set, the parser is generated with functions to parse the
+           input source one element at a time in a bounded window of
+           memory.  Setting this flag also sets the context use flag.
+     \param flag TRUE or FALSE
+  */
+
+void generator_set_stream_flag(unsigned char flag)
+{
+  _use_stream = flag;
+
+  if (flag)
+    generator_set_context_flag(TRUE);
+}
+
+  /*!
+     \brief Get push parse use flag from code generator.
+     \retval unsigned char push parse use flag
+  */
+
+unsigned char generator_get_push_flag(void)
+{
+  return _use_push;
+}
+
+  /*!
+     \brief Set push parse use flag for code generator.
+     \note When set, the parser is generated with functions to feed the
+           input to a parser context in chunks as it arrives.  Setting
+           this flag also sets the streaming parse use flag.
+     \param flag TRUE or FALSE
+  */
+
+void generator_set_push_flag(unsigned char flag)
+{
+  _use_push = flag;
+
+  if (flag)
+    generator_set_stream_flag(TRUE);
+}
+
+  /*!
+     \brief Get push context stack size from code generator.
+     \retval long push context stack size in bytes
+  */
+
+long generator_get_push_stack_size(void)
+{
+  return _push_stack_size;
+}
+
+  /*!
+     \brief Set push context stack size for code generator.
+     \note The size is the default of the emitted PROJECT_PUSH_STACK_SIZE,
+           the stack on which each element of a push parse is parsed.
+     \param size stack size in bytes
+  */
+
+void generator_set_push_stack_size(long size)
+{
+  _push_stack_size = size;
+}
+
+  /*!
+     \brief Get VM backend use flag from code generator.
+     \retval unsigned char VM backend use flag
+  */
+
+unsigned char generator_get_vm_flag(void)
+{
+  return _use_vm;
+}
+
+  /*!
+     \brief Set VM backend use flag for code generator.
+     \note When set, the phrase parsing functions are generated as tables
+           of phrase programs run by one interpreter, in place of one
+           function body per phrase.
+     \param flag TRUE or FALSE
+  */
+
+void generator_set_vm_flag(unsigned char flag)
+{
+  _use_vm = flag;
+}
+
+  /*!
+     \brief Get phrase inlining use flag from code generator.
+     \retval unsigned char phrase inlining use flag
+  */
+
+unsigned char generator_get_inline_flag(void)
+{
+  return _use_inline;
+}
+
+  /*!
+     \brief Set phrase inlining use flag for code generator.
+     \note When set, trivial phrases are generated as static inline
+           functions, which the other phrase parsing functions call in
+           place of the public phrase parsing functions.
+     \param flag TRUE or FALSE
+  */
+
+void generator_set_inline_flag(unsigned char flag)
+{
+  _use_inline = flag;
+}
+
+  /*!
+     \brief Get recognizer use flag from code generator.
+     \retval unsigned char recognizer use flag
+  */
+
+unsigned char generator_get_recognizer_flag(void)
+{
+  return _use_recognizer;
+}
+
+  /*!
+     \brief Set recognizer use flag for code generator.
+     \note When set, a recognizer function is generated for each phrase,
+           which returns the length of input matched without building any
+           tokens.  The walker uses the recognizers for syntax checks.
+     \param flag TRUE or FALSE
+  */
+
+void generator_set_recognizer_flag(unsigned char flag)
+{
+  _use_recognizer = flag;
+}
+
+  /*!
+     \brief Get event use flag from code generator.
+     \retval unsigned char event use flag
+  */
+
+unsigned char generator_get_events_flag(void)
+{
+  return _use_events;
+}
+
+  /*!
+     \brief Set event use flag for code generator.
+     \note When set, the recognizers report each phrase they match to an
+           event handler set by the caller, with the phrase index and the
+           offsets of the match.  Setting this flag also sets the
+           recognizer use flag.
+     \param flag TRUE or FALSE
+  */
+
+void generator_set_events_flag(unsigned char flag)
+{
+  _use_events = flag;
+
+  if (flag)
+    generator_set_recognizer_flag(TRUE);
+}
+
+  /*!
+     \brief Get list of trivia phrases from code generator.
+     \retval "char *" string containing comma separated phrase names, or NULL
+  */
+
+char * generator_get_trivia_phrases(void)
+{
+  return _trivia_phrases;
+}
+
+  /*!
+     \brief Set list of trivia phrases for code generator.
+     \note Trivia phrases are parsed by their recognizers into single span
+           tokens.  Setting a list also sets the recognizer use flag.
+     \param phrases string containing comma separated phrase names
+  */
+
+void generator_set_trivia_phrases(char *phrases)
+{
+  _trivia_phrases = phrases;
+
+  if (phrases)
+    generator_set_recognizer_flag(TRUE);
+}
+
+  /*!
+     \brief Get trivia drop flag from code generator.
+     \retval unsigned char trivia drop flag
+  */
+
+unsigned char generator_get_trivia_drop_flag(void)
+{
+  return _use_trivia_drop;
+}
+
+  /*!
+     \brief Set trivia drop flag for code generator.
+     \note When set, trivia phrases are skipped where other phrases use
+           them, without adding any token.
+     \param flag TRUE or FALSE
+  */
+
+void generator_set_trivia_drop_flag(unsigned char flag)
+{
+  _use_trivia_drop = flag;
+}
+
   /*!
 
      \brief Generic helper function for code generation functions.
@@ -3836,3 +15608,88 @@ static char * make_file_name(char *project, char *file_name)
   return fn;
 }
 
+
+  /*!
+
+     \brief Helper function for \e generate_phrase function.
+
+     This function decides whether the parsing function of a phrase is
+     memoized.  When a list of memoized phrases is set, only the phrases
+     named in the list are memoized.  Otherwise, when the memo use flag is
+     set, every phrase not matching a single byte is memoized.
+
+     \param pn string containing phrase name as written in the grammar
+
+     \retval unsigned char TRUE if phrase is memoized, FALSE otherwise
+
+  */
+
+static unsigned char is_memo_phrase(char *pn)
+{
+  if (!pn)
+    return FALSE;
+
+  if (_memo_phrases)
+    return is_listed_phrase(_memo_phrases, pn);
+
+  if (_use_memo)
+    if (!phrase_map_list_find_item_by_name(_sbl, pn))
+      return TRUE;
+
+  return FALSE;
+}
+
+  /*!
+
+     \brief Helper function for \e generate_phrase function.
+
+     This function decides whether a phrase is trivia, which is parsed by
+     its recognizer into a single span token, or into no token at all when
+     trivia tokens are dropped.
+
+     \param pn string containing phrase name as written in the grammar
+
+     \retval unsigned char TRUE if phrase is trivia, FALSE otherwise
+
+  */
+
+static unsigned char is_trivia_phrase(char *pn)
+{
+  if (!pn || !_trivia_phrases || _use_vm)
+    return FALSE;
+
+  return is_listed_phrase(_trivia_phrases, pn);
+}
+
+  /*!
+
+     \brief Helper function for \e is_memo_phrase and \e is_trivia_phrase
+            functions.
+
+     This function finds whether a phrase is named in a comma separated
+     list of phrase names.
+
+     \param list string containing comma separated phrase names
+     \param pn   string containing phrase name as written in the grammar
+
+     \retval unsigned char TRUE if phrase is in list, FALSE otherwise
+
+  */
+
+static unsigned char is_listed_phrase(char *list, char *pn)
+{
+  char *s;
+  long l;
+
+  l = strlen(pn);
+  s = list;
+  while (s)
+  {
+    if (!strncmp(s, pn, l) && ((s[l] == ',') || (s[l] == '\0')))
+      return TRUE;
+    if ((s = strchr(s, ',')))
+      ++s;
+  }
+
+  return FALSE;
+}
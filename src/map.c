@@ -84,15 +84,15 @@ phrase_map_item *phrase_map(egg_token *g)
   if (!g)
     return NULL;
 
-  ge = egg_token_find(g, egg_token_type_grammar_element);
+  ge = egg_token_find_child(g, egg_token_type_grammar_element);
   if (ge)
   {
     while (ge)
     {
-      p = egg_token_find(ge->descendant, egg_token_type_phrase);
+      p = egg_token_find_child(ge, egg_token_type_phrase);
       if (p)
       {
-        pn = egg_token_find(p->descendant, egg_token_type_phrase_name);
+        pn = egg_token_find_child(p, egg_token_type_phrase_name);
         if (pn)
         {
           s = NULL;
@@ -105,7 +105,7 @@ phrase_map_item *phrase_map(egg_token *g)
             return NULL;
           }
           free(s);
-          d = egg_token_find(p->descendant, egg_token_type_definition);
+          d = egg_token_find_child(p, egg_token_type_definition);
           if (d)
             all_phrase_names(d->descendant, npmi);
         }
@@ -135,6 +135,7 @@ static void all_phrase_names(egg_token *t, phrase_map_item *pmi)
 {
   char *s;
   phrase_map_item *npmi;
+  egg_token_iterator it;
 
   if (!t)
     return;
@@ -142,8 +143,12 @@ static void all_phrase_names(egg_token *t, phrase_map_item *pmi)
   if (!pmi)
     return;
 
-  if (t->type == egg_token_type_phrase_name)
+  egg_token_iterator_init(&it, t, egg_token_pre_order);
+  while ((t = egg_token_iterator_next(&it)))
   {
+    if (t->type != egg_token_type_phrase_name)
+      continue;
+
     s = NULL;
     s = egg_token_to_string(t->descendant, s);
     npmi = phrase_map_list_append_item_by_name(&(pmi->uses), s, TRUE);
@@ -152,10 +157,6 @@ static void all_phrase_names(egg_token *t, phrase_map_item *pmi)
       return;
   }
 
-  all_phrase_names(t->descendant, pmi);
-
-  all_phrase_names(t->next, pmi);
-
   return;
 }
 
@@ -568,9 +569,10 @@ void phrase_map_list_isolate_top_level_phrases(phrase_map_item **list)
   ppmi = *list;
   while (ppmi)
   {
+    ppmi2 = ppmi->next;
     if (ppmi->name[0] == ' ')
       phrase_map_item_delete(list, ppmi);
-    ppmi = ppmi->next;
+    ppmi = ppmi2;
   }
 
   return;
@@ -0,0 +1,106 @@
+#include <stdio.h>
+
+#include "input.h"
+#include "memo-token.h"
+#include "memo-parser.h"
+
+  // Parser generated from memo.egg with --use-memo=true, where phrase r
+  // backtracks over a recorded q and a recorded p before reusing both
+
+#define INPUT_FILE "memo.input"
+#define INPUT_TEXT "abqz"
+
+static int check_links(memo_token *t, int depth);
+static int check_token(memo_token *t, memo_token_type type,
+                       long offset, long length);
+
+int main(void)
+{
+  memo_token *t, *c;
+  FILE *f;
+  int failures = 0;
+
+  if (!(f = fopen(INPUT_FILE, "wb")))
+    return 1;
+  fputs(INPUT_TEXT, f);
+  fclose(f);
+
+  if (!memo_input_initialize(INPUT_FILE))
+  {
+    remove(INPUT_FILE);
+    return 1;
+  }
+
+  t = r();
+  printf("r() on '%s' = %s\n", INPUT_TEXT, (t) ? "token" : "NULL");
+
+  if (t)
+  {
+    failures += !check_links(t, 0);
+
+      // r = q + 'z', q = p + s, p = 'a' + 'b', s = 'q'
+
+    failures += !check_token(t, memo_token_type_r, 0, 4);
+    c = memo_token_get_descendant(t);
+    failures += !check_token(c, memo_token_type_q, 0, 3);
+    c = (c) ? memo_token_get_descendant(c) : NULL;
+    failures += !check_token(c, memo_token_type_p, 0, 2);
+    c = (c) ? memo_token_get_next(c) : NULL;
+    failures += !check_token(c, memo_token_type_s, 2, 1);
+
+    memo_token_free(t);
+  }
+  else
+    ++failures;
+
+  input_cleanup();
+  remove(INPUT_FILE);
+
+  printf("%d failure(s)\n", failures);
+
+  return (failures) ? 1 : 0;
+}
+
+static int check_links(memo_token *t, int depth)
+{
+  memo_token *c, *p;
+  long end;
+  int ok = 1;
+
+  printf("%*s%d@%ld+%ld\n", depth * 2, "", memo_token_get_type(t),
+         memo_token_get_offset(t), memo_token_get_length(t));
+
+  end = memo_token_get_offset(t);
+  for (p = NULL, c = memo_token_get_descendant(t); c;
+       p = c, c = memo_token_get_next(c))
+  {
+    if ((memo_token_get_ascendant(c) != t) ||
+        (memo_token_get_previous(c) != p) ||
+        (memo_token_get_offset(c) < end))
+    {
+      printf("%*sbad links at %d@%ld\n", depth * 2 + 2, "",
+             memo_token_get_type(c), memo_token_get_offset(c));
+      ok = 0;
+    }
+    end = memo_token_get_offset(c) + memo_token_get_length(c);
+    ok = check_links(c, depth + 1) && ok;
+  }
+
+  if (end > memo_token_get_offset(t) + memo_token_get_length(t))
+    ok = 0;
+
+  return ok;
+}
+
+static int check_token(memo_token *t, memo_token_type type,
+                       long offset, long length)
+{
+  int same;
+
+  same = (t && (memo_token_get_type(t) == type) &&
+          (memo_token_get_offset(t) == offset) &&
+          (memo_token_get_length(t) == length));
+  printf("check_token(%d, %ld, %ld) = %d\n", type, offset, length, same);
+
+  return same;
+}
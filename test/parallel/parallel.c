@@ -0,0 +1,161 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nest-token.h"
+#include "nest-parser.h"
+
+  // Parser generated from nest.egg with --use-parallel=true, where a list
+  // element may run over many lines, so that newline split points fall both
+  // at and within top level elements
+
+#define INPUT_SIZE (256L * 1024L)
+
+static long make_input(unsigned char *buffer, long size, int kind);
+static long put_list(unsigned char *buffer, long at, int depth, int lines);
+static int same_tree(nest_token *a, nest_token *b);
+
+static char *kinds[] =
+  {
+    "one word per line",
+    "lists over several lines",
+    "mixed, with a list over many chunks",
+    "mixed, cut short in an open list"
+  };
+
+static int threads[] = { 1, 2, 3, 4, 8, 0 };
+
+int main(void)
+{
+  unsigned char *buffer;
+  nest_context *ctx;
+  nest_token *s, *p;
+  nest_phrase_function terminator;
+  long length;
+  int failures = 0;
+  int kind, i, j;
+  int r;
+
+  if (!(buffer = malloc(INPUT_SIZE)))
+    return 1;
+
+  for (kind = 0; kind < (int) (sizeof(kinds) / sizeof(kinds[0])); kind++)
+  {
+    length = make_input(buffer, INPUT_SIZE, kind);
+
+    if (!(ctx = nest_context_new(buffer, length)))
+    {
+      free(buffer);
+      return 1;
+    }
+    s = program(ctx);
+    nest_context_delete(ctx);
+
+    printf("%s: %ld bytes, sequential parse of %ld\n",
+           kinds[kind], length, (s) ? nest_token_get_length(s) : -1L);
+
+    for (j = 0; j < 2; j++)
+    {
+      terminator = (j) ? lf : NULL;
+
+      for (i = 0; i < (int) (sizeof(threads) / sizeof(threads[0])); i++)
+      {
+        if (!(ctx = nest_context_new(buffer, length)))
+        {
+          free(buffer);
+          return 1;
+        }
+        p = nest_parse_parallel(ctx, nest_token_type_program, element,
+                                terminator, threads[i]);
+        nest_context_delete(ctx);
+
+        r = same_tree(s, p);
+        printf("  nest_parse_parallel(%s, %d) = %s, same_tree = %d\n",
+               (terminator) ? "lf" : "NULL", threads[i],
+               (p) ? "token" : "NULL", r);
+        failures += (r != 1);
+      }
+    }
+
+    nest_token_arena_release();
+  }
+
+  free(buffer);
+
+  printf("%d failure(s)\n", failures);
+
+  return (failures) ? 1 : 0;
+}
+
+static long make_input(unsigned char *buffer, long size, int kind)
+{
+  long at = 0;
+  int n = 0;
+
+  while (at < size - 4096)
+  {
+    switch (kind)
+    {
+      case 0:
+        at += sprintf((char *) buffer + at, "%.*s\n", 1 + n % 6, "abcdef");
+        break;
+      case 1:
+        at = put_list(buffer, at, 2 + n % 3, 1 + n % 7);
+        buffer[at++] = '\n';
+        break;
+      default:
+        if (n == 8)
+        {
+          at = put_list(buffer, at, 3, (int) (size / 32));
+          buffer[at++] = '\n';
+        }
+        else if (n % 3)
+          at += sprintf((char *) buffer + at, "%.*s %.*s\n%s",
+                        1 + n % 6, "abcdef", 1 + n % 4, "fedcba",
+                        (n % 5 == 1) ? "\n\n" : "");
+        else
+        {
+          at = put_list(buffer, at, 1 + n % 4, n % 5);
+          buffer[at++] = (n % 2) ? '\n' : ' ';
+        }
+        break;
+    }
+    ++n;
+  }
+
+  if (kind == 3)
+  {
+    at -= 3000;
+    at += sprintf((char *) buffer + at, "ab\n(cd\nef\n(");
+  }
+
+  return at;
+}
+
+static long put_list(unsigned char *buffer, long at, int depth, int lines)
+{
+  int i;
+
+  buffer[at++] = '(';
+  for (i = 0; i < lines; i++)
+  {
+    at += sprintf((char *) buffer + at, "%.*s\n", 1 + i % 6, "abcdef");
+    if (depth > 1 && i == lines / 2)
+      at = put_list(buffer, at, depth - 1, lines / 2);
+  }
+  buffer[at++] = ')';
+
+  return at;
+}
+
+static int same_tree(nest_token *a, nest_token *b)
+{
+  for (; a && b; a = nest_token_get_next(a), b = nest_token_get_next(b))
+    if ((nest_token_get_type(a) != nest_token_get_type(b)) ||
+        (nest_token_get_offset(a) != nest_token_get_offset(b)) ||
+        (nest_token_get_length(a) != nest_token_get_length(b)) ||
+        !same_tree(nest_token_get_descendant(a), nest_token_get_descendant(b)))
+      return 0;
+
+  return (a == b);
+}
@@ -0,0 +1,227 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "input.h"
+#include "egg-token.h"
+#include "egg-token-tree.h"
+#include "egg-parser.h"
+
+#define SNAPSHOT_FILE "snapshot.tree"
+#define TRUNCATED_FILE "snapshot-truncated.tree"
+#define CHANGED_INPUT_FILE "snapshot-changed.egg"
+
+static int same_tree(egg_token_tree *a, egg_token_tree *b);
+static int same_text(egg_token_tree *a, egg_token_tree *b);
+static int copy_file(char *from, char *to, long length, long flip);
+
+int main(int argc, char **argv)
+{
+  egg_token *t;
+  egg_token_tree *tree, *loaded;
+  FILE *f;
+  long size;
+  int failures = 0;
+  int r;
+
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: snapshot <egg-file>\n");
+    return 1;
+  }
+
+  if (!egg_input_initialize(argv[1]))
+    return 1;
+
+  if (!(t = grammar()) || !(tree = egg_token_tree_new(t)))
+  {
+    fprintf(stderr, "%s: parse failed\n", argv[1]);
+    input_cleanup();
+    return 1;
+  }
+
+    // Save and load without the input text, and compare the trees
+
+  r = egg_token_tree_save(tree, SNAPSHOT_FILE, 0);
+  printf("egg_token_tree_save(tree, '%s', 0) = %d\n", SNAPSHOT_FILE, r);
+  failures += (r != 1);
+
+  loaded = egg_token_tree_load(SNAPSHOT_FILE);
+  printf("egg_token_tree_load('%s') = %s\n",
+         SNAPSHOT_FILE, (loaded) ? "tree" : "NULL");
+  if (loaded)
+  {
+    r = same_tree(tree, loaded);
+    printf("same_tree(tree, loaded) = %d\n", r);
+    failures += (r != 1);
+
+    r = egg_token_tree_match_input(loaded);
+    printf("egg_token_tree_match_input(loaded) = %d\n", r);
+    failures += (r != 1);
+
+    r = same_text(tree, loaded);
+    printf("same_text(tree, loaded) = %d\n", r);
+    failures += (r != 1);
+
+    egg_token_tree_free(loaded);
+  }
+  else
+    ++failures;
+
+    // Save and load with the input text embedded
+
+  r = egg_token_tree_save(tree, SNAPSHOT_FILE, 1);
+  printf("egg_token_tree_save(tree, '%s', 1) = %d\n", SNAPSHOT_FILE, r);
+  failures += (r != 1);
+
+  loaded = egg_token_tree_load(SNAPSHOT_FILE);
+  printf("egg_token_tree_load('%s') = %s\n",
+         SNAPSHOT_FILE, (loaded) ? "tree" : "NULL");
+  if (loaded)
+  {
+    r = same_tree(tree, loaded) && same_text(tree, loaded);
+    printf("same_tree(tree, loaded) && same_text(tree, loaded) = %d\n", r);
+    failures += (r != 1);
+
+    egg_token_tree_free(loaded);
+  }
+  else
+    ++failures;
+
+    // Refuse a snapshot cut short, after its header and halfway through
+
+  f = fopen(SNAPSHOT_FILE, "rb");
+  fseek(f, 0, SEEK_END);
+  size = ftell(f);
+  fclose(f);
+
+  if (copy_file(SNAPSHOT_FILE, TRUNCATED_FILE,
+                sizeof(egg_token_tree_snapshot_header), -1))
+  {
+    loaded = egg_token_tree_load(TRUNCATED_FILE);
+    printf("egg_token_tree_load('%s') after header = %s\n",
+           TRUNCATED_FILE, (loaded) ? "tree" : "NULL");
+    failures += (loaded != NULL);
+    egg_token_tree_free(loaded);
+  }
+  else
+    ++failures;
+
+  if (copy_file(SNAPSHOT_FILE, TRUNCATED_FILE, size / 2, -1))
+  {
+    loaded = egg_token_tree_load(TRUNCATED_FILE);
+    printf("egg_token_tree_load('%s') at half = %s\n",
+           TRUNCATED_FILE, (loaded) ? "tree" : "NULL");
+    failures += (loaded != NULL);
+    egg_token_tree_free(loaded);
+  }
+  else
+    ++failures;
+
+  remove(TRUNCATED_FILE);
+
+    // Refuse a snapshot without input text against a changed input
+
+  r = egg_token_tree_save(tree, SNAPSHOT_FILE, 0);
+  failures += (r != 1);
+
+  input_cleanup();
+
+  f = fopen(argv[1], "rb");
+  fseek(f, 0, SEEK_END);
+  size = ftell(f);
+  fclose(f);
+
+  if (copy_file(argv[1], CHANGED_INPUT_FILE, size, size / 2) &&
+      egg_input_initialize(CHANGED_INPUT_FILE))
+  {
+    loaded = egg_token_tree_load(SNAPSHOT_FILE);
+    r = (loaded) ? egg_token_tree_match_input(loaded) : -1;
+    printf("egg_token_tree_match_input(loaded) on '%s' = %d\n",
+           CHANGED_INPUT_FILE, r);
+    failures += (r != 0);
+    egg_token_tree_free(loaded);
+    input_cleanup();
+  }
+  else
+    ++failures;
+
+  remove(CHANGED_INPUT_FILE);
+  remove(SNAPSHOT_FILE);
+
+  egg_token_tree_free(tree);
+
+  printf("%d failure(s)\n", failures);
+
+  return (failures) ? 1 : 0;
+}
+
+static int same_tree(egg_token_tree *a, egg_token_tree *b)
+{
+  egg_token_index i;
+
+  if (egg_token_tree_get_count(a) != egg_token_tree_get_count(b))
+    return 0;
+
+  for (i = 0; i < egg_token_tree_get_count(a); i++)
+    if ((egg_token_tree_get_type(a, i) != egg_token_tree_get_type(b, i)) ||
+        (egg_token_tree_get_ascendant(a, i) !=
+         egg_token_tree_get_ascendant(b, i)) ||
+        (egg_token_tree_get_descendant(a, i) !=
+         egg_token_tree_get_descendant(b, i)) ||
+        (egg_token_tree_get_next(a, i) != egg_token_tree_get_next(b, i)) ||
+        (egg_token_tree_get_offset(a, i) != egg_token_tree_get_offset(b, i)) ||
+        (egg_token_tree_get_length(a, i) != egg_token_tree_get_length(b, i)))
+      return 0;
+
+  return 1;
+}
+
+static int same_text(egg_token_tree *a, egg_token_tree *b)
+{
+  egg_token_index i;
+  input_location la, lb;
+  char *sa, *sb;
+  int same = 1;
+
+  for (i = 0; same && (i < egg_token_tree_get_count(a)); i++)
+  {
+    sa = egg_token_tree_span_to_string(a, i, NULL);
+    sb = egg_token_tree_span_to_string(b, i, NULL);
+    same = (sa && sb && !strcmp(sa, sb));
+    free(sa);
+    free(sb);
+
+    egg_token_tree_get_location(a, i, &la);
+    egg_token_tree_get_location(b, i, &lb);
+    if ((la.line_number != lb.line_number) ||
+        (la.character_offset != lb.character_offset))
+      same = 0;
+  }
+
+  return same;
+}
+
+static int copy_file(char *from, char *to, long length, long flip)
+{
+  FILE *in, *out;
+  long i;
+  int c;
+
+  if (!(in = fopen(from, "rb")))
+    return 0;
+
+  if (!(out = fopen(to, "wb")))
+  {
+    fclose(in);
+    return 0;
+  }
+
+  for (i = 0; (i < length) && ((c = fgetc(in)) != EOF); i++)
+    fputc((i == flip) ? c ^ 0x20 : c, out);
+
+  fclose(in);
+  fclose(out);
+
+  return 1;
+}